@@ -31,6 +31,7 @@
 #include <boost/math/special_functions/beta.hpp> // for beta.
 #include <boost/math/distributions/complement.hpp> // complements.
 #include <boost/math/distributions/detail/common_error_handling.hpp> // error checks
+#include <boost/math/distributions/detail/log_incomplete.hpp> // logpdf and logcdf.
 #include <boost/math/special_functions/fpclassify.hpp> // isnan.
 #include <boost/math/tools/roots.hpp> // for root finding.
 #include <boost/math/policies/error_handling.hpp>
@@ -428,6 +429,69 @@ namespace boost
       return static_cast<RealType>(ibeta_derivative(a, b, x, Policy()));
     } // pdf
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED inline RealType logpdf(const beta_distribution<RealType, Policy>& dist, const RealType& x)
+    { // Log of the Probability Density/Mass Function.
+      BOOST_FPU_EXCEPTION_GUARD
+
+      constexpr auto function = "boost::math::logpdf(beta_distribution<%1%> const&, %1%)";
+
+      BOOST_MATH_STD_USING // for ADL of std functions
+
+      RealType a = dist.alpha();
+      RealType b = dist.beta();
+
+      // Argument checks:
+      RealType result = 0;
+      if(false == beta_detail::check_dist_and_x(
+        function,
+        a, b, x,
+        &result, Policy()))
+      {
+        return result;
+      }
+
+      // Corner cases as for the pdf:
+      if(x == 0)
+      {
+        if (a == 1)
+        {
+          return -detail::log_beta(a, b, Policy());
+        }
+        else if (a < 1)
+        {
+          return policies::raise_overflow_error<RealType>(function, nullptr, Policy());
+        }
+        else
+        {
+          return -boost::math::numeric_limits<RealType>::infinity();
+        }
+      }
+      else if (x == 1)
+      {
+        if (b == 1)
+        {
+          return -detail::log_beta(a, b, Policy());
+        }
+        else if (b < 1)
+        {
+          return policies::raise_overflow_error<RealType>(function, nullptr, Policy());
+        }
+        else
+        {
+          return -boost::math::numeric_limits<RealType>::infinity();
+        }
+      }
+
+      // The pdf is accurate wherever it has not underflowed, beyond that work in logs:
+      result = ibeta_derivative(a, b, x, Policy());
+      if((result > detail::log_space_threshold<RealType>()) && (result < tools::max_value<RealType>()))
+      {
+        return log(result);
+      }
+      return (a - 1) * log(x) + (b - 1) * boost::math::log1p(-x, Policy()) - detail::log_beta(a, b, Policy());
+    } // logpdf
+
     template <class RealType, class Policy>
     BOOST_MATH_GPU_ENABLED inline RealType cdf(const beta_distribution<RealType, Policy>& dist, const RealType& x)
     { // Cumulative Distribution Function beta.
@@ -459,6 +523,37 @@ namespace boost
       return static_cast<RealType>(ibeta(a, b, x, Policy()));
     } // beta cdf
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED inline RealType logcdf(const beta_distribution<RealType, Policy>& dist, const RealType& x)
+    { // Log of the Cumulative Distribution Function beta.
+      BOOST_MATH_STD_USING // for ADL of std functions
+
+      constexpr auto function = "boost::math::logcdf(beta_distribution<%1%> const&, %1%)";
+
+      RealType a = dist.alpha();
+      RealType b = dist.beta();
+
+      // Argument checks:
+      RealType result = 0;
+      if(false == beta_detail::check_dist_and_x(
+        function,
+        a, b, x,
+        &result, Policy()))
+      {
+        return result;
+      }
+      // Special cases:
+      if (x == 0)
+      {
+        return -boost::math::numeric_limits<RealType>::infinity();
+      }
+      else if (x == 1)
+      {
+        return 0;
+      }
+      return detail::log_ibeta(a, b, x, RealType(1 - x), false, Policy());
+    } // beta logcdf
+
     template <class RealType, class Policy>
     BOOST_MATH_GPU_ENABLED inline RealType cdf(const complemented2_type<beta_distribution<RealType, Policy>, RealType>& c)
     { // Complemented Cumulative Distribution Function beta.
@@ -495,6 +590,39 @@ namespace boost
       return static_cast<RealType>(ibetac(a, b, x, Policy()));
     } // beta cdf
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED inline RealType logcdf(const complemented2_type<beta_distribution<RealType, Policy>, RealType>& c)
+    { // Log of the Complemented Cumulative Distribution Function beta.
+
+      BOOST_MATH_STD_USING // for ADL of std functions
+
+      constexpr auto function = "boost::math::logcdf(beta_distribution<%1%> const&, %1%)";
+
+      RealType const& x = c.param;
+      beta_distribution<RealType, Policy> const& dist = c.dist;
+      RealType a = dist.alpha();
+      RealType b = dist.beta();
+
+      // Argument checks:
+      RealType result = 0;
+      if(false == beta_detail::check_dist_and_x(
+        function,
+        a, b, x,
+        &result, Policy()))
+      {
+        return result;
+      }
+      if (x == 0)
+      {
+        return 0;
+      }
+      else if (x == 1)
+      {
+        return -boost::math::numeric_limits<RealType>::infinity();
+      }
+      return detail::log_ibeta(a, b, x, RealType(1 - x), true, Policy());
+    } // beta logcdf complement
+
     template <class RealType, class Policy>
     BOOST_MATH_GPU_ENABLED inline RealType quantile(const beta_distribution<RealType, Policy>& dist, const RealType& p)
     { // Quantile or Percent Point beta function or
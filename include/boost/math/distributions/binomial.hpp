@@ -86,6 +86,7 @@
 #include <boost/math/distributions/complement.hpp> // complements
 #include <boost/math/distributions/detail/common_error_handling.hpp> // error checks
 #include <boost/math/distributions/detail/inv_discrete_quantile.hpp> // error checks
+#include <boost/math/distributions/detail/log_incomplete.hpp> // logpdf and logcdf.
 #include <boost/math/special_functions/fpclassify.hpp> // isnan.
 #include <boost/math/tools/roots.hpp> // for root finding.
 
@@ -502,6 +503,63 @@ namespace boost
 
       } // pdf
 
+      template <class RealType, class Policy>
+      BOOST_MATH_CUDA_ENABLED RealType logpdf(const binomial_distribution<RealType, Policy>& dist, const RealType& k)
+      { // Log of the Probability Density/Mass Function.
+        BOOST_FPU_EXCEPTION_GUARD
+
+        BOOST_MATH_STD_USING // for ADL of std functions
+
+        RealType n = dist.trials();
+        RealType p = dist.success_fraction();
+
+        // Error check:
+        RealType result = 0; // initialization silences some compiler warnings
+        if(false == binomial_detail::check_dist_and_k(
+           "boost::math::logpdf(binomial_distribution<%1%> const&, %1%)",
+           n,
+           p,
+           k,
+           &result, Policy()))
+        {
+           return result;
+        }
+
+        // Special cases as for the pdf:
+        if (p == 0)
+        {
+           return k == 0 ? RealType(0) : -boost::math::numeric_limits<RealType>::infinity();
+        }
+        if (p == 1)
+        {
+           return k == n ? RealType(0) : -boost::math::numeric_limits<RealType>::infinity();
+        }
+        if (n == 0)
+        {
+          return 0;
+        }
+        if (k == n)
+        {
+          return k * log(p);
+        }
+        if (k == 0)
+        {
+          return n * boost::math::log1p(-p, Policy());
+        }
+
+        // The pdf is accurate wherever it has not underflowed, beyond that work in logs:
+        //
+        // log(f(k; n,p)) = k log(p) + (n-k) log(1-p) - log(beta(k+1, n-k+1)) - log(n+1)
+        //
+        result = ibeta_derivative(k+1, n-k+1, p, Policy()) / (n+1);
+        if (result > detail::log_space_threshold<RealType>())
+        {
+          return log(result);
+        }
+        return k * log(p) + (n - k) * boost::math::log1p(-p, Policy())
+           - detail::log_beta(RealType(k + 1), RealType(n - k + 1), Policy()) - log(n + 1);
+      } // logpdf
+
       template <class RealType, class Policy>
       BOOST_MATH_CUDA_ENABLED inline RealType cdf(const binomial_distribution<RealType, Policy>& dist, const RealType& k)
       { // Cumulative Distribution Function Binomial.
@@ -574,6 +632,38 @@ namespace boost
         return ibetac(k + 1, n - k, p, Policy());
       } // binomial cdf
 
+      template <class RealType, class Policy>
+      BOOST_MATH_CUDA_ENABLED inline RealType logcdf(const binomial_distribution<RealType, Policy>& dist, const RealType& k)
+      { // Log of the Cumulative Distribution Function Binomial.
+        BOOST_MATH_STD_USING // for ADL of std functions
+
+        RealType n = dist.trials();
+        RealType p = dist.success_fraction();
+
+        // Error check:
+        RealType result = 0;
+        if(false == binomial_detail::check_dist_and_k(
+           "boost::math::logcdf(binomial_distribution<%1%> const&, %1%)",
+           n,
+           p,
+           k,
+           &result, Policy()))
+        {
+           return result;
+        }
+        // Special cases as for the cdf:
+        if ((k == n) || (p == 0))
+        {
+          return 0;
+        }
+        if (p == 1)
+        {
+          return -boost::math::numeric_limits<RealType>::infinity();
+        }
+        // P = I[1-p](n - k, k + 1) = 1 - I[p](k + 1, n - k)
+        return detail::log_ibeta(RealType(k + 1), RealType(n - k), p, RealType(1 - p), true, Policy());
+      } // binomial logcdf
+
       template <class RealType, class Policy>
       BOOST_MATH_CUDA_ENABLED inline RealType cdf(const complemented2_type<binomial_distribution<RealType, Policy>, RealType>& c)
       { // Complemented Cumulative Distribution Function Binomial.
@@ -651,6 +741,40 @@ namespace boost
         return ibeta(k + 1, n - k, p, Policy());
       } // binomial cdf
 
+      template <class RealType, class Policy>
+      BOOST_MATH_CUDA_ENABLED inline RealType logcdf(const complemented2_type<binomial_distribution<RealType, Policy>, RealType>& c)
+      { // Log of the Complemented Cumulative Distribution Function Binomial.
+        BOOST_MATH_STD_USING // for ADL of std functions
+
+        RealType const& k = c.param;
+        binomial_distribution<RealType, Policy> const& dist = c.dist;
+        RealType n = dist.trials();
+        RealType p = dist.success_fraction();
+
+        // Error checks:
+        RealType result = 0;
+        if(false == binomial_detail::check_dist_and_k(
+           "boost::math::logcdf(binomial_distribution<%1%> const&, %1%)",
+           n,
+           p,
+           k,
+           &result, Policy()))
+        {
+           return result;
+        }
+        // Special cases as for the cdf complement:
+        if ((k == n) || (p == 0))
+        {
+          return -boost::math::numeric_limits<RealType>::infinity();
+        }
+        if (p == 1)
+        {
+          return 0;
+        }
+        // Q = I[p](k + 1, n - k)
+        return detail::log_ibeta(RealType(k + 1), RealType(n - k), p, RealType(1 - p), false, Policy());
+      } // binomial logcdf complement
+
       template <class RealType, class Policy>
       BOOST_MATH_CUDA_ENABLED inline RealType quantile(const binomial_distribution<RealType, Policy>& dist, const RealType& p)
       {
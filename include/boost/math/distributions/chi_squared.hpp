@@ -18,6 +18,7 @@
 #include <boost/math/special_functions/gamma.hpp> // for incomplete beta.
 #include <boost/math/distributions/complement.hpp> // complements
 #include <boost/math/distributions/detail/common_error_handling.hpp> // error checks
+#include <boost/math/distributions/detail/log_incomplete.hpp> // logcdf
 #include <boost/math/special_functions/fpclassify.hpp>
 
 namespace boost{ namespace math{
@@ -134,6 +135,53 @@ BOOST_MATH_GPU_ENABLED RealType pdf(const chi_squared_distribution<RealType, Pol
    return gamma_p_derivative(degrees_of_freedom / 2, chi_square / 2, Policy()) / 2;
 } // pdf
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED RealType logpdf(const chi_squared_distribution<RealType, Policy>& dist, const RealType& chi_square)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+   using boost::math::lgamma;
+   RealType degrees_of_freedom = dist.degrees_of_freedom();
+   // Error check:
+   RealType error_result;
+
+   constexpr auto function = "boost::math::logpdf(const chi_squared_distribution<%1%>&, %1%)";
+
+   if(false == detail::check_df(
+         function, degrees_of_freedom, &error_result, Policy()))
+      return error_result;
+
+   if((chi_square < 0) || !(boost::math::isfinite)(chi_square))
+   {
+      return policies::raise_domain_error<RealType>(
+         function, "Chi Square parameter was %1%, but must be > 0 !", chi_square, Policy());
+   }
+
+   if(chi_square == 0)
+   {
+      // Handle special cases:
+      if(degrees_of_freedom < 2)
+      {
+         return policies::raise_overflow_error<RealType>(
+            function, 0, Policy());
+      }
+      else if(degrees_of_freedom == 2)
+      {
+         return -constants::ln_two<RealType>();
+      }
+      else
+      {
+         return -boost::math::numeric_limits<RealType>::infinity();
+      }
+   }
+
+   // The pdf is accurate wherever it has not underflowed, beyond that work in logs:
+   RealType result = gamma_p_derivative(degrees_of_freedom / 2, chi_square / 2, Policy()) / 2;
+   if(result > detail::log_space_threshold<RealType>())
+      return log(result);
+   RealType k = degrees_of_freedom / 2;
+   return (k - 1) * log(chi_square / 2) - chi_square / 2 - lgamma(k, Policy()) - constants::ln_two<RealType>();
+} // logpdf
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType cdf(const chi_squared_distribution<RealType, Policy>& dist, const RealType& chi_square)
 {
@@ -155,6 +203,27 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const chi_squared_distribution<RealTy
    return boost::math::gamma_p(degrees_of_freedom / 2, chi_square / 2, Policy());
 } // cdf
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const chi_squared_distribution<RealType, Policy>& dist, const RealType& chi_square)
+{
+   RealType degrees_of_freedom = dist.degrees_of_freedom();
+   // Error check:
+   RealType error_result;
+   constexpr auto function = "boost::math::logcdf(const chi_squared_distribution<%1%>&, %1%)";
+
+   if(false == detail::check_df(
+         function, degrees_of_freedom, &error_result, Policy()))
+      return error_result;
+
+   if((chi_square < 0) || !(boost::math::isfinite)(chi_square))
+   {
+      return policies::raise_domain_error<RealType>(
+         function, "Chi Square parameter was %1%, but must be > 0 !", chi_square, Policy());
+   }
+
+   return detail::log_gamma_incomplete(RealType(degrees_of_freedom / 2), RealType(chi_square / 2), false, Policy());
+} // logcdf
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const chi_squared_distribution<RealType, Policy>& dist, const RealType& p)
 {
@@ -193,6 +262,27 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const complemented2_type<chi_squared_
    return boost::math::gamma_q(degrees_of_freedom / 2, chi_square / 2, Policy());
 }
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const complemented2_type<chi_squared_distribution<RealType, Policy>, RealType>& c)
+{
+   RealType const& degrees_of_freedom = c.dist.degrees_of_freedom();
+   RealType const& chi_square = c.param;
+   constexpr auto function = "boost::math::logcdf(const chi_squared_distribution<%1%>&, %1%)";
+   // Error check:
+   RealType error_result;
+   if(false == detail::check_df(
+         function, degrees_of_freedom, &error_result, Policy()))
+      return error_result;
+
+   if((chi_square < 0) || !(boost::math::isfinite)(chi_square))
+   {
+      return policies::raise_domain_error<RealType>(
+         function, "Chi Square parameter was %1%, but must be > 0 !", chi_square, Policy());
+   }
+
+   return detail::log_gamma_incomplete(RealType(degrees_of_freedom / 2), RealType(chi_square / 2), true, Policy());
+}
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const complemented2_type<chi_squared_distribution<RealType, Policy>, RealType>& c)
 {
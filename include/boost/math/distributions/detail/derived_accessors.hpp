@@ -30,6 +30,7 @@
 
 #include <boost/math/tools/config.hpp>
 #include <boost/math/tools/assert.hpp>
+#include <boost/math/tools/type_traits.hpp>
 
 #ifndef BOOST_MATH_HAS_NVRTC
 #include <cmath>
@@ -43,6 +44,47 @@
 
 namespace boost{ namespace math{
 
+namespace detail{
+//
+// The logpdf and logcdf overloads below forward mixed argument types to the distribution's
+// own log-space functions where it has them; once the argument already has the
+// distribution's value_type there is nothing more specific, and the log is taken directly:
+//
+template <class Distribution>
+BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logpdf_imp(const Distribution& dist, const typename Distribution::value_type& x, const boost::math::true_type&)
+{
+   using std::log;
+   return log(pdf(dist, x));
+}
+template <class Distribution>
+BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logpdf_imp(const Distribution& dist, const typename Distribution::value_type& x, const boost::math::false_type&)
+{
+   return logpdf(dist, x);
+}
+template <class Distribution>
+BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logcdf_imp(const Distribution& dist, const typename Distribution::value_type& x, const boost::math::true_type&)
+{
+   using std::log;
+   return log(cdf(dist, x));
+}
+template <class Distribution>
+BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logcdf_imp(const Distribution& dist, const typename Distribution::value_type& x, const boost::math::false_type&)
+{
+   return logcdf(dist, x);
+}
+template <class Distribution>
+BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logccdf_imp(const Distribution& dist, const typename Distribution::value_type& x, const boost::math::true_type&)
+{
+   using std::log;
+   return log(cdf(complement(dist, x)));
+}
+template <class Distribution>
+BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logccdf_imp(const Distribution& dist, const typename Distribution::value_type& x, const boost::math::false_type&)
+{
+   return logcdf(complement(dist, x));
+}
+} // namespace detail
+
 template <class Distribution>
 BOOST_MATH_GPU_ENABLED typename Distribution::value_type variance(const Distribution& dist);
 
@@ -117,9 +159,8 @@ BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type pdf(const Distri
 template <class Distribution, class RealType>
 BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logpdf(const Distribution& dist, const RealType& x)
 {
-   using std::log;
    typedef typename Distribution::value_type value_type;
-   return log(pdf(dist, static_cast<value_type>(x)));
+   return detail::logpdf_imp(dist, static_cast<value_type>(x), boost::math::is_same<RealType, value_type>());
 }
 template <class Distribution, class RealType>
 BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type cdf(const Distribution& dist, const RealType& x)
@@ -130,9 +171,8 @@ BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type cdf(const Distri
 template <class Distribution, class Realtype>
 BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logcdf(const Distribution& dist, const Realtype& x)
 {
-   using std::log;
    using value_type = typename Distribution::value_type;
-   return log(cdf(dist, static_cast<value_type>(x)));
+   return detail::logcdf_imp(dist, static_cast<value_type>(x), boost::math::is_same<Realtype, value_type>());
 }
 template <class Distribution, class RealType>
 BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type quantile(const Distribution& dist, const RealType& x)
@@ -158,9 +198,8 @@ BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type cdf(const comple
 template <class Distribution, class RealType>
 BOOST_MATH_GPU_ENABLED inline typename Distribution::value_type logcdf(const complemented2_type<Distribution, RealType>& c)
 {
-   using std::log;
    typedef typename Distribution::value_type value_type;
-   return log(cdf(complement(c.dist, static_cast<value_type>(c.param))));
+   return detail::logccdf_imp(c.dist, static_cast<value_type>(c.param), boost::math::is_same<RealType, value_type>());
 }
 
 template <class Distribution, class RealType>
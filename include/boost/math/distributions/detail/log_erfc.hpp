@@ -0,0 +1,66 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_DETAIL_LOG_ERFC_HPP
+#define BOOST_MATH_DISTRIBUTIONS_DETAIL_LOG_ERFC_HPP
+
+//
+// The logarithm of erfc for the logcdf overloads of the normal family, kept apart from
+// log_incomplete.hpp so that those distributions need not include the incomplete gamma
+// and beta functions.
+//
+
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/numeric_limits.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+
+namespace boost{ namespace math{ namespace detail{
+
+// Below this the regular functions start to lose digits as their results become denormal:
+template <class T>
+BOOST_MATH_GPU_ENABLED inline T log_space_threshold()
+{
+   return tools::min_value<T>() / tools::epsilon<T>();
+}
+
+//
+// log(erfc(z)): for large z erfc(z) = exp(-z^2) / (z sqrt(pi)) * S where
+// S = sum (-1)^n (2n-1)!! / (2z^2)^n is asymptotic, but by the time erfc
+// has underflowed z^2 > -log(min_value) and the smallest term is far below epsilon.
+//
+template <class T, class Policy>
+BOOST_MATH_GPU_ENABLED T log_erfc(T z, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   T result = boost::math::erfc(z, pol);
+   if(result > log_space_threshold<T>())
+   {
+      return log(result);
+   }
+   if((boost::math::isinf)(z))
+   {
+      return -boost::math::numeric_limits<T>::infinity();
+   }
+   const T z2 = z * z;
+   const T eps = policies::get_epsilon<T, Policy>();
+   T sum = 1;
+   T term = 1;
+   for(unsigned n = 1; n < 100; ++n)
+   {
+      term *= -static_cast<T>(2 * n - 1) / (2 * z2);
+      sum += term;
+      if(fabs(term) < eps * sum)
+         break;
+   }
+   return -z2 - log(z) - log(constants::root_pi<T>()) + log(sum);
+}
+
+}}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_DETAIL_LOG_ERFC_HPP
@@ -0,0 +1,120 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_DETAIL_LOG_INCOMPLETE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_DETAIL_LOG_INCOMPLETE_HPP
+
+//
+// Logarithms of the regularized incomplete gamma and beta functions,
+// for the logcdf overloads of the distributions.  The regular functions are used
+// wherever their result is comfortably above the underflow threshold; below it the
+// logarithm is assembled from the log of the power terms prefix and the same
+// series or continued fraction that the regular functions use, so that the result
+// stays finite and accurate arbitrarily far into the tails.
+//
+
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/numeric_limits.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/fraction.hpp>
+#include <boost/math/distributions/detail/log_erfc.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+
+namespace boost{ namespace math{ namespace detail{
+
+template <class T, class Policy>
+BOOST_MATH_GPU_ENABLED T log_beta(T a, T b, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   using boost::math::lgamma;
+   T result = boost::math::beta(a, b, pol);
+   if((result > log_space_threshold<T>()) && (result < tools::max_value<T>()))
+   {
+      return log(result);
+   }
+   return lgamma(a, pol) + lgamma(b, pol) - lgamma(T(a + b), pol);
+}
+
+//
+// log(gamma_p(a, x)), or log(gamma_q(a, x)) when invert is true.  A tiny P implies x < a,
+// where the lower series applies; a tiny Q implies x > a, where the continued fraction does.
+//
+template <class T, class Policy>
+BOOST_MATH_GPU_ENABLED T log_gamma_incomplete(T a, T x, bool invert, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   using boost::math::lgamma;
+   T result = invert ? boost::math::gamma_q(a, x, pol) : boost::math::gamma_p(a, x, pol);
+   if(result > log_space_threshold<T>())
+   {
+      if(result > T(0.5))
+      {
+         return boost::math::log1p(-(invert ? boost::math::gamma_p(a, x, pol) : boost::math::gamma_q(a, x, pol)), pol);
+      }
+      return log(result);
+   }
+   if((x == 0) || (boost::math::isinf)(x))
+   {
+      return -boost::math::numeric_limits<T>::infinity();
+   }
+   result = a * log(x) - x - lgamma(a, pol);
+   if(invert)
+   {
+      result += log(upper_gamma_fraction(a, x, policies::get_epsilon<T, Policy>()));
+   }
+   else
+   {
+      result += log(lower_gamma_series(a, x, pol) / a);
+   }
+   return result;
+}
+
+//
+// log(ibeta(a, b, x)), or log(ibetac(a, b, x)) when invert is true, with y = 1 - x.  A tiny
+// I[x](a,b) implies x lies below the mean a/(a+b), where the continued fraction
+//
+// I[x](a,b) = x^a y^b / (B(a,b) F)
+//
+// converges rapidly; the complement is the same thing with a, b and x, y swapped.
+//
+template <class T, class Policy>
+BOOST_MATH_GPU_ENABLED T log_ibeta(T a, T b, T x, T y, bool invert, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   T result = invert ? boost::math::ibetac(a, b, x, pol) : boost::math::ibeta(a, b, x, pol);
+   if(result > log_space_threshold<T>())
+   {
+      if(result > T(0.5))
+      {
+         return boost::math::log1p(-(invert ? boost::math::ibeta(a, b, x, pol) : boost::math::ibetac(a, b, x, pol)), pol);
+      }
+      return log(result);
+   }
+   if(invert)
+   {
+      BOOST_MATH_GPU_SAFE_SWAP(a, b);
+      BOOST_MATH_GPU_SAFE_SWAP(x, y);
+   }
+   if(x == 0)
+   {
+      return -boost::math::numeric_limits<T>::infinity();
+   }
+   // Whichever of x and y is the smaller is the more accurate:
+   T log_x = x > T(0.5) ? T(boost::math::log1p(-y, pol)) : T(log(x));
+   T log_y = y > T(0.5) ? T(boost::math::log1p(-x, pol)) : T(log(y));
+   result = a * log_x + b * log_y - log_beta(a, b, pol);
+   ibeta_fraction2_t<T> f(a, b, x, y);
+   T fract = boost::math::tools::continued_fraction_b(f, policies::get_epsilon<T, Policy>());
+   return result - log(fract);
+}
+
+}}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_DETAIL_LOG_INCOMPLETE_HPP
@@ -0,0 +1,387 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_DISCRETE_TABLE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_DISCRETE_TABLE_HPP
+
+// References:
+// Alastair J. Walker, An Efficient Method for Generating Discrete Random Variables with General Distributions,
+// ACM Transactions on Mathematical Software 3 (1977), 253-256.
+// Michael D. Vose, A Linear Algorithm for Generating Random Numbers with a Given Distribution,
+// IEEE Transactions on Software Engineering 17 (1991), 972-975.
+// Hui-Chuan Chen and Yoshinori Asau, On Generating Random Variates from an Empirical Distribution,
+// AIIE Transactions 6 (1974), 163-166.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/sampler.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math {
+
+namespace detail {
+
+// The distribution's own functions, found by argument dependent lookup so that this header needs
+// none of their declarations, and called from members that hide the names:
+template <class Distribution>
+inline typename Distribution::value_type discrete_table_pdf(const Distribution& dist, const typename Distribution::value_type& k)
+{
+   return pdf(dist, k);
+}
+
+template <class Distribution>
+inline typename Distribution::value_type discrete_table_cdf(const Distribution& dist, const typename Distribution::value_type& k)
+{
+   return cdf(dist, k);
+}
+
+template <class Distribution>
+inline typename Distribution::value_type discrete_table_ccdf(const Distribution& dist, const typename Distribution::value_type& k)
+{
+   return cdf(complement(dist, k));
+}
+
+template <class Distribution>
+inline typename Distribution::value_type discrete_table_quantile(const Distribution& dist, const typename Distribution::value_type& p)
+{
+   return quantile(dist, p);
+}
+
+template <class Distribution>
+inline typename Distribution::value_type discrete_table_cquantile(const Distribution& dist, const typename Distribution::value_type& q)
+{
+   return quantile(complement(dist, q));
+}
+
+// The smallest k with cdf(complement(dist, k)) < q, the upper tail counterpart of sampler_invert:
+template <class Distribution>
+typename Distribution::value_type discrete_invert_complement(const Distribution& dist, typename Distribution::value_type q)
+{
+   BOOST_MATH_STD_USING
+   typedef typename Distribution::value_type value_type;
+   value_type lowest = static_cast<value_type>(support(dist).first);
+   value_type k = (std::max)(value_type(floor(quantile(complement(dist, q)))), lowest);
+   while (cdf(complement(dist, k)) >= q)
+   {
+      ++k;
+   }
+   while ((k > lowest) && (cdf(complement(dist, value_type(k - 1))) < q))
+   {
+      --k;
+   }
+   return k;
+}
+
+} // namespace detail
+
+// Tabulates the pdf and cdf of a discrete distribution over all but the extreme tails of its support,
+// giving O(1) sampling from a Walker alias table and O(1) quantiles from a Chen-Asau guide table.
+// Anything that falls in the tails is handed back to the distribution itself.
+template <class Distribution>
+class discrete_table
+{
+public:
+   typedef Distribution distribution_type;
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+
+   explicit discrete_table(const Distribution& dist, value_type tail = tools::epsilon<value_type>(), std::size_t max_entries = std::size_t(1) << 24)
+      : m_dist(dist)
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::discrete_table<%1%>::discrete_table";
+      m_lowest = static_cast<value_type>(support(dist).first);
+      m_highest = static_cast<value_type>(support(dist).second);
+      if (!((tail > 0) && (tail < value_type(0.25))))
+      {
+         policies::raise_domain_error<value_type>(function, "The tail probability must be in (0, 0.25), but got %1%.", tail, policy_type());
+         build_empty();
+         return;
+      }
+
+      // The table runs from k0 to k1, with at most tail probability on either side:
+      value_type k0 = (std::max)(value_type(floor(detail::discrete_table_quantile(dist, tail))), m_lowest);
+      while ((k0 > m_lowest) && (detail::discrete_table_cdf(dist, value_type(k0 - 1)) > tail))
+      {
+         --k0;
+      }
+      value_type k1 = (std::min)(value_type(ceil(detail::discrete_table_cquantile(dist, tail))), m_highest);
+      while ((k1 < m_highest) && (detail::discrete_table_ccdf(dist, k1) > tail))
+      {
+         ++k1;
+      }
+      if (k1 - k0 + 1 > static_cast<value_type>(max_entries))
+      {
+         policies::raise_domain_error<value_type>(function, "The effective support needs %1% entries, more than the maximum requested.", value_type(k1 - k0 + 1), policy_type());
+         build_empty();
+         return;
+      }
+      m_k0 = k0;
+      m_k1 = k1;
+      const std::size_t n = static_cast<std::size_t>(k1 - k0) + 1;
+      m_pdf.resize(n);
+      m_cdf.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         value_type k = k0 + static_cast<value_type>(i);
+         m_pdf[i] = detail::discrete_table_pdf(dist, k);
+         m_cdf[i] = detail::discrete_table_cdf(dist, k);
+      }
+      m_lower_tail = k0 > m_lowest ? value_type(detail::discrete_table_cdf(dist, value_type(k0 - 1))) : value_type(0);
+      m_upper_tail = k1 < m_highest ? value_type(detail::discrete_table_ccdf(dist, k1)) : value_type(0);
+
+      build_guide();
+      build_alias();
+   }
+
+   const Distribution& distribution() const
+   {
+      return m_dist;
+   }
+
+   // The tabulated part of the support:
+   std::pair<value_type, value_type> table_range() const
+   {
+      return std::make_pair(m_k0, m_k1);
+   }
+
+   value_type pdf(const value_type& k) const
+   {
+      BOOST_MATH_STD_USING
+      if ((k >= m_k0) && (k <= m_k1) && (floor(k) == k))
+      {
+         return m_pdf[static_cast<std::size_t>(k - m_k0)];
+      }
+      return detail::discrete_table_pdf(m_dist, k);
+   }
+
+   value_type cdf(const value_type& k) const
+   {
+      BOOST_MATH_STD_USING
+      if ((k >= m_k0) && (k <= m_k1) && (floor(k) == k))
+      {
+         return m_cdf[static_cast<std::size_t>(k - m_k0)];
+      }
+      return detail::discrete_table_cdf(m_dist, k);
+   }
+
+   // The quantile, rounded as the distribution's discrete_quantile policy requires; the real and
+   // integer_round_nearest policies depend on the continuous extension of the cdf, so always go
+   // to the distribution.
+   value_type quantile(const value_type& p) const
+   {
+      if (m_cdf.empty())
+      {
+         return detail::discrete_table_quantile(m_dist, p);
+      }
+      return quantile_imp(p, typename policy_type::discrete_quantile_type());
+   }
+
+   template <class URBG>
+   value_type operator()(URBG& gen) const
+   {
+      // The high 53 bits of one draw pick both the entry and the position within it:
+      double x = static_cast<double>(detail::sampler_bits(gen) >> 11)*m_alias_scale;
+      std::size_t i = (std::min)(static_cast<std::size_t>(x), m_prob.size() - 1);
+      std::size_t j = x - static_cast<double>(i) < m_prob[i] ? i : static_cast<std::size_t>(m_alias[i]);
+      if (j < m_pdf.size())
+      {
+         return m_k0 + static_cast<value_type>(j);
+      }
+      return sample_tail(gen);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   // After an error under a policy that doesn't throw: an empty table, whose single alias slot is
+   // the lower tail covering the whole support, so that everything goes to the distribution.
+   void build_empty()
+   {
+      m_k0 = 1;
+      m_k1 = 0;
+      m_lower_tail = 1;
+      m_upper_tail = 0;
+      m_guide_scale = 0;
+      m_alias_scale = 1/9007199254740992.0;
+      m_prob.assign(1, 1);
+      m_alias.assign(1, 0);
+   }
+
+   void build_guide()
+   {
+      // m_guide[j] is the first entry with floor(cdf*g) >= j, so that a search for p may start
+      // at m_guide[floor(p*g)]; rounding in the products is monotone so never overshoots the answer.
+      const std::size_t g = m_cdf.size();
+      m_guide_scale = static_cast<value_type>(g);
+      m_guide.assign(g, static_cast<std::uint32_t>(g - 1));
+      std::size_t i = 0;
+      for (std::size_t j = 0; j < g; ++j)
+      {
+         while ((i < g - 1) && (static_cast<value_type>(m_cdf[i]*m_guide_scale) < static_cast<value_type>(j)))
+         {
+            ++i;
+         }
+         m_guide[j] = static_cast<std::uint32_t>(i);
+      }
+   }
+
+   void build_alias()
+   {
+      // Vose's method, with one extra slot for the tails when they have any probability:
+      const std::size_t n = m_pdf.size();
+      const std::size_t m = (m_lower_tail + m_upper_tail > 0) ? n + 1 : n;
+      std::vector<double> scaled(m);
+      double total = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         scaled[i] = static_cast<double>(m_pdf[i]);
+         total += scaled[i];
+      }
+      if (m > n)
+      {
+         scaled[n] = static_cast<double>(m_lower_tail + m_upper_tail);
+         total += scaled[n];
+      }
+      std::vector<std::uint32_t> small;
+      std::vector<std::uint32_t> large;
+      for (std::size_t i = 0; i < m; ++i)
+      {
+         scaled[i] *= m/total;
+         (scaled[i] < 1 ? small : large).push_back(static_cast<std::uint32_t>(i));
+      }
+      m_prob.assign(m, 1);
+      m_alias.resize(m);
+      for (std::size_t i = 0; i < m; ++i)
+      {
+         m_alias[i] = static_cast<std::uint32_t>(i);
+      }
+      while (!small.empty() && !large.empty())
+      {
+         std::uint32_t s = small.back();
+         small.pop_back();
+         std::uint32_t l = large.back();
+         m_prob[s] = scaled[s];
+         m_alias[s] = l;
+         scaled[l] -= 1 - scaled[s];
+         if (scaled[l] < 1)
+         {
+            large.pop_back();
+            small.push_back(l);
+         }
+      }
+      // Whatever is left over differs from one only by rounding, and keeps m_prob = 1.
+      m_alias_scale = static_cast<double>(m)/9007199254740992.0;
+   }
+
+   template <class URBG>
+   value_type sample_tail(URBG& gen) const
+   {
+      // Split one uniform variate between the two tails in proportion to their probabilities,
+      // and invert the distribution within whichever tail it lands in:
+      value_type t = detail::sampler_uniform<value_type>(gen)*(m_lower_tail + m_upper_tail);
+      if (t < m_lower_tail)
+      {
+         return detail::sampler_invert(m_dist, t, std::true_type());
+      }
+      return detail::discrete_invert_complement(m_dist, value_type(t - m_lower_tail));
+   }
+
+   std::size_t guide_start(const value_type& p) const
+   {
+      return m_guide[(std::min)(static_cast<std::size_t>(p*m_guide_scale), m_guide.size() - 1)];
+   }
+
+   // The smallest k with cdf(k) >= p:
+   value_type round_up(const value_type& p) const
+   {
+      if (!((p > m_lower_tail) && (p <= m_cdf.back())))
+      {
+         return detail::discrete_table_quantile(m_dist, p);
+      }
+      std::size_t i = guide_start(p);
+      while (m_cdf[i] < p)
+      {
+         ++i;
+      }
+      return m_k0 + static_cast<value_type>(i);
+   }
+
+   // The largest k with cdf(k) <= p, or the bottom of the support when there is none:
+   value_type round_down(const value_type& p) const
+   {
+      if ((p >= 0) && (p < m_cdf[0]) && (m_k0 == m_lowest))
+      {
+         return m_lowest;
+      }
+      if (!((p >= m_cdf[0]) && (p < m_cdf.back())))
+      {
+         return detail::discrete_table_quantile(m_dist, p);
+      }
+      std::size_t i = guide_start(p);
+      while (m_cdf[i] <= p)
+      {
+         ++i;
+      }
+      return m_k0 + static_cast<value_type>(i - 1);
+   }
+
+   template <class Tag>
+   value_type quantile_imp(const value_type& p, const Tag&) const
+   {
+      return detail::discrete_table_quantile(m_dist, p);
+   }
+
+   value_type quantile_imp(const value_type& p, const policies::discrete_quantile<policies::integer_round_up>&) const
+   {
+      return round_up(p);
+   }
+
+   value_type quantile_imp(const value_type& p, const policies::discrete_quantile<policies::integer_round_down>&) const
+   {
+      return round_down(p);
+   }
+
+   value_type quantile_imp(const value_type& p, const policies::discrete_quantile<policies::integer_round_outwards>&) const
+   {
+      return p < value_type(0.5) ? round_down(p) : round_up(p);
+   }
+
+   value_type quantile_imp(const value_type& p, const policies::discrete_quantile<policies::integer_round_inwards>&) const
+   {
+      return p < value_type(0.5) ? round_up(p) : round_down(p);
+   }
+
+   Distribution m_dist;
+   value_type m_lowest;
+   value_type m_highest;
+   value_type m_k0;
+   value_type m_k1;
+   value_type m_lower_tail;
+   value_type m_upper_tail;
+   std::vector<value_type> m_pdf;
+   std::vector<value_type> m_cdf;
+   value_type m_guide_scale;
+   std::vector<std::uint32_t> m_guide;
+   double m_alias_scale;
+   std::vector<double> m_prob;
+   std::vector<std::uint32_t> m_alias;
+};
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_DISCRETE_TABLE_HPP
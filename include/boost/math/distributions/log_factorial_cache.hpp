@@ -0,0 +1,750 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_LOG_FACTORIAL_CACHE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_LOG_FACTORIAL_CACHE_HPP
+
+// References:
+// Catherine Loader, Fast and Accurate Computation of Binomial Probabilities (2000).
+// The saddle point expansion used here is also that of R's dbinom and dhyper.
+
+//
+// The pmfs of the binomial, negative binomial and hypergeometric distributions are ratios
+// of factorials.  Their logarithms are large and nearly cancel, so a table of log(n!) alone
+// gives poor relative accuracy once n is more than a few hundred.  Instead each entry also
+// holds the error of Stirling's approximation,
+//
+//   delta(n) = log(n!) - (n + 1/2) log(n) + n - log(sqrt(2 pi)),
+//
+// which is small, and the pmf is written as exp(delta terms - deviance terms) times a square root
+// factor, where the deviances x log(x/np) + np - x are computed without cancellation.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <boost/math/distributions/binomial.hpp>
+#include <boost/math/distributions/negative_binomial.hpp>
+#include <boost/math/distributions/hypergeometric.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/precision.hpp>
+
+#if defined(BOOST_MATH_HAS_THREADS) && !defined(BOOST_NO_CXX11_HDR_MUTEX) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+#include <atomic>
+#include <mutex>
+#else
+#  define BOOST_MATH_LOG_FACTORIAL_CACHE_NOTHREADS
+#endif
+
+namespace boost { namespace math {
+
+namespace detail {
+
+// delta(n) from its asymptotic series sum B_2k / (2k (2k-1) n^(2k-1)), for n >= 16, where the
+// smallest term is far below the precision of any supported type:
+template <class T>
+T stirling_error_series(T n)
+{
+   BOOST_MATH_STD_USING
+   const T n2 = n * n;
+   T power = 1 / n;
+   T sum = 0;
+   for (std::size_t k = 1; k <= static_cast<std::size_t>(max_bernoulli_b2n<T>::value); ++k)
+   {
+      const T term = unchecked_bernoulli_b2n<T>(k) * power / static_cast<T>(2 * k * (2 * k - 1));
+      sum += term;
+      if (fabs(term) <= tools::epsilon<T>() * sum)
+      {
+         break;
+      }
+      power /= n2;
+   }
+   return sum;
+}
+
+// delta(n) = delta(n+1) + (n + 1/2) log((n+1)/n) - 1, and with t = 1/(2n+1) the last two terms are
+// t^2/3 + t^4/5 + t^6/7 + ..., which has no cancellation.  So small n recur down from 16:
+template <class T>
+T stirling_error_step(std::uintmax_t n)
+{
+   const T t = 1 / static_cast<T>(2 * n + 1);
+   const T t2 = t * t;
+   T power = t2;
+   T sum = 0;
+   for (int j = 1; j < 1000; ++j)
+   {
+      const T next = sum + power / (2 * j + 1);
+      if (next == sum)
+      {
+         break;
+      }
+      sum = next;
+      power *= t2;
+   }
+   return sum;
+}
+
+template <class T>
+T stirling_error_imp(std::uintmax_t n)
+{
+   if (n >= 16)
+   {
+      return stirling_error_series(static_cast<T>(n));
+   }
+   if (n == 0)
+   {
+      // Not defined by the formula, and never used by the pmfs:
+      return 0;
+   }
+   T result = stirling_error_series(T(16));
+   for (std::uintmax_t i = 15; i >= n; --i)
+   {
+      result += stirling_error_step<T>(i);
+   }
+   return result;
+}
+
+// The deviance x log(x/np) + np - x >= 0, by its series in v = (x - np)/(x + np) when x and np are
+// close enough for the direct formula to cancel:
+template <class T>
+T binomial_deviance(T x, T np)
+{
+   BOOST_MATH_STD_USING
+   if (fabs(x - np) < (x + np) / 2)
+   {
+      T v = (x - np) / (x + np);
+      T s = (x - np) * v;
+      if (fabs(s) < tools::min_value<T>())
+      {
+         return s;
+      }
+      T ej = 2 * x * v;
+      v *= v;
+      for (int j = 1; j < 1000; ++j)
+      {
+         ej *= v;
+         const T next = s + ej / (2 * j + 1);
+         if (next == s)
+         {
+            break;
+         }
+         s = next;
+      }
+      return s;
+   }
+   return x * log(x / np) + np - x;
+}
+
+} // namespace detail
+
+//
+// A table of log(n!) and of the error in Stirling's approximation to it, filled lazily a block at
+// a time up to max_entries, and safe to share between threads.  Arguments beyond the table are
+// computed directly.
+//
+template <class RealType = double>
+class log_factorial_cache
+{
+public:
+   typedef RealType value_type;
+
+   explicit log_factorial_cache(std::size_t max_entries = std::size_t(1) << 20)
+      : m_max_entries((std::max)(max_entries, block_size)),
+        m_blocks((m_max_entries + block_size - 1) / block_size),
+        m_chunks(new chunk_pointer[m_blocks]()),
+        m_size(0)
+   {
+      m_max_entries = m_blocks * block_size;
+   }
+
+   log_factorial_cache(const log_factorial_cache&) = delete;
+   log_factorial_cache& operator=(const log_factorial_cache&) = delete;
+
+   // A process wide instance, for the batched pdf and cdf when no cache is given.
+   // Note that we rely on C++11 thread-safe initialization here:
+   static const log_factorial_cache& shared()
+   {
+      static const log_factorial_cache data;
+      return data;
+   }
+
+   RealType log_factorial(std::uintmax_t n) const
+   {
+      if (n < m_max_entries)
+      {
+         return lookup(n).log_factorial;
+      }
+      return boost::math::lgamma(static_cast<RealType>(n) + 1, policies::policy<>());
+   }
+
+   RealType stirling_error(std::uintmax_t n) const
+   {
+      if (n < m_max_entries)
+      {
+         return lookup(n).stirling_error;
+      }
+      return detail::stirling_error_series(static_cast<RealType>(n));
+   }
+
+   // The number of entries computed so far, and the most there will ever be:
+   std::size_t size() const
+   {
+#ifndef BOOST_MATH_LOG_FACTORIAL_CACHE_NOTHREADS
+      return m_size.load(std::memory_order_relaxed);
+#else
+      return m_size;
+#endif
+   }
+
+   std::size_t max_size() const
+   {
+      return m_max_entries;
+   }
+
+private:
+   struct entry
+   {
+      RealType log_factorial;
+      RealType stirling_error;
+   };
+   static constexpr std::size_t block_size = 1024;
+
+#ifndef BOOST_MATH_LOG_FACTORIAL_CACHE_NOTHREADS
+   typedef std::atomic<const entry*> chunk_pointer;
+#else
+   typedef const entry* chunk_pointer;
+#endif
+
+   const entry& lookup(std::uintmax_t n) const
+   {
+      const std::size_t b = static_cast<std::size_t>(n / block_size);
+#ifndef BOOST_MATH_LOG_FACTORIAL_CACHE_NOTHREADS
+      const entry* p = m_chunks[b].load(std::memory_order_acquire);
+#else
+      const entry* p = m_chunks[b];
+#endif
+      if (p == nullptr)
+      {
+         p = fill(b);
+      }
+      return p[n % block_size];
+   }
+
+   //
+   // Blocks, once published, never move, so readers need only the one acquire load above:
+   //
+   const entry* fill(std::size_t b) const
+   {
+#ifndef BOOST_MATH_LOG_FACTORIAL_CACHE_NOTHREADS
+      std::lock_guard<std::mutex> lock(m_mutex);
+      const entry* existing = m_chunks[b].load(std::memory_order_relaxed);
+      if (existing != nullptr)
+      {
+         return existing;
+      }
+#endif
+      std::unique_ptr<entry[]> block(new entry[block_size]);
+      const std::uintmax_t first = static_cast<std::uintmax_t>(b) * block_size;
+      for (std::size_t i = 0; i < block_size; ++i)
+      {
+         const std::uintmax_t n = first + i;
+         block[i].log_factorial = boost::math::lgamma(static_cast<RealType>(n) + 1, policies::policy<>());
+         block[i].stirling_error = detail::stirling_error_imp<RealType>(n);
+      }
+      const entry* p = block.get();
+      m_storage.push_back(std::move(block));
+#ifndef BOOST_MATH_LOG_FACTORIAL_CACHE_NOTHREADS
+      m_chunks[b].store(p, std::memory_order_release);
+      m_size.fetch_add(block_size, std::memory_order_relaxed);
+#else
+      m_chunks[b] = p;
+      m_size += block_size;
+#endif
+      return p;
+   }
+
+   std::size_t m_max_entries;
+   std::size_t m_blocks;
+   std::unique_ptr<chunk_pointer[]> m_chunks;
+   mutable std::vector<std::unique_ptr<entry[]>> m_storage;
+#ifndef BOOST_MATH_LOG_FACTORIAL_CACHE_NOTHREADS
+   mutable std::mutex m_mutex;
+   mutable std::atomic<std::size_t> m_size;
+#else
+   mutable std::size_t m_size;
+#endif
+};
+
+template <class RealType>
+constexpr std::size_t log_factorial_cache<RealType>::block_size;
+
+namespace detail {
+
+// delta(v) for v a non-negative integer held in a T, which may be too large for the table or for an integer type:
+template <class T>
+T stirling_error_of(const log_factorial_cache<T>& cache, const T& v)
+{
+   return (v < static_cast<T>(cache.max_size())) ? cache.stirling_error(static_cast<std::uintmax_t>(v)) : stirling_error_series(v);
+}
+
+// The deviance at x of a mean held to twice working precision as m + m_lo, to first order in m_lo:
+template <class T>
+inline T binomial_deviance(T x, T m, T m_lo)
+{
+   return binomial_deviance(x, m) + (1 - x / m) * m_lo;
+}
+
+//
+// The binomial pmf C(n, x) p^x q^(n-x) for integers 0 <= x <= n, with q = 1 - p, by Loader's saddle
+// point expansion.  The deviances change by about |x - np| eps when np is rounded, which is thousands
+// of epsilon in the body of a large distribution, so np and nq are carried to twice working precision:
+//
+template <class T>
+T binomial_pmf_saddle(T x, T n, T p, T q, const log_factorial_cache<T>& cache)
+{
+   BOOST_MATH_STD_USING
+   using std::fma;
+   if (p == 0)
+   {
+      return (x == 0) ? T(1) : T(0);
+   }
+   if (q == 0)
+   {
+      return (x == n) ? T(1) : T(0);
+   }
+   // The smaller of np and nq is an exact product, and the larger the difference from n:
+   const bool small_p = p <= q;
+   const T small = n * (small_p ? p : q);
+   const T small_lo = fma(n, small_p ? p : q, T(-small));
+   const T large = n - small;
+   const T large_lo = ((n - large) - small) - small_lo;
+   const T np = small_p ? small : large;
+   const T np_lo = small_p ? small_lo : large_lo;
+   const T nq = small_p ? large : small;
+   const T nq_lo = small_p ? large_lo : small_lo;
+   if (x == 0)
+   {
+      if (n == 0)
+      {
+         return 1;
+      }
+      return exp((p < T(0.1)) ? T(-binomial_deviance(n, nq, nq_lo) - (np + np_lo)) : T(n * log(q)));
+   }
+   if (x == n)
+   {
+      return exp((q < T(0.1)) ? T(-binomial_deviance(n, np, np_lo) - (nq + nq_lo)) : T(n * log(p)));
+   }
+   const T lc = stirling_error_of(cache, n) - stirling_error_of(cache, x) - stirling_error_of(cache, T(n - x))
+      - binomial_deviance(x, np, np_lo) - binomial_deviance(T(n - x), nq, nq_lo);
+   // log(2 pi x (n - x)/n), without the cancellation in 1 - x/n when x is close to n:
+   const T lf = log(constants::two_pi<T>() * x * ((n - x) / n));
+   return exp(lc - lf / 2);
+}
+
+// C(r, x) C(N - r, n - x) / C(N, n), as the ratio of three binomial pmfs with p = n/N, whose
+// dependence on p cancels exactly:
+template <class T>
+T hypergeometric_pmf_saddle(T x, T r, T n, T N, const log_factorial_cache<T>& cache)
+{
+   if (N == 0)
+   {
+      return 1;
+   }
+   const T p = n / N;
+   const T q = (N - n) / N;
+   const T p1 = binomial_pmf_saddle(x, r, p, q, cache);
+   const T p2 = binomial_pmf_saddle(T(n - x), T(N - r), p, q, cache);
+   const T p3 = binomial_pmf_saddle(n, N, p, q, cache);
+   return p1 * p2 / p3;
+}
+
+template <class T>
+bool is_integer_value(const T& x)
+{
+   BOOST_MATH_STD_USING
+   return (boost::math::isfinite)(x) && (floor(x) == x);
+}
+
+// Kahan's compensated sum, since a cdf may be the sum of many thousands of terms:
+template <class T>
+struct compensated_sum
+{
+   T sum = 0;
+   T carry = 0;
+
+   void reset(const T& x)
+   {
+      sum = x;
+      carry = 0;
+   }
+
+   void add(const T& x)
+   {
+      const T y = x - carry;
+      const T t = sum + y;
+      carry = (t - sum) - y;
+      sum = t;
+   }
+};
+
+//
+// The cdf of a unimodal pmf on the integers lo ... hi at points sorted in increasing order, all
+// integers within the support.  The cdf is summed upwards from the previous point for every point
+// below the mode, and for those above it while the cdf is still below 1/2.  For the rest the
+// complement is summed downwards from the next point, so that each sum is of terms that increase
+// towards the point, and 1 - Q never cancels.  The first sum on each side, and any after the
+// running sum underflows or a long gap, walks outwards from the point until the rest of the tail
+// is negligible: that is bounded by the geometric series t r / (1 - r) in the last term t and the
+// ratio r to the next, which for a small p in the negative binomial is far more than t.
+//
+// The pmf is stepped by its ratio from one integer to the next, and is recomputed directly after
+// 64 steps, or as soon as it has grown 16 fold: the pmf's relative error grows with |log(pmf)|, so a
+// small anchor would pass its larger error on to the larger terms stepped from it.
+//
+template <class T, class Pmf, class Up, class Down>
+void discrete_sorted_cdf(const std::vector<std::pair<T, std::size_t>>& points, T lo, T hi, T mode,
+                         Pmf pmf, Up up, Down down, std::vector<T>& result)
+{
+   const T eps = tools::epsilon<T>();
+   const T tiny = tools::min_value<T>();
+   const int max_steps = 64;
+   const T max_growth = 16;
+   auto split = std::lower_bound(points.begin(), points.end(), mode,
+      [](const std::pair<T, std::size_t>& a, const T& b) { return a.first < b; });
+   // True once the rest of a tail, after the last term t, is below eps of the total:
+   auto negligible = [&](const T& t, const T& ratio, const T& total)
+   {
+      return !(t > total * eps) && (ratio < 1) && !(t * ratio > total * eps * (1 - ratio));
+   };
+
+   // Lower tail: P(X <= k), with term = pmf(k) at the last point.
+   compensated_sum<T> sum;
+   T term = 0;
+   T anchored = 0;
+   int steps = 0;
+   T previous = lo;
+   auto it = points.begin();
+   for (; it != points.end(); ++it)
+   {
+      const T k = it->first;
+      if ((it >= split) && (sum.sum >= T(0.5)))
+      {
+         break;
+      }
+      if (!(sum.sum >= tiny) || (k - previous > 4096))
+      {
+         term = pmf(k);
+         anchored = term;
+         steps = 0;
+         sum.reset(term);
+         T t = term;
+         int count = 0;
+         for (T j = k; j > lo; --j)
+         {
+            t = (++count % max_steps == 0) ? pmf(T(j - 1)) : T(t * down(j));
+            sum.add(t);
+            if (negligible(t, (j - 1 > lo) ? T(down(T(j - 1))) : T(0), sum.sum))
+            {
+               break;
+            }
+         }
+      }
+      else
+      {
+         for (T j = previous; j < k; ++j)
+         {
+            term *= up(j);
+            if ((++steps >= max_steps) || (term > max_growth * anchored))
+            {
+               term = pmf(T(j + 1));
+               anchored = term;
+               steps = 0;
+            }
+            sum.add(term);
+         }
+      }
+      previous = k;
+      if ((it >= split) && (sum.sum >= T(0.5)))
+      {
+         break;
+      }
+      result[it->second] = (std::min)(sum.sum, T(1));
+   }
+   split = it;
+
+   // Upper tail: Q = P(X > k), with term = pmf(k + 1) at the last point.
+   compensated_sum<T> q;
+   previous = hi;
+   for (auto it = points.end(); it != split;)
+   {
+      --it;
+      const T k = it->first;
+      if (!(q.sum >= tiny) || (previous - k > 4096))
+      {
+         q.reset(0);
+         term = 0;
+         if (k < hi)
+         {
+            term = pmf(T(k + 1));
+            anchored = term;
+            steps = 0;
+            q.reset(term);
+            T t = term;
+            int count = 0;
+            for (T j = k + 1; j < hi; ++j)
+            {
+               t = (++count % max_steps == 0) ? pmf(T(j + 1)) : T(t * up(j));
+               q.add(t);
+               if (negligible(t, (j + 1 < hi) ? T(up(T(j + 1))) : T(0), q.sum))
+               {
+                  break;
+               }
+            }
+         }
+      }
+      else
+      {
+         for (T j = previous; j > k; --j)
+         {
+            term *= down(T(j + 1));
+            if ((++steps >= max_steps) || (term > max_growth * anchored))
+            {
+               term = pmf(j);
+               anchored = term;
+               steps = 0;
+            }
+            q.add(term);
+         }
+      }
+      previous = k;
+      result[it->second] = (std::max)(T(1 - q.sum), T(0));
+   }
+}
+
+// Reads the points, passes those that are not integers in the support to the distribution's own
+// cdf (which reports any errors), and sorts the rest:
+template <class T, class ForwardIterator, class Scalar>
+void discrete_batched_points(ForwardIterator first, ForwardIterator last, T lo, T hi, Scalar scalar,
+                             std::vector<std::pair<T, std::size_t>>& points, std::vector<T>& result)
+{
+   for (; first != last; ++first)
+   {
+      const T k = static_cast<T>(*first);
+      if (is_integer_value(k) && (k >= lo) && (k <= hi))
+      {
+         points.emplace_back(k, result.size());
+         result.push_back(0);
+      }
+      else
+      {
+         result.push_back(scalar(*first));
+      }
+   }
+   if (!std::is_sorted(points.begin(), points.end()))
+   {
+      std::sort(points.begin(), points.end());
+   }
+}
+
+} // namespace detail
+
+//
+// The pmfs through a cache:
+//
+template <class RealType, class Policy>
+RealType pdf(const binomial_distribution<RealType, Policy>& dist, const RealType& k, const log_factorial_cache<RealType>& cache)
+{
+   const RealType n = dist.trials();
+   const RealType p = dist.success_fraction();
+   RealType result = 0;
+   if (false == binomial_detail::check_dist_and_k(
+      "boost::math::pdf(binomial_distribution<%1%> const&, %1%, log_factorial_cache<%1%> const&)", n, p, k, &result, Policy()))
+   {
+      return result;
+   }
+   if (!detail::is_integer_value(n) || !detail::is_integer_value(k))
+   {
+      return pdf(dist, k);
+   }
+   return detail::binomial_pmf_saddle(k, n, p, RealType(1 - p), cache);
+}
+
+template <class RealType, class Policy>
+RealType pdf(const negative_binomial_distribution<RealType, Policy>& dist, const RealType& k, const log_factorial_cache<RealType>& cache)
+{
+   const RealType r = dist.successes();
+   const RealType p = dist.success_fraction();
+   RealType result = 0;
+   if (false == negative_binomial_detail::check_dist_and_k(
+      "boost::math::pdf(const negative_binomial_distribution<%1%>&, %1%, const log_factorial_cache<%1%>&)", r, p, k, &result, Policy()))
+   {
+      return result;
+   }
+   if (!detail::is_integer_value(r) || !detail::is_integer_value(k) || (r == 0))
+   {
+      return pdf(dist, k);
+   }
+   // C(k + r - 1, k) p^r q^k = r/(r + k) C(r + k, r) p^r q^k:
+   return r / (r + k) * detail::binomial_pmf_saddle(r, RealType(r + k), p, RealType(1 - p), cache);
+}
+
+template <class RealType, class Policy, class U>
+RealType pdf(const hypergeometric_distribution<RealType, Policy>& dist, const U& x, const log_factorial_cache<RealType>& cache)
+{
+   static const char* function = "boost::math::pdf(const hypergeometric_distribution<%1%>&, const %1%&, const log_factorial_cache<%1%>&)";
+   const RealType k = static_cast<RealType>(x);
+   RealType result = 0;
+   if (!dist.check_params(function, &result))
+   {
+      return result;
+   }
+   if (!detail::is_integer_value(k) || (k < 0))
+   {
+      return boost::math::policies::raise_domain_error<RealType>(
+         function, "Random variable out of range: must be an integer but got %1%", k, Policy());
+   }
+   if (!dist.check_x(static_cast<std::uint64_t>(k), function, &result))
+   {
+      return result;
+   }
+   return detail::hypergeometric_pmf_saddle(k, static_cast<RealType>(dist.defective()), static_cast<RealType>(dist.sample_count()),
+                                            static_cast<RealType>(dist.total()), cache);
+}
+
+//
+// Batched pmfs and cdfs.  The cdf sorts the points, and sums the pmf incrementally from one to the
+// next, so the cost is that of one pmf per point plus a multiplication for each integer in between.
+//
+template <class Distribution, class ForwardIterator, class OutputIterator>
+OutputIterator pdf(const Distribution& dist, ForwardIterator first, ForwardIterator last, OutputIterator out,
+                   const log_factorial_cache<typename Distribution::value_type>& cache)
+{
+   typedef typename Distribution::value_type value_type;
+   for (; first != last; ++first, ++out)
+   {
+      *out = pdf(dist, static_cast<value_type>(*first), cache);
+   }
+   return out;
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator cdf(const binomial_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out,
+                   const log_factorial_cache<RealType>& cache)
+{
+   BOOST_MATH_STD_USING
+   const RealType n = dist.trials();
+   const RealType p = dist.success_fraction();
+   const RealType q = 1 - p;
+   std::vector<std::pair<RealType, std::size_t>> points;
+   std::vector<RealType> result;
+   // For non-integer n every point goes to the distribution:
+   const RealType hi = detail::is_integer_value(n) ? n : RealType(-1);
+   detail::discrete_batched_points(first, last, RealType(0), hi, [&](const RealType& k) { return cdf(dist, k); }, points, result);
+   const RealType mode = (std::min)(floor((n + 1) * p), n);
+   detail::discrete_sorted_cdf(points, RealType(0), n, mode,
+      [&](const RealType& k) { return detail::binomial_pmf_saddle(k, n, p, q, cache); },
+      [&](const RealType& k) { return (n - k) / (k + 1) * (p / q); },
+      [&](const RealType& k) { return k / (n - k + 1) * (q / p); },
+      result);
+   return std::copy(result.begin(), result.end(), out);
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator cdf(const negative_binomial_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out,
+                   const log_factorial_cache<RealType>& cache)
+{
+   BOOST_MATH_STD_USING
+   const RealType r = dist.successes();
+   const RealType p = dist.success_fraction();
+   const RealType q = 1 - p;
+   std::vector<std::pair<RealType, std::size_t>> points;
+   std::vector<RealType> result;
+   // The degenerate distributions go to the distribution, and so does the top of the range, beyond which
+   // it is pointless to sum:
+   const RealType hi = ((r > 0) && (p > 0) && (p < 1)) ? RealType(tools::max_value<RealType>() / 2) : RealType(-1);
+   detail::discrete_batched_points(first, last, RealType(0), hi, [&](const RealType& k) { return cdf(dist, k); }, points, result);
+   const RealType mode = (r > 1) ? RealType(floor((r - 1) * q / p)) : RealType(0);
+   detail::discrete_sorted_cdf(points, RealType(0), boost::math::numeric_limits<RealType>::infinity(), mode,
+      [&](const RealType& k) { return pdf(dist, k, cache); },
+      [&](const RealType& k) { return (k + r) / (k + 1) * q; },
+      [&](const RealType& k) { return k / (k + r - 1) / q; },
+      result);
+   return std::copy(result.begin(), result.end(), out);
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+OutputIterator cdf(const hypergeometric_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out,
+                   const log_factorial_cache<RealType>& cache)
+{
+   BOOST_MATH_STD_USING
+   const RealType r = static_cast<RealType>(dist.defective());
+   const RealType n = static_cast<RealType>(dist.sample_count());
+   const RealType N = static_cast<RealType>(dist.total());
+   const std::pair<std::uint64_t, std::uint64_t> support_range = range(dist);
+   const RealType lo = static_cast<RealType>(support_range.first);
+   const RealType hi = static_cast<RealType>(support_range.second);
+   std::vector<std::pair<RealType, std::size_t>> points;
+   std::vector<RealType> result;
+   detail::discrete_batched_points(first, last, lo, hi, [&](const RealType& k) { return cdf(dist, k); }, points, result);
+   const RealType mode = floor((r + 1) * (n + 1) / (N + 2));
+   detail::discrete_sorted_cdf(points, lo, hi, mode,
+      [&](const RealType& k) { return detail::hypergeometric_pmf_saddle(k, r, n, N, cache); },
+      [&](const RealType& k) { return (r - k) * (n - k) / ((k + 1) * (N - r - n + k + 1)); },
+      [&](const RealType& k) { return k * (N - r - n + k) / ((r - k + 1) * (n - k + 1)); },
+      result);
+   return std::copy(result.begin(), result.end(), out);
+}
+
+// The same through the shared cache:
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+inline OutputIterator pdf(const binomial_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return pdf(dist, first, last, out, log_factorial_cache<RealType>::shared());
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+inline OutputIterator pdf(const negative_binomial_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return pdf(dist, first, last, out, log_factorial_cache<RealType>::shared());
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+inline OutputIterator pdf(const hypergeometric_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return pdf(dist, first, last, out, log_factorial_cache<RealType>::shared());
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+inline OutputIterator cdf(const binomial_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return cdf(dist, first, last, out, log_factorial_cache<RealType>::shared());
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+inline OutputIterator cdf(const negative_binomial_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return cdf(dist, first, last, out, log_factorial_cache<RealType>::shared());
+}
+
+template <class RealType, class Policy, class ForwardIterator, class OutputIterator>
+inline OutputIterator cdf(const hypergeometric_distribution<RealType, Policy>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return cdf(dist, first, last, out, log_factorial_cache<RealType>::shared());
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_LOG_FACTORIAL_CACHE_HPP
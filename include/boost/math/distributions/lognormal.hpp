@@ -132,6 +132,37 @@ BOOST_MATH_GPU_ENABLED RealType pdf(const lognormal_distribution<RealType, Polic
    return result;
 }
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED RealType logpdf(const lognormal_distribution<RealType, Policy>& dist, const RealType& x)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   RealType mu = dist.location();
+   RealType sigma = dist.scale();
+
+   constexpr auto function = "boost::math::logpdf(const lognormal_distribution<%1%>&, %1%)";
+
+   RealType result = -boost::math::numeric_limits<RealType>::infinity();
+   if(0 == detail::check_scale(function, sigma, &result, Policy()))
+      return result;
+   if(0 == detail::check_location(function, mu, &result, Policy()))
+      return result;
+   if(0 == detail::check_lognormal_x(function, x, &result, Policy()))
+      return result;
+
+   if(x == 0)
+      return -boost::math::numeric_limits<RealType>::infinity();
+
+   RealType log_x = log(x);
+   RealType exponent = log_x - mu;
+   exponent *= -exponent;
+   exponent /= 2 * sigma * sigma;
+
+   result = exponent - log(sigma) - log_x - constants::log_root_two_pi<RealType>();
+
+   return result;
+}
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType cdf(const lognormal_distribution<RealType, Policy>& dist, const RealType& x)
 {
@@ -154,6 +185,28 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const lognormal_distribution<RealType
    return cdf(norm, log(x));
 }
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const lognormal_distribution<RealType, Policy>& dist, const RealType& x)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   constexpr auto function = "boost::math::logcdf(const lognormal_distribution<%1%>&, %1%)";
+
+   RealType result = 0;
+   if(0 == detail::check_scale(function, dist.scale(), &result, Policy()))
+      return result;
+   if(0 == detail::check_location(function, dist.location(), &result, Policy()))
+      return result;
+   if(0 == detail::check_lognormal_x(function, x, &result, Policy()))
+      return result;
+
+   if(x == 0)
+      return -boost::math::numeric_limits<RealType>::infinity();
+
+   normal_distribution<RealType, Policy> norm(dist.location(), dist.scale());
+   return logcdf(norm, log(x));
+}
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const lognormal_distribution<RealType, Policy>& dist, const RealType& p)
 {
@@ -200,6 +253,28 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const complemented2_type<lognormal_di
    return cdf(complement(norm, log(c.param)));
 }
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const complemented2_type<lognormal_distribution<RealType, Policy>, RealType>& c)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   constexpr auto function = "boost::math::logcdf(const lognormal_distribution<%1%>&, %1%)";
+
+   RealType result = 0;
+   if(0 == detail::check_scale(function, c.dist.scale(), &result, Policy()))
+      return result;
+   if(0 == detail::check_location(function, c.dist.location(), &result, Policy()))
+      return result;
+   if(0 == detail::check_lognormal_x(function, c.param, &result, Policy()))
+      return result;
+
+   if(c.param == 0)
+      return 0;
+
+   normal_distribution<RealType, Policy> norm(c.dist.location(), c.dist.scale());
+   return logcdf(complement(norm, log(c.param)));
+}
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const complemented2_type<lognormal_distribution<RealType, Policy>, RealType>& c)
 {
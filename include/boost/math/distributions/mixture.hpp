@@ -0,0 +1,902 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_MIXTURE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_MIXTURE_HPP
+
+// References:
+// Geoffrey McLachlan and David Peel, Finite Mixture Models, Wiley (2000), chapters 1 and 2.
+// Arthur P. Dempster, Nan M. Laird and Donald B. Rubin, Maximum Likelihood from Incomplete Data via the EM Algorithm,
+// Journal of the Royal Statistical Society B 39 (1977), 1-38.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/lognormal.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/exponential.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/roots.hpp>
+#include <boost/math/tools/tuple.hpp>
+
+namespace boost { namespace math {
+
+namespace detail {
+
+// log(w[i]) + logpdf(components[i], x) for each component, or -infinity where x lies outside its range:
+template <class Distribution, class T>
+void mixture_log_terms_generic(const std::vector<Distribution>& components, const std::vector<T>& log_weights, T x, T* out)
+{
+   BOOST_MATH_STD_USING
+   for (std::size_t i = 0; i < components.size(); ++i)
+   {
+      std::pair<T, T> r = range(components[i]);
+      if ((x < r.first) || (x > r.second) || (log_weights[i] == -std::numeric_limits<T>::infinity()))
+      {
+         out[i] = -std::numeric_limits<T>::infinity();
+         continue;
+      }
+      T l = logpdf(components[i], x);
+      if ((boost::math::isnan)(l))
+      {
+         // Some logpdfs leave the end points of the range undefined, where the pdf is not:
+         l = log(pdf(components[i], x));
+      }
+      out[i] = log_weights[i] + l;
+   }
+}
+
+//
+// The log densities of the weighted components.  The families below keep their parameters as
+// structures of arrays, with everything that does not depend on x folded into one constant per
+// component, so that the loop over the components is a few arithmetic operations that the compiler
+// can vectorize; any other family, and the edges of the support, go through the components' logpdf.
+//
+template <class Distribution>
+class mixture_log_density
+{
+public:
+   typedef typename Distribution::value_type value_type;
+
+   void assign(const std::vector<Distribution>&, const std::vector<value_type>& weights)
+   {
+      BOOST_MATH_STD_USING
+      m_log_weights.resize(weights.size());
+      for (std::size_t i = 0; i < weights.size(); ++i)
+      {
+         m_log_weights[i] = log(weights[i]);
+      }
+   }
+
+   void operator()(const std::vector<Distribution>& components, value_type x, value_type* out) const
+   {
+      mixture_log_terms_generic(components, m_log_weights, x, out);
+   }
+
+private:
+   std::vector<value_type> m_log_weights;
+};
+
+template <class RealType, class Policy>
+class mixture_log_density<normal_distribution<RealType, Policy> >
+{
+public:
+   typedef normal_distribution<RealType, Policy> distribution_type;
+
+   void assign(const std::vector<distribution_type>& components, const std::vector<RealType>& weights)
+   {
+      BOOST_MATH_STD_USING
+      const std::size_t n = components.size();
+      m_log_weights.resize(n);
+      m_location.resize(n);
+      m_inv_scale.resize(n);
+      m_constant.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         m_log_weights[i] = log(weights[i]);
+         m_location[i] = components[i].mean();
+         m_inv_scale[i] = 1 / components[i].standard_deviation();
+         m_constant[i] = m_log_weights[i] - log(components[i].standard_deviation()) - constants::log_root_two_pi<RealType>();
+      }
+   }
+
+   void operator()(const std::vector<distribution_type>& components, RealType x, RealType* out) const
+   {
+      if (!(boost::math::isfinite)(x))
+      {
+         mixture_log_terms_generic(components, m_log_weights, x, out);
+         return;
+      }
+      const std::size_t n = m_location.size();
+      const RealType* mu = m_location.data();
+      const RealType* inv_s = m_inv_scale.data();
+      const RealType* c = m_constant.data();
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         RealType z = (x - mu[i]) * inv_s[i];
+         out[i] = c[i] - z * z / 2;
+      }
+   }
+
+private:
+   std::vector<RealType> m_log_weights;
+   std::vector<RealType> m_location;
+   std::vector<RealType> m_inv_scale;
+   std::vector<RealType> m_constant;
+};
+
+template <class RealType, class Policy>
+class mixture_log_density<lognormal_distribution<RealType, Policy> >
+{
+public:
+   typedef lognormal_distribution<RealType, Policy> distribution_type;
+
+   void assign(const std::vector<distribution_type>& components, const std::vector<RealType>& weights)
+   {
+      BOOST_MATH_STD_USING
+      const std::size_t n = components.size();
+      m_log_weights.resize(n);
+      m_location.resize(n);
+      m_inv_scale.resize(n);
+      m_constant.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         m_log_weights[i] = log(weights[i]);
+         m_location[i] = components[i].location();
+         m_inv_scale[i] = 1 / components[i].scale();
+         m_constant[i] = m_log_weights[i] - log(components[i].scale()) - constants::log_root_two_pi<RealType>();
+      }
+   }
+
+   void operator()(const std::vector<distribution_type>& components, RealType x, RealType* out) const
+   {
+      BOOST_MATH_STD_USING
+      if (!((x > 0) && (boost::math::isfinite)(x)))
+      {
+         mixture_log_terms_generic(components, m_log_weights, x, out);
+         return;
+      }
+      const RealType lx = log(x);
+      const std::size_t n = m_location.size();
+      const RealType* mu = m_location.data();
+      const RealType* inv_s = m_inv_scale.data();
+      const RealType* c = m_constant.data();
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         RealType z = (lx - mu[i]) * inv_s[i];
+         out[i] = c[i] - lx - z * z / 2;
+      }
+   }
+
+private:
+   std::vector<RealType> m_log_weights;
+   std::vector<RealType> m_location;
+   std::vector<RealType> m_inv_scale;
+   std::vector<RealType> m_constant;
+};
+
+template <class RealType, class Policy>
+class mixture_log_density<gamma_distribution<RealType, Policy> >
+{
+public:
+   typedef gamma_distribution<RealType, Policy> distribution_type;
+
+   void assign(const std::vector<distribution_type>& components, const std::vector<RealType>& weights)
+   {
+      BOOST_MATH_STD_USING
+      const std::size_t n = components.size();
+      m_log_weights.resize(n);
+      m_shape_m1.resize(n);
+      m_inv_scale.resize(n);
+      m_constant.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         const RealType k = components[i].shape();
+         const RealType theta = components[i].scale();
+         m_log_weights[i] = log(weights[i]);
+         m_shape_m1[i] = k - 1;
+         m_inv_scale[i] = 1 / theta;
+         m_constant[i] = m_log_weights[i] - boost::math::lgamma(k, Policy()) - k * log(theta);
+      }
+   }
+
+   void operator()(const std::vector<distribution_type>& components, RealType x, RealType* out) const
+   {
+      BOOST_MATH_STD_USING
+      if (!((x > 0) && (boost::math::isfinite)(x)))
+      {
+         mixture_log_terms_generic(components, m_log_weights, x, out);
+         return;
+      }
+      const RealType lx = log(x);
+      const std::size_t n = m_shape_m1.size();
+      const RealType* km1 = m_shape_m1.data();
+      const RealType* inv_s = m_inv_scale.data();
+      const RealType* c = m_constant.data();
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         out[i] = c[i] + km1[i] * lx - x * inv_s[i];
+      }
+   }
+
+private:
+   std::vector<RealType> m_log_weights;
+   std::vector<RealType> m_shape_m1;
+   std::vector<RealType> m_inv_scale;
+   std::vector<RealType> m_constant;
+};
+
+template <class RealType, class Policy>
+class mixture_log_density<exponential_distribution<RealType, Policy> >
+{
+public:
+   typedef exponential_distribution<RealType, Policy> distribution_type;
+
+   void assign(const std::vector<distribution_type>& components, const std::vector<RealType>& weights)
+   {
+      BOOST_MATH_STD_USING
+      const std::size_t n = components.size();
+      m_log_weights.resize(n);
+      m_rate.resize(n);
+      m_constant.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         m_log_weights[i] = log(weights[i]);
+         m_rate[i] = components[i].lambda();
+         m_constant[i] = m_log_weights[i] + log(m_rate[i]);
+      }
+   }
+
+   void operator()(const std::vector<distribution_type>& components, RealType x, RealType* out) const
+   {
+      if (!((x >= 0) && (boost::math::isfinite)(x)))
+      {
+         mixture_log_terms_generic(components, m_log_weights, x, out);
+         return;
+      }
+      const std::size_t n = m_rate.size();
+      const RealType* rate = m_rate.data();
+      const RealType* c = m_constant.data();
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         out[i] = c[i] - rate[i] * x;
+      }
+   }
+
+private:
+   std::vector<RealType> m_log_weights;
+   std::vector<RealType> m_rate;
+   std::vector<RealType> m_constant;
+};
+
+// The log of the sum of exp(terms), which is -infinity when every term is.  This is the
+// log-sum-exp of special_functions/logsumexp.hpp, except that terms more than
+// log(n / epsilon) below the largest are skipped rather than passed to exp: together they
+// change the sum by less than one epsilon, and with many components most terms are far
+// out in their tails, so the comparison saves most of the exps.
+template <class T>
+T mixture_logsumexp(const std::vector<T>& terms)
+{
+   using std::exp;
+   using std::log1p;
+   const auto elem = std::max_element(terms.begin(), terms.end());
+   const T max_val = *elem;
+   if (max_val == -std::numeric_limits<T>::infinity())
+   {
+      return -std::numeric_limits<T>::infinity();
+   }
+   // A cutoff at or below log(epsilon / n), found without calling log:
+   int bits = tools::digits<T>();
+   for (std::size_t n = terms.size(); n != 0; n >>= 1)
+   {
+      ++bits;
+   }
+   const T cutoff = max_val - bits * constants::ln_two<T>();
+   T arg = 0;
+   for (auto i = terms.begin(); i != terms.end(); ++i)
+   {
+      if ((i != elem) && (*i > cutoff))
+      {
+         arg += exp(*i - max_val);
+      }
+   }
+   return max_val + log1p(arg);
+}
+
+} // namespace detail
+
+// A finite mixture of distributions of one family, with density sum w[i] pdf(components[i], x).
+template <class Distribution>
+class mixture_distribution
+{
+public:
+   typedef Distribution component_type;
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+
+   template <class WeightIterator, class ComponentIterator>
+   mixture_distribution(WeightIterator weight_first, WeightIterator weight_last, ComponentIterator component_first, ComponentIterator component_last)
+      : m_weights(weight_first, weight_last), m_components(component_first, component_last)
+   {
+      init();
+   }
+
+   template <class WeightRange, class ComponentRange>
+   mixture_distribution(const WeightRange& weights, const ComponentRange& components)
+      : m_weights(std::begin(weights), std::end(weights)), m_components(std::begin(components), std::end(components))
+   {
+      init();
+   }
+
+   mixture_distribution(std::initializer_list<value_type> weights, std::initializer_list<Distribution> components)
+      : m_weights(weights.begin(), weights.end()), m_components(components.begin(), components.end())
+   {
+      init();
+   }
+
+   // The weights, normalized to sum to one:
+   const std::vector<value_type>& weights() const
+   {
+      return m_weights;
+   }
+
+   const std::vector<Distribution>& components() const
+   {
+      return m_components;
+   }
+
+   std::size_t num_components() const
+   {
+      return m_components.size();
+   }
+
+   // log(w[i]) + logpdf(components()[i], x) for every component, written to out:
+   void log_terms(value_type x, value_type* out) const
+   {
+      m_density(m_components, x, out);
+   }
+
+private:
+   void init()
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::mixture_distribution<%1%>::mixture_distribution";
+      if (m_weights.empty() || (m_weights.size() != m_components.size()))
+      {
+         policies::raise_domain_error<value_type>(function, "There must be one weight per component, and at least one component, but got %1% weights.", static_cast<value_type>(m_weights.size()), policy_type());
+         return;
+      }
+      value_type sum = 0;
+      for (const value_type& w : m_weights)
+      {
+         if (!((w >= 0) && (boost::math::isfinite)(w)))
+         {
+            policies::raise_domain_error<value_type>(function, "The weights must be finite and non-negative, but got %1%.", w, policy_type());
+            return;
+         }
+         sum += w;
+      }
+      if (!(sum > 0))
+      {
+         policies::raise_domain_error<value_type>(function, "At least one weight must be positive, but their sum was %1%.", sum, policy_type());
+         return;
+      }
+      for (value_type& w : m_weights)
+      {
+         w /= sum;
+      }
+      m_density.assign(m_components, m_weights);
+   }
+
+   std::vector<value_type> m_weights;
+   std::vector<Distribution> m_components;
+   detail::mixture_log_density<Distribution> m_density;
+};
+
+// The hull of the ranges and supports of the components:
+template <class Distribution>
+inline std::pair<typename Distribution::value_type, typename Distribution::value_type> range(const mixture_distribution<Distribution>& dist)
+{
+   typedef typename Distribution::value_type value_type;
+   std::pair<value_type, value_type> result = range(dist.components()[0]);
+   for (const Distribution& c : dist.components())
+   {
+      std::pair<value_type, value_type> r = range(c);
+      result.first = (std::min)(result.first, r.first);
+      result.second = (std::max)(result.second, r.second);
+   }
+   return result;
+}
+
+template <class Distribution>
+inline std::pair<typename Distribution::value_type, typename Distribution::value_type> support(const mixture_distribution<Distribution>& dist)
+{
+   typedef typename Distribution::value_type value_type;
+   std::pair<value_type, value_type> result = support(dist.components()[0]);
+   for (const Distribution& c : dist.components())
+   {
+      std::pair<value_type, value_type> r = support(c);
+      result.first = (std::min)(result.first, r.first);
+      result.second = (std::max)(result.second, r.second);
+   }
+   return result;
+}
+
+namespace detail {
+
+template <class Distribution>
+bool mixture_check_x(const char* function, const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x, typename Distribution::value_type* result)
+{
+   typedef typename Distribution::value_type value_type;
+   std::pair<value_type, value_type> r = range(dist);
+   if (!((x >= r.first) && (x <= r.second)))
+   {
+      *result = policies::raise_domain_error<value_type>(function, "The random variable must lie within the range of the mixture, but is %1%.", x, typename Distribution::policy_type());
+      return false;
+   }
+   return true;
+}
+
+template <class Distribution>
+typename Distribution::value_type mixture_logpdf_imp(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x, std::vector<typename Distribution::value_type>& terms)
+{
+   terms.resize(dist.num_components());
+   dist.log_terms(x, terms.data());
+   return mixture_logsumexp(terms);
+}
+
+// The cdf, or its complement, as the weighted sum of the components' own:
+template <class Distribution>
+typename Distribution::value_type mixture_cdf_imp(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x, bool complement)
+{
+   typedef typename Distribution::value_type value_type;
+   value_type result = 0;
+   for (std::size_t i = 0; i < dist.num_components(); ++i)
+   {
+      const Distribution& c = dist.components()[i];
+      std::pair<value_type, value_type> r = range(c);
+      value_type p;
+      if (x <= r.first)
+      {
+         p = complement ? 1 : 0;
+      }
+      else if (x >= r.second)
+      {
+         p = complement ? 0 : 1;
+      }
+      else
+      {
+         p = complement ? cdf(boost::math::complement(c, x)) : cdf(c, x);
+      }
+      result += dist.weights()[i] * p;
+   }
+   return (std::min)(result, value_type(1));
+}
+
+template <class Distribution>
+typename Distribution::value_type mixture_logcdf_imp(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x, bool complement)
+{
+   BOOST_MATH_STD_USING
+   typedef typename Distribution::value_type value_type;
+   std::vector<value_type> terms(dist.num_components());
+   for (std::size_t i = 0; i < dist.num_components(); ++i)
+   {
+      const Distribution& c = dist.components()[i];
+      std::pair<value_type, value_type> r = range(c);
+      value_type lp;
+      if ((x <= r.first) || (x >= r.second))
+      {
+         lp = ((x <= r.first) == complement) ? value_type(0) : -std::numeric_limits<value_type>::infinity();
+      }
+      else
+      {
+         lp = complement ? logcdf(boost::math::complement(c, x)) : logcdf(c, x);
+      }
+      terms[i] = log(dist.weights()[i]) + lp;
+   }
+   return (std::min)(mixture_logsumexp(terms), value_type(0));
+}
+
+// Newton's method on the cdf, with the density as its derivative:
+template <class Distribution>
+struct mixture_quantile_functor
+{
+   typedef typename Distribution::value_type value_type;
+
+   mixture_quantile_functor(const mixture_distribution<Distribution>& d, value_type target, bool c)
+      : dist(d), p(target), comp(c) {}
+
+   boost::math::tuple<value_type, value_type> operator()(const value_type& x)
+   {
+      BOOST_MATH_STD_USING
+      value_type f = comp ? value_type(p - mixture_cdf_imp(dist, x, true)) : value_type(mixture_cdf_imp(dist, x, false) - p);
+      value_type density = exp(mixture_logpdf_imp(dist, x, terms));
+      return boost::math::make_tuple(f, density);
+   }
+
+   const mixture_distribution<Distribution>& dist;
+   value_type p;
+   bool comp;
+   std::vector<value_type> terms;
+};
+
+//
+// Every component has probability at most p below the smallest of the components' quantiles, and at
+// least p below the largest, so the mixture's quantile lies between the two.  Starting from the
+// weighted mean of the component quantiles, Newton's method then falls back on bisection whenever a
+// step would leave that bracket.
+//
+template <class Distribution>
+typename Distribution::value_type mixture_quantile_imp(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& p, bool comp)
+{
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+   const char* function = comp ? "boost::math::quantile(const boost::math::complemented2_type<boost::math::mixture_distribution<%1%>, %1%>&)"
+                               : "boost::math::quantile(const boost::math::mixture_distribution<%1%>&, %1%)";
+   value_type result = 0;
+   if (!check_probability(function, p, &result, policy_type()))
+   {
+      return result;
+   }
+   value_type lo = tools::max_value<value_type>();
+   value_type hi = -tools::max_value<value_type>();
+   value_type guess = 0;
+   for (std::size_t i = 0; i < dist.num_components(); ++i)
+   {
+      const Distribution& c = dist.components()[i];
+      value_type q = comp ? quantile(complement(c, p)) : quantile(c, p);
+      lo = (std::min)(lo, q);
+      hi = (std::max)(hi, q);
+      guess += dist.weights()[i] * q;
+   }
+   if ((lo == hi) || (p == 0) || (p == 1))
+   {
+      return (comp ? p == 0 : p == 1) ? hi : lo;
+   }
+   guess = (std::min)((std::max)(guess, lo), hi);
+   std::uintmax_t max_iter = policies::get_max_root_iterations<policy_type>();
+   mixture_quantile_functor<Distribution> f(dist, p, comp);
+   result = tools::newton_raphson_iterate(f, guess, lo, hi, policies::digits<value_type, policy_type>(), max_iter);
+   if (max_iter >= policies::get_max_root_iterations<policy_type>())
+   {
+      return policies::raise_evaluation_error<value_type>(function, "Unable to locate solution in a reasonable time: either there is no answer to the quantile or the answer is infinite. Current best guess is %1%", result, policy_type()); // LCOV_EXCL_LINE
+   }
+   return result;
+}
+
+// The raw moments E[X], E[X^2], E[X^3] and E[X^4] of the mixture, up to order n:
+template <class Distribution>
+void mixture_raw_moments(const mixture_distribution<Distribution>& dist, int n, typename Distribution::value_type* m)
+{
+   typedef typename Distribution::value_type value_type;
+   for (int k = 0; k < 4; ++k)
+   {
+      m[k] = 0;
+   }
+   for (std::size_t i = 0; i < dist.num_components(); ++i)
+   {
+      const Distribution& c = dist.components()[i];
+      const value_type w = dist.weights()[i];
+      const value_type mu = mean(c);
+      m[0] += w * mu;
+      if (n < 2)
+         continue;
+      const value_type var = variance(c);
+      m[1] += w * (mu * mu + var);
+      if (n < 3)
+         continue;
+      const value_type s3 = skewness(c) * var * standard_deviation(c);
+      m[2] += w * (mu * mu * mu + 3 * mu * var + s3);
+      if (n < 4)
+         continue;
+      m[3] += w * (mu * mu * mu * mu + 6 * mu * mu * var + 4 * mu * s3 + kurtosis(c) * var * var);
+   }
+}
+
+} // namespace detail
+
+template <class Distribution>
+typename Distribution::value_type pdf(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x)
+{
+   BOOST_MATH_STD_USING
+   typename Distribution::value_type result = 0;
+   if (!detail::mixture_check_x("boost::math::pdf(const boost::math::mixture_distribution<%1%>&, %1%)", dist, x, &result))
+   {
+      return result;
+   }
+   std::vector<typename Distribution::value_type> terms;
+   return exp(detail::mixture_logpdf_imp(dist, x, terms));
+}
+
+template <class Distribution>
+typename Distribution::value_type logpdf(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x)
+{
+   typename Distribution::value_type result = 0;
+   if (!detail::mixture_check_x("boost::math::logpdf(const boost::math::mixture_distribution<%1%>&, %1%)", dist, x, &result))
+   {
+      return result;
+   }
+   std::vector<typename Distribution::value_type> terms;
+   return detail::mixture_logpdf_imp(dist, x, terms);
+}
+
+template <class Distribution>
+typename Distribution::value_type cdf(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x)
+{
+   typename Distribution::value_type result = 0;
+   if (!detail::mixture_check_x("boost::math::cdf(const boost::math::mixture_distribution<%1%>&, %1%)", dist, x, &result))
+   {
+      return result;
+   }
+   return detail::mixture_cdf_imp(dist, x, false);
+}
+
+template <class Distribution>
+typename Distribution::value_type cdf(const complemented2_type<mixture_distribution<Distribution>, typename Distribution::value_type>& c)
+{
+   typename Distribution::value_type result = 0;
+   if (!detail::mixture_check_x("boost::math::cdf(const boost::math::complemented2_type<boost::math::mixture_distribution<%1%>, %1%>&)", c.dist, c.param, &result))
+   {
+      return result;
+   }
+   return detail::mixture_cdf_imp(c.dist, c.param, true);
+}
+
+template <class Distribution>
+typename Distribution::value_type logcdf(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& x)
+{
+   typename Distribution::value_type result = 0;
+   if (!detail::mixture_check_x("boost::math::logcdf(const boost::math::mixture_distribution<%1%>&, %1%)", dist, x, &result))
+   {
+      return result;
+   }
+   return detail::mixture_logcdf_imp(dist, x, false);
+}
+
+template <class Distribution>
+typename Distribution::value_type logcdf(const complemented2_type<mixture_distribution<Distribution>, typename Distribution::value_type>& c)
+{
+   typename Distribution::value_type result = 0;
+   if (!detail::mixture_check_x("boost::math::logcdf(const boost::math::complemented2_type<boost::math::mixture_distribution<%1%>, %1%>&)", c.dist, c.param, &result))
+   {
+      return result;
+   }
+   return detail::mixture_logcdf_imp(c.dist, c.param, true);
+}
+
+template <class Distribution>
+typename Distribution::value_type quantile(const mixture_distribution<Distribution>& dist, const typename Distribution::value_type& p)
+{
+   return detail::mixture_quantile_imp(dist, p, false);
+}
+
+template <class Distribution>
+typename Distribution::value_type quantile(const complemented2_type<mixture_distribution<Distribution>, typename Distribution::value_type>& c)
+{
+   return detail::mixture_quantile_imp(c.dist, c.param, true);
+}
+
+//
+// Batched evaluation, which reuses one buffer for the log densities of the components:
+//
+template <class Distribution, class ForwardIterator, class OutputIterator>
+OutputIterator pdf(const mixture_distribution<Distribution>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   BOOST_MATH_STD_USING
+   typedef typename Distribution::value_type value_type;
+   std::vector<value_type> terms(dist.num_components());
+   for (; first != last; ++first)
+   {
+      value_type x = *first;
+      value_type result = 0;
+      if (detail::mixture_check_x("boost::math::pdf(const boost::math::mixture_distribution<%1%>&, %1%)", dist, x, &result))
+      {
+         result = exp(detail::mixture_logpdf_imp(dist, x, terms));
+      }
+      *out++ = result;
+   }
+   return out;
+}
+
+template <class Distribution, class ForwardIterator, class OutputIterator>
+OutputIterator logpdf(const mixture_distribution<Distribution>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   typedef typename Distribution::value_type value_type;
+   std::vector<value_type> terms(dist.num_components());
+   for (; first != last; ++first)
+   {
+      value_type x = *first;
+      value_type result = 0;
+      if (detail::mixture_check_x("boost::math::logpdf(const boost::math::mixture_distribution<%1%>&, %1%)", dist, x, &result))
+      {
+         result = detail::mixture_logpdf_imp(dist, x, terms);
+      }
+      *out++ = result;
+   }
+   return out;
+}
+
+template <class Distribution, class ForwardIterator, class OutputIterator>
+OutputIterator cdf(const mixture_distribution<Distribution>& dist, ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   for (; first != last; ++first)
+   {
+      *out++ = cdf(dist, static_cast<typename Distribution::value_type>(*first));
+   }
+   return out;
+}
+
+template <class Distribution>
+typename Distribution::value_type mean(const mixture_distribution<Distribution>& dist)
+{
+   typename Distribution::value_type m[4];
+   detail::mixture_raw_moments(dist, 1, m);
+   return m[0];
+}
+
+template <class Distribution>
+typename Distribution::value_type variance(const mixture_distribution<Distribution>& dist)
+{
+   typename Distribution::value_type m[4];
+   detail::mixture_raw_moments(dist, 2, m);
+   return m[1] - m[0] * m[0];
+}
+
+template <class Distribution>
+typename Distribution::value_type skewness(const mixture_distribution<Distribution>& dist)
+{
+   BOOST_MATH_STD_USING
+   typedef typename Distribution::value_type value_type;
+   value_type m[4];
+   detail::mixture_raw_moments(dist, 3, m);
+   const value_type var = m[1] - m[0] * m[0];
+   return (m[2] - 3 * m[0] * m[1] + 2 * m[0] * m[0] * m[0]) / (var * sqrt(var));
+}
+
+template <class Distribution>
+typename Distribution::value_type kurtosis(const mixture_distribution<Distribution>& dist)
+{
+   typedef typename Distribution::value_type value_type;
+   value_type m[4];
+   detail::mixture_raw_moments(dist, 4, m);
+   const value_type mu = m[0];
+   const value_type var = m[1] - mu * mu;
+   return (m[3] - 4 * mu * m[2] + 6 * mu * mu * m[1] - 3 * mu * mu * mu * mu) / (var * var);
+}
+
+template <class Distribution>
+typename Distribution::value_type kurtosis_excess(const mixture_distribution<Distribution>& dist)
+{
+   return kurtosis(dist) - 3;
+}
+
+//
+// Refits the weights of a mixture to data by expectation maximization, keeping the components fixed.
+// Each iteration gives every observation to the components in proportion to their weighted densities
+// there, and takes the new weights to be the average of those responsibilities; the log likelihood
+// never decreases.  The iteration stops once the log likelihood changes by less than tolerance times
+// its magnitude, or after max_iter iterations, and max_iter is set to the number of iterations taken.
+//
+template <class Distribution, class ForwardIterator>
+mixture_distribution<Distribution> fit_weights(const mixture_distribution<Distribution>& initial, ForwardIterator first, ForwardIterator last,
+   typename Distribution::value_type tolerance, std::uintmax_t& max_iter)
+{
+   BOOST_MATH_STD_USING
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+   static const char* function = "boost::math::fit_weights(const boost::math::mixture_distribution<%1%>&, ...)";
+   const std::vector<value_type> x(first, last);
+   const std::size_t n = x.size();
+   const std::size_t k = initial.num_components();
+   if (n == 0)
+   {
+      policies::raise_domain_error<value_type>(function, "At least one observation is required to fit the weights, but got %1%.", value_type(0), policy_type());
+      return initial;
+   }
+   // The component densities relative to the largest in each row do not change from one iteration to
+   // the next, so are kept when they fit in a modest amount of memory:
+   const mixture_distribution<Distribution> unweighted(std::vector<value_type>(k, value_type(1)), initial.components());
+   const bool cached = n * k <= (std::size_t(1) << 22);
+   std::vector<value_type> density(cached ? n * k : k);
+   std::vector<value_type> row_max(n);
+   auto fill_row = [&](std::size_t i, value_type* d)
+   {
+      unweighted.log_terms(x[i], d);
+      value_type m = *std::max_element(d, d + k);
+      if (m == -std::numeric_limits<value_type>::infinity())
+      {
+         return false;
+      }
+      for (std::size_t j = 0; j < k; ++j)
+      {
+         d[j] = exp(d[j] - m);
+      }
+      row_max[i] = m;
+      return true;
+   };
+   if (cached)
+   {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         if (!fill_row(i, density.data() + i * k))
+         {
+            policies::raise_domain_error<value_type>(function, "The observation %1% has zero density under every component.", x[i], policy_type());
+            return initial;
+         }
+      }
+   }
+
+   std::vector<value_type> w(initial.weights());
+   std::vector<value_type> next(k);
+   value_type last_ll = -std::numeric_limits<value_type>::infinity();
+   std::uintmax_t iter = 0;
+   while (iter < max_iter)
+   {
+      ++iter;
+      std::fill(next.begin(), next.end(), value_type(0));
+      value_type ll = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         value_type* d = cached ? density.data() + i * k : density.data();
+         if (!cached && !fill_row(i, d))
+         {
+            policies::raise_domain_error<value_type>(function, "The observation %1% has zero density under every component.", x[i], policy_type());
+            return initial;
+         }
+         value_type s = 0;
+         for (std::size_t j = 0; j < k; ++j)
+         {
+            s += w[j] * d[j];
+         }
+         if (!(s > 0))
+         {
+            policies::raise_domain_error<value_type>(function, "The observation %1% has zero density under the current weights.", x[i], policy_type());
+            return initial;
+         }
+         ll += row_max[i] + log(s);
+         const value_type inv = 1 / s;
+         for (std::size_t j = 0; j < k; ++j)
+         {
+            next[j] += w[j] * d[j] * inv;
+         }
+      }
+      for (std::size_t j = 0; j < k; ++j)
+      {
+         w[j] = next[j] / n;
+      }
+      if (fabs(ll - last_ll) <= tolerance * fabs(ll))
+      {
+         break;
+      }
+      last_ll = ll;
+   }
+   max_iter = iter;
+   return mixture_distribution<Distribution>(w, initial.components());
+}
+
+template <class Distribution, class ForwardIterator>
+inline mixture_distribution<Distribution> fit_weights(const mixture_distribution<Distribution>& initial, ForwardIterator first, ForwardIterator last)
+{
+   BOOST_MATH_STD_USING
+   std::uintmax_t max_iter = policies::get_max_root_iterations<typename Distribution::policy_type>();
+   return fit_weights(initial, first, last, sqrt(tools::epsilon<typename Distribution::value_type>()), max_iter);
+}
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_MIXTURE_HPP
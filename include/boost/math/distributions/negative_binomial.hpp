@@ -55,6 +55,7 @@
 #include <boost/math/special_functions/fpclassify.hpp> // isnan.
 #include <boost/math/tools/roots.hpp> // for root finding.
 #include <boost/math/distributions/detail/inv_discrete_quantile.hpp>
+#include <boost/math/distributions/detail/log_incomplete.hpp> // logpdf and logcdf.
 #include <boost/math/policies/error_handling.hpp>
 
 #if defined (BOOST_MSVC)
@@ -362,6 +363,42 @@ namespace boost
       return result;
     } // negative_binomial_pdf
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED inline RealType logpdf(const negative_binomial_distribution<RealType, Policy>& dist, const RealType& k)
+    { // Log of the Probability Density/Mass Function.
+      BOOST_FPU_EXCEPTION_GUARD
+      BOOST_MATH_STD_USING // for ADL of std functions.
+
+      constexpr auto function = "boost::math::logpdf(const negative_binomial_distribution<%1%>&, %1%)";
+
+      RealType r = dist.successes();
+      RealType p = dist.success_fraction();
+      RealType result = 0;
+      if(false == negative_binomial_detail::check_dist_and_k(
+        function,
+        r,
+        p,
+        k,
+        &result, Policy()))
+      {
+        return result;
+      }
+
+      if(k == 0)
+      { // pdf = p^r
+        return r * log(p);
+      }
+      // The pdf is accurate wherever it has not underflowed, beyond that work in logs:
+      result = (p/(r + k)) * ibeta_derivative(r, static_cast<RealType>(k+1), p, Policy());
+      if(result > detail::log_space_threshold<RealType>())
+      {
+        return log(result);
+      }
+      // lgamma(r + k) - lgamma(r) - lgamma(k+1) = -log(r + k) - log(beta(r, k+1))
+      return r * log(p) + k * boost::math::log1p(-p, Policy())
+        - log(r + k) - detail::log_beta(r, static_cast<RealType>(k+1), Policy());
+    } // negative_binomial_logpdf
+
     template <class RealType, class Policy>
     BOOST_MATH_GPU_ENABLED inline RealType cdf(const negative_binomial_distribution<RealType, Policy>& dist, const RealType& k)
     { // Cumulative Distribution Function of Negative Binomial.
@@ -388,6 +425,27 @@ namespace boost
       return probability;
     } // cdf Cumulative Distribution Function Negative Binomial.
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED inline RealType logcdf(const negative_binomial_distribution<RealType, Policy>& dist, const RealType& k)
+    { // Log of the Cumulative Distribution Function of Negative Binomial.
+      constexpr auto function = "boost::math::logcdf(const negative_binomial_distribution<%1%>&, %1%)";
+      RealType p = dist.success_fraction();
+      RealType r = dist.successes();
+      // Error check:
+      RealType result = 0;
+      if(false == negative_binomial_detail::check_dist_and_k(
+        function,
+        r,
+        p,
+        k,
+        &result, Policy()))
+      {
+        return result;
+      }
+      // log(Ip(r, k+1))
+      return detail::log_ibeta(r, static_cast<RealType>(k+1), p, RealType(1 - p), false, Policy());
+    } // logcdf Cumulative Distribution Function Negative Binomial.
+
       template <class RealType, class Policy>
       BOOST_MATH_GPU_ENABLED inline RealType cdf(const complemented2_type<negative_binomial_distribution<RealType, Policy>, RealType>& c)
       { // Complemented Cumulative Distribution Function Negative Binomial.
@@ -422,6 +480,29 @@ namespace boost
       return probability;
     } // cdf Cumulative Distribution Function Negative Binomial.
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED inline RealType logcdf(const complemented2_type<negative_binomial_distribution<RealType, Policy>, RealType>& c)
+    { // Log of the Complemented Cumulative Distribution Function Negative Binomial.
+      constexpr auto function = "boost::math::logcdf(const negative_binomial_distribution<%1%>&, %1%)";
+      RealType const& k = c.param;
+      negative_binomial_distribution<RealType, Policy> const& dist = c.dist;
+      RealType p = dist.success_fraction();
+      RealType r = dist.successes();
+      // Error check:
+      RealType result = 0;
+      if(false == negative_binomial_detail::check_dist_and_k(
+        function,
+        r,
+        p,
+        k,
+        &result, Policy()))
+      {
+        return result;
+      }
+      // log(ibetac(r, k+1, p))
+      return detail::log_ibeta(r, static_cast<RealType>(k+1), p, RealType(1 - p), true, Policy());
+    } // logcdf Complemented Cumulative Distribution Function Negative Binomial.
+
     template <class RealType, class Policy>
     BOOST_MATH_GPU_ENABLED inline RealType quantile(const negative_binomial_distribution<RealType, Policy>& dist, const RealType& P)
     { // Quantile, percentile/100 or Percent Point Negative Binomial function.
@@ -0,0 +1,1264 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_NON_CENTRAL_TABLE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_NON_CENTRAL_TABLE_HPP
+
+//
+// The non-central chi squared, beta, F and t distributions are all Poisson weighted
+// sums of central distributions, evaluated by recurrence outwards from the mode of
+// the weights.  The weights, and the ratios of gamma functions that step the central
+// terms from one index to the next, depend only on the parameters of the distribution
+// and not on x.  non_central_table computes them once, over the window of indexes in
+// which the weights are representable, so that each evaluation is left with the
+// central functions at the starting index and a loop of multiplications.  The series
+// themselves are those of the distributions, term for term.
+//
+
+#include <cstddef>
+#include <vector>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <boost/math/distributions/non_central_beta.hpp>
+#include <boost/math/distributions/non_central_f.hpp>
+#include <boost/math/distributions/non_central_t.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/round.hpp>
+#include <boost/math/special_functions/trunc.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math {
+
+namespace detail {
+
+// The Poisson weights e^-l l^i / i!, for the indexes i at which they are no smaller than the
+// smallest normal value, built by recurrence outwards from the mode as the series do.  Anything
+// outside the window reads as zero.
+template <class T>
+class poisson_weight_table
+{
+public:
+   poisson_weight_table() : m_first(0) {}
+
+   template <class Policy>
+   bool init(T l, std::size_t max_entries, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      const T tiny = tools::min_value<T>();
+      // The window is wider than sqrt(l), so there is no point in looking when that is too many:
+      if (!(l > 0) || (l / static_cast<T>(max_entries) > static_cast<T>(max_entries)))
+      {
+         return false;
+      }
+      const long long mode = lltrunc(l, pol);
+      const T peak = gamma_p_derivative(static_cast<T>(mode + 1), l, pol);
+      if (!(peak >= tiny))
+      {
+         return false;
+      }
+      std::vector<T> below;
+      T w = peak;
+      for (long long i = mode; i > 0; --i)
+      {
+         w *= i / l;
+         if (w < tiny)
+         {
+            break;
+         }
+         below.push_back(w);
+         if (below.size() > max_entries)
+         {
+            return false;
+         }
+      }
+      m_first = mode - static_cast<long long>(below.size());
+      m_w.assign(below.rbegin(), below.rend());
+      w = peak;
+      for (long long i = mode; w >= tiny; ++i)
+      {
+         m_w.push_back(w);
+         if (m_w.size() > max_entries)
+         {
+            return false;
+         }
+         w *= l / (i + 1);
+      }
+      return true;
+   }
+
+   T operator()(long long i) const
+   {
+      const unsigned long long j = static_cast<unsigned long long>(i - m_first);
+      return j < m_w.size() ? m_w[static_cast<std::size_t>(j)] : T(0);
+   }
+
+   long long first() const
+   {
+      return m_first;
+   }
+
+   long long last() const
+   {
+      return m_first + static_cast<long long>(m_w.size()) - 1;
+   }
+
+   const std::vector<T>& values() const
+   {
+      return m_w;
+   }
+
+private:
+   long long m_first;
+   std::vector<T> m_w;
+};
+
+// A table of f(i) for i in [0, n), falling back to f itself beyond the end:
+template <class T, class F>
+inline void fill_ratio_table(std::vector<T>& table, long long n, F f)
+{
+   table.resize(static_cast<std::size_t>(n));
+   for (long long i = 0; i < n; ++i)
+   {
+      table[static_cast<std::size_t>(i)] = f(i);
+   }
+}
+
+template <class T>
+inline bool in_table(const std::vector<T>& table, long long i)
+{
+   return static_cast<unsigned long long>(i) < table.size();
+}
+
+//
+// The series of non_central_chi_square_q, non_central_chi_square_p_ding, non_central_chi_square_p
+// and non_central_chi_square_pdf with a = n/2 + j, where every division by a + i or by the Poisson
+// recurrence's i becomes a multiplication by a tabulated reciprocal or weight.
+//
+template <class T, class Policy>
+class non_central_chi_squared_series
+{
+public:
+   bool init(T n, T lambda, std::size_t max_entries, const Policy& pol)
+   {
+      m_n = n;
+      m_lambda = lambda;
+      m_n2 = n / 2;
+      if (!m_weights.init(T(lambda / 2), max_entries, pol))
+      {
+         return false;
+      }
+      const T n2 = m_n2;
+      fill_ratio_table(m_recip, m_weights.last() + 2, [n2](long long j) { return 1 / (n2 + j); });
+      if (lambda < 200)
+      {
+         // Ding's method runs over the cumulative weights from zero:
+         T v = 0;
+         fill_ratio_table(m_cumulative, m_weights.last() + 1, [&](long long i) { v += m_weights(i); return v; });
+      }
+      return true;
+   }
+
+   // The complement of the cdf, plus init_sum:
+   T q(T x, T init_sum, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      if (x == 0)
+         return 1;
+      const T lambda = m_lambda / 2;
+      const T del = m_n2;
+      const T y = x / 2;
+      const T inv_y = 1 / y;
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      T sum = init_sum;
+      const long long k = llround(lambda, pol);
+      T gamf = boost::math::gamma_q(del + k, y, pol);
+      T xtermf = boost::math::gamma_p_derivative(del + 1 + k, y, pol);
+      T xtermb = xtermf * (del + k) * inv_y;
+      T gamb = gamf - xtermb;
+
+      // Forwards, the stable direction for the gamma recurrence:
+      long long i;
+      for (i = k; static_cast<boost::math::uintmax_t>(i - k) < max_iter; ++i)
+      {
+         T term = m_weights(i) * gamf;
+         sum += term;
+         gamf += xtermf;
+         xtermf *= y * recip(i + 1);
+         if (((sum == 0) || (fabs(term / sum) < errtol)) && (term >= m_weights(i + 1) * gamf))
+            break;
+      }
+      if (static_cast<boost::math::uintmax_t>(i - k) >= max_iter)
+         return policies::raise_evaluation_error("cdf(non_central_chi_squared_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+      // Backwards, where the terms must shrink faster than cancellation grows:
+      for (i = k - 1; i >= 0; --i)
+      {
+         T term = m_weights(i) * gamb;
+         sum += term;
+         xtermb *= (del + i) * inv_y;
+         gamb -= xtermb;
+         if ((sum == 0) || (fabs(term / sum) < errtol))
+            break;
+      }
+      return sum;
+   }
+
+   // Ding's forward recurrence for the cdf when the non-centrality is small:
+   T p_ding(T x, T init_sum, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      if (x == 0)
+         return 0;
+      const T x2 = x / 2;
+      T tk = boost::math::gamma_p_derivative(m_n2 + 1, x2, pol);
+      T sum = init_sum + tk * cumulative(0);
+      if (sum == 0)
+         return sum;
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      int i;
+      T lterm(0), term(0);
+      for (i = 1; static_cast<boost::math::uintmax_t>(i) < max_iter; ++i)
+      {
+         tk *= x2 * recip(i);
+         lterm = term;
+         term = cumulative(i) * tk;
+         sum += term;
+         if ((fabs(term / sum) < errtol) && (term <= lterm))
+            break;
+      }
+      if (static_cast<boost::math::uintmax_t>(i) >= max_iter)
+         return policies::raise_evaluation_error("cdf(non_central_chi_squared_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+      return sum;
+   }
+
+   // Krishnamoorthy's recurrence for the cdf, starting after the largest term:
+   T p(T y, T init_sum, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      if (y == 0)
+         return 0;
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      T errorf(0), errorb(0);
+      const T x = y / 2;
+      const T inv_x = 1 / x;
+      const long long k = llround(T(m_lambda / 2), pol);
+      const T a = m_n2 + k;
+      T gamkf = boost::math::gamma_p(a, x, pol);
+      T gamkb = gamkf;
+      T xtermf = boost::math::gamma_p_derivative(a, x, pol);
+      T xtermb = xtermf * x / a;
+      T sum = init_sum + m_weights(k) * gamkf;
+      if (sum == 0)
+         return sum;
+      // Backwards, the stable direction for the gamma recurrence:
+      int i = 1;
+      while (i <= k)
+      {
+         xtermb *= (a - i + 1) * inv_x;
+         gamkb += xtermb;
+         errorf = errorb;
+         errorb = gamkb * m_weights(k - i);
+         sum += errorb;
+         if ((fabs(errorb / sum) < errtol) && (errorb <= errorf))
+            break;
+         ++i;
+      }
+      // Forwards, where the terms must shrink faster than cancellation grows:
+      i = 1;
+      do
+      {
+         xtermf *= x * recip(k + i - 1);
+         gamkf -= xtermf;
+         errorf = m_weights(k + i) * gamkf;
+         sum += errorf;
+         ++i;
+      } while ((fabs(errorf / sum) > errtol) && (static_cast<boost::math::uintmax_t>(i) < max_iter));
+      if (static_cast<boost::math::uintmax_t>(i) >= max_iter)
+         return policies::raise_evaluation_error("cdf(non_central_chi_squared_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+      return sum;
+   }
+
+   // The series for the pdf, as a sum of weights times central densities:
+   T pdf(T x, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      const T x2 = x / 2;
+      const T inv_x2 = 1 / x2;
+      T sum = 0;
+      const long long k = lltrunc(T(m_lambda / 2));
+      const T density = gamma_p_derivative(static_cast<T>(m_n2 + k), x2, pol);
+      T pois = m_weights(k) * density;
+      if (pois == 0)
+         return 0;
+      T g = density;
+      for (long long i = k; ; ++i)
+      {
+         sum += pois;
+         if (pois / sum < errtol)
+            break;
+         if (static_cast<boost::math::uintmax_t>(i - k) >= max_iter)
+            return policies::raise_evaluation_error("pdf(non_central_chi_squared_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+         g *= x2 * recip(i);
+         pois = m_weights(i + 1) * g;
+      }
+      g = density;
+      for (long long i = k - 1; i >= 0; --i)
+      {
+         g *= (m_n2 + i) * inv_x2;
+         T poisb = m_weights(i) * g;
+         sum += poisb;
+         if (poisb / sum < errtol)
+            break;
+      }
+      return sum / 2;
+   }
+
+   // As non_central_chi_squared_cdf:
+   T cdf(T x, bool invert, const Policy& pol) const
+   {
+      T result;
+      if (x > m_n + m_lambda)
+      {
+         result = q(x, static_cast<T>(invert ? 0 : -1), pol);
+         invert = !invert;
+      }
+      else if (m_lambda < 200)
+      {
+         result = p_ding(x, static_cast<T>(invert ? -1 : 0), pol);
+      }
+      else
+      {
+         result = p(x, static_cast<T>(invert ? -1 : 0), pol);
+      }
+      return invert ? T(-result) : result;
+   }
+
+private:
+   T recip(long long j) const
+   {
+      return in_table(m_recip, j) ? m_recip[static_cast<std::size_t>(j)] : T(1 / (m_n2 + j));
+   }
+
+   T cumulative(long long i) const
+   {
+      return in_table(m_cumulative, i) ? m_cumulative[static_cast<std::size_t>(i)] : (m_cumulative.empty() ? T(0) : m_cumulative.back());
+   }
+
+   T m_n;
+   T m_lambda;
+   T m_n2;
+   poisson_weight_table<T> m_weights;
+   // 1 / (n/2 + j):
+   std::vector<T> m_recip;
+   // The sum of the weights up to i, when lambda < 200:
+   std::vector<T> m_cumulative;
+};
+
+//
+// The series of non_central_beta_p, non_central_beta_q and non_central_beta_pdf with the
+// ratios (a + i - 1) / (a + b + i - 2) and (a + i - 1) / (a + b + i - 1) that step the
+// incomplete beta and its derivative from one index to the next tabulated along with
+// their reciprocals.
+//
+template <class T, class Policy>
+class non_central_beta_series
+{
+public:
+   bool init(T a, T b, T lambda, std::size_t max_entries, const Policy& pol)
+   {
+      m_a = a;
+      m_b = b;
+      m_lambda = lambda;
+      m_l2 = lambda / 2;
+      if (!m_weights.init(m_l2, max_entries, pol))
+      {
+         return false;
+      }
+      const long long n = m_weights.last() + 2;
+      fill_ratio_table(m_down, n, [a, b](long long i) { return down_ratio(a, b, i); });
+      fill_ratio_table(m_up, n, [a, b](long long i) { return up_ratio(a, b, i); });
+      fill_ratio_table(m_pdf_down, n, [a, b](long long i) { return pdf_down_ratio(a, b, i); });
+      fill_ratio_table(m_pdf_up, n, [a, b](long long i) { return pdf_up_ratio(a, b, i); });
+      return true;
+   }
+
+   const poisson_weight_table<T>& weights() const
+   {
+      return m_weights;
+   }
+
+   T a() const
+   {
+      return m_a;
+   }
+
+   T b() const
+   {
+      return m_b;
+   }
+
+   T non_centrality() const
+   {
+      return m_lambda;
+   }
+
+   T p(T x, T y, T init_val, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      const T a = m_a;
+      const T b = m_b;
+      const T inv_x = 1 / x;
+      long long k = lltrunc(m_l2);
+      if (k == 0)
+         k = 1;
+      T pois = m_weights(k);
+      if (pois == 0)
+         return init_val;
+      T xterm;
+      T beta = x < y
+         ? detail::ibeta_imp(T(a + k), b, x, pol, false, true, &xterm)
+         : detail::ibeta_imp(b, T(a + k), y, pol, true, true, &xterm);
+      while (fabs(beta * pois) < tools::min_value<T>())
+      {
+         // Bisecting towards zero from below the window can only make the weight smaller:
+         if ((k == 0) || ((pois == 0) && (k < m_weights.first())))
+            return init_val;
+         k /= 2;
+         pois = m_weights(k);
+         beta = x < y
+            ? detail::ibeta_imp(T(a + k), b, x, pol, false, true, &xterm)
+            : detail::ibeta_imp(b, T(a + k), y, pol, true, true, &xterm);
+      }
+      xterm *= y / (a + b + k - 1);
+      T betaf(beta), xtermf(xterm);
+      T sum = init_val;
+      if ((beta == 0) && (xterm == 0))
+         return init_val;
+      // Backwards, the stable direction:
+      T last_term = 0;
+      boost::math::uintmax_t count = k;
+      for (auto i = k; i >= 0; --i)
+      {
+         T term = beta * m_weights(i);
+         sum += term;
+         if (((fabs(term / sum) < errtol) && (fabs(last_term) >= fabs(term))) || (term == 0))
+         {
+            count = k - i;
+            break;
+         }
+         beta += xterm;
+         if (a + b + i != 2)
+         {
+            xterm *= down(i) * inv_x;
+         }
+         last_term = term;
+      }
+      last_term = 0;
+      for (auto i = k + 1; ; ++i)
+      {
+         xtermf *= x * up(i);
+         betaf -= xtermf;
+         T term = m_weights(i) * betaf;
+         sum += term;
+         if (((fabs(term / sum) < errtol) && (fabs(last_term) >= fabs(term))) || (term == 0))
+         {
+            break;
+         }
+         last_term = term;
+         if (static_cast<boost::math::uintmax_t>(count + i - k) > max_iter)
+         {
+            return policies::raise_evaluation_error("cdf(non_central_beta_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+         }
+      }
+      return sum;
+   }
+
+   T q(T x, T y, T init_val, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      const T a = m_a;
+      const T b = m_b;
+      const T inv_x = 1 / x;
+      long long k = lltrunc(m_l2);
+      if (k <= 30)
+      {
+         if (a + b > 1)
+            k = 0;
+         else if (k == 0)
+            k = 1;
+      }
+      T pois = m_weights(k);
+      if (pois == 0)
+         return init_val;
+      T xterm;
+      T beta = x < y
+         ? detail::ibeta_imp(T(a + k), b, x, pol, true, true, &xterm)
+         : detail::ibeta_imp(b, T(a + k), y, pol, false, true, &xterm);
+      xterm *= y / (a + b + k - 1);
+      T betaf(beta), xtermf(xterm);
+      T sum = init_val;
+      if ((beta == 0) && (xterm == 0))
+         return init_val;
+      // Forwards, the stable direction and the location of the bulk of the sum:
+      T last_term = 0;
+      boost::math::uintmax_t count = 0;
+      for (auto i = k + 1; ; ++i)
+      {
+         xtermf *= x * up(i);
+         betaf += xtermf;
+         T term = m_weights(i) * betaf;
+         sum += term;
+         if ((fabs(term / sum) < errtol) && (last_term >= term))
+         {
+            count = i - k;
+            break;
+         }
+         if (static_cast<boost::math::uintmax_t>(i - k) > max_iter)
+         {
+            return policies::raise_evaluation_error("cdf(non_central_beta_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+         }
+         last_term = term;
+      }
+      for (auto i = k; i >= 0; --i)
+      {
+         T term = beta * m_weights(i);
+         sum += term;
+         if (fabs(term / sum) < errtol)
+         {
+            break;
+         }
+         if (static_cast<boost::math::uintmax_t>(count + k - i) > max_iter)
+         {
+            return policies::raise_evaluation_error("cdf(non_central_beta_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+         }
+         beta -= xterm;
+         if (a + b + i - 2 != 0)
+         {
+            xterm *= down(i) * inv_x;
+         }
+      }
+      return sum;
+   }
+
+   T pdf(T x, T y, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      if ((x == 0) || (y == 0))
+         return 0;
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      const T a = m_a;
+      const T b = m_b;
+      const T inv_x = 1 / x;
+      long long k = lltrunc(m_l2);
+      T pois = m_weights(k);
+      T beta = x < y
+         ? ibeta_derivative(a + k, b, x, pol)
+         : ibeta_derivative(b, a + k, y, pol);
+      while (fabs(beta * pois) < tools::min_value<T>())
+      {
+         if ((k == 0) || ((pois == 0) && (k < m_weights.first())))
+            return 0;
+         k /= 2;
+         pois = m_weights(k);
+         beta = x < y
+            ? ibeta_derivative(a + k, b, x, pol)
+            : ibeta_derivative(b, a + k, y, pol);
+      }
+      T sum = 0;
+      T betaf(beta);
+      // Backwards, the stable direction; as in non_central_beta_pdf this only stops on a zero term:
+      boost::math::uintmax_t count = k;
+      for (auto i = k; i >= 0; --i)
+      {
+         T term = beta * m_weights(i);
+         sum += term;
+         if (term == 0)
+         {
+            count = k - i;
+            break;
+         }
+         if (a + b + i != 1)
+         {
+            beta *= pdf_down(i) * inv_x;
+         }
+      }
+      T old_ratio = 0;
+      for (auto i = k + 1; ; ++i)
+      {
+         betaf *= x * pdf_up(i);
+         T term = m_weights(i) * betaf;
+         sum += term;
+         T ratio = fabs(term / sum);
+         if (((ratio < errtol) && (ratio < old_ratio)) || (term == 0))
+         {
+            break;
+         }
+         old_ratio = ratio;
+         if (static_cast<boost::math::uintmax_t>(count + i - k) > max_iter)
+         {
+            return policies::raise_evaluation_error("pdf(non_central_beta_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+         }
+      }
+      return sum;
+   }
+
+   // As non_central_beta_cdf:
+   T cdf(T x, T y, bool invert, const Policy& pol) const
+   {
+      if (x == 0)
+         return invert ? T(1) : T(0);
+      if (y == 0)
+         return invert ? T(0) : T(1);
+      const T c = m_a + m_b + m_lambda / 2;
+      const T cross = 1 - (m_b / c) * (1 + m_lambda / (2 * c * c));
+      T result;
+      if (x > cross)
+      {
+         result = q(x, y, static_cast<T>(invert ? 0 : -1), pol);
+         invert = !invert;
+      }
+      else
+      {
+         result = p(x, y, static_cast<T>(invert ? -1 : 0), pol);
+      }
+      return invert ? T(-result) : result;
+   }
+
+private:
+   static T down_ratio(T a, T b, long long i)
+   {
+      return (a + b + i - 2 != 0) ? T((a + i - 1) / (a + b + i - 2)) : T(0);
+   }
+
+   static T up_ratio(T a, T b, long long i)
+   {
+      return (a + b + i - 2) / (a + i - 1);
+   }
+
+   static T pdf_down_ratio(T a, T b, long long i)
+   {
+      return (a + b + i - 1 != 0) ? T((a + i - 1) / (a + i + b - 1)) : T(0);
+   }
+
+   static T pdf_up_ratio(T a, T b, long long i)
+   {
+      return (a + b + i - 1) / (a + i - 1);
+   }
+
+   T down(long long i) const
+   {
+      return in_table(m_down, i) ? m_down[static_cast<std::size_t>(i)] : down_ratio(m_a, m_b, i);
+   }
+
+   T up(long long i) const
+   {
+      return in_table(m_up, i) ? m_up[static_cast<std::size_t>(i)] : up_ratio(m_a, m_b, i);
+   }
+
+   T pdf_down(long long i) const
+   {
+      return in_table(m_pdf_down, i) ? m_pdf_down[static_cast<std::size_t>(i)] : pdf_down_ratio(m_a, m_b, i);
+   }
+
+   T pdf_up(long long i) const
+   {
+      return in_table(m_pdf_up, i) ? m_pdf_up[static_cast<std::size_t>(i)] : pdf_up_ratio(m_a, m_b, i);
+   }
+
+   T m_a;
+   T m_b;
+   T m_lambda;
+   T m_l2;
+   poisson_weight_table<T> m_weights;
+   std::vector<T> m_down;
+   std::vector<T> m_up;
+   std::vector<T> m_pdf_down;
+   std::vector<T> m_pdf_up;
+};
+
+//
+// The half-integer series of non_central_t2_p and non_central_t2_q, whose weights
+// e^-d d^i / Gamma(i + 3/2) |delta| / sqrt(2), with d = delta^2 / 2, share the window
+// of the Poisson weights of the beta series.  The sign of delta is applied per call,
+// since the reflection for t < 0 changes it.
+//
+template <class T, class Policy>
+class non_central_t2_series
+{
+public:
+   bool init(T v, T delta, const poisson_weight_table<T>& weights, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      m_v = v;
+      m_v2 = v / 2;
+      const T d2 = delta * delta / 2;
+      m_first = weights.first();
+      const long long mode = lltrunc(d2);
+      const std::size_t n = weights.values().size();
+      m_h.resize(n);
+      const T peak = weights(mode) * tgamma_delta_ratio(T(mode + 1), T(0.5f), pol) * fabs(delta) / constants::root_two<T>();
+      const std::size_t m = static_cast<std::size_t>(mode - m_first);
+      T h = peak;
+      for (std::size_t j = m; j < n; ++j)
+      {
+         m_h[j] = h;
+         h *= d2 / (m_first + static_cast<long long>(j) + T(1.5f));
+      }
+      h = peak;
+      for (std::size_t j = m; j > 0; --j)
+      {
+         h *= (m_first + static_cast<long long>(j) + T(0.5f)) / d2;
+         m_h[j - 1] = h;
+      }
+      const T v2 = m_v2;
+      fill_ratio_table(m_down, weights.last() + 2, [v2](long long i) { return down_ratio(v2, i); });
+      fill_ratio_table(m_up, weights.last() + 2, [v2](long long i) { return up_ratio(v2, i); });
+      m_d2 = d2;
+      return true;
+   }
+
+   T p(T delta, T x, T y, T init_val, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      const T v = m_v;
+      const T sign = delta < 0 ? T(-1) : T(1);
+      const T inv_x = 1 / x;
+      long long k = lltrunc(m_d2);
+      if (k == 0)
+         k = 1;
+      T pois = sign * weight(k);
+      if (pois == 0)
+         return init_val;
+      T xterm, beta;
+      beta = x < y
+         ? detail::ibeta_imp(T(k + 1), m_v2, x, pol, false, true, &xterm)
+         : detail::ibeta_imp(m_v2, T(k + 1), y, pol, true, true, &xterm);
+      while (fabs(beta * pois) < tools::min_value<T>())
+      {
+         if ((k == 0) || ((pois == 0) && (k < m_first)))
+            return init_val;
+         k /= 2;
+         pois = sign * weight(k);
+         beta = x < y
+            ? detail::ibeta_imp(T(k + 1), m_v2, x, pol, false, true, &xterm)
+            : detail::ibeta_imp(m_v2, T(k + 1), y, pol, true, true, &xterm);
+      }
+      xterm *= y / (m_v2 + k);
+      T betaf(beta), xtermf(xterm);
+      T sum = init_val;
+      if ((xterm == 0) && (beta == 0))
+         return init_val;
+      boost::math::uintmax_t count = 0;
+      T last_term = 0;
+      for (auto i = k; i >= 0; --i)
+      {
+         T term = beta * sign * weight(i);
+         sum += term;
+         if (((fabs(last_term) > fabs(term)) && fabs(term / sum) < errtol) || (v == 2 && i == 0))
+            break;
+         last_term = term;
+         beta += xterm;
+         xterm *= down(i) * inv_x;
+         ++count;
+      }
+      last_term = 0;
+      for (auto i = k + 1; ; ++i)
+      {
+         xtermf *= x * up(i);
+         betaf -= xtermf;
+         T term = sign * weight(i) * betaf;
+         sum += term;
+         if ((fabs(last_term) >= fabs(term)) && (fabs(term / sum) < errtol))
+            break;
+         last_term = term;
+         ++count;
+         if (count > max_iter)
+         {
+            return policies::raise_evaluation_error("cdf(non_central_t_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+         }
+      }
+      return sum;
+   }
+
+   T q(T delta, T x, T y, T init_val, const Policy& pol) const
+   {
+      BOOST_MATH_STD_USING
+      const boost::math::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      const T errtol = policies::get_epsilon<T, Policy>();
+      const T v = m_v;
+      const T sign = delta < 0 ? T(-1) : T(1);
+      const T inv_x = 1 / x;
+      long long k = lltrunc(m_d2);
+      if (k == 0)
+         k = 1;
+      T pois = sign * weight(k);
+      if (pois == 0)
+         return init_val;
+      T xterm;
+      T beta = x < y
+         ? detail::ibeta_imp(T(k + 1), m_v2, x, pol, true, true, &xterm)
+         : detail::ibeta_imp(m_v2, T(k + 1), y, pol, false, true, &xterm);
+      xterm *= y / (m_v2 + k);
+      T betaf(beta), xtermf(xterm);
+      T sum = init_val;
+      if ((xterm == 0) && (beta == 0))
+         return init_val;
+      // Forwards and backwards together:
+      boost::math::uintmax_t count = 0;
+      T last_term = 0;
+      for (auto i = k + 1, j = k; ; ++i, --j)
+      {
+         xtermf *= x * up(i);
+         betaf += xtermf;
+         T term = sign * weight(i) * betaf;
+         if (j >= 0)
+         {
+            term += beta * sign * weight(j);
+            beta -= xterm;
+            if (!(v == 2 && j == 0))
+               xterm *= down(j) * inv_x;
+         }
+         sum += term;
+         if ((fabs(last_term) > fabs(term)) && fabs(term / sum) < errtol)
+            break;
+         last_term = term;
+         if (count > max_iter)
+         {
+            return policies::raise_evaluation_error("cdf(non_central_t_distribution<%1%>, %1%)", "Series did not converge, closest value was %1%", sum, pol); // LCOV_EXCL_LINE
+         }
+         ++count;
+      }
+      return sum;
+   }
+
+private:
+   // i / (v/2 + i - 1), and its reciprocal:
+   static T down_ratio(T v2, long long i)
+   {
+      return (v2 + i - 1 != 0) ? T(i / (v2 + i - 1)) : T(0);
+   }
+
+   static T up_ratio(T v2, long long i)
+   {
+      return (v2 + i - 1) / i;
+   }
+
+   T weight(long long i) const
+   {
+      const unsigned long long j = static_cast<unsigned long long>(i - m_first);
+      return j < m_h.size() ? m_h[static_cast<std::size_t>(j)] : T(0);
+   }
+
+   T down(long long i) const
+   {
+      return in_table(m_down, i) ? m_down[static_cast<std::size_t>(i)] : down_ratio(m_v2, i);
+   }
+
+   T up(long long i) const
+   {
+      return in_table(m_up, i) ? m_up[static_cast<std::size_t>(i)] : up_ratio(m_v2, i);
+   }
+
+   T m_v;
+   T m_v2;
+   T m_d2;
+   long long m_first;
+   std::vector<T> m_h;
+   std::vector<T> m_down;
+   std::vector<T> m_up;
+};
+
+template <class Policy>
+struct non_central_table_policy
+{
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type type;
+};
+
+template <class Distribution>
+class non_central_table_engine;
+
+template <class RealType, class Policy>
+class non_central_table_engine<non_central_chi_squared_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_chi_squared_distribution<RealType, Policy> distribution_type;
+   typedef typename policies::evaluation<RealType, Policy>::type value_type;
+   typedef typename non_central_table_policy<Policy>::type forwarding_policy;
+
+   non_central_table_engine(const distribution_type& dist, std::size_t max_entries) : m_dist(dist), m_tabulated(false)
+   {
+      RealType r;
+      const char* function = "boost::math::non_central_table<non_central_chi_squared_distribution<%1%>>::non_central_table";
+      if (!detail::check_df(function, dist.degrees_of_freedom(), &r, Policy())
+         || !detail::check_non_centrality(function, dist.non_centrality(), &r, Policy()))
+      {
+         return;
+      }
+      m_tabulated = (dist.non_centrality() > 0)
+         && m_series.init(static_cast<value_type>(dist.degrees_of_freedom()), static_cast<value_type>(dist.non_centrality()), max_entries, forwarding_policy());
+   }
+
+   const distribution_type& distribution() const { return m_dist; }
+   bool is_tabulated() const { return m_tabulated; }
+
+   RealType pdf(const RealType& x) const
+   {
+      // Below l = 50 the distribution uses a single Bessel function instead of the series:
+      if (!m_tabulated || !((x > 0) && (boost::math::isfinite)(x)) || !(m_dist.non_centrality() > 50))
+      {
+         return boost::math::pdf(m_dist, x);
+      }
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         m_series.pdf(static_cast<value_type>(x), forwarding_policy()),
+         "pdf(non_central_chi_squared_distribution<%1%>, %1%)");
+   }
+
+   RealType cdf(const RealType& x, bool invert) const
+   {
+      if (!m_tabulated || !((x > 0) && (boost::math::isfinite)(x)))
+      {
+         return invert ? boost::math::cdf(complement(m_dist, x)) : boost::math::cdf(m_dist, x);
+      }
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         m_series.cdf(static_cast<value_type>(x), invert, forwarding_policy()),
+         "boost::math::non_central_chi_squared_cdf<%1%>(%1%, %1%, %1%)");
+   }
+
+private:
+   distribution_type m_dist;
+   bool m_tabulated;
+   non_central_chi_squared_series<value_type, forwarding_policy> m_series;
+};
+
+template <class RealType, class Policy>
+class non_central_table_engine<non_central_beta_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_beta_distribution<RealType, Policy> distribution_type;
+   typedef typename policies::evaluation<RealType, Policy>::type value_type;
+   typedef typename non_central_table_policy<Policy>::type forwarding_policy;
+
+   non_central_table_engine(const distribution_type& dist, std::size_t max_entries) : m_dist(dist), m_tabulated(false)
+   {
+      RealType r;
+      const char* function = "boost::math::non_central_table<non_central_beta_distribution<%1%>>::non_central_table";
+      if (!beta_detail::check_alpha(function, dist.alpha(), &r, Policy())
+         || !beta_detail::check_beta(function, dist.beta(), &r, Policy())
+         || !detail::check_non_centrality(function, dist.non_centrality(), &r, Policy()))
+      {
+         return;
+      }
+      m_tabulated = (dist.non_centrality() > 0)
+         && m_series.init(static_cast<value_type>(dist.alpha()), static_cast<value_type>(dist.beta()), static_cast<value_type>(dist.non_centrality()), max_entries, forwarding_policy());
+   }
+
+   const distribution_type& distribution() const { return m_dist; }
+   bool is_tabulated() const { return m_tabulated; }
+
+   RealType pdf(const RealType& x) const
+   {
+      if (!m_tabulated || !((x >= 0) && (x <= 1)))
+      {
+         return boost::math::pdf(m_dist, x);
+      }
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         m_series.pdf(static_cast<value_type>(x), value_type(1 - static_cast<value_type>(x)), forwarding_policy()),
+         "pdf(non_central_beta_distribution<%1%>, %1%)");
+   }
+
+   RealType cdf(const RealType& x, bool invert) const
+   {
+      if (!m_tabulated || !((x >= 0) && (x <= 1)))
+      {
+         return invert ? boost::math::cdf(complement(m_dist, x)) : boost::math::cdf(m_dist, x);
+      }
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         m_series.cdf(static_cast<value_type>(x), value_type(1 - static_cast<value_type>(x)), invert, forwarding_policy()),
+         "boost::math::non_central_beta_cdf<%1%>(%1%, %1%, %1%)");
+   }
+
+private:
+   distribution_type m_dist;
+   bool m_tabulated;
+   non_central_beta_series<value_type, forwarding_policy> m_series;
+};
+
+// The F distribution is the beta distribution at x a / (b + x a):
+template <class RealType, class Policy>
+class non_central_table_engine<non_central_f_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_f_distribution<RealType, Policy> distribution_type;
+   typedef typename policies::evaluation<RealType, Policy>::type value_type;
+   typedef typename non_central_table_policy<Policy>::type forwarding_policy;
+
+   non_central_table_engine(const distribution_type& dist, std::size_t max_entries) : m_dist(dist), m_tabulated(false)
+   {
+      RealType r;
+      const char* function = "boost::math::non_central_table<non_central_f_distribution<%1%>>::non_central_table";
+      if (!detail::check_df(function, dist.degrees_of_freedom1(), &r, Policy())
+         || !detail::check_df(function, dist.degrees_of_freedom2(), &r, Policy())
+         || !detail::check_non_centrality(function, dist.non_centrality(), &r, Policy()))
+      {
+         return;
+      }
+      m_tabulated = (dist.non_centrality() > 0)
+         && m_series.init(static_cast<value_type>(dist.degrees_of_freedom1() / 2), static_cast<value_type>(dist.degrees_of_freedom2() / 2), static_cast<value_type>(dist.non_centrality()), max_entries, forwarding_policy());
+   }
+
+   const distribution_type& distribution() const { return m_dist; }
+   bool is_tabulated() const { return m_tabulated; }
+
+   RealType pdf(const RealType& x) const
+   {
+      if (!m_tabulated || !((x >= 0) && (boost::math::isfinite)(x)))
+      {
+         return boost::math::pdf(m_dist, x);
+      }
+      const value_type y = x * m_series.a() / m_series.b();
+      const value_type c = y / (1 + y);
+      const value_type r = m_series.pdf(c, value_type(1 - c), forwarding_policy());
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         r * (m_dist.degrees_of_freedom1() / m_dist.degrees_of_freedom2()) / ((1 + y) * (1 + y)),
+         "pdf(non_central_f_distribution<%1%>, %1%)");
+   }
+
+   RealType cdf(const RealType& x, bool invert) const
+   {
+      if (!m_tabulated || !((x >= 0) && (boost::math::isfinite)(x)))
+      {
+         return invert ? boost::math::cdf(complement(m_dist, x)) : boost::math::cdf(m_dist, x);
+      }
+      // Both x and 1-x go to the series, so that neither loses accuracy near one:
+      const RealType y = x * (m_dist.degrees_of_freedom1() / 2) / (m_dist.degrees_of_freedom2() / 2);
+      const RealType c = y / (1 + y);
+      const RealType cp = 1 / (1 + y);
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         m_series.cdf(static_cast<value_type>(c), static_cast<value_type>(cp), invert, forwarding_policy()),
+         "boost::math::non_central_beta_cdf<%1%>(%1%, %1%, %1%)");
+   }
+
+private:
+   distribution_type m_dist;
+   bool m_tabulated;
+   non_central_beta_series<value_type, forwarding_policy> m_series;
+};
+
+// The t distribution is half a beta series in t^2 / (v + t^2) and half the series of non_central_t2_p:
+template <class RealType, class Policy>
+class non_central_table_engine<non_central_t_distribution<RealType, Policy> >
+{
+public:
+   typedef non_central_t_distribution<RealType, Policy> distribution_type;
+   typedef typename policies::evaluation<RealType, Policy>::type value_type;
+   typedef typename non_central_table_policy<Policy>::type forwarding_policy;
+
+   non_central_table_engine(const distribution_type& dist, std::size_t max_entries) : m_dist(dist), m_tabulated(false)
+   {
+      BOOST_MATH_STD_USING
+      RealType r;
+      const char* function = "boost::math::non_central_table<non_central_t_distribution<%1%>>::non_central_table";
+      const RealType v = dist.degrees_of_freedom();
+      const RealType delta = dist.non_centrality();
+      if (!detail::check_df_gt0_to_inf(function, v, &r, Policy())
+         || !detail::check_non_centrality(function, static_cast<RealType>(delta * delta), &r, Policy()))
+      {
+         return;
+      }
+      // Infinite degrees of freedom give a normal distribution, and where delta is negligible next to
+      // v the distribution is approximated by a shifted Student's t; neither has a series to cache:
+      if ((delta == 0) || (boost::math::isinf)(v) || (fabs(delta / (4 * v)) < policies::get_epsilon<value_type, forwarding_policy>()))
+      {
+         return;
+      }
+      const value_type d = delta;
+      m_tabulated = m_series.init(value_type(0.5f), static_cast<value_type>(v / 2), value_type(d * d), max_entries, forwarding_policy())
+         && m_t2.init(static_cast<value_type>(v), d, m_series.weights(), forwarding_policy());
+   }
+
+   const distribution_type& distribution() const { return m_dist; }
+   bool is_tabulated() const { return m_tabulated; }
+
+   // The density is a hypergeometric series rather than a Poisson mixture:
+   RealType pdf(const RealType& x) const
+   {
+      return boost::math::pdf(m_dist, x);
+   }
+
+   // As non_central_t_cdf:
+   RealType cdf(const RealType& x, bool invert) const
+   {
+      if (!m_tabulated || !(boost::math::isfinite)(x))
+      {
+         return invert ? boost::math::cdf(complement(m_dist, x)) : boost::math::cdf(m_dist, x);
+      }
+      const forwarding_policy pol;
+      const value_type v = m_dist.degrees_of_freedom();
+      value_type delta = m_dist.non_centrality();
+      value_type t = x;
+      if (t < 0)
+      {
+         t = -t;
+         delta = -delta;
+         invert = !invert;
+      }
+      const value_type x2 = t * t / (v + t * t);
+      const value_type y2 = v / (v + t * t);
+      const value_type d2 = delta * delta;
+      const value_type a = 0.5f;
+      const value_type b = v / 2;
+      const value_type c = a + b + d2 / 2;
+      const value_type cross = 1 - (b / c) * (1 + d2 / (2 * c * c));
+      value_type result;
+      if (x2 < cross)
+      {
+         if (x2 != 0)
+         {
+            result = m_series.p(x2, y2, value_type(0), pol);
+            result = m_t2.p(delta, x2, y2, result, pol);
+            result /= 2;
+         }
+         else
+            result = 0;
+         if (invert)
+         {
+            result = boost::math::cdf(complement(normal_distribution<value_type, forwarding_policy>(), -delta)) - result;
+            invert = false;
+         }
+         else
+            result += boost::math::cdf(normal_distribution<value_type, forwarding_policy>(), -delta);
+      }
+      else
+      {
+         invert = !invert;
+         if (x2 != 0)
+         {
+            result = m_series.q(x2, y2, value_type(0), pol);
+            result = m_t2.q(delta, x2, y2, result, pol);
+            result /= 2;
+         }
+         else
+            result = boost::math::cdf(complement(normal_distribution<value_type, forwarding_policy>(), -delta));
+      }
+      if (invert)
+         result = 1 - result;
+      return policies::checked_narrowing_cast<RealType, forwarding_policy>(
+         result,
+         "boost::math::cdf(non_central_t_distribution<%1%>&, %1%)");
+   }
+
+private:
+   distribution_type m_dist;
+   bool m_tabulated;
+   non_central_beta_series<value_type, forwarding_policy> m_series;
+   non_central_t2_series<value_type, forwarding_policy> m_t2;
+};
+
+} // namespace detail
+
+// A non-central chi squared, beta, F or t distribution prepared for evaluation at many points.
+// Construction tabulates the Poisson weights and the recurrence coefficients of the series, which
+// costs about as much as a few evaluations of the cdf; the pdf, cdf and complement then give the
+// same results as the distribution's own functions, to within rounding.  When the non-centrality
+// is zero, or so large that the weights need more than max_entries entries, every call is handed
+// to the distribution.
+template <class Distribution>
+class non_central_table
+{
+public:
+   typedef Distribution distribution_type;
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+
+   explicit non_central_table(const Distribution& dist, std::size_t max_entries = std::size_t(1) << 20)
+      : m_engine(dist, max_entries)
+   {
+   }
+
+   const Distribution& distribution() const
+   {
+      return m_engine.distribution();
+   }
+
+   // Whether the series are tabulated, rather than passed through to the distribution:
+   bool is_tabulated() const
+   {
+      return m_engine.is_tabulated();
+   }
+
+   value_type pdf(const value_type& x) const
+   {
+      return m_engine.pdf(x);
+   }
+
+   value_type cdf(const value_type& x) const
+   {
+      return m_engine.cdf(x, false);
+   }
+
+   // The complement of the cdf, as cdf(complement(dist, x)):
+   value_type ccdf(const value_type& x) const
+   {
+      return m_engine.cdf(x, true);
+   }
+
+   template <class ForwardIterator, class OutputIterator>
+   OutputIterator pdf(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+   {
+      for (; first != last; ++first)
+      {
+         *out++ = m_engine.pdf(*first);
+      }
+      return out;
+   }
+
+   template <class ForwardIterator, class OutputIterator>
+   OutputIterator cdf(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+   {
+      for (; first != last; ++first)
+      {
+         *out++ = m_engine.cdf(*first, false);
+      }
+      return out;
+   }
+
+   template <class ForwardIterator, class OutputIterator>
+   OutputIterator ccdf(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+   {
+      for (; first != last; ++first)
+      {
+         *out++ = m_engine.cdf(*first, true);
+      }
+      return out;
+   }
+
+private:
+   detail::non_central_table_engine<Distribution> m_engine;
+};
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_NON_CENTRAL_TABLE_HPP
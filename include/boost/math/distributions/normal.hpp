@@ -22,6 +22,7 @@
 #include <boost/math/special_functions/erf.hpp> // for erf/erfc.
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
+#include <boost/math/distributions/detail/log_erfc.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/policies/policy.hpp>
 
@@ -230,6 +231,44 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const normal_distribution<RealType, P
    return result;
 } // cdf
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const normal_distribution<RealType, Policy>& dist, const RealType& x)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   RealType sd = dist.standard_deviation();
+   RealType mean = dist.mean();
+   constexpr auto function = "boost::math::logcdf(const normal_distribution<%1%>&, %1%)";
+   RealType result = 0;
+   if(false == detail::check_scale(function, sd, &result, Policy()))
+   {
+      return result;
+   }
+   if(false == detail::check_location(function, mean, &result, Policy()))
+   {
+      return result;
+   }
+   if((boost::math::isinf)(x))
+   {
+     if(x < 0) return -boost::math::numeric_limits<RealType>::infinity(); // -infinity
+     return 0; // + infinity
+   }
+   if(false == detail::check_x(function, x, &result, Policy()))
+   {
+     return result;
+   }
+   RealType diff = (x - mean) / (sd * constants::root_two<RealType>());
+   if(diff < 0)
+   {
+      result = detail::log_erfc(RealType(-diff), Policy()) - constants::ln_two<RealType>();
+   }
+   else
+   {
+      result = boost::math::log1p(-boost::math::erfc(diff, Policy()) / 2, Policy());
+   }
+   return result;
+} // logcdf
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const normal_distribution<RealType, Policy>& dist, const RealType& p)
 {
@@ -282,6 +321,41 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const complemented2_type<normal_distr
    return result;
 } // cdf complement
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const complemented2_type<normal_distribution<RealType, Policy>, RealType>& c)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions
+
+   RealType sd = c.dist.standard_deviation();
+   RealType mean = c.dist.mean();
+   RealType x = c.param;
+   constexpr auto function = "boost::math::logcdf(const complement(normal_distribution<%1%>&), %1%)";
+
+   RealType result = 0;
+   if(false == detail::check_scale(function, sd, &result, Policy()))
+      return result;
+   if(false == detail::check_location(function, mean, &result, Policy()))
+      return result;
+   if((boost::math::isinf)(x))
+   {
+     if(x < 0) return 0; // log cdf complement -infinity is zero.
+     return -boost::math::numeric_limits<RealType>::infinity(); // log cdf complement +infinity
+   }
+   if(false == detail::check_x(function, x, &result, Policy()))
+      return result;
+
+   RealType diff = (x - mean) / (sd * constants::root_two<RealType>());
+   if(diff > 0)
+   {
+      result = detail::log_erfc(diff, Policy()) - constants::ln_two<RealType>();
+   }
+   else
+   {
+      result = boost::math::log1p(-boost::math::erfc(RealType(-diff), Policy()) / 2, Policy());
+   }
+   return result;
+} // logcdf complement
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const complemented2_type<normal_distribution<RealType, Policy>, RealType>& c)
 {
@@ -50,6 +50,7 @@
 #include <boost/math/special_functions/factorials.hpp> // factorials.
 #include <boost/math/tools/roots.hpp> // for root finding.
 #include <boost/math/distributions/detail/inv_discrete_quantile.hpp>
+#include <boost/math/distributions/detail/log_incomplete.hpp> // logcdf.
 
 namespace boost
 {
@@ -362,6 +363,32 @@ namespace boost
       return gamma_q(k+1, mean, Policy());
     } // binomial cdf
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED RealType logcdf(const poisson_distribution<RealType, Policy>& dist, const RealType& k)
+    { // Log of the Cumulative Distribution Function Poisson.
+      RealType mean = dist.mean();
+      // Error checks:
+      RealType result = 0;
+      if(false == poisson_detail::check_dist_and_k(
+        "boost::math::logcdf(const poisson_distribution<%1%>&, %1%)",
+        mean,
+        k,
+        &result, Policy()))
+      {
+        return result;
+      }
+      // Special cases as for the cdf:
+      if (mean == 0)
+      {
+        return -boost::math::numeric_limits<RealType>::infinity();
+      }
+      if (k == 0)
+      {
+        return -mean;
+      }
+      return detail::log_gamma_incomplete(RealType(k+1), mean, true, Policy());
+    } // poisson logcdf
+
     template <class RealType, class Policy>
     BOOST_MATH_GPU_ENABLED RealType cdf(const complemented2_type<poisson_distribution<RealType, Policy>, RealType>& c)
     { // Complemented Cumulative Distribution Function Poisson
@@ -412,6 +439,38 @@ namespace boost
       // CCDF = gamma_p(k+1, lambda)
     } // poisson ccdf
 
+    template <class RealType, class Policy>
+    BOOST_MATH_GPU_ENABLED RealType logcdf(const complemented2_type<poisson_distribution<RealType, Policy>, RealType>& c)
+    { // Log of the Complemented Cumulative Distribution Function Poisson
+      BOOST_MATH_STD_USING // for ADL of std functions.
+
+      RealType const& k = c.param;
+      poisson_distribution<RealType, Policy> const& dist = c.dist;
+
+      RealType mean = dist.mean();
+
+      // Error checks:
+      RealType result = 0;
+      if(false == poisson_detail::check_dist_and_k(
+        "boost::math::logcdf(const poisson_distribution<%1%>&, %1%)",
+        mean,
+        k,
+        &result, Policy()))
+      {
+        return result;
+      }
+      // Special cases as for the cdf complement:
+      if (mean == 0)
+      {
+        return 0;
+      }
+      if (k == 0)
+      { // log(1 - exp(-mean)), whichever way round is the more accurate.
+         return mean < constants::ln_two<RealType>() ? RealType(log(-boost::math::expm1(-mean, Policy()))) : RealType(boost::math::log1p(-exp(-mean), Policy()));
+      }
+      return detail::log_gamma_incomplete(RealType(k + 1), mean, false, Policy());
+    } // poisson logccdf
+
     template <class RealType, class Policy>
     BOOST_MATH_GPU_ENABLED inline RealType quantile(const poisson_distribution<RealType, Policy>& dist, const RealType& p)
     { // Quantile (or Percent Point) Poisson function.
@@ -0,0 +1,380 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_QUANTILE_SKETCH_HPP
+#define BOOST_MATH_DISTRIBUTIONS_QUANTILE_SKETCH_HPP
+
+// References:
+// Zohar Karnin, Kevin Lang and Edo Liberty, Optimal Quantile Approximation in Streams,
+// 2016 IEEE 57th Annual Symposium on Foundations of Computer Science, 71-78.
+// Nikita Ivkin, Edo Liberty, Kevin Lang, Zohar Karnin and Vladimir Braverman, Streaming Quantiles Algorithms
+// with Small Space and Update Time, Sensors 22 (2022), 9612.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace boost { namespace math {
+
+// A KLL sketch: a stack of compactors in which an item on level h stands for 2^h of the original samples.
+// When a level fills, it is sorted and every other item, starting at a random offset, is promoted to the
+// level above while the rest are discarded.  Capacities shrink geometrically down the stack so that the
+// sketch holds O(k) items however many samples it has seen, and any rank is then known to within about
+// 1.3% of the total count for the default k = 200.  Two sketches built from disjoint data merge into a sketch of the union with
+// the same guarantee.
+template<class Real>
+class quantile_sketch
+{
+public:
+    using value_type = Real;
+    using result_type = typename std::conditional<std::is_integral<Real>::value, double, Real>::type;
+
+    explicit quantile_sketch(std::size_t k = 200, std::uint64_t seed = 0x9E3779B97F4A7C15ull)
+        : m_k(k), m_count(0), m_retained(0), m_capacity(0), m_random(seed), m_levels(1), m_view_valid(false)
+    {
+        if (k < min_capacity || k > std::numeric_limits<std::uint16_t>::max())
+        {
+            throw std::domain_error("The sketch parameter k must lie in [" + std::to_string(min_capacity) + ", 65535] but got k = " + std::to_string(k) + ".");
+        }
+        m_capacity = total_capacity();
+    }
+
+    void insert(Real x)
+    {
+        if (is_nan(x))
+        {
+            throw std::domain_error("NaN cannot be inserted into a quantile sketch.");
+        }
+        if (m_count == 0)
+        {
+            m_min = x;
+            m_max = x;
+        }
+        else
+        {
+            m_min = (std::min)(m_min, x);
+            m_max = (std::max)(m_max, x);
+        }
+        m_levels[0].push_back(x);
+        ++m_count;
+        ++m_retained;
+        m_view_valid = false;
+        if (m_retained >= m_capacity)
+        {
+            compress();
+        }
+    }
+
+    template<class ForwardIterator>
+    void insert(ForwardIterator first, ForwardIterator last)
+    {
+        for (; first != last; ++first)
+        {
+            insert(*first);
+        }
+    }
+
+    // Folds in a sketch of a disjoint part of the data, for example one built on another node:
+    void merge(const quantile_sketch& other)
+    {
+        if (other.m_k != m_k)
+        {
+            throw std::domain_error("Only sketches with the same parameter k can be merged, but got k = " + std::to_string(m_k) + " and " + std::to_string(other.m_k) + ".");
+        }
+        if (other.m_count == 0)
+        {
+            return;
+        }
+        if (m_count == 0)
+        {
+            m_min = other.m_min;
+            m_max = other.m_max;
+        }
+        else
+        {
+            m_min = (std::min)(m_min, other.m_min);
+            m_max = (std::max)(m_max, other.m_max);
+        }
+        if (other.m_levels.size() > m_levels.size())
+        {
+            m_levels.resize(other.m_levels.size());
+            m_capacity = total_capacity();
+        }
+        m_levels[0].insert(m_levels[0].end(), other.m_levels[0].begin(), other.m_levels[0].end());
+        for (std::size_t h = 1; h < other.m_levels.size(); ++h)
+        {
+            append_sorted(m_levels[h], other.m_levels[h].begin(), other.m_levels[h].end());
+        }
+        m_count += other.m_count;
+        m_retained += other.m_retained;
+        m_view_valid = false;
+        compress();
+    }
+
+    // The number of samples seen:
+    std::uint64_t count() const
+    {
+        return m_count;
+    }
+
+    // The number of items the sketch holds:
+    std::size_t retained() const
+    {
+        return m_retained;
+    }
+
+    std::size_t k() const
+    {
+        return m_k;
+    }
+
+    bool empty() const
+    {
+        return m_count == 0;
+    }
+
+    // Until the first compaction every sample is held, and queries are exact:
+    bool is_exact() const
+    {
+        return m_levels.size() == 1;
+    }
+
+    Real min() const
+    {
+        check_not_empty();
+        return m_min;
+    }
+
+    Real max() const
+    {
+        check_not_empty();
+        return m_max;
+    }
+
+    // An upper bound on the error in the normalized rank of a single query, holding with 99% confidence.
+    // These are the empirical fits to the error of KLL sketches published with the Apache DataSketches library:
+    double normalized_rank_error() const
+    {
+        return 2.296 / std::pow(static_cast<double>(m_k), 0.9723);
+    }
+
+    // The fraction of samples <= x, as returned by empirical_cumulative_distribution_function:
+    result_type cdf(Real x) const
+    {
+        check_not_empty();
+        if (x < m_min)
+        {
+            return result_type(0);
+        }
+        if (x >= m_max)
+        {
+            return result_type(1);
+        }
+        refresh_view();
+        auto it = std::upper_bound(m_view.begin(), m_view.end(), x, [](Real v, const std::pair<Real, std::uint64_t>& p) { return v < p.first; });
+        if (it == m_view.begin())
+        {
+            return result_type(0);
+        }
+        return static_cast<result_type>((it - 1)->second) / static_cast<result_type>(m_count);
+    }
+
+    result_type operator()(Real x) const
+    {
+        return cdf(x);
+    }
+
+    // The smallest retained item whose normalized rank is at least p:
+    Real quantile(result_type p) const
+    {
+        check_not_empty();
+        if (!(p >= 0 && p <= 1))
+        {
+            throw std::domain_error("The probability passed to quantile must lie in [0, 1].");
+        }
+        if (p == 0)
+        {
+            return m_min;
+        }
+        if (p == 1)
+        {
+            return m_max;
+        }
+        refresh_view();
+        result_type target = p * static_cast<result_type>(m_count);
+        auto it = std::lower_bound(m_view.begin(), m_view.end(), target, [](const std::pair<Real, std::uint64_t>& e, result_type t) { return static_cast<result_type>(e.second) < t; });
+        if (it == m_view.end())
+        {
+            return m_max;
+        }
+        return it->first;
+    }
+
+    template<class ForwardIterator, class OutputIterator>
+    OutputIterator quantiles(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+    {
+        for (; first != last; ++first)
+        {
+            *out++ = quantile(*first);
+        }
+        return out;
+    }
+
+private:
+    static constexpr std::size_t min_capacity = 8;
+
+    template<class T = Real>
+    static typename std::enable_if<std::is_integral<T>::value, bool>::type is_nan(T)
+    {
+        return false;
+    }
+
+    template<class T = Real>
+    static typename std::enable_if<!std::is_integral<T>::value, bool>::type is_nan(T x)
+    {
+        return x != x;
+    }
+
+    void check_not_empty() const
+    {
+        if (m_count == 0)
+        {
+            throw std::domain_error("At least one sample is required to query a quantile sketch.");
+        }
+    }
+
+    // Capacities fall by a factor of 2/3 for each level below the top, which holds k items:
+    std::size_t level_capacity(std::size_t h) const
+    {
+        std::size_t depth = m_levels.size() - 1 - h;
+        double c = static_cast<double>(m_k) * std::pow(2.0 / 3.0, static_cast<double>(depth));
+        return (std::max)(min_capacity, static_cast<std::size_t>(std::ceil(c)));
+    }
+
+    std::size_t total_capacity() const
+    {
+        std::size_t total = 0;
+        for (std::size_t h = 0; h < m_levels.size(); ++h)
+        {
+            total += level_capacity(h);
+        }
+        return total;
+    }
+
+    // Levels above the first are always sorted, so merging in a sorted run is linear:
+    template<class Iterator>
+    static void append_sorted(std::vector<Real>& level, Iterator first, Iterator last)
+    {
+        auto middle = static_cast<std::ptrdiff_t>(level.size());
+        level.insert(level.end(), first, last);
+        std::inplace_merge(level.begin(), level.begin() + middle, level.end());
+    }
+
+    bool random_bit()
+    {
+        // splitmix64, which needs no more state than its counter:
+        std::uint64_t z = (m_random += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return ((z ^ (z >> 31)) >> 63) != 0;
+    }
+
+    // Halves the lowest full level into the one above it:
+    void compact(std::size_t h)
+    {
+        if (h + 1 == m_levels.size())
+        {
+            m_levels.emplace_back();
+            m_capacity = total_capacity();
+        }
+        std::vector<Real>& level = m_levels[h];
+        if (h == 0)
+        {
+            std::sort(level.begin(), level.end());
+        }
+        // An odd item out stays behind, so the weight of the level is preserved exactly:
+        std::size_t kept = level.size() & 1u;
+        std::size_t offset = random_bit() ? 1 : 0;
+        std::vector<Real> promoted;
+        promoted.reserve(level.size() / 2);
+        for (std::size_t i = kept + offset; i < level.size(); i += 2)
+        {
+            promoted.push_back(level[i]);
+        }
+        m_retained -= level.size() - kept - promoted.size();
+        level.resize(kept);
+        append_sorted(m_levels[h + 1], promoted.begin(), promoted.end());
+    }
+
+    // Compaction is lazy: a level is only halved once the sketch as a whole is full, at which point
+    // the lowest level over its own capacity is the one that goes.  Each compaction of a level of
+    // c items frees c/2 slots, so insertion costs O(log k) amortized whatever the number of samples.
+    void compress()
+    {
+        while (m_retained >= m_capacity)
+        {
+            for (std::size_t h = 0; h < m_levels.size(); ++h)
+            {
+                if (m_levels[h].size() >= level_capacity(h))
+                {
+                    compact(h);
+                    break;
+                }
+            }
+        }
+    }
+
+    // Every retained item with its cumulative weight, sorted by value:
+    void refresh_view() const
+    {
+        if (m_view_valid)
+        {
+            return;
+        }
+        m_view.clear();
+        m_view.reserve(m_retained);
+        for (std::size_t h = 0; h < m_levels.size(); ++h)
+        {
+            for (const Real& v : m_levels[h])
+            {
+                m_view.emplace_back(v, std::uint64_t(1) << h);
+            }
+        }
+        std::sort(m_view.begin(), m_view.end(), [](const std::pair<Real, std::uint64_t>& a, const std::pair<Real, std::uint64_t>& b) { return a.first < b.first; });
+        std::uint64_t cumulative = 0;
+        for (auto& e : m_view)
+        {
+            cumulative += e.second;
+            e.second = cumulative;
+        }
+        m_view_valid = true;
+    }
+
+    std::size_t m_k;
+    std::uint64_t m_count;
+    std::size_t m_retained;
+    std::size_t m_capacity;
+    std::uint64_t m_random;
+    Real m_min{};
+    Real m_max{};
+    std::vector<std::vector<Real>> m_levels;
+    // Queries sort the retained items once and reuse them until the next insertion or merge:
+    mutable std::vector<std::pair<Real, std::uint64_t>> m_view;
+    mutable bool m_view_valid;
+};
+
+template<class Real>
+constexpr std::size_t quantile_sketch<Real>::min_capacity;
+
+}}
+#endif
@@ -0,0 +1,352 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_QUANTILE_TABLE_HPP
+#define BOOST_MATH_DISTRIBUTIONS_QUANTILE_TABLE_HPP
+
+// References:
+// Lloyd N. Trefethen, Approximation Theory and Approximation Practice, SIAM (2013), chapters 3 and 4.
+// Wolfgang Hormann and Josef Leydold, Continuous random variate generation by fast numerical inversion,
+// ACM Transactions on Modeling and Computer Simulation 13 (2003), 347-362.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/distributions/sampler.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/tools/rational.hpp>
+
+namespace boost { namespace math {
+
+namespace detail {
+
+//
+// The table covers each tail q = min(p, 1-p) in (0, 1/2] by octaves: u = 2q = m 2^-k with m in [1/2, 1),
+// and octave k split into S equal pieces in m.  Every piece is a polynomial of degree D in the
+// position within it.  The quantile's behaviour in the tails, whether q^-a for a heavy tail or
+// log(1/q)^a for a light one, is smooth on the scale of an octave, so the same few pieces serve every
+// octave down to q = 2^-(K+1).
+//
+template <class T>
+struct quantile_table_shape
+{
+   static constexpr int digits = std::numeric_limits<T>::is_specialized && (std::numeric_limits<T>::radix == 2) ? std::numeric_limits<T>::digits : 53;
+   static constexpr int degree = digits <= 24 ? 5 : digits <= 53 ? 10 : digits <= 64 ? 12 : 20;
+   static constexpr int subdivisions = 32;
+   static constexpr int octaves = 64;
+};
+
+// Splits u in (0, 1] into the octave k = -ilogb(u) - 1 and the mantissa m = u 2^k in [1/2, 1],
+// where u = 1 is the upper end of octave 0.  Only min/max style selections are used:
+template <class T>
+inline int quantile_table_split(T u, T& m, const std::false_type&)
+{
+   BOOST_MATH_STD_USING
+   int e;
+   T f = frexp(u, &e);
+   m = (e > 0) ? T(1) : f;
+   return (std::max)(-e, 0);
+}
+
+// For IEEE double the exponent and mantissa are read from the representation.  Only normal u are
+// looked up, as anything smaller is far outside the table:
+inline int quantile_table_split(double u, double& m, const std::true_type&)
+{
+   std::uint64_t bits;
+   std::memcpy(&bits, &u, sizeof(bits));
+   const int e = static_cast<int>(bits >> 52) - 1022;
+   const std::uint64_t mantissa = (bits & ((std::uint64_t(1) << 52) - 1)) | (std::uint64_t(1022) << 52);
+   std::memcpy(&m, &mantissa, sizeof(m));
+   m = (e > 0) ? 1.0 : m;
+   return (std::max)(-e, 0);
+}
+
+template <class T>
+struct quantile_table_fast_split : public std::integral_constant<bool, std::is_same<T, double>::value && std::numeric_limits<double>::is_iec559> {};
+
+// The distribution's own quantiles, found by argument dependent lookup so that this header needs
+// none of their declarations, and called from members that hide the name:
+template <class Distribution>
+inline typename Distribution::value_type quantile_table_quantile(const Distribution& dist, const typename Distribution::value_type& p)
+{
+   return quantile(dist, p);
+}
+
+template <class Distribution>
+inline typename Distribution::value_type quantile_table_cquantile(const Distribution& dist, const typename Distribution::value_type& q)
+{
+   return quantile(complement(dist, q));
+}
+
+} // namespace detail
+
+template <class Distribution>
+class quantile_table
+{
+public:
+   typedef Distribution distribution_type;
+   typedef typename Distribution::value_type value_type;
+   typedef typename Distribution::policy_type policy_type;
+
+   explicit quantile_table(const Distribution& dist) : m_dist(dist)
+   {
+      build();
+   }
+
+   const Distribution& distribution() const
+   {
+      return m_dist;
+   }
+
+   // The largest error found when the table was built, in units of epsilon relative to the larger
+   // of |quantile| and the interquartile range:
+   value_type max_error() const
+   {
+      return m_max_error;
+   }
+
+   value_type quantile(const value_type& p) const
+   {
+      if (!((p > 0) && (p < 1)))
+      {
+         // Let the distribution handle the end points, and report invalid probabilities:
+         return detail::quantile_table_quantile(m_dist, p);
+      }
+      const bool upper = p > constants::half<value_type>();
+      const value_type q = upper ? value_type(1 - p) : p;
+      return lookup(upper, q);
+   }
+
+   value_type cquantile(const value_type& q) const
+   {
+      if (!((q > 0) && (q < 1)))
+      {
+         return detail::quantile_table_cquantile(m_dist, q);
+      }
+      const bool upper = q <= constants::half<value_type>();
+      return lookup(upper, upper ? q : value_type(1 - q));
+   }
+
+   //
+   // Batched evaluation: the octaves and positions of a block of probabilities are found first, then
+   // the polynomials are evaluated, so that both loops are free of branches and may be vectorized.
+   // Probabilities outside the table are fixed up afterwards.
+   //
+   template <class ForwardIterator, class OutputIterator>
+   OutputIterator quantile(ForwardIterator first, ForwardIterator last, OutputIterator out) const
+   {
+      constexpr int block = 64;
+      std::size_t piece[block];
+      value_type x[block];
+      value_type p[block];
+      value_type result[block];
+      while (first != last)
+      {
+         int n = 0;
+         for (; (n < block) && (first != last); ++n, ++first)
+         {
+            p[n] = static_cast<value_type>(*first);
+         }
+         bool all_inside = true;
+         for (int i = 0; i < n; ++i)
+         {
+            const bool upper = p[i] > constants::half<value_type>();
+            const value_type q = upper ? value_type(1 - p[i]) : p[i];
+            const bool inside = (q >= m_smallest[upper]) && (p[i] < 1);
+            piece[i] = inside ? segment(upper, q, x[i]) : 0;
+            x[i] = inside ? x[i] : value_type(0);
+            all_inside = all_inside && inside;
+         }
+         for (int i = 0; i < n; ++i)
+         {
+            result[i] = tools::evaluate_polynomial(m_pieces[piece[i]], x[i]);
+         }
+         if (!all_inside)
+         {
+            for (int i = 0; i < n; ++i)
+            {
+               const bool upper = p[i] > constants::half<value_type>();
+               const value_type q = upper ? value_type(1 - p[i]) : p[i];
+               if (!((q >= m_smallest[upper]) && (p[i] < 1)))
+               {
+                  result[i] = quantile(p[i]);
+               }
+            }
+         }
+         out = std::copy(result, result + n, out);
+      }
+      return out;
+   }
+
+   // A random variate, from 64 random bits: the top one picks the tail, and the rest the
+   // probability q = (bits + 1/2) 2^-64 within it, which is always in the table unless
+   // the quantile overflows value_type first.
+   template <class URBG>
+   value_type operator()(URBG& gen) const
+   {
+      const std::uint64_t bits = detail::sampler_bits(gen);
+      const value_type q = (static_cast<value_type>(bits & ~(std::uint64_t(1) << 63)) + constants::half<value_type>()) * m_two_pow_minus_64;
+      return lookup((bits >> 63) != 0, q);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   typedef detail::quantile_table_shape<value_type> shape;
+   static constexpr int coefficients = shape::degree + 1;
+
+   // The index of the piece containing q in the given tail, and the position
+   // x in [-1, 1] within it.  q must be in the table, at least m_smallest[upper]:
+   std::size_t segment(bool upper, value_type q, value_type& x) const
+   {
+      value_type m;
+      const int k = detail::quantile_table_split(value_type(2 * q), m, detail::quantile_table_fast_split<value_type>());
+      const value_type t = (m - constants::half<value_type>()) * (2 * shape::subdivisions);
+      const int j = (std::min)(static_cast<int>(t), shape::subdivisions - 1);
+      x = 2 * (t - j) - 1;
+      return (static_cast<std::size_t>(upper) * shape::octaves + static_cast<std::size_t>(k)) * shape::subdivisions + static_cast<std::size_t>(j);
+   }
+
+   value_type lookup(bool upper, value_type q) const
+   {
+      if (q < m_smallest[upper])
+      {
+         return exact(upper, q);
+      }
+      value_type x;
+      const std::size_t piece = segment(upper, q, x);
+      return tools::evaluate_polynomial(m_pieces[piece], x);
+   }
+
+   value_type exact(bool upper, value_type q) const
+   {
+      return upper ? detail::quantile_table_cquantile(m_dist, q) : detail::quantile_table_quantile(m_dist, q);
+   }
+
+   //
+   // Each piece interpolates the distribution's own quantile at the D+1 Chebyshev points of its interval,
+   // and the interpolant is converted from the Chebyshev to the monomial basis, so that it can be evaluated by
+   // tools::evaluate_polynomial, which unrolls the loop for a fixed degree.  The error is then measured at the
+   // midpoints between those points and at the ends of the interval.  Each tail is tabulated down to the first
+   // octave in which the quantile is not finite.
+   //
+   void build()
+   {
+      BOOST_MATH_STD_USING
+      m_two_pow_minus_64 = ldexp(value_type(1), -64);
+      const value_type spread = detail::quantile_table_cquantile(m_dist, value_type(0.25)) - detail::quantile_table_quantile(m_dist, value_type(0.25));
+      std::array<value_type, coefficients> zero;
+      zero.fill(value_type(0));
+      m_pieces.assign(std::size_t(2) * shape::octaves * shape::subdivisions, zero);
+      m_max_error = 0;
+
+      const int n = coefficients;
+      std::vector<value_type> nodes(n);
+      std::vector<value_type> values(n);
+      std::vector<value_type> chebyshev(n);
+      // The monomial coefficients of T_0 ... T_D, row by row:
+      std::vector<value_type> basis(static_cast<std::size_t>(n) * n, value_type(0));
+      basis[0] = 1;
+      if (n > 1)
+      {
+         basis[n + 1] = 1;
+      }
+      for (int i = 2; i < n; ++i)
+      {
+         for (int j = 0; j < n; ++j)
+         {
+            value_type v = -basis[(i - 2) * n + j];
+            if (j > 0)
+            {
+               v += 2 * basis[(i - 1) * n + j - 1];
+            }
+            basis[i * n + j] = v;
+         }
+      }
+      for (int i = 0; i < n; ++i)
+      {
+         nodes[i] = cos(constants::pi<value_type>() * (i + constants::half<value_type>()) / n);
+      }
+
+      for (int side = 0; side < 2; ++side)
+      {
+         int k = 0;
+         for (; k < shape::octaves; ++k)
+         {
+            bool finite = true;
+            value_type octave_error = 0;
+            for (int j = 0; j < shape::subdivisions; ++j)
+            {
+               // The piece covers q = m 2^-(k+1) for m between these:
+               const value_type m0 = constants::half<value_type>() + value_type(j) / (2 * shape::subdivisions);
+               const value_type width = value_type(1) / (2 * shape::subdivisions);
+               const value_type scale = ldexp(value_type(1), -k - 1);
+               auto q_at = [&](value_type x) { return (m0 + (x + 1) * width / 2) * scale; };
+               for (int i = 0; i < n; ++i)
+               {
+                  values[i] = exact(side != 0, q_at(nodes[i]));
+                  finite = finite && (boost::math::isfinite)(values[i]);
+               }
+               for (int l = 0; l < n; ++l)
+               {
+                  value_type s = 0;
+                  for (int i = 0; i < n; ++i)
+                  {
+                     s += values[i] * cos(l * constants::pi<value_type>() * (i + constants::half<value_type>()) / n);
+                  }
+                  chebyshev[l] = s * (l == 0 ? 1 : 2) / n;
+               }
+               std::array<value_type, coefficients>& a = m_pieces[(static_cast<std::size_t>(side) * shape::octaves + k) * shape::subdivisions + j];
+               for (int l = 0; l < n; ++l)
+               {
+                  for (int i = 0; i < n; ++i)
+                  {
+                     a[i] += chebyshev[l] * basis[l * n + i];
+                  }
+               }
+               // Measure the error between the nodes and at the ends:
+               for (int i = 0; i <= n; ++i)
+               {
+                  const value_type x = (i == 0) ? value_type(-1) : (i == n) ? value_type(1) : (nodes[i - 1] + nodes[i]) / 2;
+                  const value_type expected = exact(side != 0, q_at(x));
+                  const value_type error = fabs(tools::evaluate_polynomial(a, x) - expected) / ((std::max)(fabs(expected), spread) * tools::epsilon<value_type>());
+                  finite = finite && (boost::math::isfinite)(error);
+                  octave_error = (std::max)(octave_error, error);
+               }
+            }
+            if (!finite)
+            {
+               break;
+            }
+            m_max_error = (std::max)(m_max_error, octave_error);
+         }
+         // Octaves 0 to k-1 cover q >= 2^-(k+1); with none, even q = 1/2 is passed on:
+         m_smallest[side] = (k == 0) ? value_type(1) : ldexp(value_type(1), -k - 1);
+      }
+   }
+
+   Distribution m_dist;
+   std::vector<std::array<value_type, coefficients>> m_pieces;
+   value_type m_max_error;
+   value_type m_smallest[2];
+   value_type m_two_pow_minus_64;
+};
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_QUANTILE_TABLE_HPP
@@ -0,0 +1,840 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DISTRIBUTIONS_SAMPLER_HPP
+#define BOOST_MATH_DISTRIBUTIONS_SAMPLER_HPP
+
+// References:
+// George Marsaglia and Wai Wan Tsang, The Ziggurat Method for Generating Random Variables,
+// Journal of Statistical Software 5 (2000).
+// George Marsaglia and Wai Wan Tsang, A Simple Method for Generating Gamma Variables,
+// ACM Transactions on Mathematical Software 26 (2000), 363-372.
+// Jurgen A. Doornik, An Improved Ziggurat Method to Generate Normal Random Samples (2005).
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <boost/math/distributions/fwd.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/piecewise_chebyshev.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/tools/precision.hpp>
+
+namespace boost { namespace math {
+
+namespace detail {
+
+template <class URBG>
+struct sampler_bits_tag
+{
+   static constexpr std::uint64_t range = static_cast<std::uint64_t>((URBG::max)() - (URBG::min)());
+   typedef std::integral_constant<int, range == ~std::uint64_t(0) ? 64 : range == 0xFFFFFFFFu ? 32 : 0> type;
+};
+
+template <class URBG>
+inline std::uint64_t sampler_bits(URBG& gen, const std::integral_constant<int, 64>&)
+{
+   return static_cast<std::uint64_t>(gen() - (URBG::min)());
+}
+
+template <class URBG>
+inline std::uint64_t sampler_bits(URBG& gen, const std::integral_constant<int, 32>&)
+{
+   std::uint64_t high = static_cast<std::uint64_t>(gen() - (URBG::min)());
+   return (high << 32) | static_cast<std::uint64_t>(gen() - (URBG::min)());
+}
+
+template <class URBG>
+inline std::uint64_t sampler_bits(URBG& gen, const std::integral_constant<int, 0>&)
+{
+   return std::uniform_int_distribution<std::uint64_t>()(gen);
+}
+
+// 64 uniformly distributed bits from any uniform random bit generator:
+template <class URBG>
+inline std::uint64_t sampler_bits(URBG& gen)
+{
+   return sampler_bits(gen, typename sampler_bits_tag<URBG>::type());
+}
+
+// The number of random bits that fit in the significand of Real, at most 53 so that the
+// low order bits of the same draw are free for the ziggurat layer and sign:
+template <class Real>
+struct sampler_digits
+{
+   static constexpr int significand = std::numeric_limits<Real>::is_specialized && (std::numeric_limits<Real>::radix == 2) ? std::numeric_limits<Real>::digits : 53;
+   static constexpr int value = significand < 53 ? significand : 53;
+};
+
+// A uniform variate strictly inside (0, 1): (m + 1/2)/2^d for a d bit integer m never rounds to either end.
+template <class Real, class URBG>
+inline Real sampler_uniform(URBG& gen)
+{
+   constexpr int d = sampler_digits<Real>::value - 1;
+   return (static_cast<Real>(sampler_bits(gen) >> (64 - d)) + constants::half<Real>())/static_cast<Real>(std::uint64_t(1) << d);
+}
+
+// 256 layer ziggurat for a monotone decreasing density f on [0, infinity): layer i is the
+// rectangle of width x[i] between heights f[i] and f[i + 1], and layer 0 also carries the tail beyond r.
+template <class Real>
+struct ziggurat_table
+{
+   static constexpr unsigned layers = 256;
+   Real r;
+   Real unit;
+   int shift;
+   std::array<Real, layers + 1> x;
+   std::array<Real, layers + 1> f;
+};
+
+template <class Real, class F, class FInverse>
+void fill_ziggurat_table(ziggurat_table<Real>& table, Real r, Real v, F f, FInverse f_inverse)
+{
+   BOOST_MATH_STD_USING
+   const unsigned n = ziggurat_table<Real>::layers;
+   table.r = r;
+   table.shift = 64 - sampler_digits<Real>::value;
+   table.unit = ldexp(Real(1), -sampler_digits<Real>::value);
+   table.x[0] = v/f(r);
+   table.x[1] = r;
+   for (unsigned i = 1; i < n; ++i)
+   {
+      // Every layer has area v, the top one is closed off at x = 0 whatever rounding has accumulated:
+      Real y = v/table.x[i] + f(table.x[i]);
+      table.x[i + 1] = (i + 1 < n) && (y < 1) ? Real(f_inverse(y)) : Real(0);
+   }
+   for (unsigned i = 0; i <= n; ++i)
+   {
+      table.f[i] = f(table.x[i]);
+   }
+}
+
+template <class Real>
+ziggurat_table<Real> make_normal_ziggurat()
+{
+   BOOST_MATH_STD_USING
+   ziggurat_table<Real> table;
+   Real r = static_cast<Real>(3.6541528853610087963519472518L);
+   Real v = r*exp(-r*r/2) + constants::root_half_pi<Real>()*boost::math::erfc(r*constants::one_div_root_two<Real>());
+   fill_ziggurat_table(table, r, v,
+      [](Real x) { return Real(exp(-x*x/2)); },
+      [](Real y) { return Real(sqrt(-2*log(y))); });
+   return table;
+}
+
+template <class Real>
+ziggurat_table<Real> make_exponential_ziggurat()
+{
+   BOOST_MATH_STD_USING
+   ziggurat_table<Real> table;
+   Real r = static_cast<Real>(7.6971174701310497140446280481L);
+   Real v = (r + 1)*exp(-r);
+   fill_ziggurat_table(table, r, v,
+      [](Real x) { return Real(exp(-x)); },
+      [](Real y) { return Real(-log(y)); });
+   return table;
+}
+
+template <class Real>
+inline const ziggurat_table<Real>& normal_ziggurat()
+{
+   static const ziggurat_table<Real> table = make_normal_ziggurat<Real>();
+   return table;
+}
+
+template <class Real>
+inline const ziggurat_table<Real>& exponential_ziggurat()
+{
+   static const ziggurat_table<Real> table = make_exponential_ziggurat<Real>();
+   return table;
+}
+
+// The layer comes from the low 8 bits of each draw, the sign from the next, and the position within
+// the layer from the high bits, so that no two of them are correlated (Doornik 2005):
+template <class Real, class URBG>
+Real sample_standard_normal(URBG& gen)
+{
+   BOOST_MATH_STD_USING
+   const ziggurat_table<Real>& t = normal_ziggurat<Real>();
+   for (;;)
+   {
+      std::uint64_t bits = sampler_bits(gen);
+      unsigned i = static_cast<unsigned>(bits & 0xFF);
+      bool negative = (bits & 0x100) != 0;
+      Real z = static_cast<Real>(bits >> t.shift)*t.unit*t.x[i];
+      if (z < t.x[i + 1])
+      {
+         return negative ? Real(-z) : z;
+      }
+      if (i == 0)
+      {
+         // Marsaglia's method for the tail beyond r:
+         Real a;
+         Real e;
+         do
+         {
+            a = -log(sampler_uniform<Real>(gen))/t.r;
+            e = -log(sampler_uniform<Real>(gen));
+         } while (2*e < a*a);
+         z = t.r + a;
+         return negative ? Real(-z) : z;
+      }
+      if (t.f[i] + sampler_uniform<Real>(gen)*(t.f[i + 1] - t.f[i]) < exp(-z*z/2))
+      {
+         return negative ? Real(-z) : z;
+      }
+   }
+}
+
+template <class Real, class URBG>
+Real sample_standard_exponential(URBG& gen)
+{
+   BOOST_MATH_STD_USING
+   const ziggurat_table<Real>& t = exponential_ziggurat<Real>();
+   for (;;)
+   {
+      std::uint64_t bits = sampler_bits(gen);
+      unsigned i = static_cast<unsigned>(bits & 0xFF);
+      Real z = static_cast<Real>(bits >> t.shift)*t.unit*t.x[i];
+      if (z < t.x[i + 1])
+      {
+         return z;
+      }
+      if (i == 0)
+      {
+         // The exponential distribution is memoryless, so the tail is just a shifted copy:
+         return t.r - log(sampler_uniform<Real>(gen));
+      }
+      if (t.f[i] + sampler_uniform<Real>(gen)*(t.f[i + 1] - t.f[i]) < exp(-z))
+      {
+         return z;
+      }
+   }
+}
+
+// Marsaglia and Tsang's squeeze method for a gamma variate of unit scale, boosted by a power
+// of a uniform variate when the shape is less than one:
+template <class Real>
+class gamma_variate
+{
+public:
+   explicit gamma_variate(Real shape)
+   {
+      BOOST_MATH_STD_USING
+      m_small = shape < 1;
+      m_inv_shape = 1/shape;
+      m_d = (m_small ? shape + 1 : shape) - Real(1)/3;
+      m_c = 1/sqrt(9*m_d);
+   }
+
+   template <class URBG>
+   Real operator()(URBG& gen) const
+   {
+      BOOST_MATH_STD_USING
+      Real result;
+      for (;;)
+      {
+         Real x;
+         Real v;
+         do
+         {
+            x = sample_standard_normal<Real>(gen);
+            v = 1 + m_c*x;
+         } while (v <= 0);
+         v = v*v*v;
+         Real u = sampler_uniform<Real>(gen);
+         Real xs = x*x;
+         if ((u < 1 - Real(0.0331)*xs*xs) || (log(u) < xs/2 + m_d*(1 - v + log(v))))
+         {
+            result = m_d*v;
+            break;
+         }
+      }
+      return m_small ? Real(result*pow(sampler_uniform<Real>(gen), m_inv_shape)) : result;
+   }
+
+private:
+   bool m_small;
+   Real m_inv_shape;
+   Real m_d;
+   Real m_c;
+};
+
+// The affine map from the standard distribution to dist is location + scale*(x - bias):
+template <class Distribution>
+inline typename Distribution::value_type sampler_bias(const Distribution&)
+{
+   return 0;
+}
+
+template <class RealType, class Policy>
+inline RealType sampler_bias(const landau_distribution<RealType, Policy>& dist)
+{
+   return dist.bias();
+}
+
+// The quantile of the standard member of a location-scale family, tabulated once per type over the
+// central 1 - 2^-9 of probability to a relative accuracy of about epsilon^(3/4); draws in the tails
+// call the quantile of the distribution directly.
+template <class Distribution>
+class quantile_table_sampler
+{
+public:
+   typedef Distribution distribution_type;
+   typedef typename Distribution::value_type value_type;
+
+   explicit quantile_table_sampler(const Distribution& dist)
+      : m_dist(dist), m_location(dist.location()), m_scale(dist.scale()), m_bias(sampler_bias(dist))
+   {
+   }
+
+   const Distribution& distribution() const
+   {
+      return m_dist;
+   }
+
+   static value_type tail_probability()
+   {
+      return value_type(1)/1024;
+   }
+
+   static const piecewise_chebyshev<value_type>& table()
+   {
+      static const piecewise_chebyshev<value_type> t = make_table();
+      return t;
+   }
+
+   template <class URBG>
+   value_type operator()(URBG& gen) const
+   {
+      return transform(sampler_uniform<value_type>(gen), table());
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      // Uniforms are drawn a block at a time, and the central ones passed to the table together:
+      const piecewise_chebyshev<value_type>& t = table();
+      const value_type p = tail_probability();
+      std::array<value_type, 256> u;
+      std::array<value_type, 256> central;
+      while (first != last)
+      {
+         std::size_t n = 0;
+         std::size_t m = 0;
+         for (ForwardIterator it = first; (it != last) && (n < u.size()); ++it)
+         {
+            value_type v = sampler_uniform<value_type>(gen);
+            u[n++] = v;
+            if ((v >= p) && (v <= 1 - p))
+            {
+               central[m++] = v;
+            }
+         }
+         t(central.begin(), central.begin() + m, central.begin());
+         for (std::size_t i = 0, j = 0; i < n; ++i, ++first)
+         {
+            value_type v = u[i];
+            *first = (v >= p) && (v <= 1 - p) ? value_type(m_location + m_scale*(central[j++] - m_bias)) : value_type(quantile(m_dist, v));
+         }
+      }
+   }
+
+private:
+   static piecewise_chebyshev<value_type> make_table()
+   {
+      BOOST_MATH_STD_USING
+      const Distribution standard(0, 1);
+      value_type p = tail_probability();
+      // Going much below epsilon^(3/4) only resolves the joins between the rational approximations
+      // making up the quantile, and multiplies the size of the table for no statistical benefit:
+      value_type tol = ldexp(value_type(1), -3*tools::digits<value_type>()/4);
+      return piecewise_chebyshev<value_type>([&standard](value_type q) { return quantile(standard, q); }, p, 1 - p, tol, tol, 12, 20);
+   }
+
+   value_type transform(value_type u, const piecewise_chebyshev<value_type>& t) const
+   {
+      value_type p = tail_probability();
+      if (!((u >= p) && (u <= 1 - p)))
+      {
+         return quantile(m_dist, u);
+      }
+      return m_location + m_scale*(t(u) - m_bias);
+   }
+
+   Distribution m_dist;
+   value_type m_location;
+   value_type m_scale;
+   value_type m_bias;
+};
+
+// Discrete distributions are inverted to the smallest k with cdf(k) >= u, which is what sampling
+// requires whatever rounding the distribution's discrete_quantile policy asks for:
+template <class Distribution>
+struct sampler_is_discrete : public std::false_type {};
+
+template <class RealType, class Policy>
+struct sampler_is_discrete<bernoulli_distribution<RealType, Policy>> : public std::true_type {};
+
+template <class RealType, class Policy>
+struct sampler_is_discrete<binomial_distribution<RealType, Policy>> : public std::true_type {};
+
+template <class RealType, class Policy>
+struct sampler_is_discrete<geometric_distribution<RealType, Policy>> : public std::true_type {};
+
+template <class RealType, class Policy>
+struct sampler_is_discrete<hypergeometric_distribution<RealType, Policy>> : public std::true_type {};
+
+template <class RealType, class Policy>
+struct sampler_is_discrete<negative_binomial_distribution<RealType, Policy>> : public std::true_type {};
+
+template <class RealType, class Policy>
+struct sampler_is_discrete<poisson_distribution<RealType, Policy>> : public std::true_type {};
+
+template <class Distribution>
+inline typename Distribution::value_type sampler_invert(const Distribution& dist, typename Distribution::value_type u, const std::false_type&)
+{
+   return quantile(dist, u);
+}
+
+template <class Distribution>
+typename Distribution::value_type sampler_invert(const Distribution& dist, typename Distribution::value_type u, const std::true_type&)
+{
+   BOOST_MATH_STD_USING
+   typedef typename Distribution::value_type value_type;
+   value_type k = floor(quantile(dist, u));
+   value_type lowest = support(dist).first;
+   while ((k > lowest) && (cdf(dist, value_type(k - 1)) >= u))
+   {
+      --k;
+   }
+   while (cdf(dist, k) < u)
+   {
+      ++k;
+   }
+   return k;
+}
+
+template <class Sampler, class URBG, class ForwardIterator>
+inline void sampler_fill(const Sampler& s, URBG& gen, ForwardIterator first, ForwardIterator last)
+{
+   for (; first != last; ++first)
+   {
+      *first = s(gen);
+   }
+}
+
+} // namespace detail
+
+// Draws random variates from a distribution given a uniform random bit generator such as std::mt19937_64.
+// The general case inverts the distribution's quantile; the specializations below use faster
+// methods specific to each distribution.
+template <class Distribution>
+class sampler
+{
+public:
+   typedef Distribution distribution_type;
+   typedef typename Distribution::value_type value_type;
+
+   explicit sampler(const Distribution& dist) : m_dist(dist) {}
+
+   const Distribution& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   value_type operator()(URBG& gen) const
+   {
+      return detail::sampler_invert(m_dist, detail::sampler_uniform<value_type>(gen), detail::sampler_is_discrete<Distribution>());
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   Distribution m_dist;
+};
+
+template <class RealType, class Policy>
+class sampler<normal_distribution<RealType, Policy>>
+{
+public:
+   typedef normal_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist) : m_dist(dist) {}
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      return m_dist.mean() + m_dist.standard_deviation()*detail::sample_standard_normal<RealType>(gen);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+};
+
+template <class RealType, class Policy>
+class sampler<lognormal_distribution<RealType, Policy>>
+{
+public:
+   typedef lognormal_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist) : m_dist(dist) {}
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      BOOST_MATH_STD_USING
+      return exp(m_dist.location() + m_dist.scale()*detail::sample_standard_normal<RealType>(gen));
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+};
+
+template <class RealType, class Policy>
+class sampler<exponential_distribution<RealType, Policy>>
+{
+public:
+   typedef exponential_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist) : m_dist(dist), m_scale(1/dist.lambda()) {}
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      return m_scale*detail::sample_standard_exponential<RealType>(gen);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+   RealType m_scale;
+};
+
+template <class RealType, class Policy>
+class sampler<gamma_distribution<RealType, Policy>>
+{
+public:
+   typedef gamma_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist) : m_dist(dist), m_gamma(dist.shape()) {}
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      return m_dist.scale()*m_gamma(gen);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+   detail::gamma_variate<RealType> m_gamma;
+};
+
+template <class RealType, class Policy>
+class sampler<chi_squared_distribution<RealType, Policy>>
+{
+public:
+   typedef chi_squared_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist) : m_dist(dist), m_gamma(dist.degrees_of_freedom()/2) {}
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      return 2*m_gamma(gen);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+   detail::gamma_variate<RealType> m_gamma;
+};
+
+template <class RealType, class Policy>
+class sampler<beta_distribution<RealType, Policy>>
+{
+public:
+   typedef beta_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist) : m_dist(dist), m_x(dist.alpha()), m_y(dist.beta()) {}
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      RealType x = m_x(gen);
+      RealType y = m_y(gen);
+      // Both variates can underflow when both shapes are tiny, the quantile is then the only option:
+      if (x + y == 0)
+      {
+         return quantile(m_dist, detail::sampler_uniform<RealType>(gen));
+      }
+      return x/(x + y);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+   detail::gamma_variate<RealType> m_x;
+   detail::gamma_variate<RealType> m_y;
+};
+
+template <class RealType, class Policy>
+class sampler<students_t_distribution<RealType, Policy>>
+{
+public:
+   typedef students_t_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_dist(dist), m_finite((boost::math::isfinite)(dist.degrees_of_freedom())),
+        m_gamma(m_finite ? dist.degrees_of_freedom()/2 : RealType(1))
+   {
+   }
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      BOOST_MATH_STD_USING
+      RealType z = detail::sample_standard_normal<RealType>(gen);
+      if (!m_finite)
+      {
+         return z;
+      }
+      return z*sqrt(m_dist.degrees_of_freedom()/(2*m_gamma(gen)));
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+   bool m_finite;
+   detail::gamma_variate<RealType> m_gamma;
+};
+
+template <class RealType, class Policy>
+class sampler<fisher_f_distribution<RealType, Policy>>
+{
+public:
+   typedef fisher_f_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_dist(dist), m_ratio(dist.degrees_of_freedom2()/dist.degrees_of_freedom1()),
+        m_numerator(dist.degrees_of_freedom1()/2), m_denominator(dist.degrees_of_freedom2()/2)
+   {
+   }
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      RealType x = m_numerator(gen);
+      return m_ratio*x/m_denominator(gen);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+   RealType m_ratio;
+   detail::gamma_variate<RealType> m_numerator;
+   detail::gamma_variate<RealType> m_denominator;
+};
+
+// With k >= 1 degrees of freedom the non-central chi squared variate is (Z + sqrt(lambda))^2 plus a
+// central chi squared variate on k - 1 degrees of freedom.  Otherwise it is a Poisson mixture
+// of central chi squared variates, with the Poisson variate drawn by sequential search, or the
+// quantile inverted when the Poisson probabilities underflow.
+template <class RealType, class Policy>
+class sampler<non_central_chi_squared_distribution<RealType, Policy>>
+{
+public:
+   typedef non_central_chi_squared_distribution<RealType, Policy> distribution_type;
+   typedef RealType value_type;
+
+   explicit sampler(const distribution_type& dist)
+      : m_dist(dist), m_shift(0), m_mixture(dist.degrees_of_freedom() < 1),
+        m_central(m_mixture ? RealType(1) : RealType(dist.degrees_of_freedom() - 1)/2)
+   {
+      BOOST_MATH_STD_USING
+      m_shift = sqrt(dist.non_centrality());
+   }
+
+   const distribution_type& distribution() const
+   {
+      return m_dist;
+   }
+
+   template <class URBG>
+   RealType operator()(URBG& gen) const
+   {
+      BOOST_MATH_STD_USING
+      RealType k = m_dist.degrees_of_freedom();
+      if (!m_mixture)
+      {
+         RealType z = detail::sample_standard_normal<RealType>(gen) + m_shift;
+         return z*z + (k > 1 ? RealType(2*m_central(gen)) : RealType(0));
+      }
+      RealType half_lambda = m_dist.non_centrality()/2;
+      RealType u = detail::sampler_uniform<RealType>(gen);
+      RealType term = exp(-half_lambda);
+      RealType cdf = term;
+      if (term == 0)
+      {
+         return quantile(m_dist, u);
+      }
+      unsigned n = 0;
+      while ((u > cdf) && (term > 0))
+      {
+         ++n;
+         term *= half_lambda/n;
+         cdf += term;
+      }
+      return 2*detail::gamma_variate<RealType>(k/2 + n)(gen);
+   }
+
+   template <class URBG, class ForwardIterator>
+   void fill(URBG& gen, ForwardIterator first, ForwardIterator last) const
+   {
+      detail::sampler_fill(*this, gen, first, last);
+   }
+
+private:
+   distribution_type m_dist;
+   RealType m_shift;
+   bool m_mixture;
+   detail::gamma_variate<RealType> m_central;
+};
+
+// The stable family (and the Map-Airy distribution) have quantiles built from many piecewise rational
+// approximations; sampling goes through a single Chebyshev table of the standard quantile instead.
+template <class RealType, class Policy>
+class sampler<landau_distribution<RealType, Policy>> : public detail::quantile_table_sampler<landau_distribution<RealType, Policy>>
+{
+public:
+   using detail::quantile_table_sampler<landau_distribution<RealType, Policy>>::quantile_table_sampler;
+};
+
+template <class RealType, class Policy>
+class sampler<holtsmark_distribution<RealType, Policy>> : public detail::quantile_table_sampler<holtsmark_distribution<RealType, Policy>>
+{
+public:
+   using detail::quantile_table_sampler<holtsmark_distribution<RealType, Policy>>::quantile_table_sampler;
+};
+
+template <class RealType, class Policy>
+class sampler<saspoint5_distribution<RealType, Policy>> : public detail::quantile_table_sampler<saspoint5_distribution<RealType, Policy>>
+{
+public:
+   using detail::quantile_table_sampler<saspoint5_distribution<RealType, Policy>>::quantile_table_sampler;
+};
+
+template <class RealType, class Policy>
+class sampler<mapairy_distribution<RealType, Policy>> : public detail::quantile_table_sampler<mapairy_distribution<RealType, Policy>>
+{
+public:
+   using detail::quantile_table_sampler<mapairy_distribution<RealType, Policy>>::quantile_table_sampler;
+};
+
+}} // namespaces
+
+#endif // BOOST_MATH_DISTRIBUTIONS_SAMPLER_HPP
@@ -22,6 +22,7 @@
 #include <boost/math/distributions/complement.hpp>
 #include <boost/math/distributions/detail/common_error_handling.hpp>
 #include <boost/math/distributions/normal.hpp> 
+#include <boost/math/distributions/detail/log_incomplete.hpp>
 #include <boost/math/policies/policy.hpp>
 
 #ifdef _MSC_VER
@@ -137,6 +138,41 @@ BOOST_MATH_GPU_ENABLED inline RealType pdf(const students_t_distribution<RealTyp
    return result;
 } // pdf
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logpdf(const students_t_distribution<RealType, Policy>& dist, const RealType& x)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   BOOST_MATH_STD_USING  // for ADL of std functions.
+
+   RealType error_result;
+   if(false == detail::check_x_not_NaN(
+      "boost::math::logpdf(const students_t_distribution<%1%>&, %1%)", x, &error_result, Policy()))
+      return error_result;
+   RealType df = dist.degrees_of_freedom();
+   if(false == detail::check_df_gt0_to_inf( // Check that df > 0 or == +infinity.
+      "boost::math::logpdf(const students_t_distribution<%1%>&, %1%)", df, &error_result, Policy()))
+      return error_result;
+
+   if ((boost::math::isinf)(x))
+   { // - or +infinity.
+     return -boost::math::numeric_limits<RealType>::infinity();
+   }
+   RealType limit = policies::get_epsilon<RealType, Policy>();
+   limit = static_cast<RealType>(1) / limit; // 1/eps
+   if (df > limit)
+   { // Special case for really big degrees_of_freedom > 1 / eps, as for the pdf.
+     normal_distribution<RealType, Policy> n(0, 1);
+     return logpdf(n, x);
+   }
+   //
+   // log(pdf) = -(df + 1)/2 * log(1 + x^2/df) - log(sqrt(df) * beta(df/2, 1/2)),
+   // where for very large |x| log(1 + x^2/df) = 2 log|x| - log(df) to working precision:
+   //
+   RealType basem1 = x * x / df;
+   RealType log_base = (boost::math::isfinite)(basem1) ? RealType(boost::math::log1p(basem1, Policy())) : RealType(2 * log(fabs(x)) - log(df));
+   return -log_base * (df + 1) / 2 - log(df) / 2 - detail::log_beta(RealType(df / 2), RealType(0.5f), Policy());
+} // logpdf
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType cdf(const students_t_distribution<RealType, Policy>& dist, const RealType& x)
 {
@@ -211,6 +247,74 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const students_t_distribution<RealTyp
   }
 } // cdf
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const students_t_distribution<RealType, Policy>& dist, const RealType& x)
+{
+   BOOST_MATH_STD_USING  // for ADL of std functions.
+
+   RealType error_result;
+   // degrees_of_freedom > 0 or infinity check:
+   RealType df = dist.degrees_of_freedom();
+   if (false == detail::check_df_gt0_to_inf(  // Check that df > 0 or == +infinity.
+     "boost::math::logcdf(const students_t_distribution<%1%>&, %1%)", df, &error_result, Policy()))
+   {
+     return error_result;
+   }
+   // Check for bad x first.
+   if(false == detail::check_x_not_NaN(
+      "boost::math::logcdf(const students_t_distribution<%1%>&, %1%)", x, &error_result, Policy()))
+   {
+      return error_result;
+   }
+   if (x == 0)
+   { // Special case with exact result.
+     return -constants::ln_two<RealType>();
+   }
+   if ((boost::math::isinf)(x))
+   { // x == - or + infinity, regardless of df.
+     return ((x < 0) ? -boost::math::numeric_limits<RealType>::infinity() : static_cast<RealType>(0));
+   }
+
+   RealType limit = policies::get_epsilon<RealType, Policy>();
+   limit = static_cast<RealType>(1) / limit; // 1/eps
+   if (df > limit)
+   { // Special case for really big degrees_of_freedom > 1 / eps, as for the cdf.
+     normal_distribution<RealType, Policy> n(0, 1);
+     return logcdf(n, x);
+   }
+   //
+   // As for the cdf, the probability beyond |x| is ibeta(df / 2, 1/2, df / (df + x^2)) / 2,
+   // which is the part that may underflow, so below zero is found directly in logs:
+   //
+   RealType x2 = x * x;
+   if(x > 0)
+   {
+      RealType probability;
+      if(df > 2 * x2)
+      {
+         RealType z = x2 / (df + x2);
+         probability = ibetac(static_cast<RealType>(0.5), df / 2, z, Policy()) / 2;
+      }
+      else
+      {
+         RealType z = df / (df + x2);
+         probability = ibeta(df / 2, static_cast<RealType>(0.5), z, Policy()) / 2;
+      }
+      return boost::math::log1p(-probability, Policy());
+   }
+   if(df > 2 * x2)
+   {
+      RealType z = x2 / (df + x2);
+      return log(ibetac(static_cast<RealType>(0.5), df / 2, z, Policy()) / 2);
+   }
+   if((boost::math::isfinite)(x2))
+   {
+      return detail::log_ibeta(df / 2, static_cast<RealType>(0.5), RealType(df / (df + x2)), RealType(x2 / (df + x2)), false, Policy()) - constants::ln_two<RealType>();
+   }
+   // x^2 overflows, so only the leading term ibeta(a, b, z) = z^a / (a beta(a, b)) remains, with z = df / x^2:
+   return (df / 2) * (log(df) - 2 * log(-x)) - log(df) - detail::log_beta(RealType(df / 2), static_cast<RealType>(0.5), Policy());
+} // logcdf
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const students_t_distribution<RealType, Policy>& dist, const RealType& p)
 {
@@ -271,6 +375,12 @@ BOOST_MATH_GPU_ENABLED inline RealType cdf(const complemented2_type<students_t_d
    return cdf(c.dist, -c.param);
 }
 
+template <class RealType, class Policy>
+BOOST_MATH_GPU_ENABLED inline RealType logcdf(const complemented2_type<students_t_distribution<RealType, Policy>, RealType>& c)
+{
+   return logcdf(c.dist, -c.param);
+}
+
 template <class RealType, class Policy>
 BOOST_MATH_GPU_ENABLED inline RealType quantile(const complemented2_type<students_t_distribution<RealType, Policy>, RealType>& c)
 {
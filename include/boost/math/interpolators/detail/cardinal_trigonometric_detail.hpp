@@ -7,8 +7,15 @@
 #define BOOST_MATH_INTERPOLATORS_DETAIL_CARDINAL_TRIGONOMETRIC_HPP
 #include <cstddef>
 #include <cmath>
+#include <complex>
+#include <vector>
 #include <stdexcept>
 #include <boost/math/constants/constants.hpp>
+#include <boost/math/tools/fft.hpp>
+
+// FFTW is an optional accelerator for float, double, long double and __float128;
+// every other type, and every type when BOOST_MATH_USE_FFTW is not defined, uses the built-in transform.
+#ifdef BOOST_MATH_USE_FFTW
 
 #ifdef BOOST_HAS_FLOAT128
 #include <quadmath.h>
@@ -18,30 +25,149 @@
 #  if __has_include(<fftw3.h>)
 #    include <fftw3.h>
 #  else
-#    error "This feature is unavailable without fftw3 installed"
+#    error "BOOST_MATH_USE_FFTW is defined, but fftw3 is not installed"
 #endif
+#else
+#  include <fftw3.h>
 #endif
 
+#endif // BOOST_MATH_USE_FFTW
+
 namespace boost { namespace math { namespace interpolators { namespace detail {
 
 template<typename Real>
 class cardinal_trigonometric_detail {
 public:
-  cardinal_trigonometric_detail(const Real* data, size_t length, Real t0, Real h)
+  cardinal_trigonometric_detail(const Real* data, size_t length, Real t0, Real h) : m_t0{t0}, m_h{h}
+  {
+    if (length == 0)
+    {
+      throw std::logic_error("At least one sample is required.");
+    }
+    if (h <= 0)
+    {
+      throw std::logic_error("The step size must be > 0");
+    }
+    // The period sadly must be stored, since the complex vector has length that cannot be used to recover the period:
+    m_T = m_h*length;
+    m_complex_vector_size = length/2 + 1;
+    m_gamma.resize(m_complex_vector_size);
+    boost::math::tools::real_fft(data, length, m_gamma.data());
+
+    Real denom = length;
+    for (size_t k = 0; k < m_complex_vector_size; ++k)
+    {
+      m_gamma[k] /= denom;
+    }
+
+    if (length % 2 == 0)
+    {
+      m_gamma[m_complex_vector_size -1] = std::complex<Real>(m_gamma[m_complex_vector_size -1].real()/2, m_gamma[m_complex_vector_size -1].imag());
+    }
+  }
+
+  cardinal_trigonometric_detail(const cardinal_trigonometric_detail& old)  = delete;
+
+  cardinal_trigonometric_detail& operator=(const cardinal_trigonometric_detail&) = delete;
+
+  cardinal_trigonometric_detail(cardinal_trigonometric_detail &&) = delete;
+
+  Real operator()(Real t) const
   {
-    m_data = data;
-    m_length = length;
-    m_t0 = t0;
-    m_h = h;
-    throw std::domain_error("Not implemented.");
+    using std::sin;
+    using std::cos;
+    using boost::math::constants::two_pi;
+    Real s = m_gamma[0].real();
+    Real x = two_pi<Real>()*(t - m_t0)/m_T;
+    Real z0 = cos(x);
+    Real z1 = sin(x);
+    Real b0 = 0;
+    Real b1 = 0;
+    for (size_t k = m_complex_vector_size - 1; k >= 1; --k) {
+      // b = gamma_k + b*z
+      Real u0 = b0*z0 - b1*z1;
+      Real u1 = b0*z1 + b1*z0;
+      b0 = m_gamma[k].real() + u0;
+      b1 = m_gamma[k].imag() + u1;
+    }
+
+    s += 2*(b0*z0 - b1*z1);
+    return s;
   }
+
+  Real prime(Real t) const
+  {
+      using std::sin;
+      using std::cos;
+      using boost::math::constants::two_pi;
+      Real x = two_pi<Real>()*(t - m_t0)/m_T;
+      Real z0 = cos(x);
+      Real z1 = sin(x);
+      Real b0 = 0;
+      Real b1 = 0;
+      for (size_t k = m_complex_vector_size - 1; k >= 1; --k)
+      {
+        Real u0 = b0*z0 - b1*z1;
+        Real u1 = b0*z1 + b1*z0;
+        b0 = k*m_gamma[k].real() + u0;
+        b1 = k*m_gamma[k].imag() + u1;
+      }
+      return -2*two_pi<Real>()*(b1*z0 + b0*z1)/m_T;
+  }
+
+  Real double_prime(Real t) const
+  {
+      using std::sin;
+      using std::cos;
+      using boost::math::constants::two_pi;
+      Real x = two_pi<Real>()*(t - m_t0)/m_T;
+      Real z0 = cos(x);
+      Real z1 = sin(x);
+      Real b0 = 0;
+      Real b1 = 0;
+      for (size_t k = m_complex_vector_size - 1; k >= 1; --k)
+      {
+        Real u0 = b0*z0 - b1*z1;
+        Real u1 = b0*z1 + b1*z0;
+        b0 = k*k*m_gamma[k].real() + u0;
+        b1 = k*k*m_gamma[k].imag() + u1;
+      }
+      return -2*two_pi<Real>()*two_pi<Real>()*(b0*z0 - b1*z1)/(m_T*m_T);
+  }
+
+  Real period() const
+  {
+    return m_T;
+  }
+
+  Real integrate() const
+  {
+    return m_T*m_gamma[0].real();
+  }
+
+  Real squared_l2() const
+  {
+    Real s = 0;
+    // Always add smallest to largest for accuracy.
+    for (size_t i = m_complex_vector_size - 1; i >= 1; --i)
+    {
+        s += (m_gamma[i].real()*m_gamma[i].real() + m_gamma[i].imag()*m_gamma[i].imag());
+    }
+    s *= 2;
+    s += m_gamma[0].real()*m_gamma[0].real();
+    return s*m_T;
+  }
+
 private:
-  size_t m_length;
   Real m_t0;
   Real m_h;
-  Real* m_data;
+  Real m_T;
+  std::vector<std::complex<Real>> m_gamma;
+  size_t m_complex_vector_size;
 };
 
+#ifdef BOOST_MATH_USE_FFTW
+
 template<>
 class cardinal_trigonometric_detail<float> {
 public:
@@ -680,5 +806,7 @@ private:
 };
 #endif
 
+#endif // BOOST_MATH_USE_FFTW
+
 }}}}
 #endif
@@ -6,9 +6,15 @@
 #ifndef BOOST_MATH_SPECIAL_CHEBYSHEV_TRANSFORM_HPP
 #define BOOST_MATH_SPECIAL_CHEBYSHEV_TRANSFORM_HPP
 #include <cmath>
+#include <vector>
 #include <type_traits>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/chebyshev.hpp>
+#include <boost/math/tools/fft.hpp>
+
+// FFTW is an optional accelerator for float, double, long double and __float128;
+// every other type, and every type when BOOST_MATH_USE_FFTW is not defined, uses the built-in transform.
+#ifdef BOOST_MATH_USE_FFTW
 
 #ifdef BOOST_HAS_FLOAT128
 #include <quadmath.h>
@@ -18,14 +24,41 @@
 #  if __has_include(<fftw3.h>)
 #    include <fftw3.h>
 #  else
-#    error "This feature is unavailable without fftw3 installed"
+#    error "BOOST_MATH_USE_FFTW is defined, but fftw3 is not installed"
 #endif
+#else
+#  include <fftw3.h>
 #endif
 
+#endif // BOOST_MATH_USE_FFTW
+
 namespace boost { namespace math {
 
 namespace detail{
 
+// Built-in type II DCT with the FFTW REDFT10 conventions:
+template <class T>
+struct builtin_cos_transform
+{
+   builtin_cos_transform(int n, T*, T*) : m_n(static_cast<std::size_t>(n)) {}
+   void execute(T* data1, T* data2)
+   {
+      tools::dct_2(data1, m_n, data2);
+   }
+   static T cos(T x) { using std::cos; return cos(x); }
+   static T fabs(T x) { using std::fabs; return fabs(x); }
+private:
+   std::size_t m_n;
+};
+
+template <class T>
+struct cos_transform : public builtin_cos_transform<T>
+{
+   using builtin_cos_transform<T>::builtin_cos_transform;
+};
+
+#ifdef BOOST_MATH_USE_FFTW
+
 template <class T>
 struct fftw_cos_transform;
 
@@ -113,7 +146,33 @@ private:
    fftwq_plan plan;
 };
 
+template<>
+struct cos_transform<__float128> : public fftw_cos_transform<__float128>
+{
+   using fftw_cos_transform<__float128>::fftw_cos_transform;
+};
+
 #endif
+
+template<>
+struct cos_transform<float> : public fftw_cos_transform<float>
+{
+   using fftw_cos_transform<float>::fftw_cos_transform;
+};
+
+template<>
+struct cos_transform<double> : public fftw_cos_transform<double>
+{
+   using fftw_cos_transform<double>::fftw_cos_transform;
+};
+
+template<>
+struct cos_transform<long double> : public fftw_cos_transform<long double>
+{
+   using fftw_cos_transform<long double>::fftw_cos_transform;
+};
+
+#endif // BOOST_MATH_USE_FFTW
 }
 
 template<class Real>
@@ -144,12 +203,12 @@ public:
             vf.resize(n);
             m_coeffs.resize(n);
 
-            detail::fftw_cos_transform<Real> plan(static_cast<int>(n), vf.data(), m_coeffs.data());
+            detail::cos_transform<Real> plan(static_cast<int>(n), vf.data(), m_coeffs.data());
             Real inv_n = 1/static_cast<Real>(n);
             for(size_t j = 0; j < n/2; ++j)
             {
                 // Use symmetry cos((j+1/2)pi/n) = - cos((n-1-j+1/2)pi/n)
-                Real y = detail::fftw_cos_transform<Real>::cos(pi<Real>()*(j+half<Real>())*inv_n);
+                Real y = detail::cos_transform<Real>::cos(pi<Real>()*(j+half<Real>())*inv_n);
                 vf[j] = f(y*bma + bpa)*inv_n;
                 vf[n-1-j]= f(bpa-y*bma)*inv_n;
             }
@@ -158,9 +217,9 @@ public:
             Real max_coeff = 0;
             for (auto const & coeff : m_coeffs)
             {
-                if (detail::fftw_cos_transform<Real>::fabs(coeff) > max_coeff)
+                if (detail::cos_transform<Real>::fabs(coeff) > max_coeff)
                 {
-                    max_coeff = detail::fftw_cos_transform<Real>::fabs(coeff);
+                    max_coeff = detail::cos_transform<Real>::fabs(coeff);
                 }
             }
             size_t j = m_coeffs.size() - 1;
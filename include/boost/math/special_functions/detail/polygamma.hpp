@@ -12,8 +12,10 @@
   #define _BOOST_POLYGAMMA_DETAIL_2013_07_30_HPP_
 
 #include <cmath>
+#include <cstddef>
 #include <limits>
 #include <string>
+#include <vector>
 #include <boost/math/policies/policy.hpp>
 #include <boost/math/special_functions/bernoulli.hpp>
 #include <boost/math/special_functions/trunc.hpp>
@@ -550,6 +552,108 @@ namespace boost { namespace math { namespace detail{
     }
   }
 
+  template<class T, class Policy>
+  void polygamma_imp_batch(const int n, const T* x, T* result, std::size_t count, const Policy& pol)
+  {
+    BOOST_MATH_STD_USING
+    static const char* function = "boost::math::polygamma<%1%>(int, %1%)";
+    polygamma_initializer<T, Policy>::initializer.force_instantiate();
+    if((n < 2) || (n >= (int)boost::math::max_factorial<T>::value))
+    {
+       for(std::size_t i = 0; i < count; ++i)
+          result[i] = polygamma_imp(n, x[i], pol);
+       return;
+    }
+    //
+    // Away from the origin polygamma_attransitionplus shifts x up to N with the recurrence
+    // and then sums the asymptotic series of polygamma_atinfinityplus.  For a fixed order the
+    // series coefficients do not depend on x, so here they are tabulated once per batch,
+    // scaled by (n-1)! and truncated where they become negligible at z = N:
+    //
+    //   polygamma(n, z) ~ (-1)^(n+1) (n-1)! z^-n [1 + n / 2z + sum coef[k] / z^2(k+1)]
+    //
+    // Each argument then costs the recurrence plus a single polynomial evaluation in 1/z^2.
+    // Anything the tabulated series can't handle goes to the scalar code.
+    //
+    const int N = static_cast<int>(0.4F * policies::digits_base10<T, Policy>()) + 4 * n;
+    const T w_min = 1 / (T(N) * N);
+    std::vector<T> coef;
+    T part_term = 1;
+    T w_power = 1;
+    for(unsigned k = 1;; ++k)
+    {
+       part_term *= T(n + 2 * k - 2) * (n + 2 * k - 1);
+       part_term /= T(2 * k - 1) * (2 * k);
+       w_power *= w_min;
+       coef.push_back(part_term * boost::math::bernoulli_b2n<T>(k, pol));
+       if(fabs(coef.back() * w_power) < tools::epsilon<T>())
+          break;
+       if(k > policies::get_max_series_iterations<Policy>())
+       {
+          policies::raise_evaluation_error<T>(function, "Series did not converge, closest value was %1%", coef.back(), pol);
+          break;
+       }
+    }
+    const T n_factorial = boost::math::unchecked_factorial<T>(n);
+    const T n_minus_one_factorial = boost::math::unchecked_factorial<T>(n - 1);
+    const T small_x_limit = (std::min)(T(T(5) / n), T(0.25f));
+    for(std::size_t i = 0; i < count; ++i)
+    {
+       T z = x[i];
+       if(!(z >= small_x_limit) || (z == 1) || (z == 0.5f) || !(boost::math::isfinite)(z))
+       {
+          result[i] = polygamma_imp(n, z, pol);
+          continue;
+       }
+       //
+       // Calling pow for each recurrence term dominates the run time, so for low orders
+       // we use repeated squaring instead, whose error grows with n but is at most a few eps here:
+       //
+       T sum0 = 0;
+       if(z < N)
+       {
+          for(int k = N - itrunc(z); k > 0; --k)
+          {
+             if(n < 16)
+             {
+                T base = 1 / z;
+                T term = 1;
+                for(int p = n + 1; p != 0; p >>= 1)
+                {
+                   if(p & 1)
+                      term *= base;
+                   base *= base;
+                }
+                sum0 += term;
+             }
+             else
+                sum0 += pow(z, T(-n - 1));
+             z += 1;
+          }
+       }
+       T w = 1 / (z * z);
+       T series = coef.back();
+       for(std::size_t k = coef.size() - 1; k > 0; --k)
+          series = series * w + coef[k - 1];
+       series *= w;
+       //
+       // z^-n, and z^-(n+1) for the recurrence terms, may be denormal while the result
+       // is still finite and non-zero, having lost most of its digits:
+       //
+       const T z_power = pow(z, T(-n));
+       const T leading = n_minus_one_factorial * z_power;
+       T r = n_factorial * sum0 + leading * (1 + n / (2 * z) + series);
+       if((r == 0) || !(boost::math::isfinite)(r) || (z_power / z < tools::min_value<T>()) || (leading < tools::min_value<T>()))
+       {
+          // Overflow or underflow somewhere, the scalar code switches to logarithms for these:
+          r = polygamma_imp(n, x[i], pol);
+       }
+       else if((n - 1) & 1)
+          r = -r;
+       result[i] = r;
+    }
+  }
+
 } } } // namespace boost::math::detail
 
 #ifdef _MSC_VER
@@ -74,6 +74,11 @@ BOOST_MATH_INSTRUMENT_LAMBERT_W_SMALL_Z_SERIES_ITERATIONS  // Show evaluation of
 #include <exception>
 #include <type_traits>
 #include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <vector>
+#include <algorithm>
 
 // Needed for testing and diagnostics only.
 #include <iostream>
@@ -2052,6 +2057,242 @@ T lambert_wm1_imp(const T z, const Policy&  pol)
 //      } // Schroeder or Schroeder and Halley.
     }
   } // template<typename T = double> T lambert_wm1_imp(const T z)
+
+// Batch evaluation
+// ==============================================================================================
+//
+// The scalar code selects among many approximations per call, which is all branches.
+// For a batch we instead use a single method for almost every argument, whose inner loop is
+// straight-line arithmetic plus one table lookup:
+//
+// * The argument is mapped to u > 0 (u = z + 1/e for W0, and u = -z for W-1), and the table
+//   cell is read off the binary exponent and the leading mantissa bits of u, so the cells
+//   have constant relative width and no search is required.
+// * Quadratic interpolation of W across the cell gives an estimate good to about 8 significant digits,
+//   except close to the origin on W0, where we interpolate W(z)/z instead so that the
+//   relative error stays small as z -> 0.
+// * exp(w) is obtained from exp(W) tabulated at the cell midpoint and a short Taylor
+//   series in w - W, so the refinement needs no transcendental functions either.
+// * A fixed number of Halley steps (one for up to double precision, two for up to 64 bits) then
+//   completes the evaluation.
+//
+// Arguments outside the tabulated range, including those close to the branch point at -1/e,
+// where Halley's method loses its rapid convergence, go to the scalar code.
+//
+template <typename T>
+struct lambert_w_batch_table
+{
+   static constexpr int mantissa_bits = 6;
+   static constexpr int cells_per_octave = 1 << mantissa_bits;
+   // Each cell holds {a0, a1, a2, b0, b1, b2, W, exp(W)}: the starting estimate at position t in [0, 1)
+   // across the cell is a0 + t * (a1 + t * a2) + z * (b0 + t * (b1 + t * b2)), and W is at the midpoint
+   // of the cell.  Keeping them together means each lookup touches a single cache line:
+   static constexpr int stride = 8;
+
+   T shift;        // u = sign * z + shift
+   T sign;
+   int min_exponent;  // Tabulated range is 2^min_exponent <= u < 2^max_exponent.
+   int max_exponent;
+   T u_min;
+   T u_max;
+   std::vector<T> cells;
+
+   template <class F>
+   lambert_w_batch_table(T shift_, T sign_, int min_exponent_, int max_exponent_, F f)
+      : shift(shift_), sign(sign_), min_exponent(min_exponent_), max_exponent(max_exponent_)
+   {
+      BOOST_MATH_STD_USING
+      u_min = ldexp(T(1), min_exponent);
+      u_max = ldexp(T(1), max_exponent);
+      std::size_t count = static_cast<std::size_t>(max_exponent - min_exponent) * cells_per_octave;
+      // W at the cell edges (even k) and midpoints (odd k):
+      std::vector<T> w(2 * count + 1);
+      for (std::size_t k = 0; k < w.size(); ++k)
+      {
+         T u = ldexp(T(1) + T(k % (2 * cells_per_octave)) / (2 * cells_per_octave), min_exponent + static_cast<int>(k / (2 * cells_per_octave)));
+         w[k] = f((u - shift) / sign);
+      }
+      cells.resize(count * stride);
+      for (std::size_t k = 0; k < count; ++k)
+      {
+         T* c = &cells[k * stride];
+         T w0 = w[2 * k];
+         T wm = w[2 * k + 1];
+         T w1 = w[2 * k + 2];
+         // Close to the origin interpolate W(z)/z = exp(-W(z)), so that the relative error
+         // of the estimate doesn't blow up as z -> 0:
+         bool near_origin = (fabs(w0) < 1) && (fabs(w1) < 1);
+         T* q = near_origin ? c + 3 : c;
+         T* zero = near_origin ? c : c + 3;
+         T f0 = near_origin ? exp(-w0) : w0;
+         T fm = near_origin ? exp(-wm) : wm;
+         T f1 = near_origin ? exp(-w1) : w1;
+         // The quadratic through the cell edges and midpoint:
+         q[0] = f0;
+         q[1] = 4 * fm - 3 * f0 - f1;
+         q[2] = 2 * (f0 + f1) - 4 * fm;
+         zero[0] = zero[1] = zero[2] = 0;
+         c[6] = wm;
+         c[7] = exp(wm);
+      }
+   }
+};
+
+// Cell index and position t in [0, 1) within the cell, for u in [u_min, u_max):
+template <typename T>
+inline std::size_t lambert_w_batch_cell(const lambert_w_batch_table<T>& table, T u, T& t, const std::integral_constant<int, 0>&)
+{
+   BOOST_MATH_STD_USING
+   int e;
+   T m = frexp(u, &e);
+   T pos = (2 * m - 1) * lambert_w_batch_table<T>::cells_per_octave;
+   std::size_t cell = static_cast<std::size_t>(pos);
+   t = pos - cell;
+   return static_cast<std::size_t>(e - 1 - table.min_exponent) * lambert_w_batch_table<T>::cells_per_octave + cell;
+}
+// IEEE float and double: pull the exponent and mantissa bits out directly, which is much cheaper than frexp:
+template <typename T, class UInt>
+inline std::size_t lambert_w_batch_cell_ieee(const lambert_w_batch_table<T>& table, T u, T& t)
+{
+   constexpr int fraction_bits = std::numeric_limits<T>::digits - 1;
+   constexpr int shift = fraction_bits - lambert_w_batch_table<T>::mantissa_bits;
+   constexpr int bias = std::numeric_limits<T>::max_exponent - 1;
+   constexpr UInt fraction_mask = (UInt(1) << fraction_bits) - 1;
+   constexpr UInt one = static_cast<UInt>(bias) << fraction_bits;
+   UInt i;
+   std::memcpy(&i, &u, sizeof(T));
+   int e = static_cast<int>(i >> fraction_bits) - bias;
+   int cell = static_cast<int>((i >> shift) & (lambert_w_batch_table<T>::cells_per_octave - 1));
+   // The mantissa of u as a value in [1, 2):
+   UInt mi = (i & fraction_mask) | one;
+   T m;
+   std::memcpy(&m, &mi, sizeof(T));
+   t = (m - 1) * lambert_w_batch_table<T>::cells_per_octave - static_cast<T>(cell);
+   return static_cast<std::size_t>(e - table.min_exponent) * lambert_w_batch_table<T>::cells_per_octave + static_cast<std::size_t>(cell);
+}
+template <typename T>
+inline std::size_t lambert_w_batch_cell(const lambert_w_batch_table<T>& table, T u, T& t, const std::integral_constant<int, 32>&)
+{
+   return lambert_w_batch_cell_ieee<T, std::uint32_t>(table, u, t);
+}
+template <typename T>
+inline std::size_t lambert_w_batch_cell(const lambert_w_batch_table<T>& table, T u, T& t, const std::integral_constant<int, 64>&)
+{
+   return lambert_w_batch_cell_ieee<T, std::uint64_t>(table, u, t);
+}
+
+template <typename T, typename F>
+void lambert_w_batch_imp(const lambert_w_batch_table<T>& table, const T* z, T* result, std::size_t count, F scalar)
+{
+   using cell_tag = std::integral_constant<int,
+      !std::numeric_limits<T>::is_iec559 ? 0 :
+      (sizeof(T) == sizeof(std::uint32_t)) && (std::numeric_limits<T>::digits == 24) ? 32 :
+      (sizeof(T) == sizeof(std::uint64_t)) && (std::numeric_limits<T>::digits == 53) ? 64 : 0>;
+   const int halley_steps = std::numeric_limits<T>::digits <= 53 ? 1 : 2;
+   // |w - W| is less than 1/120 about the cell midpoint, so this many terms of the series for exp(w - W) suffice:
+   const int taylor_terms = std::numeric_limits<T>::digits <= 24 ? 3 : std::numeric_limits<T>::digits <= 53 ? 6 : 8;
+   T inverse_factorial[9];
+   inverse_factorial[0] = 1;
+   for (int j = 1; j < 9; ++j)
+      inverse_factorial[j] = inverse_factorial[j - 1] / j;
+   const T* cells = table.cells.data();
+   //
+   // Work through the arguments in blocks: the first loop does the table lookups, and the second
+   // is pure arithmetic on contiguous arrays, which the compiler can vectorize:
+   //
+   constexpr std::size_t block = 64;
+   T w[block];
+   T d[block];
+   T exp_w[block];
+   bool outside[block];
+   for (std::size_t first = 0; first < count; first += block)
+   {
+      std::size_t n = (std::min)(block, count - first);
+      bool any_outside = false;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         // Arguments outside the table are clamped here, and recomputed by the scalar code below:
+         T x = z[first + i];
+         T u = table.sign * x + table.shift;
+         outside[i] = !((u >= table.u_min) && (u < table.u_max));
+         any_outside |= outside[i];
+         u = outside[i] ? table.u_min : u;
+         T t;
+         const T* c = cells + lambert_w_batch_table<T>::stride * lambert_w_batch_cell(table, u, t, cell_tag());
+         w[i] = c[0] + t * (c[1] + t * c[2]) + x * (c[3] + t * (c[4] + t * c[5]));
+         d[i] = w[i] - c[6];
+         exp_w[i] = c[7];
+      }
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         T x = z[first + i];
+         T wi = w[i];
+         T e = inverse_factorial[taylor_terms];
+         for (int j = taylor_terms - 1; j >= 0; --j)
+            e = e * d[i] + inverse_factorial[j];
+         e *= exp_w[i];
+         for (int step = 0; step < halley_steps; ++step)
+         {
+            T dw = 2 * (wi + 1) * (e * wi - x) / (x * (wi + 2) + e * (wi * (wi + 2) + 2));
+            wi -= dw;
+            if (step + 1 < halley_steps)
+            {
+               // exp(w - dw) = exp(w) * exp(-dw), and dw is tiny by now:
+               e *= 1 - dw * (1 - dw * (inverse_factorial[2] - dw * (inverse_factorial[3] - dw * inverse_factorial[4])));
+            }
+         }
+         result[first + i] = wi;
+      }
+      if (any_outside)
+      {
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            if (outside[i])
+               result[first + i] = scalar(z[first + i]);
+         }
+      }
+   }
+}
+
+template <typename T>
+const lambert_w_batch_table<T>& lambert_w0_batch_table()
+{
+   // u = z + 1/e in [2^-6, 2^24), which is z in [-0.352, 1.6e7]:
+   static const lambert_w_batch_table<T> table(constants::exp_minus_one<T>(), T(1), -6, 24,
+      [](T z) { return lambert_w0_imp(z, policies::policy<>(), std::integral_constant<int, 0>()); });
+   return table;
+}
+
+template <typename T>
+const lambert_w_batch_table<T>& lambert_wm1_batch_table()
+{
+   // u = -z in [2^-64, 2^-2), which is z in [-0.25, -5.4e-20].
+   // Beyond -0.25 the rate of convergence of Halley's method falls off towards the branch point:
+   static const lambert_w_batch_table<T> table(T(0), T(-1), -64, -2,
+      [](T z) { return lambert_wm1_imp(z, policies::policy<>()); });
+   return table;
+}
+
+template <typename T, int Branch, typename F>
+void lambert_w_batch(const std::vector<T>& z, std::vector<T>& result, F scalar, const std::integral_constant<int, Branch>&, const std::true_type&)
+{
+   const lambert_w_batch_table<T>& table = Branch == 0 ? lambert_w0_batch_table<T>() : lambert_wm1_batch_table<T>();
+   lambert_w_batch_imp(table, z.data(), result.data(), z.size(), scalar);
+}
+
+// Types wider than 64 bits need more refinement than is worthwhile here, so use the scalar code throughout:
+template <typename T, int Branch, typename F>
+void lambert_w_batch(const std::vector<T>& z, std::vector<T>& result, F scalar, const std::integral_constant<int, Branch>&, const std::false_type&)
+{
+   for (std::size_t i = 0; i < z.size(); ++i)
+      result[i] = scalar(z[i]);
+}
+
+template <typename T>
+struct lambert_w_batch_supported
+   : public std::integral_constant<bool, std::numeric_limits<T>::is_specialized && (std::numeric_limits<T>::radix == 2)
+      && (std::numeric_limits<T>::digits <= 64) && !std::is_integral<T>::value> {};
+
 } // namespace lambert_w_detail
 
 /////////////////////////////  User Lambert w functions. //////////////////////////////
@@ -2127,6 +2368,48 @@ T lambert_wm1_imp(const T z, const Policy&  pol)
     return lambert_w_detail::lambert_wm1_imp(result_type(z), policies::policy<>());
   } // lambert_wm1(T z)
 
+  //! Lambert W0 of each element of [first, last), written to out.
+  template <class ForwardIterator, class OutputIterator, class Policy>
+  OutputIterator lambert_w0(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol)
+  {
+    using result_type = typename tools::promote_args<typename std::iterator_traits<ForwardIterator>::value_type>::type;
+    std::vector<result_type> z;
+    z.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (; first != last; ++first)
+      z.push_back(static_cast<result_type>(*first));
+    std::vector<result_type> result(z.size());
+    lambert_w_detail::lambert_w_batch(z, result, [&pol](result_type x) { return lambert_w0(x, pol); },
+      std::integral_constant<int, 0>(), lambert_w_detail::lambert_w_batch_supported<result_type>());
+    return std::copy(result.begin(), result.end(), out);
+  }
+
+  template <class ForwardIterator, class OutputIterator>
+  inline OutputIterator lambert_w0(ForwardIterator first, ForwardIterator last, OutputIterator out)
+  {
+    return lambert_w0(first, last, out, policies::policy<>());
+  }
+
+  //! Lambert W-1 of each element of [first, last), written to out.
+  template <class ForwardIterator, class OutputIterator, class Policy>
+  OutputIterator lambert_wm1(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol)
+  {
+    using result_type = typename tools::promote_args<typename std::iterator_traits<ForwardIterator>::value_type>::type;
+    std::vector<result_type> z;
+    z.reserve(static_cast<std::size_t>(std::distance(first, last)));
+    for (; first != last; ++first)
+      z.push_back(static_cast<result_type>(*first));
+    std::vector<result_type> result(z.size());
+    lambert_w_detail::lambert_w_batch(z, result, [&pol](result_type x) { return lambert_wm1(x, pol); },
+      std::integral_constant<int, -1>(), lambert_w_detail::lambert_w_batch_supported<result_type>());
+    return std::copy(result.begin(), result.end(), out);
+  }
+
+  template <class ForwardIterator, class OutputIterator>
+  inline OutputIterator lambert_wm1(ForwardIterator first, ForwardIterator last, OutputIterator out)
+  {
+    return lambert_wm1(first, last, out, policies::policy<>());
+  }
+
   // First derivative of Lambert W0 and W-1.
   template <typename T, typename Policy>
   inline typename tools::promote_args<T>::type
@@ -0,0 +1,832 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SPECIAL_MULTIVARIATE_NORMAL_HPP
+#define BOOST_MATH_SPECIAL_MULTIVARIATE_NORMAL_HPP
+
+// References:
+// Alan Genz, Numerical computation of rectangular bivariate and trivariate normal and t probabilities,
+// Statistics and Computing 14 (2004), 251-260.
+// Alan Genz, Numerical computation of multivariate normal probabilities,
+// Journal of Computational and Graphical Statistics 1 (1992), 141-149.
+// Alan Genz and Frank Bretz, Computation of Multivariate Normal and t Probabilities,
+// Lecture Notes in Statistics 195, Springer (2009).
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/special_functions/owens_t.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/tools/promotion.hpp>
+
+namespace boost { namespace math {
+
+namespace detail {
+
+// Quadrature rule for Genz's refinement of the Drezner-Wesolowsky method, which depends only on rho.
+// For |rho| < 0.925 Plackett's integral in asin(rho) is integrated directly: x holds sin(theta) and
+// y holds 1/cos^2(theta) at each node.  Otherwise the singular part of the integrand at |rho| = 1 is
+// subtracted analytically and the remainder integrated: x holds the squared abscissa,
+// y holds 1/sqrt(1 - x) and z holds 1/(1 + sqrt(1 - x)).
+template <class T>
+struct bivariate_normal_rule
+{
+   // Enough for the 30 point rule used at 64 bit precision:
+   static constexpr std::size_t max_nodes = 60;
+
+   T rho;
+   bool near_singular;
+   unsigned order;
+   std::size_t count;
+   std::array<T, max_nodes> w;
+   std::array<T, max_nodes> x;
+   std::array<T, max_nodes> y;
+   std::array<T, max_nodes> z;
+};
+
+template <class T, unsigned N>
+void bivariate_normal_fill_rule(T rho, bivariate_normal_rule<T>& rule)
+{
+   BOOST_MATH_STD_USING
+   typedef quadrature::gauss<T, N> gauss_type;
+   const auto& abscissa = gauss_type::abscissa();
+   const auto& weights = gauss_type::weights();
+
+   rule.rho = rho;
+   rule.near_singular = !(fabs(rho) < T(0.925));
+   rule.count = 0;
+   T a = sqrt((1 - rho)*(1 + rho));
+   T asr = asin(rho);
+   for (std::size_t i = 0; i < abscissa.size(); ++i)
+   {
+      for (int sign = -1; sign <= 1; sign += 2)
+      {
+         // The node at the origin of an odd order rule is used only once:
+         if ((N & 1) && (i == 0) && (sign > 0))
+         {
+            continue;
+         }
+         // Nodes and weights mapped to [0, 1]:
+         T u = (1 + sign*static_cast<T>(abscissa[i]))/2;
+         T w = static_cast<T>(weights[i])/2;
+         std::size_t j = rule.count++;
+         if (!rule.near_singular)
+         {
+            T theta = asr*u;
+            T c = cos(theta);
+            rule.w[j] = w*asr/constants::two_pi<T>();
+            rule.x[j] = sin(theta);
+            rule.y[j] = 1/(c*c);
+            rule.z[j] = 0;
+         }
+         else
+         {
+            T xs = a*u;
+            xs *= xs;
+            T rs = sqrt(1 - xs);
+            rule.w[j] = w*a;
+            rule.x[j] = xs;
+            rule.y[j] = 1/rs;
+            rule.z[j] = 1/(1 + rs);
+         }
+      }
+   }
+}
+
+// The order needed depends on both |rho| and how far into the tails the limits lie, since the integrand
+// then varies over many orders of magnitude; these were found by comparison with the 30 point rule in
+// a wider type, and hold the relative error of the lower tail for rho >= 0 to a few tens of epsilon:
+template <class T>
+unsigned bivariate_normal_order(T rho, T hs, const std::integral_constant<int, 53>&)
+{
+   BOOST_MATH_STD_USING
+   T r = fabs(rho);
+   if (r < T(0.3))
+   {
+      return hs < 4 ? 7 : hs < 40 ? 10 : 15;
+   }
+   if (r < T(0.75))
+   {
+      return hs < 16 ? 15 : 20;
+   }
+   if (r < T(0.925))
+   {
+      return hs < 4 ? 20 : hs < 16 ? 25 : 30;
+   }
+   return hs < 16 ? 20 : 30;
+}
+
+template <class T>
+unsigned bivariate_normal_order(T rho, T hs, const std::integral_constant<int, 64>&)
+{
+   BOOST_MATH_STD_USING
+   T r = fabs(rho);
+   if (r < T(0.3))
+   {
+      return hs < 16 ? 10 : 15;
+   }
+   if (r < T(0.75))
+   {
+      return hs < 16 ? 20 : 25;
+   }
+   return 30;
+}
+
+template <class T>
+void bivariate_normal_make_rule(T rho, unsigned order, bivariate_normal_rule<T>& rule)
+{
+   switch (order)
+   {
+   case 7:
+      bivariate_normal_fill_rule<T, 7>(rho, rule);
+      break;
+   case 10:
+      bivariate_normal_fill_rule<T, 10>(rho, rule);
+      break;
+   case 15:
+      bivariate_normal_fill_rule<T, 15>(rho, rule);
+      break;
+   case 20:
+      bivariate_normal_fill_rule<T, 20>(rho, rule);
+      break;
+   case 25:
+      bivariate_normal_fill_rule<T, 25>(rho, rule);
+      break;
+   default:
+      bivariate_normal_fill_rule<T, 30>(rho, rule);
+   }
+   rule.order = order;
+}
+
+// P(X <= h, Y <= k) for finite h and k, evaluated as Genz's upper orthant probability at (-h, -k):
+template <class T, class Policy>
+T bivariate_normal_genz(T h, T k, const bivariate_normal_rule<T>& rule, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   h = -h;
+   k = -k;
+   T hk = h*k;
+   T result = 0;
+   if (!rule.near_singular)
+   {
+      T hs = (h*h + k*k)/2;
+      for (std::size_t i = 0; i < rule.count; ++i)
+      {
+         result += rule.w[i]*exp((rule.x[i]*hk - hs)*rule.y[i]);
+      }
+      return result + owens_t_znorm2(h, pol)*owens_t_znorm2(k, pol);
+   }
+
+   T rho = rule.rho;
+   if (rho < 0)
+   {
+      k = -k;
+      hk = -hk;
+   }
+   if (fabs(rho) < 1)
+   {
+      T as = (1 - rho)*(1 + rho);
+      T a = sqrt(as);
+      T bs = (h - k)*(h - k);
+      T c = (4 - hk)/8;
+      T d = (12 - hk)/16;
+      // None of these exponents can overflow, since bs >= -4hk whenever hk < 0:
+      result = a*exp(-(bs/as + hk)/2)*(1 - c*(bs - as)*(1 - d*bs/5)/3 + c*d*as*as/5);
+      if (hk > -100)
+      {
+         T b = sqrt(bs);
+         result -= exp(-hk/2)*constants::root_two_pi<T>()*owens_t_znorm2(T(b/a), pol)*b*(1 - c*bs*(1 - d*bs/5)/3);
+      }
+      for (std::size_t i = 0; i < rule.count; ++i)
+      {
+         T xs = rule.x[i];
+         result += rule.w[i]*(exp(-bs/(2*xs) - hk*rule.z[i])*rule.y[i] - exp(-(bs/xs + hk)/2)*(1 + c*xs*(1 + d*xs)));
+      }
+      result = -result/constants::two_pi<T>();
+   }
+   if (rho > 0)
+   {
+      return result + owens_t_znorm2((std::max)(h, k), pol);
+   }
+   return -result + (std::max)(T(0), T(owens_t_znorm2(h, pol) - owens_t_znorm2(k, pol)));
+}
+
+// T(h, num/(h*s)), including the limits as the second argument tends to infinity:
+template <class T, class Policy>
+T bivariate_normal_owens_t_term(T h, T num, T s, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   if (h != 0)
+   {
+      T a = num/(h*s);
+      if ((boost::math::isfinite)(a))
+      {
+         return owens_t(h, a, pol);
+      }
+   }
+   // h == 0 is taken as the limit from above, so the sign of the ratio is that of the numerator:
+   T t = owens_t_znorm2(T(fabs(h)), pol)/2;
+   return ((num < 0) != (h < 0)) ? T(-t) : t;
+}
+
+// The classical reduction to Owen's T function, used when the fixed order rules above are not accurate enough:
+template <class T, class Policy>
+T bivariate_normal_owens_t(T h, T k, T rho, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   if (rho == 1)
+   {
+      return owens_t_znorm2(T(-(std::min)(h, k)), pol);
+   }
+   if (rho == -1)
+   {
+      return (std::max)(T(0), T(owens_t_znorm2(T(-h), pol) - owens_t_znorm2(k, pol)));
+   }
+   if ((h == 0) && (k == 0))
+   {
+      return constants::half<T>()*constants::half<T>() + asin(rho)/constants::two_pi<T>();
+   }
+   T s = sqrt((1 - rho)*(1 + rho));
+   T result = (owens_t_znorm2(T(-h), pol) + owens_t_znorm2(T(-k), pol))/2
+      - bivariate_normal_owens_t_term(h, T(k - rho*h), s, pol)
+      - bivariate_normal_owens_t_term(k, T(h - rho*k), s, pol);
+   if ((h*k < 0) || ((h*k == 0) && (h + k < 0)))
+   {
+      result -= constants::half<T>();
+   }
+   return result;
+}
+
+// Handles the error conditions and the infinite limits, returns false if the probability still needs computing:
+template <class T, class Policy>
+bool bivariate_normal_cdf_special(T h, T k, T rho, T& result, const Policy& pol)
+{
+   static const char* function = "boost::math::bivariate_normal_cdf<%1%>(%1%, %1%, %1%)";
+   if (!((rho >= -1) && (rho <= 1)))
+   {
+      result = policies::raise_domain_error<T>(function, "The correlation must be in [-1, 1], but got %1%.", rho, pol);
+      return true;
+   }
+   if ((boost::math::isnan)(h) || (boost::math::isnan)(k))
+   {
+      result = policies::raise_domain_error<T>(function, "The limits must not be NaN, but got %1%.", (boost::math::isnan)(h) ? h : k, pol);
+      return true;
+   }
+   if ((boost::math::isinf)(h) || (boost::math::isinf)(k))
+   {
+      if ((h < 0) || (k < 0))
+      {
+         result = 0;
+      }
+      else
+      {
+         result = owens_t_znorm2(T(-(std::min)(h, k)), pol);
+      }
+      return true;
+   }
+   return false;
+}
+
+template <class T, class Policy, class Tag>
+T bivariate_normal_cdf_dispatch(T h, T k, T rho, const Policy& pol, const Tag& tag)
+{
+   bivariate_normal_rule<T> rule;
+   bivariate_normal_make_rule(rho, bivariate_normal_order(rho, T((h*h + k*k)/2), tag), rule);
+   return bivariate_normal_genz(h, k, rule, pol);
+}
+
+template <class T, class Policy>
+T bivariate_normal_cdf_dispatch(T h, T k, T rho, const Policy& pol, const std::integral_constant<int, 0>&)
+{
+   return bivariate_normal_owens_t(h, k, rho, pol);
+}
+
+template <class T>
+inline T bivariate_normal_clamp(T p)
+{
+   return (std::min)((std::max)(p, T(0)), T(1));
+}
+
+template <class T, class Policy, class Tag>
+T bivariate_normal_cdf_imp(T h, T k, T rho, const Policy& pol, const Tag& tag)
+{
+   T result;
+   if (bivariate_normal_cdf_special(h, k, rho, result, pol))
+   {
+      return result;
+   }
+   return bivariate_normal_clamp(bivariate_normal_cdf_dispatch(h, k, rho, pol, tag));
+}
+
+// Batches reuse the quadrature rule for as long as rho is unchanged and the rule is of high enough
+// order, which removes all of the trigonometric functions when many limits share a correlation:
+template <class T, class Policy, class InputIterator1, class InputIterator2, class InputIterator3, class OutputIterator, class Tag>
+OutputIterator bivariate_normal_cdf_batch(InputIterator1 h_first, InputIterator1 h_last, InputIterator2 k_first, InputIterator3 rho_first, OutputIterator out, const Policy& pol, const Tag& tag)
+{
+   bivariate_normal_rule<T> rule;
+   rule.count = 0;
+   for (; h_first != h_last; ++h_first, ++k_first, ++rho_first, ++out)
+   {
+      T h = static_cast<T>(*h_first);
+      T k = static_cast<T>(*k_first);
+      T rho = static_cast<T>(*rho_first);
+      T result;
+      if (!bivariate_normal_cdf_special(h, k, rho, result, pol))
+      {
+         unsigned order = bivariate_normal_order(rho, T((h*h + k*k)/2), tag);
+         if ((rule.count == 0) || (rule.rho != rho) || (rule.order < order))
+         {
+            bivariate_normal_make_rule(rho, order, rule);
+         }
+         result = bivariate_normal_clamp(bivariate_normal_genz(h, k, rule, pol));
+      }
+      *out = result;
+   }
+   return out;
+}
+
+template <class T, class Policy, class InputIterator1, class InputIterator2, class InputIterator3, class OutputIterator>
+OutputIterator bivariate_normal_cdf_batch(InputIterator1 h_first, InputIterator1 h_last, InputIterator2 k_first, InputIterator3 rho_first, OutputIterator out, const Policy& pol, const std::integral_constant<int, 0>& tag)
+{
+   for (; h_first != h_last; ++h_first, ++k_first, ++rho_first, ++out)
+   {
+      *out = bivariate_normal_cdf_imp(static_cast<T>(*h_first), static_cast<T>(*k_first), static_cast<T>(*rho_first), pol, tag);
+   }
+   return out;
+}
+
+template <class T, class Policy>
+struct bivariate_normal_tag
+{
+   typedef typename policies::precision<T, Policy>::type precision_type;
+   typedef std::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 : 0
+   > type;
+};
+
+// Genz's separation of variables for P(a < X <= b), X ~ N(0, LL^T): the variables are reordered so
+// that the most constraining come first, and the integral over the unit cube is estimated with
+// randomly shifted Richtmyer lattices, periodized by the tent transform and antithetic sampling.
+template <class Real, class Policy>
+class multivariate_normal_integrand
+{
+public:
+   multivariate_normal_integrand(std::vector<Real> a, std::vector<Real> b, std::vector<Real> r, std::size_t m, const Policy& pol)
+      : m_a(std::move(a)), m_b(std::move(b)), m_c(m*m, Real(0)), m_m(m), m_pol(pol), m_y(m)
+   {
+      BOOST_MATH_STD_USING
+      // Pivoted Cholesky factorization, choosing at each step the variable with the smallest
+      // expected probability given the conditional means of those already chosen:
+      std::vector<Real> y(m, Real(0));
+      for (std::size_t i = 0; i < m; ++i)
+      {
+         std::size_t pivot = i;
+         Real smallest = 2;
+         Real smallest_sd = 0;
+         for (std::size_t j = i; j < m; ++j)
+         {
+            Real s = 0;
+            Real v = r[j*m + j];
+            for (std::size_t l = 0; l < i; ++l)
+            {
+               s += m_c[j*m + l]*y[l];
+               v -= m_c[j*m + l]*m_c[j*m + l];
+            }
+            Real sd = v > 0 ? Real(sqrt(v)) : Real(0);
+            Real p = probability(m_a[j], m_b[j], s, sd);
+            if (p < smallest)
+            {
+               smallest = p;
+               smallest_sd = sd;
+               pivot = j;
+            }
+         }
+         if (pivot != i)
+         {
+            std::swap(m_a[i], m_a[pivot]);
+            std::swap(m_b[i], m_b[pivot]);
+            for (std::size_t l = 0; l < m; ++l)
+            {
+               std::swap(r[i*m + l], r[pivot*m + l]);
+            }
+            for (std::size_t l = 0; l < m; ++l)
+            {
+               std::swap(r[l*m + i], r[l*m + pivot]);
+            }
+            for (std::size_t l = 0; l < i; ++l)
+            {
+               std::swap(m_c[i*m + l], m_c[pivot*m + l]);
+            }
+         }
+
+         Real v = r[i*m + i];
+         Real s = 0;
+         for (std::size_t l = 0; l < i; ++l)
+         {
+            v -= m_c[i*m + l]*m_c[i*m + l];
+            s += m_c[i*m + l]*y[l];
+         }
+         // A (numerically) singular matrix leaves this variable determined by the earlier ones:
+         if (v > 16*m*tools::epsilon<Real>())
+         {
+            Real cii = sqrt(v);
+            m_c[i*m + i] = cii;
+            for (std::size_t j = i + 1; j < m; ++j)
+            {
+               Real t = r[j*m + i];
+               for (std::size_t l = 0; l < i; ++l)
+               {
+                  t -= m_c[j*m + l]*m_c[i*m + l];
+               }
+               m_c[j*m + i] = t/cii;
+            }
+            // Mean of the truncated conditional distribution:
+            Real lo = (m_a[i] - s)/cii;
+            Real hi = (m_b[i] - s)/cii;
+            Real p = phi(hi) - phi(lo);
+            if (p > tools::min_value<Real>())
+            {
+               y[i] = (density(lo) - density(hi))/p;
+            }
+            else
+            {
+               y[i] = (boost::math::isfinite)(lo) ? lo : hi;
+            }
+         }
+         // A degenerate variable was only tested at the conditional means of the earlier ones, so
+         // may still be within its limits for other values of them, which the integrand checks:
+         if ((smallest == 0) && (smallest_sd > 0))
+         {
+            m_zero = true;
+         }
+      }
+      m_d0 = phi(m_a[0]/m_c[0]);
+      m_e0 = phi(m_b[0]/m_c[0]);
+   }
+
+   bool is_zero() const
+   {
+      return m_zero;
+   }
+
+   std::size_t dimension() const
+   {
+      return m_m - 1;
+   }
+
+   Real operator()(const Real* w)
+   {
+      BOOST_MATH_STD_USING
+      Real d = m_d0;
+      Real e = m_e0;
+      Real f = e - d;
+      for (std::size_t i = 1; (i < m_m) && (f > 0); ++i)
+      {
+         Real u = d + w[i - 1]*(e - d);
+         u = (std::min)((std::max)(u, tools::min_value<Real>()), Real(1 - tools::epsilon<Real>()/2));
+         m_y[i - 1] = -constants::root_two<Real>()*boost::math::erfc_inv(2*u, m_pol);
+         Real s = 0;
+         for (std::size_t l = 0; l < i; ++l)
+         {
+            s += m_c[i*m_m + l]*m_y[l];
+         }
+         Real cii = m_c[i*m_m + i];
+         if (cii > 0)
+         {
+            d = phi((m_a[i] - s)/cii);
+            e = phi((m_b[i] - s)/cii);
+         }
+         else
+         {
+            d = 0;
+            e = (m_a[i] < s) && (s <= m_b[i]) ? Real(1) : Real(0);
+         }
+         f *= e - d;
+      }
+      return f;
+   }
+
+private:
+   Real phi(Real x) const
+   {
+      return owens_t_znorm2(Real(-x), m_pol);
+   }
+
+   static Real density(Real x)
+   {
+      BOOST_MATH_STD_USING
+      return (boost::math::isfinite)(x) ? Real(exp(-x*x/2)*constants::one_div_root_two_pi<Real>()) : Real(0);
+   }
+
+   Real probability(Real a, Real b, Real s, Real sd) const
+   {
+      if (sd > 0)
+      {
+         return phi((b - s)/sd) - phi((a - s)/sd);
+      }
+      return (a < s) && (s <= b) ? Real(1) : Real(0);
+   }
+
+   std::vector<Real> m_a;
+   std::vector<Real> m_b;
+   std::vector<Real> m_c;
+   std::size_t m_m;
+   Policy m_pol;
+   std::vector<Real> m_y;
+   Real m_d0;
+   Real m_e0;
+   bool m_zero = false;
+};
+
+template <class Real, class Policy>
+Real multivariate_normal_cdf_imp(std::vector<Real> a, std::vector<Real> b, const std::vector<Real>& sigma, std::size_t n, Real tolerance, Real* error_estimate, std::size_t max_evaluations, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   static const char* function = "boost::math::multivariate_normal_cdf<%1%>";
+   if (error_estimate)
+   {
+      *error_estimate = 0;
+   }
+
+   // Standardize the variables, and drop those with no constraint on them:
+   std::vector<std::size_t> index;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      Real v = sigma[i*n + i];
+      if (!(v > 0) || !(boost::math::isfinite)(v))
+      {
+         return policies::raise_domain_error<Real>(function, "The diagonal of the covariance matrix must be positive and finite, but got %1%.", v, pol);
+      }
+      if ((boost::math::isnan)(a[i]) || (boost::math::isnan)(b[i]))
+      {
+         return policies::raise_domain_error<Real>(function, "The limits must not be NaN, but got %1%.", (boost::math::isnan)(a[i]) ? a[i] : b[i], pol);
+      }
+      if (!(a[i] < b[i]))
+      {
+         return 0;
+      }
+      Real sd = sqrt(v);
+      a[i] /= sd;
+      b[i] /= sd;
+      if ((a[i] > -tools::max_value<Real>()) || (b[i] < tools::max_value<Real>()))
+      {
+         index.push_back(i);
+      }
+   }
+   const std::size_t m = index.size();
+   std::vector<Real> ra(m), rb(m), r(m*m);
+   for (std::size_t i = 0; i < m; ++i)
+   {
+      ra[i] = a[index[i]];
+      rb[i] = b[index[i]];
+      for (std::size_t j = 0; j <= i; ++j)
+      {
+         // Only the lower triangle is referenced:
+         std::size_t p = index[i];
+         std::size_t q = index[j];
+         Real c = sigma[p*n + q]/sqrt(sigma[p*n + p]*sigma[q*n + q]);
+         if (!(fabs(c) <= 1 + 16*tools::epsilon<Real>()))
+         {
+            return policies::raise_domain_error<Real>(function, "The covariance matrix implies a correlation of %1%, outside [-1, 1].", c, pol);
+         }
+         c = (std::min)((std::max)(c, Real(-1)), Real(1));
+         r[i*m + j] = c;
+         r[j*m + i] = c;
+      }
+   }
+
+   if (m == 0)
+   {
+      return 1;
+   }
+   if (m == 1)
+   {
+      return owens_t_znorm2(ra[0], pol) - owens_t_znorm2(rb[0], pol);
+   }
+   if (m == 2)
+   {
+      // Inclusion-exclusion over the four corners, the bivariate function handles the infinite ones:
+      typedef typename bivariate_normal_tag<Real, Policy>::type tag_type;
+      Real rho = r[1];
+      Real p = bivariate_normal_cdf_imp(rb[0], rb[1], rho, pol, tag_type())
+         - bivariate_normal_cdf_imp(ra[0], rb[1], rho, pol, tag_type())
+         - bivariate_normal_cdf_imp(rb[0], ra[1], rho, pol, tag_type())
+         + bivariate_normal_cdf_imp(ra[0], ra[1], rho, pol, tag_type());
+      return bivariate_normal_clamp(p);
+   }
+
+   multivariate_normal_integrand<Real, Policy> f(std::move(ra), std::move(rb), std::move(r), m, pol);
+   if (f.is_zero())
+   {
+      return 0;
+   }
+
+   const std::size_t dim = f.dimension();
+   const std::size_t replicates = 12;
+   std::vector<Real> q(dim);
+   for (std::size_t j = 0; j < dim; ++j)
+   {
+      Real root = sqrt(static_cast<Real>(boost::math::prime(static_cast<unsigned>(j))));
+      q[j] = root - floor(root);
+   }
+   // A fixed seed, so that the result is a deterministic function of the arguments:
+   std::mt19937_64 gen(0x9e3779b97f4a7c15ULL);
+   std::uniform_real_distribution<double> dis(0, 1);
+   std::vector<Real> x(replicates*dim);
+   for (auto& xi : x)
+   {
+      xi = static_cast<Real>(dis(gen));
+   }
+   std::vector<Real> sums(replicates, Real(0));
+   std::vector<Real> w(dim), wa(dim);
+   std::size_t points = 0;
+   std::size_t stage = 64;
+   std::size_t evaluations = 0;
+   Real estimate = 0;
+   Real error = 0;
+   while (true)
+   {
+      for (std::size_t rep = 0; rep < replicates; ++rep)
+      {
+         Real* xr = x.data() + rep*dim;
+         Real sum = 0;
+         for (std::size_t k = 0; k < stage; ++k)
+         {
+            for (std::size_t j = 0; j < dim; ++j)
+            {
+               xr[j] += q[j];
+               if (xr[j] >= 1)
+               {
+                  xr[j] -= 1;
+               }
+               w[j] = fabs(2*xr[j] - 1);
+               wa[j] = 1 - w[j];
+            }
+            sum += (f(w.data()) + f(wa.data()))/2;
+         }
+         sums[rep] += sum;
+      }
+      points += stage;
+      evaluations += 2*stage*replicates;
+
+      estimate = 0;
+      for (const auto& s : sums)
+      {
+         estimate += s/points;
+      }
+      estimate /= replicates;
+      Real variance = 0;
+      for (const auto& s : sums)
+      {
+         Real delta = s/points - estimate;
+         variance += delta*delta;
+      }
+      variance /= replicates*(replicates - 1);
+      // Three standard errors of the mean over the independent shifts:
+      error = 3*sqrt(variance);
+      if ((error <= tolerance) || (evaluations + 4*stage*replicates > max_evaluations))
+      {
+         break;
+      }
+      stage = points;
+   }
+   if (error_estimate)
+   {
+      *error_estimate = error;
+   }
+   return bivariate_normal_clamp(estimate);
+}
+
+} // namespace detail
+
+// P(X <= h, Y <= k) for standard normal X and Y with correlation rho:
+template <class T1, class T2, class T3, class Policy>
+inline typename tools::promote_args<T1, T2, T3>::type bivariate_normal_cdf(T1 h, T2 k, T3 rho, const Policy&)
+{
+   typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename detail::bivariate_normal_tag<value_type, forwarding_policy>::type tag_type;
+
+   return policies::checked_narrowing_cast<result_type, forwarding_policy>(
+      detail::bivariate_normal_cdf_imp(static_cast<value_type>(h), static_cast<value_type>(k), static_cast<value_type>(rho), forwarding_policy(), tag_type()),
+      "boost::math::bivariate_normal_cdf<%1%>(%1%, %1%, %1%)");
+}
+
+template <class T1, class T2, class T3>
+inline typename tools::promote_args<T1, T2, T3>::type bivariate_normal_cdf(T1 h, T2 k, T3 rho)
+{
+   return bivariate_normal_cdf(h, k, rho, policies::policy<>());
+}
+
+// Writes bivariate_normal_cdf(h[i], k[i], rho[i]) for each h in [h_first, h_last):
+template <class InputIterator1, class InputIterator2, class InputIterator3, class OutputIterator, class Policy>
+OutputIterator bivariate_normal_cdf(InputIterator1 h_first, InputIterator1 h_last, InputIterator2 k_first, InputIterator3 rho_first, OutputIterator out, const Policy&)
+{
+   typedef typename tools::promote_args<
+      typename std::iterator_traits<InputIterator1>::value_type,
+      typename std::iterator_traits<InputIterator2>::value_type,
+      typename std::iterator_traits<InputIterator3>::value_type>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename detail::bivariate_normal_tag<value_type, forwarding_policy>::type tag_type;
+
+   std::vector<value_type> result;
+   detail::bivariate_normal_cdf_batch<value_type>(h_first, h_last, k_first, rho_first, std::back_inserter(result), forwarding_policy(), tag_type());
+   for (const auto& p : result)
+   {
+      *out++ = policies::checked_narrowing_cast<result_type, forwarding_policy>(p, "boost::math::bivariate_normal_cdf<%1%>(%1%, %1%, %1%)");
+   }
+   return out;
+}
+
+template <class InputIterator1, class InputIterator2, class InputIterator3, class OutputIterator>
+inline OutputIterator bivariate_normal_cdf(InputIterator1 h_first, InputIterator1 h_last, InputIterator2 k_first, InputIterator3 rho_first, OutputIterator out)
+{
+   return bivariate_normal_cdf(h_first, h_last, k_first, rho_first, out, policies::policy<>());
+}
+
+// P(lower[i] < X[i] <= upper[i] for all i) for X ~ N(0, covariance), with the covariance matrix
+// stored row major.  The result is exact to working precision for up to two constrained variables,
+// otherwise a quasi-Monte Carlo estimate, refined until three standard errors fall below the
+// absolute tolerance or the number of integrand evaluations would exceed max_evaluations.
+template <class RandomAccessContainer, class Policy>
+typename RandomAccessContainer::value_type multivariate_normal_cdf(
+   const RandomAccessContainer& lower, const RandomAccessContainer& upper, const RandomAccessContainer& covariance,
+   typename RandomAccessContainer::value_type tolerance, typename RandomAccessContainer::value_type* error_estimate,
+   std::size_t max_evaluations, const Policy&)
+{
+   typedef typename RandomAccessContainer::value_type Real;
+   static_assert(!std::is_integral<Real>::value, "The limits and covariance must be floating point.");
+   // The integrand is only needed to the accuracy of the sampling, so there is no point in promoting:
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   static const char* function = "boost::math::multivariate_normal_cdf<%1%>";
+
+   const std::size_t n = lower.size();
+   if ((n == 0) || (upper.size() != n) || (covariance.size() != n*n))
+   {
+      return policies::raise_domain_error<Real>(function, "Require n > 0 lower and upper limits and an n x n covariance matrix, but got %1% limits.", static_cast<Real>(n), forwarding_policy());
+   }
+   std::vector<Real> a(lower.begin(), lower.end());
+   std::vector<Real> b(upper.begin(), upper.end());
+   std::vector<Real> sigma(covariance.begin(), covariance.end());
+   return detail::multivariate_normal_cdf_imp(std::move(a), std::move(b), sigma, n, tolerance, error_estimate, max_evaluations, forwarding_policy());
+}
+
+template <class RandomAccessContainer>
+inline typename RandomAccessContainer::value_type multivariate_normal_cdf(
+   const RandomAccessContainer& lower, const RandomAccessContainer& upper, const RandomAccessContainer& covariance,
+   typename RandomAccessContainer::value_type tolerance = 1e-6, typename RandomAccessContainer::value_type* error_estimate = nullptr,
+   std::size_t max_evaluations = 1000000)
+{
+   return multivariate_normal_cdf(lower, upper, covariance, tolerance, error_estimate, max_evaluations, policies::policy<>());
+}
+
+// P(X[i] <= upper[i] for all i):
+template <class RandomAccessContainer>
+inline typename RandomAccessContainer::value_type multivariate_normal_cdf(
+   const RandomAccessContainer& upper, const RandomAccessContainer& covariance,
+   typename RandomAccessContainer::value_type tolerance = 1e-6, typename RandomAccessContainer::value_type* error_estimate = nullptr,
+   std::size_t max_evaluations = 1000000)
+{
+   typedef typename RandomAccessContainer::value_type Real;
+   RandomAccessContainer lower(upper);
+   std::fill(lower.begin(), lower.end(), -std::numeric_limits<Real>::infinity());
+   return multivariate_normal_cdf(lower, upper, covariance, tolerance, error_estimate, max_evaluations, policies::policy<>());
+}
+
+}} // namespaces
+
+#endif
@@ -0,0 +1,325 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SPECIAL_PIECEWISE_CHEBYSHEV_HPP
+#define BOOST_MATH_SPECIAL_PIECEWISE_CHEBYSHEV_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <algorithm>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/chebyshev.hpp>
+
+namespace boost { namespace math {
+
+namespace detail {
+
+// Chebyshev coefficients of f on [a, b] from its values at the n Chebyshev points of the first kind.
+// The coefficients use the same convention as chebyshev_transform: c[0] is halved on evaluation.
+template<class Real, class F>
+void piecewise_chebyshev_fit(const F& f, Real a, Real b, std::size_t n, Real* coeffs, std::vector<Real>& scratch)
+{
+    using boost::math::constants::half;
+    using boost::math::constants::pi;
+    using std::cos;
+    Real bma = (b - a)*half<Real>();
+    Real bpa = (b + a)*half<Real>();
+    Real inv_n = 1/static_cast<Real>(n);
+    scratch.resize(n);
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        Real y = cos(pi<Real>()*(j + half<Real>())*inv_n);
+        scratch[j] = static_cast<Real>(f(y*bma + bpa));
+    }
+    // A direct discrete cosine transform is perfectly adequate for the small degrees used per interval:
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        Real sum = 0;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            sum += scratch[j]*cos(pi<Real>()*k*(j + half<Real>())*inv_n);
+        }
+        coeffs[k] = 2*sum*inv_n;
+    }
+}
+
+} // namespace detail
+
+// A "compiled" approximation of an expensive function: the domain [a, b] is adaptively bisected until
+// a fixed-degree Chebyshev interpolant meets the requested error on every subinterval.
+// Evaluation locates the subinterval through a uniform index at the finest bisection level,
+// so there are no comparisons or searches on the hot path.
+template<class Real>
+class piecewise_chebyshev
+{
+public:
+    template<class F>
+    piecewise_chebyshev(const F& f, Real a, Real b,
+                        Real rel_tol = 1000*std::numeric_limits<Real>::epsilon(),
+                        Real abs_tol = 0,
+                        std::size_t degree = 8,
+                        std::size_t max_depth = 16) : m_a(a), m_b(b), m_n(degree + 1)
+    {
+        using std::abs;
+        using std::isfinite;
+        if (!(a < b))
+        {
+            throw std::domain_error("a < b is required.");
+        }
+        if (!(rel_tol > 0))
+        {
+            throw std::domain_error("A positive relative tolerance is required.");
+        }
+        if (degree < 1)
+        {
+            throw std::domain_error("The degree of the interpolant must be at least one.");
+        }
+        if (max_depth > 24)
+        {
+            throw std::domain_error("A maximum bisection depth of at most 24 is supported.");
+        }
+
+        // Each accepted interval is recorded as (depth, position at that depth):
+        std::vector<std::pair<std::size_t, std::uint64_t>> accepted;
+        std::vector<std::pair<std::size_t, std::uint64_t>> stack{{0, 0}};
+        std::vector<Real> coeffs(m_n);
+        std::vector<Real> scratch;
+        m_max_error = 0;
+        std::size_t deepest = 0;
+        while (!stack.empty())
+        {
+            std::size_t depth = stack.back().first;
+            std::uint64_t pos = stack.back().second;
+            stack.pop_back();
+            Real h = (m_b - m_a)/static_cast<Real>(std::uint64_t(1) << depth);
+            Real l = m_a + pos*h;
+            Real r = (pos + 1 == (std::uint64_t(1) << depth)) ? m_b : l + h;
+            detail::piecewise_chebyshev_fit(f, l, r, m_n, coeffs.data(), scratch);
+
+            // Validate between the interpolation nodes, where the interpolation error is largest:
+            Real err = 0;
+            const std::size_t samples = 2*m_n + 1;
+            for (std::size_t i = 0; i <= samples; ++i)
+            {
+                Real t = -1 + 2*static_cast<Real>(i)/samples;
+                Real x = l + (t + 1)*(r - l)/2;
+                Real expected = static_cast<Real>(f(x));
+                Real computed = chebyshev_clenshaw_recurrence(coeffs.data(), m_n, t);
+                Real scale = (std::max)(abs(expected), abs_tol/rel_tol);
+                Real e = scale > 0 ? abs(computed - expected)/scale : abs(computed - expected);
+                if (!isfinite(e))
+                {
+                    throw std::domain_error("The function is not finite on [a, b].");
+                }
+                err = (std::max)(err, e);
+            }
+
+            if (err <= rel_tol || depth == max_depth)
+            {
+                m_max_error = (std::max)(m_max_error, err);
+                deepest = (std::max)(deepest, depth);
+                accepted.emplace_back(depth, pos);
+                m_centers.push_back((l + r)/2);
+                m_inv_half_widths.push_back(2/(r - l));
+                m_coeffs.insert(m_coeffs.end(), coeffs.begin(), coeffs.end());
+            }
+            else
+            {
+                stack.emplace_back(depth + 1, 2*pos + 1);
+                stack.emplace_back(depth + 1, 2*pos);
+            }
+        }
+
+        m_depth = deepest;
+        m_index.resize(std::size_t(1) << m_depth);
+        for (std::size_t k = 0; k < accepted.size(); ++k)
+        {
+            std::size_t shift = m_depth - accepted[k].first;
+            std::size_t first_cell = static_cast<std::size_t>(accepted[k].second << shift);
+            std::size_t cells = std::size_t(1) << shift;
+            std::fill_n(m_index.begin() + first_cell, cells, static_cast<std::uint32_t>(k));
+        }
+        m_inv_cell_width = static_cast<Real>(m_index.size())/(m_b - m_a);
+    }
+
+    // Reload a table previously written by save():
+    explicit piecewise_chebyshev(std::istream& is)
+    {
+        std::size_t intervals;
+        if (!(is >> m_a >> m_b >> m_n >> m_depth >> intervals >> m_max_error))
+        {
+            throw std::domain_error("Unable to read the piecewise Chebyshev table header.");
+        }
+        if (!(m_a < m_b) || m_n < 2 || m_depth > 24 || intervals == 0)
+        {
+            throw std::domain_error("Invalid piecewise Chebyshev table header.");
+        }
+        m_index.resize(std::size_t(1) << m_depth);
+        for (auto & k : m_index)
+        {
+            is >> k;
+        }
+        m_centers.resize(intervals);
+        m_inv_half_widths.resize(intervals);
+        m_coeffs.resize(intervals*m_n);
+        for (std::size_t k = 0; k < intervals; ++k)
+        {
+            is >> m_centers[k] >> m_inv_half_widths[k];
+            for (std::size_t j = 0; j < m_n; ++j)
+            {
+                is >> m_coeffs[k*m_n + j];
+            }
+        }
+        if (!is)
+        {
+            throw std::domain_error("Truncated piecewise Chebyshev table.");
+        }
+        for (auto k : m_index)
+        {
+            if (k >= intervals)
+            {
+                throw std::domain_error("Corrupt piecewise Chebyshev table index.");
+            }
+        }
+        m_inv_cell_width = static_cast<Real>(m_index.size())/(m_b - m_a);
+    }
+
+    Real operator()(Real x) const
+    {
+        if (!(x >= m_a && x <= m_b))
+        {
+            throw std::domain_error("x in [a, b] is required.");
+        }
+        std::size_t cell = (std::min)(static_cast<std::size_t>((x - m_a)*m_inv_cell_width), m_index.size() - 1);
+        std::size_t k = m_index[cell];
+        Real t = (x - m_centers[k])*m_inv_half_widths[k];
+        // Rounding in the cell computation can place x a hair outside the interval:
+        t = (std::min)((std::max)(t, Real(-1)), Real(1));
+        return chebyshev_clenshaw_recurrence(m_coeffs.data() + k*m_n, m_n, t);
+    }
+
+    // Evaluates the table at every point of [first, last).  The Clenshaw recurrences of four consecutive
+    // points are run in lockstep, so that their (serially dependent) latencies overlap:
+    template<class InputIterator, class OutputIterator>
+    OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out) const
+    {
+        using boost::math::constants::half;
+        constexpr std::size_t lanes = 4;
+        while (first != last)
+        {
+            std::size_t count = 0;
+            const Real* c[lanes];
+            Real t[lanes];
+            for (; (count < lanes) && (first != last); ++count, ++first)
+            {
+                Real x = static_cast<Real>(*first);
+                if (!(x >= m_a && x <= m_b))
+                {
+                    throw std::domain_error("x in [a, b] is required.");
+                }
+                std::size_t cell = (std::min)(static_cast<std::size_t>((x - m_a)*m_inv_cell_width), m_index.size() - 1);
+                std::size_t k = m_index[cell];
+                t[count] = (std::min)((std::max)(Real((x - m_centers[k])*m_inv_half_widths[k]), Real(-1)), Real(1));
+                c[count] = m_coeffs.data() + k*m_n;
+            }
+            // Unused lanes repeat the first point:
+            for (std::size_t l = count; l < lanes; ++l)
+            {
+                t[l] = t[0];
+                c[l] = c[0];
+            }
+            Real b1[lanes];
+            Real b2[lanes];
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                b1[l] = c[l][m_n - 1];
+                b2[l] = 0;
+            }
+            for (std::size_t j = m_n - 2; j >= 1; --j)
+            {
+                for (std::size_t l = 0; l < lanes; ++l)
+                {
+                    Real tmp = 2*t[l]*b1[l] - b2[l] + c[l][j];
+                    b2[l] = b1[l];
+                    b1[l] = tmp;
+                }
+            }
+            for (std::size_t l = 0; l < count; ++l, ++out)
+            {
+                *out = t[l]*b1[l] - b2[l] + half<Real>()*c[l][0];
+            }
+        }
+        return out;
+    }
+
+    void save(std::ostream& os) const
+    {
+        auto precision = os.precision(std::numeric_limits<Real>::max_digits10);
+        os << m_a << ' ' << m_b << ' ' << m_n << ' ' << m_depth << ' ' << m_centers.size() << ' ' << m_max_error << '\n';
+        for (auto k : m_index)
+        {
+            os << k << ' ';
+        }
+        os << '\n';
+        for (std::size_t k = 0; k < m_centers.size(); ++k)
+        {
+            os << m_centers[k] << ' ' << m_inv_half_widths[k];
+            for (std::size_t j = 0; j < m_n; ++j)
+            {
+                os << ' ' << m_coeffs[k*m_n + j];
+            }
+            os << '\n';
+        }
+        os.precision(precision);
+    }
+
+    std::size_t intervals() const
+    {
+        return m_centers.size();
+    }
+
+    std::size_t degree() const
+    {
+        return m_n - 1;
+    }
+
+    // Largest error observed at the validation points, relative to max(|f|, abs_tol/rel_tol):
+    Real max_error() const
+    {
+        return m_max_error;
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        return std::make_pair(m_a, m_b);
+    }
+
+    const std::vector<Real>& coefficients() const
+    {
+        return m_coeffs;
+    }
+
+private:
+    Real m_a;
+    Real m_b;
+    std::size_t m_n;
+    std::size_t m_depth;
+    Real m_inv_cell_width;
+    Real m_max_error;
+    std::vector<std::uint32_t> m_index;
+    std::vector<Real> m_centers;
+    std::vector<Real> m_inv_half_widths;
+    std::vector<Real> m_coeffs;
+};
+
+}}
+#endif
@@ -11,6 +11,8 @@
 #ifndef _BOOST_POLYGAMMA_2013_07_30_HPP_
   #define _BOOST_POLYGAMMA_2013_07_30_HPP_
 
+#include <iterator>
+#include <vector>
 #include <boost/math/special_functions/factorials.hpp>
 #include <boost/math/special_functions/detail/polygamma.hpp>
 #include <boost/math/special_functions/trigamma.hpp>
@@ -77,6 +79,52 @@ namespace boost { namespace math {
       return boost::math::polygamma(n, x, policies::policy<>());
   }
 
+  //
+  // Evaluates polygamma of a fixed order over a range of arguments, sharing the
+  // Bernoulli number part of the asymptotic expansion between all of them:
+  //
+  template<class ForwardIterator, class OutputIterator, class Policy>
+  OutputIterator polygamma(const int n, ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy& pol)
+  {
+     typedef typename std::iterator_traits<ForwardIterator>::value_type T;
+     if(n == 0)
+     {
+        for(; first != last; ++first)
+           *out++ = boost::math::digamma(*first, pol);
+        return out;
+     }
+     if(n == 1)
+     {
+        for(; first != last; ++first)
+           *out++ = boost::math::trigamma(*first, pol);
+        return out;
+     }
+     BOOST_FPU_EXCEPTION_GUARD
+     typedef typename tools::promote_args<T>::type result_type;
+     typedef typename policies::evaluation<result_type, Policy>::type value_type;
+     typedef typename policies::normalise<
+        Policy,
+        policies::promote_float<false>,
+        policies::promote_double<false>,
+        policies::discrete_quantile<>,
+        policies::assert_undefined<> >::type forwarding_policy;
+
+     std::vector<value_type> x;
+     for(; first != last; ++first)
+        x.push_back(static_cast<value_type>(*first));
+     std::vector<value_type> result(x.size());
+     detail::polygamma_imp_batch(n, x.data(), result.data(), x.size(), forwarding_policy());
+     for(const value_type& r : result)
+        *out++ = policies::checked_narrowing_cast<result_type, forwarding_policy>(r, "boost::math::polygamma<%1%>(int, %1%)");
+     return out;
+  }
+
+  template<class ForwardIterator, class OutputIterator>
+  inline OutputIterator polygamma(const int n, ForwardIterator first, ForwardIterator last, OutputIterator out)
+  {
+      return boost::math::polygamma(n, first, last, out, policies::policy<>());
+  }
+
 } } // namespace boost::math
 
 #endif // _BOOST_BERNOULLI_2013_05_30_HPP_
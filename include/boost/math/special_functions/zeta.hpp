@@ -18,6 +18,11 @@
 #include <boost/math/special_functions/gamma.hpp>
 #include <boost/math/special_functions/factorials.hpp>
 #include <boost/math/special_functions/sin_pi.hpp>
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <iterator>
+#include <vector>
 
 #if defined(__GNUC__) && defined(BOOST_MATH_USE_FLOAT128)
 //
@@ -1010,6 +1015,66 @@ T zeta_imp(T s, T sc, const Policy& pol, const Tag& tag)
    return result;
 }
 
+template <class T, class Policy, class Tag>
+void zeta_imp_batch(const T* s, T* result, std::size_t count, const Policy& pol, const Tag& tag)
+{
+   BOOST_MATH_STD_USING
+   //
+   // Sort the arguments into blocks by evaluation method, so that each method runs
+   // as one tight loop rather than re-selecting the method on every call:
+   //
+   // Block 0 holds the integers: these have closed forms (or cached values for odd
+   // integers) and are frequently repeated, so each distinct value is evaluated just once.
+   // Blocks 1 to digits + 1 hold the non-integers in [root_epsilon, digits] keyed
+   // on their integer part, which is what selects the approximation in zeta_imp_prec.
+   // The last block holds everything needing the general treatment: reflection for s < 0,
+   // the expansion about zero, s > digits, and non-finite arguments.
+   //
+   const int digits = policies::digits<T, Policy>();
+   const std::size_t blocks = static_cast<std::size_t>(digits) + 3;
+   std::vector<std::size_t> block(count);
+   std::vector<std::size_t> offsets(blocks + 1, 0);
+   for(std::size_t i = 0; i < count; ++i)
+   {
+      T x = s[i];
+      if((floor(x) == x) && (fabs(x) <= INT_MAX))
+         block[i] = 0;
+      else if((x >= tools::root_epsilon<T>()) && (x <= digits))
+         block[i] = 1 + static_cast<std::size_t>(itrunc(x, pol));
+      else
+         block[i] = blocks - 1;
+      ++offsets[block[i] + 1];
+   }
+   for(std::size_t b = 0; b < blocks; ++b)
+      offsets[b + 1] += offsets[b];
+   std::vector<std::size_t> order(count);
+   {
+      std::vector<std::size_t> next(offsets.begin(), offsets.end() - 1);
+      for(std::size_t i = 0; i < count; ++i)
+         order[next[block[i]]++] = i;
+   }
+
+   std::sort(order.begin(), order.begin() + offsets[1], [s](std::size_t a, std::size_t b) { return s[a] < s[b]; });
+   for(std::size_t i = 0; i < offsets[1]; ++i)
+   {
+      std::size_t k = order[i];
+      if((i != 0) && (s[k] == s[order[i - 1]]))
+         result[k] = result[order[i - 1]];
+      else
+         result[k] = zeta_imp(s[k], T(1 - s[k]), pol, tag);
+   }
+   for(std::size_t i = offsets[1]; i < offsets[blocks - 1]; ++i)
+   {
+      std::size_t k = order[i];
+      result[k] = zeta_imp_prec(s[k], T(1 - s[k]), pol, tag);
+   }
+   for(std::size_t i = offsets[blocks - 1]; i < count; ++i)
+   {
+      std::size_t k = order[i];
+      result[k] = zeta_imp(s[k], T(1 - s[k]), pol, tag);
+   }
+}
+
 template <class T, class Policy, class tag>
 struct zeta_initializer
 {
@@ -1093,6 +1158,101 @@ inline typename tools::promote_args<T>::type zeta(T s)
    return zeta(s, policies::policy<>());
 }
 
+//
+// Evaluates zeta over a range of arguments, grouping them by evaluation method:
+//
+template <class ForwardIterator, class OutputIterator, class Policy>
+OutputIterator zeta(ForwardIterator first, ForwardIterator last, OutputIterator out, const Policy&)
+{
+   typedef typename std::iterator_traits<ForwardIterator>::value_type T;
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef std::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 :
+      precision_type::value <= 113 ? 113 : 0
+   > tag_type;
+
+   detail::zeta_initializer<value_type, forwarding_policy, tag_type>::force_instantiate();
+
+   std::vector<value_type> s;
+   for(; first != last; ++first)
+      s.push_back(static_cast<value_type>(*first));
+   std::vector<value_type> result(s.size());
+   detail::zeta_imp_batch(s.data(), result.data(), s.size(), forwarding_policy(), tag_type());
+   for(const value_type& r : result)
+      *out++ = policies::checked_narrowing_cast<result_type, forwarding_policy>(r, "boost::math::zeta<%1%>(%1%)");
+   return out;
+}
+
+template <class ForwardIterator, class OutputIterator>
+inline OutputIterator zeta(ForwardIterator first, ForwardIterator last, OutputIterator out)
+{
+   return zeta(first, last, out, policies::policy<>());
+}
+
+//
+// Fills out with zeta(start), zeta(start + 1), ... zeta(start + count - 1):
+//
+template <class T, class OutputIterator, class Policy>
+OutputIterator zeta_integer_table(int start, unsigned count, OutputIterator out, const Policy&)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::precision<result_type, Policy>::type precision_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef std::integral_constant<int,
+      precision_type::value <= 0 ? 0 :
+      precision_type::value <= 53 ? 53 :
+      precision_type::value <= 64 ? 64 :
+      precision_type::value <= 113 ? 113 : 0
+   > tag_type;
+   static const char* function = "boost::math::zeta_integer_table<%1%>(int, unsigned, OutputIterator)";
+
+   if((count != 0) && (static_cast<long long>(start) + count - 1 > INT_MAX))
+      policies::raise_domain_error<result_type>(function, "The table would extend beyond INT_MAX, starting from %1%", static_cast<result_type>(start), forwarding_policy());
+
+   detail::zeta_initializer<value_type, forwarding_policy, tag_type>::force_instantiate();
+
+   //
+   // Every value above the precision of the type rounds to one, and the
+   // remainder all have closed forms or are cached, see zeta_imp:
+   //
+   const int digits = policies::digits<value_type, forwarding_policy>();
+   for(unsigned i = 0; i < count; ++i)
+   {
+      int v = static_cast<int>(start + static_cast<long long>(i));
+      if(v > digits)
+         *out++ = result_type(1);
+      else
+         *out++ = policies::checked_narrowing_cast<result_type, forwarding_policy>(detail::zeta_imp(
+            static_cast<value_type>(v),
+            static_cast<value_type>(1 - static_cast<value_type>(v)),
+            forwarding_policy(),
+            tag_type()), function);
+   }
+   return out;
+}
+
+template <class T, class OutputIterator>
+inline OutputIterator zeta_integer_table(int start, unsigned count, OutputIterator out)
+{
+   return zeta_integer_table<T>(start, count, out, policies::policy<>());
+}
+
 }} // namespaces
 
 #endif // BOOST_MATH_ZETA_HPP
@@ -0,0 +1,316 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_ACCUMULATORS_HPP
+#define BOOST_MATH_STATISTICS_ACCUMULATORS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <boost/math/statistics/detail/single_pass.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+
+//
+// Online versions of first_four_moments, means_and_covariance and gini_coefficient.  Each accumulator
+// takes values one at a time or a range at a time, and two accumulators of disjoint samples merge into
+// the accumulator of their union, by the same pairwise formulas as the parallel one-shot functions use
+// to combine the results of their threads.  So shards of a stream may be accumulated on different
+// threads or machines, and combined in any order, without going back to the data.
+//
+
+namespace boost { namespace math { namespace statistics {
+
+template<class Real = double>
+class moments_accumulator
+{
+public:
+    using value_type = Real;
+
+    void update(const Real x)
+    {
+        m_n += 1;
+        detail::update_first_four_moments(m_M1, m_M2, m_M3, m_M4, m_n, x);
+    }
+
+    template<class ForwardIterator>
+    void update(ForwardIterator first, ForwardIterator last)
+    {
+        if(first == last)
+        {
+            return;
+        }
+        const auto chunk = detail::first_four_moments_sequential_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+        detail::merge_first_four_moments(m_M1, m_M2, m_M3, m_M4, m_n,
+                                         std::get<0>(chunk), std::get<1>(chunk), std::get<2>(chunk), std::get<3>(chunk), std::get<4>(chunk));
+    }
+
+    template<class Container>
+    void update(Container const & v)
+    {
+        update(std::cbegin(v), std::cend(v));
+    }
+
+    void merge(moments_accumulator const & other)
+    {
+        detail::merge_first_four_moments(m_M1, m_M2, m_M3, m_M4, m_n, other.m_M1, other.m_M2, other.m_M3, other.m_M4, other.m_n);
+    }
+
+    std::size_t count() const
+    {
+        return static_cast<std::size_t>(m_n);
+    }
+
+    // The mean and the second, third and fourth central moments, as returned by first_four_moments,
+    // or NaNs if there is no data:
+    std::tuple<Real, Real, Real, Real> result() const
+    {
+        if(m_n == 0)
+        {
+            const Real nan = std::numeric_limits<Real>::quiet_NaN();
+            return std::make_tuple(nan, nan, nan, nan);
+        }
+        return std::make_tuple(m_M1, m_M2/m_n, m_M3/m_n, m_M4/m_n);
+    }
+
+    Real mean() const
+    {
+        return m_n == 0 ? std::numeric_limits<Real>::quiet_NaN() : m_M1;
+    }
+
+    Real variance() const
+    {
+        return m_M2/m_n;
+    }
+
+    Real sample_variance() const
+    {
+        return m_M2/(m_n-1);
+    }
+
+    Real skewness() const
+    {
+        using std::sqrt;
+        if(m_M2 == 0 && m_n > 0)
+        {
+            // As for skewness(), a constant dataset has no skewness.
+            return Real(0);
+        }
+        return m_M3/(m_M2*sqrt(m_M2/m_n));
+    }
+
+    Real kurtosis() const
+    {
+        if(m_M2 == 0 && m_n > 0)
+        {
+            return Real(0);
+        }
+        return (m_M4/m_n)/((m_M2/m_n)*(m_M2/m_n));
+    }
+
+    Real excess_kurtosis() const
+    {
+        return kurtosis() - 3;
+    }
+
+private:
+    Real m_M1 = 0;
+    Real m_M2 = 0;
+    Real m_M3 = 0;
+    Real m_M4 = 0;
+    Real m_n = 0;
+};
+
+template<class Real = double>
+class covariance_accumulator
+{
+public:
+    using value_type = Real;
+
+    void update(const Real u, const Real v)
+    {
+        // The merge with a sample of one, as in detail::correlation_coefficient_seq_impl:
+        const Real n = m_n + 1;
+        const Real u_tmp = u - m_mu_u;
+        const Real v_tmp = v - m_mu_v;
+        m_Qu = m_Qu + (m_n*u_tmp*u_tmp)/n;
+        m_Qv = m_Qv + (m_n*v_tmp*v_tmp)/n;
+        m_C = m_C + (m_n*u_tmp*v_tmp)/n;
+        m_mu_u = m_mu_u + u_tmp/n;
+        m_mu_v = m_mu_v + v_tmp/n;
+        m_n = n;
+    }
+
+    template<class ForwardIterator>
+    void update(ForwardIterator u_first, ForwardIterator u_last, ForwardIterator v_first, ForwardIterator v_last)
+    {
+        if(std::distance(u_first, u_last) != std::distance(v_first, v_last))
+        {
+            throw std::domain_error("The size of each sample set must be the same to compute covariance");
+        }
+        if(u_first == u_last)
+        {
+            return;
+        }
+        using ReturnType = std::tuple<Real, Real, Real, Real, Real, Real, Real>;
+        const ReturnType chunk = detail::correlation_coefficient_seq_impl<ReturnType>(u_first, u_last, v_first, v_last);
+        merge_parts(std::get<0>(chunk), std::get<2>(chunk), std::get<1>(chunk), std::get<3>(chunk), std::get<4>(chunk), std::get<6>(chunk));
+    }
+
+    template<class Container>
+    void update(Container const & u, Container const & v)
+    {
+        update(std::cbegin(u), std::cend(u), std::cbegin(v), std::cend(v));
+    }
+
+    void merge(covariance_accumulator const & other)
+    {
+        merge_parts(other.m_mu_u, other.m_mu_v, other.m_Qu, other.m_Qv, other.m_C, other.m_n);
+    }
+
+    std::size_t count() const
+    {
+        return static_cast<std::size_t>(m_n);
+    }
+
+    // The means of u and v and their population covariance, as returned by means_and_covariance:
+    std::tuple<Real, Real, Real> result() const
+    {
+        if(m_n == 0)
+        {
+            const Real nan = std::numeric_limits<Real>::quiet_NaN();
+            return std::make_tuple(nan, nan, nan);
+        }
+        return std::make_tuple(m_mu_u, m_mu_v, m_C/m_n);
+    }
+
+    Real covariance() const
+    {
+        return m_C/m_n;
+    }
+
+    // As for correlation_coefficient, NaN if either sample is constant:
+    Real correlation_coefficient() const
+    {
+        using std::sqrt;
+        if(m_Qu == 0 || m_Qv == 0)
+        {
+            return std::numeric_limits<Real>::quiet_NaN();
+        }
+        const Real rho = m_C/sqrt(m_Qu*m_Qv);
+        return (std::max)(Real(-1), (std::min)(Real(1), rho));
+    }
+
+private:
+    void merge_parts(const Real mu_u, const Real mu_v, const Real Qu, const Real Qv, const Real C, const Real n)
+    {
+        if(n == 0)
+        {
+            return;
+        }
+        // The sums of squares of the deviations merge as the co-moment of each sample with itself:
+        const Real delta_u = mu_u - m_mu_u;
+        const Real delta_v = mu_v - m_mu_v;
+        const Real weight = (m_n*n)/(m_n + n);
+        m_Qu = m_Qu + Qu + delta_u*delta_u*weight;
+        m_Qv = m_Qv + Qv + delta_v*delta_v*weight;
+        detail::merge_means_and_comoment(m_mu_u, m_mu_v, m_C, m_n, mu_u, mu_v, C, n);
+    }
+
+    Real m_mu_u = 0;
+    Real m_mu_v = 0;
+    Real m_Qu = 0;
+    Real m_Qv = 0;
+    Real m_C = 0;
+    Real m_n = 0;
+};
+
+//
+// The Gini coefficient depends on the order of the whole sample, so unlike the moments it cannot be
+// merged from a few numbers.  The accumulator keeps the values, sorted, and merges new values in
+// when a result is asked for, so that each result costs time linear in the number of values.
+//
+template<class Real = double>
+class gini_accumulator
+{
+public:
+    using value_type = Real;
+
+    void update(const Real x)
+    {
+        m_pending.push_back(x);
+    }
+
+    template<class ForwardIterator>
+    void update(ForwardIterator first, ForwardIterator last)
+    {
+        m_pending.insert(m_pending.end(), first, last);
+    }
+
+    template<class Container>
+    void update(Container const & v)
+    {
+        update(std::cbegin(v), std::cend(v));
+    }
+
+    // Leaves other untouched, so that one shard may be merged into several accumulators at once:
+    void merge(gini_accumulator const & other)
+    {
+        std::vector<Real> pending(other.m_pending);
+        std::sort(pending.begin(), pending.end());
+        const auto other_middle = pending.insert(pending.end(), other.m_sorted.begin(), other.m_sorted.end());
+        std::inplace_merge(pending.begin(), other_middle, pending.end());
+        flush();
+        const auto middle = m_sorted.insert(m_sorted.end(), pending.begin(), pending.end());
+        std::inplace_merge(m_sorted.begin(), middle, m_sorted.end());
+    }
+
+    std::size_t count() const
+    {
+        return m_sorted.size() + m_pending.size();
+    }
+
+    // As gini_coefficient.  Not const, since the new values are sorted in first:
+    Real result()
+    {
+        flush();
+        if(m_sorted.empty())
+        {
+            return std::numeric_limits<Real>::quiet_NaN();
+        }
+        return detail::gini_coefficient_sequential_impl<Real>(m_sorted.begin(), m_sorted.end());
+    }
+
+    // As sample_gini_coefficient:
+    Real sample_result()
+    {
+        const Real n = static_cast<Real>(count());
+        return n*result()/(n-1);
+    }
+
+private:
+    void flush()
+    {
+        if(m_pending.empty())
+        {
+            return;
+        }
+        std::sort(m_pending.begin(), m_pending.end());
+        const auto middle = m_sorted.insert(m_sorted.end(), m_pending.begin(), m_pending.end());
+        std::inplace_merge(m_sorted.begin(), middle, m_sorted.end());
+        m_pending.clear();
+    }
+
+    std::vector<Real> m_sorted;
+    std::vector<Real> m_pending;
+};
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_ACCUMULATORS_HPP
@@ -9,10 +9,22 @@
 #define BOOST_MATH_STATISTICS_ANDERSON_DARLING_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/config.hpp>
 #include <boost/math/statistics/univariate_statistics.hpp>
 #include <boost/math/special_functions/erf.hpp>
 
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
 namespace boost { namespace math { namespace statistics {
 
 template<class RandomAccessContainer>
@@ -108,5 +120,214 @@ auto anderson_darling_normality_statistic(RandomAccessContainer const & v,
     return v.size()*(left_tail + right_tail + integrals);
 }
 
+namespace detail {
+
+// The k-sample statistic A^2_akN of Scholz and Stephens, "K-Sample Anderson-Darling Tests", JASA 82 (1987), 918-924,
+// which uses midranks so that it also applies to samples with ties:
+//
+//   A^2 = (N-1)/N^2 sum_i 1/n_i sum_j l_j (N M_ij - n_i B_j)^2/(B_j (N - B_j) - N l_j/4)
+//
+// where the z_j are the distinct values of the pooled sample, l_j the number of observations equal to z_j,
+// B_j the number below z_j plus l_j/2, and M_ij the same count within sample i.
+// It is computed in one merge pass over the sorted samples.
+template<typename Real, typename SampleContainer>
+Real k_sample_anderson_darling_imp(SampleContainer const & samples, std::vector<std::size_t>& sizes)
+{
+    using Iterator = decltype(std::begin(*std::begin(samples)));
+    const std::size_t k = static_cast<std::size_t>(std::distance(std::begin(samples), std::end(samples)));
+    if (k < 2) {
+        throw std::domain_error("At least two samples are required.");
+    }
+    std::vector<Iterator> heads;
+    std::vector<Iterator> ends;
+    sizes.clear();
+    std::size_t N = 0;
+    for (auto const & sample : samples) {
+        heads.push_back(std::begin(sample));
+        ends.push_back(std::end(sample));
+        sizes.push_back(static_cast<std::size_t>(std::distance(std::begin(sample), std::end(sample))));
+        if (sizes.back() == 0) {
+            throw std::domain_error("Every sample must contain at least one observation.");
+        }
+        N += sizes.back();
+    }
+
+    std::vector<std::size_t> below(k, 0);
+    std::vector<std::size_t> equal(k);
+    std::vector<Real> sums(k, Real(0));
+    std::size_t below_total = 0;
+    bool started = false;
+    bool varied = false;
+    Real last_z = 0;
+    while (below_total < N) {
+        // The next distinct value is the smallest of the heads of the samples:
+        bool found = false;
+        Real z = 0;
+        for (std::size_t i = 0; i < k; ++i) {
+            if (heads[i] != ends[i] && (!found || *heads[i] < z)) {
+                z = static_cast<Real>(*heads[i]);
+                found = true;
+            }
+        }
+        // Fails for a decrease in any sample, and for NaN:
+        if (!(z == z) || (started && !(z > last_z))) {
+            throw std::domain_error("Every sample must be sorted in increasing order, and contain no NaNs.");
+        }
+        std::size_t l = 0;
+        for (std::size_t i = 0; i < k; ++i) {
+            equal[i] = 0;
+            while (heads[i] != ends[i] && *heads[i] == z) {
+                ++heads[i];
+                ++equal[i];
+            }
+            l += equal[i];
+        }
+        Real B = below_total + Real(l)/2;
+        Real denominator = B*(N - B) - Real(N)*l/4;
+        // The denominator is zero only when every observation equals z:
+        if (denominator > 0) {
+            varied = true;
+            for (std::size_t i = 0; i < k; ++i) {
+                Real M = below[i] + Real(equal[i])/2;
+                Real t = N*M - sizes[i]*B;
+                sums[i] += l*t*t/denominator;
+            }
+        }
+        for (std::size_t i = 0; i < k; ++i) {
+            below[i] += equal[i];
+        }
+        below_total += l;
+        started = true;
+        last_z = z;
+    }
+    if (!varied) {
+        // Every observation is equal, so there is nothing to compare:
+        return std::numeric_limits<Real>::quiet_NaN();
+    }
+    Real A2 = 0;
+    for (std::size_t i = 0; i < k; ++i) {
+        A2 += sums[i]/sizes[i];
+    }
+    return A2*(N - 1)/(Real(N)*N);
+}
+
+// The p-value from the standardized statistic T = (A^2 - (k-1))/sigma_N, with the variance sigma_N^2 of
+// Scholz and Stephens, equation (4).  Their table of critical values at significance levels from 0.25
+// down to 0.001, as a function of k, is interpolated by a quadratic in T fitted to log(significance),
+// as in SciPy's anderson_ksamp; p-values beyond the table are capped at 0.25 and floored at 0.001.
+template<typename Real>
+Real k_sample_anderson_darling_pvalue(Real A2, std::vector<std::size_t> const & sizes)
+{
+    using std::sqrt;
+    using std::log;
+    using std::exp;
+    const std::size_t k = sizes.size();
+    std::size_t n_total = 0;
+    Real H = 0;
+    for (std::size_t n_i : sizes) {
+        n_total += n_i;
+        H += Real(1)/n_i;
+    }
+    if (n_total < 4) {
+        throw std::domain_error("At least four observations in all are required for a p-value.");
+    }
+    const Real N = static_cast<Real>(n_total);
+    // h = sum_{i=1}^{N-1} 1/i, and g = sum_{i=1}^{N-2} sum_{j=i+1}^{N-1} 1/((N-i) j), found in one pass as
+    // sum_{j=2}^{N-1} (1/j) sum_{i=1}^{j-1} 1/(N-i):
+    Real h = 0;
+    Real g = 0;
+    Real inner = 0;
+    for (std::size_t j = 1; j < n_total; ++j) {
+        if (j > 1) {
+            inner += Real(1)/(n_total - (j - 1));
+            g += inner/j;
+        }
+        h += Real(1)/j;
+    }
+    const Real kk = static_cast<Real>(k);
+    const Real a = (4*g - 6)*(kk - 1) + (10 - 6*g)*H;
+    const Real b = (2*g - 4)*kk*kk + 8*h*kk + (2*g - 14*h - 4)*H - 8*h + 4*g - 6;
+    const Real c = (6*h + 2*g - 2)*kk*kk + (4*h - 4*g + 6)*kk + (2*h - 6)*H + 4*h;
+    const Real d = (2*h + 6)*kk*kk - 4*h*kk;
+    const Real variance = (((a*N + b)*N + c)*N + d)/((N - 1)*(N - 2)*(N - 3));
+    const Real T = (A2 - (kk - 1))/sqrt(variance);
+
+    // Critical values b0 + b1/sqrt(m) + b2/m for m = k - 1, Scholz and Stephens table 1:
+    static const double significance[7] = {0.25, 0.1, 0.05, 0.025, 0.01, 0.005, 0.001};
+    static const double b0[7] = {0.675, 1.281, 1.645, 1.96, 2.326, 2.573, 3.085};
+    static const double b1[7] = {-0.245, 0.25, 0.678, 1.149, 1.822, 2.364, 3.615};
+    static const double b2[7] = {-0.105, -0.305, -0.362, -0.391, -0.396, -0.345, -0.154};
+    const Real m = kk - 1;
+    // Least squares fit of log(significance) = p0 + p1 t + p2 t^2 through the normal equations:
+    Real S[5] = {0, 0, 0, 0, 0};
+    Real R[3] = {0, 0, 0};
+    for (int i = 0; i < 7; ++i) {
+        const Real t = b0[i] + b1[i]/sqrt(m) + b2[i]/m;
+        const Real y = log(Real(significance[i]));
+        Real power = 1;
+        for (int j = 0; j < 5; ++j) {
+            S[j] += power;
+            if (j < 3) {
+                R[j] += power*y;
+            }
+            power *= t;
+        }
+    }
+    auto det3 = [](Real a11, Real a12, Real a13, Real a21, Real a22, Real a23, Real a31, Real a32, Real a33) {
+        return a11*(a22*a33 - a23*a32) - a12*(a21*a33 - a23*a31) + a13*(a21*a32 - a22*a31);
+    };
+    const Real D = det3(S[0], S[1], S[2], S[1], S[2], S[3], S[2], S[3], S[4]);
+    const Real p0 = det3(R[0], S[1], S[2], R[1], S[2], S[3], R[2], S[3], S[4])/D;
+    const Real p1 = det3(S[0], R[0], S[2], S[1], R[1], S[3], S[2], R[2], S[4])/D;
+    const Real p2 = det3(S[0], S[1], R[0], S[1], S[2], R[1], S[2], S[3], R[2])/D;
+    const Real p = exp(p0 + (p1 + p2*T)*T);
+    return (std::min)((std::max)(p, Real(0.001)), Real(0.25));
+}
+
+} // namespace detail
+
+// The k-sample Anderson-Darling statistic A^2_akN for samples which are each sorted in increasing order,
+// passed as a container of containers.
+template<class SampleContainer,
+         typename Real = typename std::remove_cv<typename std::remove_reference<decltype(*std::begin(*std::begin(std::declval<SampleContainer const &>())))>::type>::type,
+         typename ReturnType = typename std::conditional<std::is_integral<Real>::value, double, Real>::type>
+ReturnType k_sample_anderson_darling_statistic(SampleContainer const & samples)
+{
+    std::vector<std::size_t> sizes;
+    return detail::k_sample_anderson_darling_imp<ReturnType>(samples, sizes);
+}
+
+// Returns the statistic A^2_akN and the p-value of the hypothesis that the samples come from the same distribution.
+template<class SampleContainer,
+         typename Real = typename std::remove_cv<typename std::remove_reference<decltype(*std::begin(*std::begin(std::declval<SampleContainer const &>())))>::type>::type,
+         typename ReturnType = typename std::conditional<std::is_integral<Real>::value, double, Real>::type>
+std::pair<ReturnType, ReturnType> k_sample_anderson_darling_test(SampleContainer const & samples)
+{
+    std::vector<std::size_t> sizes;
+    ReturnType A2 = detail::k_sample_anderson_darling_imp<ReturnType>(samples, sizes);
+    if (std::isnan(A2)) {
+        return std::make_pair(A2, A2);
+    }
+    return std::make_pair(A2, detail::k_sample_anderson_darling_pvalue(A2, sizes));
+}
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+// Samples in any order: sorted copies are made with the execution policy, then merged.
+template<class ExecutionPolicy, class SampleContainer,
+         typename Real = std::remove_cv_t<std::remove_reference_t<decltype(*std::begin(*std::begin(std::declval<SampleContainer const &>())))>>,
+         typename ReturnType = std::conditional_t<std::is_integral_v<Real>, double, Real>>
+std::pair<ReturnType, ReturnType> k_sample_anderson_darling_test(ExecutionPolicy&& exec, SampleContainer const & samples)
+{
+    std::vector<std::vector<Real>> sorted;
+    for (auto const & sample : samples) {
+        sorted.emplace_back(std::begin(sample), std::end(sample));
+        std::sort(exec, sorted.back().begin(), sorted.back().end());
+    }
+    return k_sample_anderson_darling_test(sorted);
+}
+
+#endif
+
 }}}
 #endif
@@ -0,0 +1,387 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_AUTOCORRELATION_HPP
+#define BOOST_MATH_STATISTICS_AUTOCORRELATION_HPP
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/fft.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/detail/batch.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// Sample autocovariance, autocorrelation and partial autocorrelation functions, as used by the
+// Ljung-Box and Box-Pierce tests and in fitting ARMA models.  Up to a few dozen lags the sums are
+// taken directly; beyond that they come from the power spectrum of the zero padded series, so that
+// any number of lags costs O(n log n).
+//
+
+namespace boost { namespace math { namespace statistics {
+
+namespace detail {
+
+template<class T>
+using autocorrelation_real_t = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+// The smallest length >= n which factors into 2, 3 and 5, so that the transforms need no Bluestein convolution:
+inline std::size_t fft_friendly_length(std::size_t n)
+{
+    std::size_t best = 1;
+    while (best < n)
+    {
+        best *= 2;
+    }
+    for (std::size_t p5 = 1; p5 < best; p5 *= 5)
+    {
+        for (std::size_t p35 = p5; p35 < best; p35 *= 3)
+        {
+            std::size_t m = p35;
+            while (m < n)
+            {
+                m *= 2;
+            }
+            if (m < best)
+            {
+                best = m;
+            }
+        }
+    }
+    return best;
+}
+
+//
+// The sums r_k = sum_t (x_t - mu)(x_{t-k} - mu) for k = 0, ..., max_lag.  The buffers are kept from one
+// series to the next, so that a batch of series allocates only once per thread.
+//
+template<class Real>
+class autocovariance_workspace
+{
+public:
+    template<class RandomAccessIterator>
+    const std::vector<Real>& sums(RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        if (n == 0)
+        {
+            throw std::domain_error("At least one sample is required to compute the autocorrelation.");
+        }
+        if (max_lag >= n)
+        {
+            throw std::domain_error("Number of lags must be < number of elements in array.");
+        }
+
+        const Real mu = boost::math::statistics::mean(first, last);
+        m_centered.resize(n);
+        for (std::size_t t = 0; t < n; ++t)
+        {
+            m_centered[t] = static_cast<Real>(first[t]) - mu;
+        }
+
+        m_sums.assign(max_lag + 1, Real(0));
+        const std::size_t m = fft_friendly_length(n + max_lag);
+        // The direct sums cost n(max_lag + 1) multiply-adds, the two transforms about 3m log2(m) each:
+        if (static_cast<double>(max_lag + 1) * n <= 6 * static_cast<double>(m) * std::log2(static_cast<double>(m)))
+        {
+            direct(max_lag);
+        }
+        else
+        {
+            spectral(m, max_lag);
+        }
+        return m_sums;
+    }
+
+private:
+    void direct(std::size_t max_lag)
+    {
+        const std::size_t n = m_centered.size();
+        const Real* c = m_centered.data();
+        for (std::size_t k = 0; k <= max_lag; ++k)
+        {
+            Real r = 0;
+            for (std::size_t t = k; t < n; ++t)
+            {
+                r += c[t]*c[t - k];
+            }
+            m_sums[k] = r;
+        }
+    }
+
+    //
+    // With the series padded by at least max_lag zeros to length m, the circular autocorrelation is the
+    // linear one for lags up to max_lag, and is the inverse transform of the power spectrum |X_k|^2.
+    // The power spectrum is real and even, so its inverse transform is its forward transform divided by m,
+    // and both transforms are of real data.
+    //
+    void spectral(std::size_t m, std::size_t max_lag)
+    {
+        m_centered.resize(m, Real(0));
+        m_spectrum.resize(m/2 + 1);
+        boost::math::tools::real_fft(m_centered.data(), m, m_spectrum.data());
+        m_power.resize(m);
+        m_power[0] = std::norm(m_spectrum[0]);
+        for (std::size_t k = 1; k <= m/2; ++k)
+        {
+            m_power[k] = std::norm(m_spectrum[k]);
+            m_power[m - k] = m_power[k];
+        }
+        boost::math::tools::real_fft(m_power.data(), m, m_spectrum.data());
+        const Real inv_m = 1/Real(m);
+        for (std::size_t k = 0; k <= max_lag; ++k)
+        {
+            m_sums[k] = m_spectrum[k].real()*inv_m;
+        }
+    }
+
+    std::vector<Real> m_centered;
+    std::vector<Real> m_power;
+    std::vector<std::complex<Real>> m_spectrum;
+    std::vector<Real> m_sums;
+};
+
+template<class Real>
+std::vector<Real> autocovariance_from_sums(const std::vector<Real>& r, std::size_t n)
+{
+    std::vector<Real> gamma(r.size());
+    for (std::size_t k = 0; k < r.size(); ++k)
+    {
+        gamma[k] = r[k]/Real(n);
+    }
+    return gamma;
+}
+
+// As for correlation_coefficient, the autocorrelation of a constant series is a quiet NaN:
+template<class Real>
+std::vector<Real> autocorrelation_from_sums(const std::vector<Real>& r)
+{
+    std::vector<Real> rho(r.size(), std::numeric_limits<Real>::quiet_NaN());
+    if (r[0] > 0)
+    {
+        for (std::size_t k = 0; k < r.size(); ++k)
+        {
+            rho[k] = r[k]/r[0];
+        }
+    }
+    return rho;
+}
+
+//
+// The partial autocorrelations phi_kk from the autocorrelations rho_0 = 1, rho_1, ..., rho_p, by the
+// Levinson-Durbin recursion for the Yule-Walker equations, in O(p^2):
+//   phi_kk = (rho_k - sum_j phi_{k-1,j} rho_{k-j}) / (1 - sum_j phi_{k-1,j} rho_j),
+//   phi_kj = phi_{k-1,j} - phi_kk phi_{k-1,k-j}.
+// The result has phi_00 = 1 in position 0, to index as the autocorrelations do.
+//
+template<class Real>
+std::vector<Real> levinson_durbin(const std::vector<Real>& rho)
+{
+    const std::size_t p = rho.size() - 1;
+    std::vector<Real> pacf(p + 1, std::numeric_limits<Real>::quiet_NaN());
+    if (!(rho[0] == 1))
+    {
+        return pacf;
+    }
+    pacf[0] = 1;
+    std::vector<Real> phi(p + 1, Real(0));
+    std::vector<Real> previous(p + 1, Real(0));
+    Real error = 1;
+    for (std::size_t k = 1; k <= p; ++k)
+    {
+        Real num = rho[k];
+        for (std::size_t j = 1; j < k; ++j)
+        {
+            num -= phi[j]*rho[k - j];
+        }
+        const Real phi_kk = num/error;
+        previous = phi;
+        for (std::size_t j = 1; j < k; ++j)
+        {
+            phi[j] = previous[j] - phi_kk*previous[k - j];
+        }
+        phi[k] = phi_kk;
+        pacf[k] = phi_kk;
+        // The innovation variance, relative to rho_0, of the order k fit:
+        error *= (1 - phi_kk*phi_kk);
+    }
+    return pacf;
+}
+
+template<class Real>
+struct autocovariance_kernel
+{
+    std::size_t max_lag;
+
+    template<class RandomAccessIterator>
+    std::vector<Real> operator()(autocovariance_workspace<Real>& workspace, RandomAccessIterator first, RandomAccessIterator last) const
+    {
+        return autocovariance_from_sums(workspace.sums(first, last, max_lag), static_cast<std::size_t>(std::distance(first, last)));
+    }
+};
+
+template<class Real>
+struct autocorrelation_kernel
+{
+    std::size_t max_lag;
+
+    template<class RandomAccessIterator>
+    std::vector<Real> operator()(autocovariance_workspace<Real>& workspace, RandomAccessIterator first, RandomAccessIterator last) const
+    {
+        return autocorrelation_from_sums(workspace.sums(first, last, max_lag));
+    }
+};
+
+template<class Real>
+struct partial_autocorrelation_kernel
+{
+    std::size_t max_lag;
+
+    template<class RandomAccessIterator>
+    std::vector<Real> operator()(autocovariance_workspace<Real>& workspace, RandomAccessIterator first, RandomAccessIterator last) const
+    {
+        return levinson_durbin(autocorrelation_from_sums(workspace.sums(first, last, max_lag)));
+    }
+};
+
+template<class Container>
+using batch_real_t = autocorrelation_real_t<batch_value_t<Container>>;
+
+struct autocorrelation_batch_tag {};
+
+} // namespace detail
+
+// gamma_k = (1/n) sum_{t=k}^{n-1} (x_t - mu)(x_{t-k} - mu), for k = 0, ..., max_lag:
+template<class RandomAccessIterator>
+auto autocovariance(RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+{
+    using Real = detail::autocorrelation_real_t<typename std::iterator_traits<RandomAccessIterator>::value_type>;
+    detail::autocovariance_workspace<Real> workspace;
+    return detail::autocovariance_kernel<Real>{max_lag}(workspace, first, last);
+}
+
+template<class RandomAccessContainer>
+inline auto autocovariance(RandomAccessContainer const & v, std::size_t max_lag)
+{
+    return autocovariance(std::cbegin(v), std::cend(v), max_lag);
+}
+
+// rho_k = gamma_k/gamma_0, for k = 0, ..., max_lag:
+template<class RandomAccessIterator>
+auto autocorrelation(RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+{
+    using Real = detail::autocorrelation_real_t<typename std::iterator_traits<RandomAccessIterator>::value_type>;
+    detail::autocovariance_workspace<Real> workspace;
+    return detail::autocorrelation_kernel<Real>{max_lag}(workspace, first, last);
+}
+
+template<class RandomAccessContainer>
+inline auto autocorrelation(RandomAccessContainer const & v, std::size_t max_lag)
+{
+    return autocorrelation(std::cbegin(v), std::cend(v), max_lag);
+}
+
+// phi_kk, the last coefficient of the order k Yule-Walker fit, for k = 0, ..., max_lag:
+template<class RandomAccessIterator>
+auto partial_autocorrelation(RandomAccessIterator first, RandomAccessIterator last, std::size_t max_lag)
+{
+    using Real = detail::autocorrelation_real_t<typename std::iterator_traits<RandomAccessIterator>::value_type>;
+    detail::autocovariance_workspace<Real> workspace;
+    return detail::partial_autocorrelation_kernel<Real>{max_lag}(workspace, first, last);
+}
+
+template<class RandomAccessContainer>
+inline auto partial_autocorrelation(RandomAccessContainer const & v, std::size_t max_lag)
+{
+    return partial_autocorrelation(std::cbegin(v), std::cend(v), max_lag);
+}
+
+//
+// The same, for each of a batch of series, which may differ in length.  The parallel versions
+// run the series on the thread pool.
+//
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class ExecutionPolicy, class Container>
+inline auto autocovariances(ExecutionPolicy&& exec, Container const & series, std::size_t max_lag)
+{
+    using Real = detail::batch_real_t<Container>;
+    return detail::series_batch<detail::autocorrelation_batch_tag, std::vector<Real>, detail::autocovariance_workspace<Real>>(
+        exec, series, detail::autocovariance_kernel<Real>{max_lag});
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto autocorrelations(ExecutionPolicy&& exec, Container const & series, std::size_t max_lag)
+{
+    using Real = detail::batch_real_t<Container>;
+    return detail::series_batch<detail::autocorrelation_batch_tag, std::vector<Real>, detail::autocovariance_workspace<Real>>(
+        exec, series, detail::autocorrelation_kernel<Real>{max_lag});
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto partial_autocorrelations(ExecutionPolicy&& exec, Container const & series, std::size_t max_lag)
+{
+    using Real = detail::batch_real_t<Container>;
+    return detail::series_batch<detail::autocorrelation_batch_tag, std::vector<Real>, detail::autocovariance_workspace<Real>>(
+        exec, series, detail::partial_autocorrelation_kernel<Real>{max_lag});
+}
+
+template<class Container>
+inline auto autocovariances(Container const & series, std::size_t max_lag)
+{
+    return autocovariances(std::execution::seq, series, max_lag);
+}
+
+template<class Container>
+inline auto autocorrelations(Container const & series, std::size_t max_lag)
+{
+    return autocorrelations(std::execution::seq, series, max_lag);
+}
+
+template<class Container>
+inline auto partial_autocorrelations(Container const & series, std::size_t max_lag)
+{
+    return partial_autocorrelations(std::execution::seq, series, max_lag);
+}
+
+#else // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Container>
+inline auto autocovariances(Container const & series, std::size_t max_lag)
+{
+    using Real = detail::batch_real_t<Container>;
+    return detail::series_batch<std::vector<Real>, detail::autocovariance_workspace<Real>>(series, detail::autocovariance_kernel<Real>{max_lag});
+}
+
+template<class Container>
+inline auto autocorrelations(Container const & series, std::size_t max_lag)
+{
+    using Real = detail::batch_real_t<Container>;
+    return detail::series_batch<std::vector<Real>, detail::autocovariance_workspace<Real>>(series, detail::autocorrelation_kernel<Real>{max_lag});
+}
+
+template<class Container>
+inline auto partial_autocorrelations(Container const & series, std::size_t max_lag)
+{
+    using Real = detail::batch_real_t<Container>;
+    return detail::series_batch<std::vector<Real>, detail::autocovariance_workspace<Real>>(series, detail::partial_autocorrelation_kernel<Real>{max_lag});
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_AUTOCORRELATION_HPP
@@ -20,8 +20,7 @@
 
 #ifdef BOOST_MATH_EXEC_COMPATIBLE
 #include <execution>
-#include <future>
-#include <thread>
+#include <boost/math/statistics/thread_pool.hpp>
 #endif
 
 namespace boost{ namespace math{ namespace statistics { namespace detail {
@@ -57,12 +56,36 @@ ReturnType means_and_covariance_seq_impl(ForwardIterator u_begin, ForwardIterato
     return std::make_tuple(mu_u, mu_v, cov/i, Real(i));
 }
 
+// Combines the means and the sum of the products of the deviations from them, C = n*cov, of two disjoint
+// samples of sizes n_a and n_b into those of their union, in place in the first.
+// https://dl.acm.org/doi/10.1145/3221269.3223036
+template<typename Real>
+void merge_means_and_comoment(Real& mu_u_a, Real& mu_v_a, Real& C_a, Real& n_a,
+                              const Real mu_u_b, const Real mu_v_b, const Real C_b, const Real n_b)
+{
+    if(n_b == 0)
+    {
+        return;
+    }
+
+    const Real n_ab = n_a + n_b;
+    const Real delta_u = mu_u_b - mu_u_a;
+    const Real delta_v = mu_v_b - mu_v_a;
+
+    C_a = C_a + C_b + delta_u*delta_v*((n_a*n_b)/n_ab);
+    mu_u_a = mu_u_a + delta_u*(n_b/n_ab);
+    mu_v_a = mu_v_a + delta_v*(n_b/n_ab);
+    n_a = n_ab;
+}
+
 #ifdef BOOST_MATH_EXEC_COMPATIBLE
 
+struct means_and_covariance_tag {};
+
 // Numerically stable parallel computation of (co-)variance
 // https://dl.acm.org/doi/10.1145/3221269.3223036
-template<typename ReturnType, typename ForwardIterator>
-ReturnType means_and_covariance_parallel_impl(ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
+template<typename ReturnType, typename Executor, typename ForwardIterator>
+ReturnType means_and_covariance_parallel_impl(Executor& ex, ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
 {
     using Real = typename std::tuple_element<0, ReturnType>::type;
 
@@ -74,81 +97,34 @@ ReturnType means_and_covariance_parallel_impl(ForwardIterator u_begin, ForwardIt
         throw std::domain_error("The size of each sample set must be the same to compute covariance");
     }
 
-    const unsigned max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    unsigned num_threads = 2u;
-    
-    // 5.16 comes from benchmarking. See boost/math/reporting/performance/bivariate_statistics_performance.cpp
-    // Threading is faster for: 10 + 5.16e-3 N/j <= 5.16e-3N => N >= 10^4j/5.16(j-1).
-    const auto parallel_lower_bound = 10e4*max_concurrency/(5.16*(max_concurrency-1));
-    const auto parallel_upper_bound = 10e4*2/5.16; // j = 2
-
-    // https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
-    if(u_elements < parallel_lower_bound)
-    {
-        return means_and_covariance_seq_impl<ReturnType>(u_begin, u_end, v_begin, v_end);
-    }
-    else if(u_elements >= parallel_upper_bound)
-    {
-        num_threads = max_concurrency;
-    }
-    else
+    const std::size_t elements = static_cast<std::size_t>(u_elements);
+    running_estimate& cost = cost_per_element<means_and_covariance_tag, Real>();
+    const std::size_t chunks = chunk_count(ex, elements, cost);
+    if(chunks == 1)
     {
-        for(unsigned i = 3; i < max_concurrency; ++i)
-        {
-            if(parallel_lower_bound < 10e4*i/(5.16*(i-1)))
-            {
-                num_threads = i;
-                break;
-            }
-        }
+        return timed_sequential(cost, elements, [&]() { return means_and_covariance_seq_impl<ReturnType>(u_begin, u_end, v_begin, v_end); });
     }
 
-    std::vector<std::future<ReturnType>> future_manager;
-    const auto elements_per_thread = std::ceil(static_cast<double>(u_elements)/num_threads);
-
-    ForwardIterator u_it = u_begin;
-    ForwardIterator v_it = v_begin;
-
-    for(std::size_t i = 0; i < num_threads - 1; ++i)
+    const auto u_boundaries = chunk_iterators(u_begin, elements, chunks);
+    const auto v_boundaries = chunk_iterators(v_begin, elements, chunks);
+    const auto results = run_chunks(ex, cost, elements, chunks, ReturnType(), [&u_boundaries, &v_boundaries](std::size_t i)
     {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, v_it, elements_per_thread]() -> ReturnType
-        {
-            return means_and_covariance_seq_impl<ReturnType>(u_it, std::next(u_it, elements_per_thread), v_it, std::next(v_it, elements_per_thread));
-        }));
-        u_it = std::next(u_it, elements_per_thread);
-        v_it = std::next(v_it, elements_per_thread);
-    }
+        return means_and_covariance_seq_impl<ReturnType>(u_boundaries[i], u_boundaries[i + 1], v_boundaries[i], v_boundaries[i + 1]);
+    });
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, u_end, v_it, v_end]() -> ReturnType
-    {
-        return means_and_covariance_seq_impl<ReturnType>(u_it, u_end, v_it, v_end);
-    }));
-
-    ReturnType temp = future_manager[0].get();
-    Real mu_u_a = std::get<0>(temp);
-    Real mu_v_a = std::get<1>(temp);
-    Real cov_a = std::get<2>(temp);
-    Real n_a = std::get<3>(temp);
+    // The sequential results are covariances, but the merge is of the sums of the products of deviations:
+    Real mu_u_a = std::get<0>(results[0]);
+    Real mu_v_a = std::get<1>(results[0]);
+    Real n_a = std::get<3>(results[0]);
+    Real C_a = std::get<2>(results[0])*n_a;
 
-    for(std::size_t i = 1; i < future_manager.size(); ++i)
+    for(std::size_t i = 1; i < results.size(); ++i)
     {
-        temp = future_manager[i].get();
-        Real mu_u_b = std::get<0>(temp);
-        Real mu_v_b = std::get<1>(temp);
-        Real cov_b = std::get<2>(temp);
-        Real n_b = std::get<3>(temp);
-
-        const Real n_ab = n_a + n_b;
-        const Real delta_u = mu_u_b - mu_u_a;
-        const Real delta_v = mu_v_b - mu_v_a;
-
-        cov_a = cov_a + cov_b + (-delta_u)*(-delta_v)*((n_a*n_b)/n_ab);
-        mu_u_a = mu_u_a + delta_u*(n_b/n_ab);
-        mu_v_a = mu_v_a + delta_v*(n_b/n_ab);
-        n_a = n_ab;
+        const ReturnType& temp = results[i];
+        merge_means_and_comoment(mu_u_a, mu_v_a, C_a, n_a, std::get<0>(temp), std::get<1>(temp), std::get<2>(temp)*std::get<3>(temp), std::get<3>(temp));
     }
 
-    return std::make_tuple(mu_u_a, mu_v_a, cov_a, n_a);
+    return std::make_tuple(mu_u_a, mu_v_a, C_a/n_a, n_a);
 }
 
 #endif // BOOST_MATH_EXEC_COMPATIBLE
@@ -203,13 +179,15 @@ ReturnType correlation_coefficient_seq_impl(ForwardIterator u_begin, ForwardIter
 
 #ifdef BOOST_MATH_EXEC_COMPATIBLE
 
+struct correlation_coefficient_tag {};
+
 // Numerically stable parallel computation of (co-)variance:
 // https://dl.acm.org/doi/10.1145/3221269.3223036
 //
 // Parallel computation of variance:
 // http://i.stanford.edu/pub/cstr/reports/cs/tr/79/773/CS-TR-79-773.pdf
-template<typename ReturnType, typename ForwardIterator>
-ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
+template<typename ReturnType, typename Executor, typename ForwardIterator>
+ReturnType correlation_coefficient_parallel_impl(Executor& ex, ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
 {
     using Real = typename std::tuple_element<0, ReturnType>::type;
 
@@ -221,57 +199,22 @@ ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, Forwar
         throw std::domain_error("The size of each sample set must be the same to compute covariance");
     }
 
-    const unsigned max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    unsigned num_threads = 2u;
-    
-    // 3.25 comes from benchmarking. See boost/math/reporting/performance/bivariate_statistics_performance.cpp
-    // Threading is faster for: 10 + 3.25e-3 N/j <= 3.25e-3N => N >= 10^4j/3.25(j-1).
-    const auto parallel_lower_bound = 10e4*max_concurrency/(3.25*(max_concurrency-1));
-    const auto parallel_upper_bound = 10e4*2/3.25; // j = 2
-
-    // https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
-    if(u_elements < parallel_lower_bound)
-    {
-        return correlation_coefficient_seq_impl<ReturnType>(u_begin, u_end, v_begin, v_end);
-    }
-    else if(u_elements >= parallel_upper_bound)
+    const std::size_t elements = static_cast<std::size_t>(u_elements);
+    running_estimate& cost = cost_per_element<correlation_coefficient_tag, Real>();
+    const std::size_t chunks = chunk_count(ex, elements, cost);
+    if(chunks == 1)
     {
-        num_threads = max_concurrency;
+        return timed_sequential(cost, elements, [&]() { return correlation_coefficient_seq_impl<ReturnType>(u_begin, u_end, v_begin, v_end); });
     }
-    else
-    {
-        for(unsigned i = 3; i < max_concurrency; ++i)
-        {
-            if(parallel_lower_bound < 10e4*i/(3.25*(i-1)))
-            {
-                num_threads = i;
-                break;
-            }
-        }
-    }
-
-    std::vector<std::future<ReturnType>> future_manager;
-    const auto elements_per_thread = std::ceil(static_cast<double>(u_elements)/num_threads);
-
-    ForwardIterator u_it = u_begin;
-    ForwardIterator v_it = v_begin;
 
-    for(std::size_t i = 0; i < num_threads - 1; ++i)
+    const auto u_boundaries = chunk_iterators(u_begin, elements, chunks);
+    const auto v_boundaries = chunk_iterators(v_begin, elements, chunks);
+    const auto results = run_chunks(ex, cost, elements, chunks, ReturnType(), [&u_boundaries, &v_boundaries](std::size_t i)
     {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, v_it, elements_per_thread]() -> ReturnType
-        {
-            return correlation_coefficient_seq_impl<ReturnType>(u_it, std::next(u_it, elements_per_thread), v_it, std::next(v_it, elements_per_thread));
-        }));
-        u_it = std::next(u_it, elements_per_thread);
-        v_it = std::next(v_it, elements_per_thread);
-    }
+        return correlation_coefficient_seq_impl<ReturnType>(u_boundaries[i], u_boundaries[i + 1], v_boundaries[i], v_boundaries[i + 1]);
+    });
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [u_it, u_end, v_it, v_end]() -> ReturnType
-    {
-        return correlation_coefficient_seq_impl<ReturnType>(u_it, u_end, v_it, v_end);
-    }));
-
-    ReturnType temp = future_manager[0].get();
+    ReturnType temp = results[0];
     Real mu_u_a = std::get<0>(temp);
     Real Qu_a = std::get<1>(temp);
     Real mu_v_a = std::get<2>(temp);
@@ -279,9 +222,9 @@ ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, Forwar
     Real cov_a = std::get<4>(temp);
     Real n_a = std::get<6>(temp);
 
-    for(std::size_t i = 1; i < future_manager.size(); ++i)
+    for(std::size_t i = 1; i < results.size(); ++i)
     {
-        temp = future_manager[i].get();
+        temp = results[i];
         Real mu_u_b = std::get<0>(temp);
         Real Qu_b = std::get<1>(temp);
         Real mu_v_b = std::get<2>(temp);
@@ -289,16 +232,16 @@ ReturnType correlation_coefficient_parallel_impl(ForwardIterator u_begin, Forwar
         Real cov_b = std::get<4>(temp);
         Real n_b = std::get<6>(temp);
 
-        const Real n_ab = n_a + n_b;
-        const Real delta_u = mu_u_b - mu_u_a;
-        const Real delta_v = mu_v_b - mu_v_a;
-
-        cov_a = cov_a + cov_b + (-delta_u)*(-delta_v)*((n_a*n_b)/n_ab);
-        mu_u_a = mu_u_a + delta_u*(n_b/n_ab);
-        mu_v_a = mu_v_a + delta_v*(n_b/n_ab);
-        Qu_a = Qu_a + Qu_b + delta_u*delta_u*((n_a*n_b)/n_ab);
-        Qv_b = Qv_a + Qv_b + delta_v*delta_v*((n_a*n_b)/n_ab);
-        n_a = n_ab;
+        // The sums of squares are the comoments of each sample with itself, merged before the means move:
+        Real mu_u_copy = mu_u_a;
+        Real mu_u_twin = mu_u_a;
+        Real n_u = n_a;
+        merge_means_and_comoment(mu_u_copy, mu_u_twin, Qu_a, n_u, mu_u_b, mu_u_b, Qu_b, n_b);
+        Real mu_v_copy = mu_v_a;
+        Real mu_v_twin = mu_v_a;
+        Real n_v = n_a;
+        merge_means_and_comoment(mu_v_copy, mu_v_twin, Qv_a, n_v, mu_v_b, mu_v_b, Qv_b, n_b);
+        merge_means_and_comoment(mu_u_a, mu_v_a, cov_a, n_a, mu_u_b, mu_v_b, cov_b, n_b);
     }
 
     // If one dataset is constant, then the correlation coefficient is undefined.
@@ -350,13 +293,13 @@ inline auto means_and_covariance(ExecutionPolicy&& exec, Container const & u, Co
         if constexpr (std::is_integral_v<Real>)
         {
             using ReturnType = std::tuple<double, double, double, double>;
-            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v));
+            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(detail::executor_of(exec), std::begin(u), std::end(u), std::begin(v), std::end(v));
             return std::make_tuple(std::get<0>(temp), std::get<1>(temp), std::get<2>(temp));
         }
         else
         {
             using ReturnType = std::tuple<Real, Real, Real, Real>;
-            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v));
+            ReturnType temp = detail::means_and_covariance_parallel_impl<ReturnType>(detail::executor_of(exec), std::begin(u), std::end(u), std::begin(v), std::end(v));
             return std::make_tuple(std::get<0>(temp), std::get<1>(temp), std::get<2>(temp));
         }
     }
@@ -401,12 +344,12 @@ inline auto correlation_coefficient(ExecutionPolicy&& exec, Container const & u,
         if constexpr (std::is_integral_v<Real>)
         {
             using ReturnType = std::tuple<double, double, double, double, double, double, double>;
-            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v)));
+            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(detail::executor_of(exec), std::begin(u), std::end(u), std::begin(v), std::end(v)));
         }
         else
         {
             using ReturnType = std::tuple<Real, Real, Real, Real, Real, Real, Real>;
-            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v)));
+            return std::get<5>(detail::correlation_coefficient_parallel_impl<ReturnType>(detail::executor_of(exec), std::begin(u), std::end(u), std::begin(v), std::end(v)));
         }
     }
 }
@@ -20,8 +20,7 @@
 
 #ifdef BOOST_MATH_EXEC_COMPATIBLE
 #include <execution>
-#include <future>
-#include <thread>
+#include <boost/math/statistics/thread_pool.hpp>
 #endif
 
 namespace boost { namespace math { namespace statistics {
@@ -32,6 +31,10 @@ template <typename BDIter>
 std::size_t chatterjee_transform(BDIter begin, BDIter end)
 {
     std::size_t sum = 0;
+    if(begin == end)
+    {
+        return sum;
+    }
 
     while(++begin != end)
     {
@@ -48,18 +51,13 @@ std::size_t chatterjee_transform(BDIter begin, BDIter end)
     return sum;
 }
 
-template <typename ReturnType, typename ForwardIterator>
-ReturnType chatterjee_correlation_seq_impl(ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
+// The coefficient from the sum of the absolute differences of the ranks of y, taken in the order of x:
+template <typename ReturnType>
+ReturnType chatterjee_from_sum(std::size_t sum, std::size_t n)
 {
     using std::abs;
-    
-    BOOST_MATH_ASSERT_MSG(std::is_sorted(u_begin, u_end), "The x values must be sorted in order to use this functionality");
-
-    const std::vector<std::size_t> rank_vector = rank(v_begin, v_end);
 
-    std::size_t sum = chatterjee_transform(rank_vector.begin(), rank_vector.end());
-
-    ReturnType result = static_cast<ReturnType>(1) - (static_cast<ReturnType>(3 * sum) / static_cast<ReturnType>(rank_vector.size() * rank_vector.size() - 1));
+    ReturnType result = static_cast<ReturnType>(1) - (static_cast<ReturnType>(3 * sum) / static_cast<ReturnType>(n * n - 1));
 
     // If the result is 1 then Y is constant and all the elements must be ties
     if (abs(result - static_cast<ReturnType>(1)) < std::numeric_limits<ReturnType>::epsilon())
@@ -70,6 +68,18 @@ ReturnType chatterjee_correlation_seq_impl(ForwardIterator u_begin, ForwardItera
     return result;
 }
 
+template <typename ReturnType, typename ForwardIterator>
+ReturnType chatterjee_correlation_seq_impl(ForwardIterator u_begin, ForwardIterator u_end, ForwardIterator v_begin, ForwardIterator v_end)
+{
+    BOOST_MATH_ASSERT_MSG(std::is_sorted(u_begin, u_end), "The x values must be sorted in order to use this functionality");
+
+    const std::vector<std::size_t> rank_vector = rank(v_begin, v_end);
+
+    std::size_t sum = chatterjee_transform(rank_vector.begin(), rank_vector.end());
+
+    return chatterjee_from_sum<ReturnType>(sum, rank_vector.size());
+}
+
 } // Namespace detail
 
 template <typename Container, typename Real = typename Container::value_type, 
@@ -87,50 +97,39 @@ namespace boost::math::statistics {
 
 namespace detail {
 
+struct chatterjee_correlation_tag {};
+
 template <typename ReturnType, typename ExecutionPolicy, typename ForwardIterator>
 ReturnType chatterjee_correlation_par_impl(ExecutionPolicy&& exec, ForwardIterator u_begin, ForwardIterator u_end,
                                                                    ForwardIterator v_begin, ForwardIterator v_end)
 {
-    using std::abs;
     BOOST_MATH_ASSERT_MSG(std::is_sorted(std::forward<ExecutionPolicy>(exec), u_begin, u_end), "The x values must be sorted in order to use this functionality");
 
     auto rank_vector = rank(std::forward<ExecutionPolicy>(exec), v_begin, v_end);
-
-    const auto num_threads = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    std::vector<std::future<std::size_t>> future_manager {};
-    const auto elements_per_thread = std::ceil(static_cast<double>(rank_vector.size()) / num_threads);
-
-    auto it = rank_vector.begin();
-    auto end = rank_vector.end();
-    for(std::size_t i {}; i < num_threads - 1; ++i)
+    if(rank_vector.size() < 2)
     {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, elements_per_thread]() -> std::size_t
-        {
-            return chatterjee_transform(it, std::next(it, elements_per_thread));
-        }));
-        it = std::next(it, elements_per_thread - 1);
+        // There are no differences to sum, and the coefficient is undefined:
+        return chatterjee_from_sum<ReturnType>(0, rank_vector.size());
     }
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, end]() -> std::size_t
+    // Chunks of the differences of successive ranks, so that each chunk of ranks overlaps the next by one:
+    thread_pool& ex = thread_pool::shared();
+    const std::size_t pairs = rank_vector.size() - 1;
+    running_estimate& cost = cost_per_element<chatterjee_correlation_tag, std::size_t>();
+    const std::size_t chunks = chunk_count(ex, pairs, cost);
+    const auto first = rank_vector.cbegin();
+    const auto partial_sums = run_chunks(ex, cost, pairs, chunks, std::size_t(0), [first, pairs, chunks](std::size_t i) -> std::size_t
     {
-        return chatterjee_transform(it, end);
-    }));
+        return chatterjee_transform(first + chunk_begin(pairs, chunks, i), first + chunk_begin(pairs, chunks, i + 1) + 1);
+    });
 
     std::size_t sum {};
-    for(std::size_t i {}; i < future_manager.size(); ++i)
+    for(const std::size_t partial : partial_sums)
     {
-        sum += future_manager[i].get();
+        sum += partial;
     }
     
-    ReturnType result = static_cast<ReturnType>(1) - (static_cast<ReturnType>(3 * sum) / static_cast<ReturnType>(rank_vector.size() * rank_vector.size() - 1));
-
-    // If the result is 1 then Y is constant and all the elements must be ties
-    if (abs(result - static_cast<ReturnType>(1)) < std::numeric_limits<ReturnType>::epsilon())
-    {
-        return std::numeric_limits<ReturnType>::quiet_NaN();
-    }
-
-    return result;
+    return chatterjee_from_sum<ReturnType>(sum, rank_vector.size());
 }
 
 } // Namespace detail
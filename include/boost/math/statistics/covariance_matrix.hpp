@@ -0,0 +1,405 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_COVARIANCE_MATRIX_HPP
+#define BOOST_MATH_STATISTICS_COVARIANCE_MATRIX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/statistics/detail/batch.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// The covariances and correlations of every pair of a set of columns, in one pass over the data rather
+// than one per pair.  The rows are taken in blocks of a fixed size, each centered once on its own means.
+// Each tile of the matrix is then the sum of the products of the centered blocks, with the blocks merged
+// in order by the update of merge_means_and_comoment in bivariate_statistics.hpp.  The blocks do not
+// depend on the number of threads, so neither do the results.
+//
+
+namespace boost { namespace math { namespace statistics {
+
+namespace detail {
+
+template<class T>
+using covariance_matrix_real_t = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+constexpr std::size_t covariance_rows = 256;    // The rows in a block.
+constexpr std::size_t covariance_panel = 4;     // The columns multiplied at once by the inner kernel.
+constexpr std::size_t covariance_block = 32;    // The columns on each side of a tile.
+
+//
+// The data in panels of 4 columns, each panel holding its rows one after another, so that the inner
+// kernel reads both of its panels in order.  The columns are padded with zeros to a whole number of panels.
+//
+template<class Real>
+struct centered_panels
+{
+    std::size_t n = 0;              // The rows.
+    std::size_t p = 0;              // The columns.
+    std::size_t width = 0;          // The columns padded to a whole number of panels.
+    std::vector<Real> data;         // Entry (r, c) is data[((c/4)*n + r)*4 + c % 4].
+    std::vector<Real> block_means;  // The mean of column c in block k is block_means[k*width + c].
+
+    std::size_t blocks() const
+    {
+        return (n + covariance_rows - 1)/covariance_rows;
+    }
+};
+
+// Fills the blocks [k_first, k_last) of the panels, centering each on its own means:
+template<class Real, class RandomAccessIterator>
+void center_blocks(const std::vector<RandomAccessIterator>& columns, centered_panels<Real>& c, std::size_t k_first, std::size_t k_last)
+{
+    constexpr std::size_t w = covariance_panel;
+    for (std::size_t k = k_first; k < k_last; ++k)
+    {
+        const std::size_t r_first = k*covariance_rows;
+        const std::size_t r_last = (std::min)(r_first + covariance_rows, c.n);
+        const Real len = static_cast<Real>(r_last - r_first);
+        for (std::size_t j = 0; j < c.p; ++j)
+        {
+            const auto x = columns[j];
+            Real sum = 0;
+            for (std::size_t r = r_first; r < r_last; ++r)
+            {
+                sum += static_cast<Real>(x[r]);
+            }
+            const Real mean = sum/len;
+            c.block_means[k*c.width + j] = mean;
+            Real* out = c.data.data() + (j/w)*c.n*w + j % w;
+            for (std::size_t r = r_first; r < r_last; ++r)
+            {
+                out[r*w] = static_cast<Real>(x[r]) - mean;
+            }
+        }
+    }
+}
+
+// The 4 by 4 products of the rows [r_first, r_last) of panels a and b, with independent sums for the compiler to vectorize:
+template<class Real>
+void panel_products(const Real* a, const Real* b, std::size_t r_first, std::size_t r_last, Real (&s)[covariance_panel][covariance_panel])
+{
+    constexpr std::size_t w = covariance_panel;
+    for (std::size_t i = 0; i < w; ++i)
+    {
+        for (std::size_t j = 0; j < w; ++j)
+        {
+            s[i][j] = 0;
+        }
+    }
+    for (std::size_t r = r_first; r < r_last; ++r)
+    {
+        const Real* x = a + r*w;
+        const Real* y = b + r*w;
+        for (std::size_t i = 0; i < w; ++i)
+        {
+            for (std::size_t j = 0; j < w; ++j)
+            {
+                s[i][j] += x[i]*y[j];
+            }
+        }
+    }
+}
+
+//
+// The sums of the products of the deviations from the means, C, for the columns of blocks I and J >= I.
+// For each block of rows, C gains the products of that block and the merge term of Bennett et al,
+//   C = C_a + C_b + (mu_b - mu_a)(nu_b - nu_a) n_a n_b/(n_a + n_b),
+// where mu and nu are the means of the two columns so far and in the block.
+//
+template<class Real>
+void comoment_tile(const centered_panels<Real>& c, std::size_t I, std::size_t J, Real* comoments)
+{
+    constexpr std::size_t w = covariance_panel;
+    constexpr std::size_t B = covariance_block;
+    const std::size_t a_first = I*B;
+    const std::size_t a_last = (std::min)(a_first + B, c.width);
+    const std::size_t b_first = J*B;
+    const std::size_t b_last = (std::min)(b_first + B, c.width);
+    std::vector<Real> C(B*B, Real(0));
+    std::vector<Real> mu(B, Real(0));
+    std::vector<Real> nu(B, Real(0));
+    std::vector<Real> delta_a(B);
+    std::vector<Real> delta_b(B);
+    Real n_a = 0;
+    Real s[w][w];
+    for (std::size_t k = 0; k < c.blocks(); ++k)
+    {
+        const std::size_t r_first = k*covariance_rows;
+        const std::size_t r_last = (std::min)(r_first + covariance_rows, c.n);
+        const Real n_b = static_cast<Real>(r_last - r_first);
+        const Real n_ab = n_a + n_b;
+        const Real weight = (n_a*n_b)/n_ab;
+        for (std::size_t a = a_first; a < a_last; ++a)
+        {
+            delta_a[a - a_first] = c.block_means[k*c.width + a] - mu[a - a_first];
+        }
+        for (std::size_t b = b_first; b < b_last; ++b)
+        {
+            delta_b[b - b_first] = c.block_means[k*c.width + b] - nu[b - b_first];
+        }
+        for (std::size_t a = a_first; a < a_last; a += w)
+        {
+            const Real* panel_a = c.data.data() + (a/w)*c.n*w;
+            // In a tile on the diagonal, only the panels on and above it:
+            for (std::size_t b = (I == J ? a : b_first); b < b_last; b += w)
+            {
+                const Real* panel_b = c.data.data() + (b/w)*c.n*w;
+                panel_products(panel_a, panel_b, r_first, r_last, s);
+                for (std::size_t i = 0; i < w; ++i)
+                {
+                    for (std::size_t j = 0; j < w; ++j)
+                    {
+                        const std::size_t ai = a - a_first + i;
+                        const std::size_t bj = b - b_first + j;
+                        C[ai*B + bj] = C[ai*B + bj] + s[i][j] + delta_a[ai]*delta_b[bj]*weight;
+                    }
+                }
+            }
+        }
+        for (std::size_t a = a_first; a < a_last; ++a)
+        {
+            mu[a - a_first] = mu[a - a_first] + delta_a[a - a_first]*(n_b/n_ab);
+        }
+        for (std::size_t b = b_first; b < b_last; ++b)
+        {
+            nu[b - b_first] = nu[b - b_first] + delta_b[b - b_first]*(n_b/n_ab);
+        }
+        n_a = n_ab;
+    }
+
+    // The tile and its mirror image, leaving out the padding.  The products of a panel with itself are
+    // symmetric to the last bit, so either half of them may be mirrored.
+    const std::size_t p = c.p;
+    for (std::size_t a = a_first; a < (std::min)(a_last, p); ++a)
+    {
+        for (std::size_t b = (I == J ? a - a % w : b_first); b < (std::min)(b_last, p); ++b)
+        {
+            const Real value = C[(a - a_first)*B + (b - b_first)];
+            comoments[a*p + b] = value;
+            comoments[b*p + a] = value;
+        }
+    }
+}
+
+template<class Real>
+struct comoment_matrix_kernel
+{
+    const centered_panels<Real>& c;
+    Real* comoments;
+
+    void operator()(std::size_t t_first, std::size_t t_last) const
+    {
+        const std::size_t tiles = (c.width + covariance_block - 1)/covariance_block;
+        auto IJ = upper_pair(tiles, t_first, true);
+        for (std::size_t t = t_first; t < t_last; ++t, next_upper_pair(IJ, tiles, true))
+        {
+            comoment_tile(c, IJ.first, IJ.second, comoments);
+        }
+    }
+};
+
+template<class Real, class RandomAccessIterator>
+struct center_blocks_kernel
+{
+    const std::vector<RandomAccessIterator>& columns;
+    centered_panels<Real>& c;
+
+    void operator()(std::size_t k_first, std::size_t k_last) const
+    {
+        center_blocks(columns, c, k_first, k_last);
+    }
+};
+
+template<class Real, class Container>
+auto column_iterators(const Container& columns, centered_panels<Real>& c)
+{
+    std::vector<decltype(std::cbegin(*std::cbegin(columns)))> starts;
+    for (const auto& column : columns)
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(std::cbegin(column), std::cend(column)));
+        if (!starts.empty() && n != c.n)
+        {
+            throw std::domain_error("All the columns must be of the same length.");
+        }
+        c.n = n;
+        starts.push_back(std::cbegin(column));
+    }
+    c.p = starts.size();
+    c.width = (c.p + covariance_panel - 1)/covariance_panel*covariance_panel;
+    c.data.assign(c.width*c.n, Real(0));
+    c.block_means.assign(c.blocks()*c.width, Real(0));
+    return starts;
+}
+
+// The sum of the products of deviations of every pair of columns, as a p by p matrix, row by row:
+template<class Real>
+std::vector<Real> comoment_matrix_seq_impl(const centered_panels<Real>& c)
+{
+    std::vector<Real> comoments(c.p*c.p, Real(0));
+    const std::size_t tiles = (c.width + covariance_block - 1)/covariance_block;
+    comoment_matrix_kernel<Real>{c, comoments.data()}(0, tiles*(tiles + 1)/2);
+    return comoments;
+}
+
+template<class Real>
+std::vector<Real> covariances_from_comoments(std::vector<Real> comoments, std::size_t n)
+{
+    for (auto& x : comoments)
+    {
+        x /= static_cast<Real>(n);
+    }
+    return comoments;
+}
+
+// The correlations from the comoments, exactly 1 on the diagonal, and NaN for a constant column:
+template<class Real>
+std::vector<Real> correlations_from_comoments(std::vector<Real> C, std::size_t p)
+{
+    using std::sqrt;
+    using std::isfinite;
+    std::vector<Real> diagonal(p);
+    for (std::size_t i = 0; i < p; ++i)
+    {
+        diagonal[i] = C[i*p + i];
+    }
+    for (std::size_t i = 0; i < p; ++i)
+    {
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            Real denominator = sqrt(diagonal[i]*diagonal[j]);
+            if (!isfinite(denominator))
+            {
+                denominator = sqrt(diagonal[i])*sqrt(diagonal[j]);
+            }
+            Real r = C[i*p + j]/denominator;
+            if (r > 1)
+            {
+                r = 1;
+            }
+            else if (r < -1)
+            {
+                r = -1;
+            }
+            C[i*p + j] = r;
+        }
+    }
+    return C;
+}
+
+struct center_blocks_tag {};
+struct comoment_matrix_tag {};
+
+template<class Container>
+using covariance_matrix_container_real_t = covariance_matrix_real_t<batch_value_t<Container>>;
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Real, class ExecutionPolicy, class Container>
+std::vector<Real> comoment_matrix(ExecutionPolicy&& exec, const Container& columns, std::size_t& n)
+{
+    centered_panels<Real> c;
+    const auto starts = column_iterators(columns, c);
+    n = c.n;
+    for_each_chunk<center_blocks_tag, Real>(exec, c.blocks(), covariance_rows*c.p,
+                                            center_blocks_kernel<Real, typename decltype(starts)::value_type>{starts, c});
+    std::vector<Real> comoments(c.p*c.p, Real(0));
+    const std::size_t tiles = (c.width + covariance_block - 1)/covariance_block;
+    const std::size_t tile_width = (std::min)(c.width, covariance_block);
+    for_each_chunk<comoment_matrix_tag, Real>(exec, tiles*(tiles + 1)/2, tile_width*tile_width*c.n,
+                                              comoment_matrix_kernel<Real>{c, comoments.data()});
+    return comoments;
+}
+
+#else
+
+template<class Real, class Container>
+std::vector<Real> comoment_matrix(const Container& columns, std::size_t& n)
+{
+    centered_panels<Real> c;
+    const auto starts = column_iterators(columns, c);
+    n = c.n;
+    center_blocks(starts, c, 0, c.blocks());
+    return comoment_matrix_seq_impl(c);
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+} // namespace detail
+
+//
+// The p by p population covariance and correlation matrices of p columns of equal length, in a std::vector,
+// row by row.  Entry (i, j) of the covariance matrix is covariance(columns[i], columns[j]), up to rounding.
+//
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class ExecutionPolicy, class Container>
+auto covariance_matrix(ExecutionPolicy&& exec, const Container& columns)
+{
+    using Real = detail::covariance_matrix_container_real_t<Container>;
+    std::size_t n = 0;
+    auto comoments = detail::comoment_matrix<Real>(exec, columns, n);
+    return detail::covariances_from_comoments(std::move(comoments), n);
+}
+
+template<class ExecutionPolicy, class Container>
+auto correlation_matrix(ExecutionPolicy&& exec, const Container& columns)
+{
+    using Real = detail::covariance_matrix_container_real_t<Container>;
+    std::size_t n = 0;
+    auto comoments = detail::comoment_matrix<Real>(exec, columns, n);
+    const std::size_t p = static_cast<std::size_t>(std::distance(std::cbegin(columns), std::cend(columns)));
+    return detail::correlations_from_comoments(std::move(comoments), p);
+}
+
+template<class Container>
+inline auto covariance_matrix(const Container& columns)
+{
+    return covariance_matrix(std::execution::seq, columns);
+}
+
+template<class Container>
+inline auto correlation_matrix(const Container& columns)
+{
+    return correlation_matrix(std::execution::seq, columns);
+}
+
+#else // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Container>
+auto covariance_matrix(const Container& columns)
+{
+    using Real = detail::covariance_matrix_container_real_t<Container>;
+    std::size_t n = 0;
+    auto comoments = detail::comoment_matrix<Real>(columns, n);
+    return detail::covariances_from_comoments(std::move(comoments), n);
+}
+
+template<class Container>
+auto correlation_matrix(const Container& columns)
+{
+    using Real = detail::covariance_matrix_container_real_t<Container>;
+    std::size_t n = 0;
+    auto comoments = detail::comoment_matrix<Real>(columns, n);
+    const std::size_t p = static_cast<std::size_t>(std::distance(std::cbegin(columns), std::cend(columns)));
+    return detail::correlations_from_comoments(std::move(comoments), p);
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_COVARIANCE_MATRIX_HPP
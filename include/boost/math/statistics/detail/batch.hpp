@@ -0,0 +1,212 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_BATCH_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_BATCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// Applies a kernel to each of a batch of series, which may differ in length, keeping one Workspace
+// per thread so that the buffers are allocated once per thread rather than once per series.
+// kernel(workspace, first, last) returns the Result for the series [first, last).  Also the chunking
+// of other batches of independent items, such as the pairs of columns of a matrix or the values of a sample.
+//
+
+namespace boost { namespace math { namespace statistics { namespace detail {
+
+template<class Container>
+using batch_value_t = typename std::iterator_traits<decltype(std::cbegin(*std::cbegin(std::declval<const Container&>())))>::value_type;
+
+template<class Result, class Workspace, class Container, class Kernel>
+std::vector<Result> series_batch_seq_impl(const Container& series, std::size_t first, std::size_t last, Kernel& kernel)
+{
+    Workspace workspace;
+    std::vector<Result> results;
+    results.reserve(last - first);
+    auto it = std::next(std::cbegin(series), first);
+    for (std::size_t i = first; i < last; ++i, ++it)
+    {
+        results.push_back(kernel(workspace, std::cbegin(*it), std::cend(*it)));
+    }
+    return results;
+}
+
+#ifdef BOOST_MATH_HAS_THREADS
+
+// The series are split into chunks of about equal numbers of samples, each with its own workspace:
+template<class Tag, class Result, class Workspace, class Executor, class Container, class Kernel>
+std::vector<Result> series_batch_parallel_impl(Executor& ex, const Container& series, Kernel& kernel)
+{
+    const std::size_t count = static_cast<std::size_t>(std::distance(std::cbegin(series), std::cend(series)));
+    std::vector<std::size_t> offsets(count + 1, 0);
+    auto it = std::cbegin(series);
+    for (std::size_t i = 0; i < count; ++i, ++it)
+    {
+        offsets[i + 1] = offsets[i] + static_cast<std::size_t>(std::distance(std::cbegin(*it), std::cend(*it)));
+    }
+    const std::size_t samples = offsets.back();
+    auto& cost = cost_per_element<Tag, Result>();
+    const std::size_t chunks = (std::min)(chunk_count(ex, samples, cost), (std::max)(count, std::size_t(1)));
+    if (chunks <= 1)
+    {
+        return timed_sequential(cost, samples, [&]() { return series_batch_seq_impl<Result, Workspace>(series, 0, count, kernel); });
+    }
+
+    // The first series starting at or after each chunk boundary of the samples:
+    std::vector<std::size_t> boundaries(chunks + 1, count);
+    std::size_t s = 0;
+    for (std::size_t c = 0; c < chunks; ++c)
+    {
+        const std::size_t start = chunk_begin(samples, chunks, c);
+        while (s < count && offsets[s] < start)
+        {
+            ++s;
+        }
+        boundaries[c] = s;
+    }
+
+    auto parts = run_chunks(ex, cost, samples, chunks, std::vector<Result>(), [&](std::size_t c)
+    {
+        return series_batch_seq_impl<Result, Workspace>(series, boundaries[c], boundaries[c + 1], kernel);
+    });
+    std::vector<Result> results;
+    results.reserve(count);
+    for (auto& part : parts)
+    {
+        for (auto& r : part)
+        {
+            results.push_back(std::move(r));
+        }
+    }
+    return results;
+}
+
+#endif // BOOST_MATH_HAS_THREADS
+
+// Runs on the thread pool, or on the executor given in place of the policy, unless the policy is sequential:
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Tag, class Result, class Workspace, class ExecutionPolicy, class Container, class Kernel>
+std::vector<Result> series_batch(ExecutionPolicy&& exec, const Container& series, Kernel kernel)
+{
+#ifdef BOOST_MATH_HAS_THREADS
+    if constexpr (!std::is_same_v<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>, std::remove_cv_t<decltype(std::execution::seq)>>)
+    {
+        return series_batch_parallel_impl<Tag, Result, Workspace>(executor_of(exec), series, kernel);
+    }
+#endif
+    (void)exec;
+    const std::size_t count = static_cast<std::size_t>(std::distance(std::cbegin(series), std::cend(series)));
+    return series_batch_seq_impl<Result, Workspace>(series, 0, count, kernel);
+}
+
+// Runs kernel(first, last) on chunks of the items [0, items), each costing about work_per_item elements,
+// on the thread pool unless the policy is sequential.  The kernel must not depend on how the items are chunked.
+template<class Tag, class Real, class ExecutionPolicy, class Kernel>
+void for_each_chunk(ExecutionPolicy&& exec, std::size_t items, std::size_t work_per_item, Kernel kernel)
+{
+#ifdef BOOST_MATH_HAS_THREADS
+    if constexpr (!std::is_same_v<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>, std::remove_cv_t<decltype(std::execution::seq)>>)
+    {
+        auto& ex = executor_of(exec);
+        auto& cost = cost_per_element<Tag, Real>();
+        const std::size_t elements = items*(std::max)(work_per_item, std::size_t(1));
+        const std::size_t chunks = (std::min)(chunk_count(ex, elements, cost), items);
+        if (chunks <= 1)
+        {
+            timed_sequential(cost, elements, [&]() { kernel(std::size_t(0), items); return items; });
+            return;
+        }
+        run_chunks(ex, cost, elements, chunks, std::size_t(0), [&](std::size_t c)
+        {
+            const std::size_t first = chunk_begin(items, chunks, c);
+            const std::size_t last = chunk_begin(items, chunks, c + 1);
+            kernel(first, last);
+            return last - first;
+        });
+        return;
+    }
+#endif
+    (void)exec;
+    (void)work_per_item;
+    kernel(std::size_t(0), items);
+}
+
+// Returns kernel(chunk_first, chunk_last) for the chunks of the n elements from first, in order, on the
+// thread pool unless the policy is sequential; merged in order, the results do not depend on the chunks.
+template<class Tag, class Real, class ExecutionPolicy, class ForwardIterator, class Kernel>
+auto map_chunks(ExecutionPolicy&& exec, ForwardIterator first, std::size_t n, Kernel kernel) -> std::vector<decltype(kernel(first, first))>
+{
+    using Result = decltype(kernel(first, first));
+#ifdef BOOST_MATH_HAS_THREADS
+    if constexpr (!std::is_same_v<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>, std::remove_cv_t<decltype(std::execution::seq)>>)
+    {
+        auto& ex = executor_of(exec);
+        auto& cost = cost_per_element<Tag, Real>();
+        const std::size_t chunks = chunk_count(ex, n, cost);
+        if (chunks <= 1)
+        {
+            return std::vector<Result>(1, timed_sequential(cost, n, [&]() { return kernel(first, std::next(first, n)); }));
+        }
+        const auto boundaries = chunk_iterators(first, n, chunks);
+        return run_chunks(ex, cost, n, chunks, Result(), [&](std::size_t c) { return kernel(boundaries[c], boundaries[c + 1]); });
+    }
+#endif
+    (void)exec;
+    return std::vector<Result>(1, kernel(first, std::next(first, n)));
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Result, class Workspace, class Container, class Kernel>
+std::vector<Result> series_batch(const Container& series, Kernel kernel)
+{
+    const std::size_t count = static_cast<std::size_t>(std::distance(std::cbegin(series), std::cend(series)));
+    return series_batch_seq_impl<Result, Workspace>(series, 0, count, kernel);
+}
+
+// The t-th pair (i, j) of the upper triangle of an m by m matrix, row by row, with or without the diagonal:
+inline std::pair<std::size_t, std::size_t> upper_pair(std::size_t m, std::size_t t, bool diagonal)
+{
+    std::size_t i = 0;
+    for (;;)
+    {
+        const std::size_t row = m - i - (diagonal ? 0 : 1);
+        if (t < row)
+        {
+            return std::make_pair(i, i + (diagonal ? 0 : 1) + t);
+        }
+        t -= row;
+        ++i;
+    }
+}
+
+inline void next_upper_pair(std::pair<std::size_t, std::size_t>& ij, std::size_t m, bool diagonal)
+{
+    if (++ij.second == m)
+    {
+        ++ij.first;
+        ij.second = ij.first + (diagonal ? 0 : 1);
+    }
+}
+
+}}}} // namespace boost::math::statistics::detail
+
+#endif // BOOST_MATH_STATISTICS_DETAIL_BATCH_HPP
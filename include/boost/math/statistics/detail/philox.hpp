@@ -0,0 +1,152 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_DETAIL_PHILOX_HPP
+#define BOOST_MATH_STATISTICS_DETAIL_PHILOX_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+//
+// The counter based generator Philox4x32-10 of Salmon, Moraes, Dror and Shaw, "Parallel random numbers:
+// as easy as 1, 2, 3", SC11.  Each block of four words is a keyed bijection of a 128 bit counter, so the
+// stream numbered s of a seed is reached in constant time, with no state shared between streams.  The
+// parallel algorithms give each of their work items its own stream, which makes their results depend on
+// the seed alone, and not on the number of threads or on the order in which the items were run.
+//
+
+namespace boost { namespace math { namespace statistics { namespace detail {
+
+class philox4x32
+{
+public:
+    using result_type = std::uint32_t;
+    using block_type = std::array<std::uint32_t, 4>;
+    using key_type = std::array<std::uint32_t, 2>;
+
+    philox4x32(std::uint64_t seed, std::uint64_t stream) noexcept
+        : m_key{{low(seed), high(seed)}}, m_stream(stream)
+    {}
+
+    static constexpr result_type (min)() noexcept { return 0; }
+    static constexpr result_type (max)() noexcept { return (std::numeric_limits<result_type>::max)(); }
+
+    result_type operator()() noexcept
+    {
+        if (m_used == m_buffer.size())
+        {
+            refill();
+        }
+        return m_buffer[m_used++];
+    }
+
+    // The block for a counter: ten rounds, each of two 32 by 32 bit products, with a key schedule.
+    static block_type block(const block_type& counter, const key_type& key) noexcept
+    {
+        block_type c = counter;
+        std::uint32_t k0 = key[0];
+        std::uint32_t k1 = key[1];
+        for (int round = 0; round < 10; ++round)
+        {
+            philox_round(c[0], c[1], c[2], c[3], k0, k1);
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        return c;
+    }
+
+private:
+    static constexpr std::size_t lanes = 4;
+
+    static std::uint32_t low(std::uint64_t x) noexcept { return static_cast<std::uint32_t>(x); }
+    static std::uint32_t high(std::uint64_t x) noexcept { return static_cast<std::uint32_t>(x >> 32); }
+
+    static void philox_round(std::uint32_t& c0, std::uint32_t& c1, std::uint32_t& c2, std::uint32_t& c3, std::uint32_t k0, std::uint32_t k1) noexcept
+    {
+        const std::uint64_t p0 = std::uint64_t(0xD2511F53u)*c0;
+        const std::uint64_t p1 = std::uint64_t(0xCD9E8D57u)*c2;
+        c0 = high(p1) ^ c1 ^ k0;
+        c1 = low(p1);
+        c2 = high(p0) ^ c3 ^ k1;
+        c3 = low(p0);
+    }
+
+    // The next blocks of the stream, computed side by side: the rounds of one block are a chain of
+    // multiplications, so a single block waits on their latency rather than their throughput.
+    void refill() noexcept
+    {
+        std::uint32_t c[4][lanes];
+        for (std::size_t l = 0; l < lanes; ++l)
+        {
+            c[0][l] = low(m_position + l);
+            c[1][l] = high(m_position + l);
+            c[2][l] = low(m_stream);
+            c[3][l] = high(m_stream);
+        }
+        std::uint32_t k0 = m_key[0];
+        std::uint32_t k1 = m_key[1];
+        for (int round = 0; round < 10; ++round)
+        {
+            for (std::size_t l = 0; l < lanes; ++l)
+            {
+                philox_round(c[0][l], c[1][l], c[2][l], c[3][l], k0, k1);
+            }
+            k0 += 0x9E3779B9u;
+            k1 += 0xBB67AE85u;
+        }
+        for (std::size_t l = 0; l < lanes; ++l)
+        {
+            for (std::size_t w = 0; w < 4; ++w)
+            {
+                m_buffer[4*l + w] = c[w][l];
+            }
+        }
+        m_position += lanes;
+        m_used = 0;
+    }
+
+    key_type m_key;
+    std::uint64_t m_stream;
+    std::uint64_t m_position = 0;
+    std::array<std::uint32_t, 4*lanes> m_buffer {};
+    std::size_t m_used = 4*lanes;
+};
+
+// A uniform integer in [0, n), n > 0, without bias: Lemire, "Fast random integer generation in an interval", 2019.
+template<class Engine>
+std::size_t uniform_index(Engine& gen, std::size_t n) noexcept
+{
+    if (static_cast<std::uint64_t>(n) <= 0xFFFFFFFFu)
+    {
+        const std::uint32_t m = static_cast<std::uint32_t>(n);
+        std::uint64_t product = std::uint64_t(gen())*m;
+        if (static_cast<std::uint32_t>(product) < m)
+        {
+            const std::uint32_t threshold = static_cast<std::uint32_t>(0u - m) % m;
+            while (static_cast<std::uint32_t>(product) < threshold)
+            {
+                product = std::uint64_t(gen())*m;
+            }
+        }
+        return static_cast<std::size_t>(product >> 32);
+    }
+    // Only reached where std::size_t has more than 32 bits; 2^64 mod n values are rejected:
+    const std::uint64_t m = static_cast<std::uint64_t>(n);
+    const std::uint64_t threshold = (0u - m) % m;
+    for (;;)
+    {
+        const std::uint64_t x = (std::uint64_t(gen()) << 32) | gen();
+        if (x >= threshold)
+        {
+            return static_cast<std::size_t>(x % m);
+        }
+    }
+}
+
+}}}} // namespace boost::math::statistics::detail
+
+#endif // BOOST_MATH_STATISTICS_DETAIL_PHILOX_HPP
@@ -29,6 +29,34 @@ struct pair_equal
     }
 };
 
+// The rank from 0 of every value, unlike rank() which returns those of the distinct values:
+// equal values share a rank, and the distinct values have consecutive ranks.
+template <typename ForwardIterator, typename T = typename std::iterator_traits<ForwardIterator>::value_type>
+std::vector<std::size_t> dense_rank(ForwardIterator first, ForwardIterator last)
+{
+    std::vector<std::pair<T, std::size_t>> sorted;
+    std::size_t i = 0;
+    for (; first != last; ++first, ++i)
+    {
+        sorted.emplace_back(*first, i);
+    }
+
+    std::sort(sorted.begin(), sorted.end());
+
+    std::vector<std::size_t> result(sorted.size());
+    std::size_t rank = 0;
+    for (i = 0; i < sorted.size(); ++i)
+    {
+        if (i > 0 && sorted[i].first != sorted[i - 1].first)
+        {
+            ++rank;
+        }
+        result[sorted[i].second] = rank;
+    }
+
+    return result;
+}
+
 }}}} // Namespaces
 
 #ifndef BOOST_MATH_EXEC_COMPATIBLE
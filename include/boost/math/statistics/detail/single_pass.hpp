@@ -18,10 +18,12 @@
 #include <stdexcept>
 #include <functional>
 #include <vector>
+#include <utility>
 
 #ifdef BOOST_MATH_HAS_THREADS
 #include <future>
 #include <thread>
+#include <boost/math/statistics/thread_pool.hpp>
 #endif
 
 namespace boost { namespace math { namespace statistics { namespace detail {
@@ -86,6 +88,19 @@ ReturnType variance_sequential_impl(ForwardIterator first, ForwardIterator last)
     return std::make_tuple(M, M2, Q/(k-1), Real(n));
 }
 
+// Adds x to the mean and the central moment sums M2, M3, M4 of a sample, where n is its size including x.
+// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Higher-order_statistics
+template<typename Real, typename Size>
+void update_first_four_moments(Real& M1, Real& M2, Real& M3, Real& M4, const Size n, const Real x)
+{
+    Real delta21 = x - M1;
+    Real tmp = delta21/n;
+    M4 = M4 + tmp*(tmp*tmp*delta21*((n-1)*(n*n-3*n+3)) + 6*tmp*M2 - 4*M3);
+    M3 = M3 + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
+    M2 = M2 + tmp*(n-1)*delta21;
+    M1 = M1 + tmp;
+}
+
 // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Higher-order_statistics
 template<typename ReturnType, typename ForwardIterator>
 ReturnType first_four_moments_sequential_impl(ForwardIterator first, ForwardIterator last)
@@ -100,101 +115,103 @@ ReturnType first_four_moments_sequential_impl(ForwardIterator first, ForwardIter
     Size n = 2;
     for (auto it = std::next(first); it != last; ++it)
     {
-        Real delta21 = *it - M1;
-        Real tmp = delta21/n;
-        M4 = M4 + tmp*(tmp*tmp*delta21*((n-1)*(n*n-3*n+3)) + 6*tmp*M2 - 4*M3);
-        M3 = M3 + tmp*((n-1)*(n-2)*delta21*tmp - 3*M2);
-        M2 = M2 + tmp*(n-1)*delta21;
-        M1 = M1 + tmp;
+        update_first_four_moments(M1, M2, M3, M4, n, Real(*it));
         n += 1;
     }
 
     return std::make_tuple(M1, M2, M3, M4, n-1);
 }
 
-#ifdef BOOST_MATH_HAS_THREADS
-
+// Combines the mean and the central moment sums M2, M3, M4 of two disjoint samples of sizes n_a and n_b
+// into those of their union, in place in the first.
 // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Higher-order_statistics
 // EQN 3.1: https://www.osti.gov/servlets/purl/1426900
-template<typename ReturnType, typename ForwardIterator>
-ReturnType first_four_moments_parallel_impl(ForwardIterator first, ForwardIterator last)
+template<typename Real>
+void merge_first_four_moments(Real& M1_a, Real& M2_a, Real& M3_a, Real& M4_a, Real& range_a,
+                              const Real M1_b, const Real M2_b, const Real M3_b, const Real M4_b, const Real range_b)
 {
-    using Real = typename std::tuple_element<0, ReturnType>::type;
+    if(range_b == 0)
+    {
+        return;
+    }
 
-    const auto elements = std::distance(first, last);
-    const unsigned max_concurrency = std::thread::hardware_concurrency() == 0 ? 2u : std::thread::hardware_concurrency();
-    unsigned num_threads = 2u;
-    
-    // Threading is faster for: 10 + 5.13e-3 N/j <= 5.13e-3N => N >= 10^4j/5.13(j-1).
-    const auto parallel_lower_bound = 10e4*max_concurrency/(5.13*(max_concurrency-1));
-    const auto parallel_upper_bound = 10e4*2/5.13; // j = 2
+    const Real n_ab = range_a + range_b;
+    const Real delta = M1_b - M1_a;
+
+    M1_a = (range_a * M1_a + range_b * M1_b) / n_ab;
+    M4_a = M4_a + M4_b + (delta * delta * delta * delta) * range_a * range_b * (range_a * range_a - range_a * range_b + range_b * range_b) / (n_ab * n_ab * n_ab)
+           + Real(6) * delta * delta * (range_a * range_a * M2_b + range_b * range_b * M2_a) / (n_ab * n_ab)
+           + Real(4) * delta * (range_a * M3_b - range_b * M3_a) / n_ab;
+    M3_a = M3_a + M3_b + (delta * delta * delta) * range_a * range_b * (range_a - range_b) / (n_ab * n_ab)
+           + Real(3) * delta * (range_a * M2_b - range_b * M2_a) / n_ab;
+    M2_a = M2_a + M2_b + delta * delta * (range_a * range_b / n_ab);
+    range_a = n_ab;
+}
 
-    // https://lemire.me/blog/2020/01/30/cost-of-a-thread-in-c-under-linux/
-    if(elements < parallel_lower_bound)
+#ifdef BOOST_MATH_HAS_THREADS
+
+struct mean_tag {};
+
+// The means of the chunks, weighted by their sizes:
+template<typename ReturnType, typename Executor, typename ForwardIterator>
+ReturnType mean_parallel_impl(Executor& ex, ForwardIterator first, ForwardIterator last)
+{
+    const std::size_t elements = static_cast<std::size_t>(std::distance(first, last));
+    running_estimate& cost = cost_per_element<mean_tag, ReturnType>();
+    const std::size_t chunks = chunk_count(ex, elements, cost);
+    if(chunks == 1)
     {
-        return detail::first_four_moments_sequential_impl<ReturnType>(first, last);
+        return timed_sequential(cost, elements, [first, last]() { return mean_sequential_impl<ReturnType>(first, last); });
     }
-    else if(elements >= parallel_upper_bound)
+
+    const auto boundaries = chunk_iterators(first, elements, chunks);
+    const auto results = run_chunks(ex, cost, elements, chunks, ReturnType(0), [&boundaries](std::size_t i)
     {
-        num_threads = max_concurrency;
-    }
-    else
+        return mean_sequential_impl<ReturnType>(boundaries[i], boundaries[i + 1]);
+    });
+
+    ReturnType mu = results[0];
+    ReturnType n = static_cast<ReturnType>(chunk_begin(elements, chunks, 1));
+    for(std::size_t i = 1; i < results.size(); ++i)
     {
-        for(unsigned i = 3; i < max_concurrency; ++i)
-        {
-            if(parallel_lower_bound < 10e4*i/(5.13*(i-1)))
-            {
-                num_threads = i;
-                break;
-            }
-        }
+        const ReturnType n_b = static_cast<ReturnType>(chunk_begin(elements, chunks, i + 1) - chunk_begin(elements, chunks, i));
+        n += n_b;
+        mu += (results[i] - mu) * (n_b / n);
     }
+    return mu;
+}
 
-    std::vector<std::future<ReturnType>> future_manager;
-    const auto elements_per_thread = std::ceil(static_cast<double>(elements) / num_threads);
+struct first_four_moments_tag {};
 
-    auto it = first;
-    for(std::size_t i {}; i < num_threads - 1; ++i)
+template<typename ReturnType, typename Executor, typename ForwardIterator>
+ReturnType first_four_moments_parallel_impl(Executor& ex, ForwardIterator first, ForwardIterator last)
+{
+    using Real = typename std::tuple_element<0, ReturnType>::type;
+
+    const auto elements = std::distance(first, last);
+    running_estimate& cost = cost_per_element<first_four_moments_tag, Real>();
+    const std::size_t chunks = chunk_count(ex, static_cast<std::size_t>(elements), cost);
+    if(chunks == 1)
     {
-        future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, elements_per_thread]() -> ReturnType
-        {
-            return first_four_moments_sequential_impl<ReturnType>(it, std::next(it, elements_per_thread));
-        }));
-        it = std::next(it, elements_per_thread);
+        return timed_sequential(cost, static_cast<std::size_t>(elements), [first, last]() { return first_four_moments_sequential_impl<ReturnType>(first, last); });
     }
 
-    future_manager.emplace_back(std::async(std::launch::async | std::launch::deferred, [it, last]() -> ReturnType
+    const auto boundaries = chunk_iterators(first, static_cast<std::size_t>(elements), chunks);
+    const auto results = run_chunks(ex, cost, static_cast<std::size_t>(elements), chunks, ReturnType(), [&boundaries](std::size_t i)
     {
-        return first_four_moments_sequential_impl<ReturnType>(it, last);
-    }));
+        return first_four_moments_sequential_impl<ReturnType>(boundaries[i], boundaries[i + 1]);
+    });
 
-    auto temp = future_manager[0].get();
-    Real M1_a = std::get<0>(temp);
-    Real M2_a = std::get<1>(temp);
-    Real M3_a = std::get<2>(temp);
-    Real M4_a = std::get<3>(temp);
-    Real range_a = std::get<4>(temp);
+    Real M1_a = std::get<0>(results[0]);
+    Real M2_a = std::get<1>(results[0]);
+    Real M3_a = std::get<2>(results[0]);
+    Real M4_a = std::get<3>(results[0]);
+    Real range_a = std::get<4>(results[0]);
 
-    for(std::size_t i = 1; i < future_manager.size(); ++i)
+    for(std::size_t i = 1; i < results.size(); ++i)
     {
-        temp = future_manager[i].get();
-        Real M1_b = std::get<0>(temp);
-        Real M2_b = std::get<1>(temp);
-        Real M3_b = std::get<2>(temp);
-        Real M4_b = std::get<3>(temp);
-        Real range_b = std::get<4>(temp);
-
-        const Real n_ab = range_a + range_b;
-        const Real delta = M1_b - M1_a;
-        
-        M1_a = (range_a * M1_a + range_b * M1_b) / n_ab;
-        M2_a = M2_a + M2_b + delta * delta * (range_a * range_b / n_ab);
-        M3_a = M3_a + M3_b + (delta * delta * delta) * range_a * range_b * (range_a - range_b) / (n_ab * n_ab)    
-               + Real(3) * delta * (range_a * M2_b - range_b * M2_a) / n_ab;
-        M4_a = M4_a + M4_b + (delta * delta * delta * delta) * range_a * range_b * (range_a * range_a - range_a * range_b + range_b * range_b) / (n_ab * n_ab * n_ab)
-               + Real(6) * delta * delta * (range_a * range_a * M2_b + range_b * range_b * M2_a) / (n_ab * n_ab) 
-               + Real(4) * delta * (range_a * M3_b - range_b * M3_a) / n_ab;
-        range_a = n_ab;
+        merge_first_four_moments(M1_a, M2_a, M3_a, M4_a, range_a,
+                                 std::get<0>(results[i]), std::get<1>(results[i]), std::get<2>(results[i]), std::get<3>(results[i]), std::get<4>(results[i]));
     }
 
     return std::make_tuple(M1_a, M2_a, M3_a, M4_a, elements);
@@ -396,6 +413,313 @@ OutputIterator mode_impl(ForwardIterator first, ForwardIterator last, OutputIter
 
     return std::move(modes.begin(), modes.end(), output);
 }
+
+// The weighted statistics take the weights from a second container of the same size.  The weights need
+// not sum to one; a weight of zero drops its value, and integer weights give the statistics of the data
+// with each value repeated as many times as its weight.
+template<typename Container>
+using weighted_real_t = typename std::conditional<std::is_integral<typename Container::value_type>::value, double, typename Container::value_type>::type;
+
+template<typename Container, typename WeightContainer>
+std::size_t weighted_size(const Container& v, const WeightContainer& weights)
+{
+    const std::size_t n = static_cast<std::size_t>(std::distance(std::begin(v), std::end(v)));
+    if(n != static_cast<std::size_t>(std::distance(std::begin(weights), std::end(weights))))
+    {
+        throw std::domain_error("The data and the weights must have the same size.");
+    }
+    return n;
+}
+
+template<typename Real>
+Real weighted_value(Real w)
+{
+    if(w < 0)
+    {
+        throw std::domain_error("The weights must be non-negative.");
+    }
+    return w;
+}
+
+template<typename Real>
+void check_weight_sum(Real sum)
+{
+    if(!(sum > 0))
+    {
+        throw std::domain_error("The sum of the weights must be positive.");
+    }
+}
+
+// The weighted mean and the sum of the weights, each value moving the mean by its share of the weight so far:
+template<typename Real, typename ForwardIterator, typename WeightIterator>
+std::pair<Real, Real> weighted_mean_sequential_impl(ForwardIterator first, ForwardIterator last, WeightIterator weights)
+{
+    Real mu = 0;
+    Real sum = 0;
+    for(; first != last; ++first, ++weights)
+    {
+        const Real w = weighted_value(static_cast<Real>(*weights));
+        if(w > 0)
+        {
+            sum += w;
+            mu += (static_cast<Real>(*first) - mu) * (w / sum);
+        }
+    }
+    return std::make_pair(mu, sum);
+}
+
+template<typename Real>
+void merge_weighted_means(std::pair<Real, Real>& a, const std::pair<Real, Real>& b)
+{
+    if(b.second > 0)
+    {
+        a.second += b.second;
+        a.first += (b.first - a.first) * (b.second / a.second);
+    }
+}
+
+// The weighted mean, the central moment sums M2, M3, M4 and the sum of the weights.  Each value is merged
+// in as a sample of its own, whose size is its weight, by merge_first_four_moments with the moments of the
+// value set to zero; written in terms of the shares r and s of the new and old weights, constant data leaves
+// the sums exactly zero.
+template<typename Real, typename ForwardIterator, typename WeightIterator>
+std::tuple<Real, Real, Real, Real, Real> weighted_first_four_moments_sequential_impl(ForwardIterator first, ForwardIterator last, WeightIterator weights)
+{
+    Real M1 = 0;
+    Real M2 = 0;
+    Real M3 = 0;
+    Real M4 = 0;
+    Real sum = 0;
+    for(; first != last; ++first, ++weights)
+    {
+        const Real w = weighted_value(static_cast<Real>(*weights));
+        if(w > 0)
+        {
+            const Real n = sum + w;
+            const Real delta = static_cast<Real>(*first) - M1;
+            const Real r = w / n;
+            const Real s = sum / n;
+            const Real t = delta * r;
+            const Real delta2_sum = delta * delta * sum;
+            M4 += delta2_sum * delta * delta * r * (s * s - s * r + r * r) + 6 * t * t * M2 - 4 * t * M3;
+            M3 += delta2_sum * delta * r * (s - r) - 3 * t * M2;
+            M2 += delta2_sum * r;
+            M1 += t;
+            sum = n;
+        }
+    }
+    return std::make_tuple(M1, M2, M3, M4, sum);
+}
+
+template<typename Real>
+void merge_weighted_moments(std::tuple<Real, Real, Real, Real, Real>& a, const std::tuple<Real, Real, Real, Real, Real>& b)
+{
+    merge_first_four_moments(std::get<0>(a), std::get<1>(a), std::get<2>(a), std::get<3>(a), std::get<4>(a),
+                             std::get<0>(b), std::get<1>(b), std::get<2>(b), std::get<3>(b), std::get<4>(b));
+}
+
+// Merges the results of neighbouring chunks in pairs, then those in pairs, and so on, so that the rounding
+// errors of the merges grow with the logarithm of the number of chunks rather than with the number:
+template<typename Result, typename Merge>
+Result merge_pairwise(std::vector<Result> results, Merge merge)
+{
+    for(std::size_t stride = 1; stride < results.size(); stride *= 2)
+    {
+        for(std::size_t i = 0; i + stride < results.size(); i += 2 * stride)
+        {
+            merge(results[i], results[i + stride]);
+        }
+    }
+    return results[0];
+}
+
+#ifdef BOOST_MATH_HAS_THREADS
+
+struct weighted_mean_tag {};
+
+template<typename Real, typename Executor, typename ForwardIterator, typename WeightIterator>
+std::pair<Real, Real> weighted_mean_parallel_impl(Executor& ex, ForwardIterator first, std::size_t elements, WeightIterator weights)
+{
+    running_estimate& cost = cost_per_element<weighted_mean_tag, Real>();
+    const std::size_t chunks = chunk_count(ex, elements, cost);
+    if(chunks == 1)
+    {
+        return timed_sequential(cost, elements, [&]() { return weighted_mean_sequential_impl<Real>(first, std::next(first, elements), weights); });
+    }
+
+    const auto boundaries = chunk_iterators(first, elements, chunks);
+    const auto weight_boundaries = chunk_iterators(weights, elements, chunks);
+    const auto results = run_chunks(ex, cost, elements, chunks, std::pair<Real, Real>(), [&](std::size_t i)
+    {
+        return weighted_mean_sequential_impl<Real>(boundaries[i], boundaries[i + 1], weight_boundaries[i]);
+    });
+    return merge_pairwise(results, merge_weighted_means<Real>);
+}
+
+struct weighted_first_four_moments_tag {};
+
+template<typename Real, typename Executor, typename ForwardIterator, typename WeightIterator>
+std::tuple<Real, Real, Real, Real, Real> weighted_first_four_moments_parallel_impl(Executor& ex, ForwardIterator first, std::size_t elements, WeightIterator weights)
+{
+    running_estimate& cost = cost_per_element<weighted_first_four_moments_tag, Real>();
+    const std::size_t chunks = chunk_count(ex, elements, cost);
+    if(chunks == 1)
+    {
+        return timed_sequential(cost, elements, [&]() { return weighted_first_four_moments_sequential_impl<Real>(first, std::next(first, elements), weights); });
+    }
+
+    const auto boundaries = chunk_iterators(first, elements, chunks);
+    const auto weight_boundaries = chunk_iterators(weights, elements, chunks);
+    const auto results = run_chunks(ex, cost, elements, chunks, std::tuple<Real, Real, Real, Real, Real>(), [&](std::size_t i)
+    {
+        return weighted_first_four_moments_sequential_impl<Real>(boundaries[i], boundaries[i + 1], weight_boundaries[i]);
+    });
+    return merge_pairwise(results, merge_weighted_moments<Real>);
+}
+
+#endif // BOOST_MATH_HAS_THREADS
+
+// The (value, weight) pairs of positive weight, which the selection and the sort may reorder:
+template<typename Real, typename Container, typename WeightContainer>
+std::vector<std::pair<Real, Real>> weighted_pairs(const Container& v, const WeightContainer& weights)
+{
+    std::vector<std::pair<Real, Real>> pairs;
+    pairs.reserve(weighted_size(v, weights));
+    auto w = std::begin(weights);
+    for(auto it = std::begin(v); it != std::end(v); ++it, ++w)
+    {
+        const Real weight = weighted_value(static_cast<Real>(*w));
+        if(weight > 0)
+        {
+            pairs.emplace_back(static_cast<Real>(*it), weight);
+        }
+    }
+    return pairs;
+}
+
+template<typename Real>
+Real weight_sum(typename std::vector<std::pair<Real, Real>>::const_iterator first, typename std::vector<std::pair<Real, Real>>::const_iterator last)
+{
+    Real sum = 0;
+    for(; first != last; ++first)
+    {
+        sum += first->second;
+    }
+    return sum;
+}
+
+// The least value x whose weight, with that of the lesser values, is at least target: the inverse of the
+// weighted distribution function.  When that weight is exactly target, the distribution is flat up to the
+// next greater value, which is the second of the result; otherwise the second is x again.  Like
+// nth_element, this partitions around pivots and keeps only the part holding x, but it compares target
+// with the weights of the parts rather than with their sizes, so there is no need to sort.
+template<typename Real>
+std::pair<Real, Real> weighted_select(std::vector<std::pair<Real, Real>>& pairs, Real target)
+{
+    using std::log2;
+    auto first = pairs.begin();
+    auto last = pairs.end();
+    // The least value known to be greater than those left, which is the next value of the greatest of them:
+    bool has_next = false;
+    Real next = 0;
+    // As in introselect, a run of poor pivots ends with a sort rather than in quadratic time:
+    int depth = 2 * static_cast<int>(log2(static_cast<double>(pairs.size()) + 1));
+    while(last - first > 16 && depth-- > 0)
+    {
+        const Real a = first->first;
+        const Real b = first[(last - first) / 2].first;
+        const Real c = (last - 1)->first;
+        const Real pivot = (std::max)((std::min)(a, b), (std::min)((std::max)(a, b), c));
+        const auto lower = std::partition(first, last, [pivot](const std::pair<Real, Real>& p) { return p.first < pivot; });
+        const auto upper = std::partition(lower, last, [pivot](const std::pair<Real, Real>& p) { return !(pivot < p.first); });
+        const Real below = weight_sum<Real>(first, lower);
+        const Real through = below + weight_sum<Real>(lower, upper);
+        if(lower != first && target <= below)
+        {
+            last = lower;
+            has_next = true;
+            next = pivot;
+        }
+        else if(target <= through)
+        {
+            if(target == through && upper != last)
+            {
+                return std::make_pair(pivot, std::min_element(upper, last)->first);
+            }
+            return std::make_pair(pivot, target == through && has_next ? next : pivot);
+        }
+        else
+        {
+            target -= through;
+            first = upper;
+        }
+    }
+
+    std::sort(first, last);
+    Real cumulative = 0;
+    for(auto it = first; it != last; ++it)
+    {
+        cumulative += it->second;
+        if(target <= cumulative)
+        {
+            if(target == cumulative && it + 1 != last)
+            {
+                return std::make_pair(it->first, (it + 1)->first);
+            }
+            return std::make_pair(it->first, target == cumulative && has_next ? next : it->first);
+        }
+    }
+    // Rounding left a target of the whole weight just above the sum of the weights:
+    return std::make_pair((last - 1)->first, (last - 1)->first);
+}
+
+// The quantile at p: the inverse of the weighted distribution function, averaged where it is flat, so that
+// with equal weights the median is the usual one.
+template<typename Real>
+Real weighted_quantile_impl(std::vector<std::pair<Real, Real>>& pairs, Real p)
+{
+    if(!(p >= 0 && p <= 1))
+    {
+        throw std::domain_error("The quantile must be in [0, 1].");
+    }
+    const Real sum = weight_sum<Real>(pairs.cbegin(), pairs.cend());
+    check_weight_sum(sum);
+    const auto x = weighted_select(pairs, p * sum);
+    return x.first == x.second ? x.first : (x.first + x.second) / 2;
+}
+
+// The mean absolute difference of the pairs of values, each pair weighted by the product of their weights,
+// over twice the mean; the values must be sorted.  Each run of equal values is greater than the values of all
+// the weight before it and less than those after it, which gives the sum over the pairs in one pass.
+template<typename Real>
+Real weighted_gini_coefficient_impl(const std::vector<std::pair<Real, Real>>& pairs)
+{
+    const Real sum = weight_sum<Real>(pairs.cbegin(), pairs.cend());
+    check_weight_sum(sum);
+    Real before = 0;
+    Real num = 0;
+    Real denom = 0;
+    for(auto it = pairs.cbegin(); it != pairs.cend();)
+    {
+        const Real x = it->first;
+        Real run = 0;
+        for(; it != pairs.cend() && it->first == x; ++it)
+        {
+            run += it->second;
+        }
+        num += run * x * (before - (sum - before - run));
+        denom += run * x;
+        before += run;
+    }
+
+    // If the weighted l1 norm is zero, all values are zero, so every value is the same.
+    if(denom == 0)
+    {
+        return Real(0);
+    }
+    return num / (sum * denom);
+}
+
 }}}}
 
 #endif // BOOST_MATH_STATISTICS_UNIVARIATE_STATISTICS_DETAIL_SINGLE_PASS_HPP
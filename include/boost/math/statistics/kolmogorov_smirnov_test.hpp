@@ -0,0 +1,223 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_KOLMOGOROV_SMIRNOV_TEST_HPP
+#define BOOST_MATH_STATISTICS_KOLMOGOROV_SMIRNOV_TEST_HPP
+
+// References:
+// J. L. Hodges, The significance probability of the Smirnov two-sample test, Arkiv för Matematik 3 (1958), 469-486.
+// J. Durbin, Distribution Theory for Tests Based on the Sample Distribution Function, SIAM (1973), section 2.4.
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/math/distributions/kolmogorov_smirnov.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+namespace boost { namespace math { namespace statistics { namespace detail {
+
+// One merge pass over two sorted samples of sizes n and m.  After each distinct value, i and j
+// observations of the two samples lie at or below it, and the empirical cdfs differ by
+// |i/n - j/m| = |i m - j n|/(n m); the largest numerator is returned, so that the statistic is
+// exact and can be compared with the lattice below without rounding.
+template<typename ForwardIterator1, typename ForwardIterator2>
+std::uintmax_t ks_two_sample_merge(ForwardIterator1 first1, ForwardIterator1 last1, std::uintmax_t n,
+                                   ForwardIterator2 first2, ForwardIterator2 last2, std::uintmax_t m)
+{
+    using Real = typename std::iterator_traits<ForwardIterator1>::value_type;
+    std::uintmax_t i = 0;
+    std::uintmax_t j = 0;
+    std::uintmax_t c = 0;
+    bool started = false;
+    Real last_z {};
+    while (first1 != last1 && first2 != last2)
+    {
+        const Real z = (*first2 < *first1) ? static_cast<Real>(*first2) : static_cast<Real>(*first1);
+        // Fails for a decrease in either sample, and for NaN:
+        if (!(z == z) || (started && !(z > last_z)))
+        {
+            throw std::domain_error("Both samples must be sorted in increasing order, and contain no NaNs.");
+        }
+        while (first1 != last1 && *first1 == z)
+        {
+            ++first1;
+            ++i;
+        }
+        while (first2 != last2 && *first2 == z)
+        {
+            ++first2;
+            ++j;
+        }
+        const std::uintmax_t d = (i * m > j * n) ? i * m - j * n : j * n - i * m;
+        c = (std::max)(c, d);
+        started = true;
+        last_z = z;
+    }
+    // Once one sample is exhausted the difference only shrinks, but the rest of the other must still be sorted:
+    auto check_tail = [&](auto first, auto last)
+    {
+        for (; first != last; ++first)
+        {
+            if (!(*first >= last_z))
+            {
+                throw std::domain_error("Both samples must be sorted in increasing order, and contain no NaNs.");
+            }
+            last_z = *first;
+        }
+    };
+    check_tail(first1, last1);
+    check_tail(first2, last2);
+    return c;
+}
+
+// P(D >= c/(n m)) for two samples of sizes n and m from the same continuous distribution.
+// Under the null hypothesis every ordering of the pooled sample is equally likely, so the merge
+// is a random monotone lattice path from (0, 0) to (n, m), and the statistic reaches c/(n m) iff the
+// path touches a point with |i m - j n| >= c.  w(i, j) is the fraction of the C(i+j, i) paths to (i, j)
+// which have touched such a point: 1 on the boundary and beyond, and inside
+//
+//   w(i, j) = i/(i+j) w(i-1, j) + j/(i+j) w(i, j-1)
+//
+// since i/(i+j) of the paths to (i, j) arrive from (i-1, j).  The weights stay in [0, 1], and the
+// p-value is a sum of positive terms, so is accurate even when it is tiny.  Only the band of
+// points inside the boundary is updated, which has width about 2c/n per row.
+template<typename Real>
+Real ks_two_sample_exact_sf(std::uintmax_t n, std::uintmax_t m, std::uintmax_t c)
+{
+    if (c == 0)
+    {
+        return 1;
+    }
+    // Keep one row of the smaller dimension:
+    if (m > n)
+    {
+        std::swap(n, m);
+    }
+    std::vector<Real> w(m + 1, Real(1));
+    for (std::uintmax_t j = 0; j <= m && j * n < c; ++j)
+    {
+        w[j] = 0;
+    }
+    std::uintmax_t lo = 0;
+    for (std::uintmax_t i = 1; i <= n; ++i)
+    {
+        // Inside the boundary i m - c < j n < i m + c:
+        const std::uintmax_t new_lo = (i * m >= c) ? (i * m - c) / n + 1 : 0;
+        const std::uintmax_t hi = (std::min)((i * m + c - 1) / n, m);
+        for (; lo < new_lo && lo <= m; ++lo)
+        {
+            w[lo] = 1;
+        }
+        // w(i, 0) = w(i-1, 0) as there is only one path to it.  Only the multiply-add by w(i, j-1)
+        // depends on the previous iteration, the division does not:
+        Real left = (lo == 0) ? w[0] : Real(1);
+        for (std::uintmax_t j = (lo == 0 ? 1 : lo); j <= hi; ++j)
+        {
+            const Real inv = 1 / static_cast<Real>(i + j);
+            left = static_cast<Real>(i) * inv * w[j] + static_cast<Real>(j) * inv * left;
+            w[j] = left;
+        }
+    }
+    return w[m];
+}
+
+template<typename Real>
+Real ks_two_sample_pvalue(std::uintmax_t n, std::uintmax_t m, std::uintmax_t c)
+{
+    using no_promote_policy = boost::math::policies::policy<boost::math::policies::promote_float<false>, boost::math::policies::promote_double<false>>;
+    // The exact recursion updates a band of about 2c/max(n, m) + 1 points in each of max(n, m) rows,
+    // so costs O(max(n, m) band) operations; beyond a million lattice points the limiting
+    // distribution of sqrt(n m/(n + m)) D is used instead:
+    if (n * m <= 1000000)
+    {
+        return ks_two_sample_exact_sf<Real>(n, m, c);
+    }
+    const Real d = static_cast<Real>(c) / (static_cast<Real>(n) * static_cast<Real>(m));
+    const Real en = static_cast<Real>(n) * static_cast<Real>(m) / static_cast<Real>(n + m);
+    boost::math::kolmogorov_smirnov_distribution<Real, no_promote_policy> dist(en);
+    const Real p = boost::math::cdf(complement(dist, d));
+    return (std::min)((std::max)(p, Real(0)), Real(1));
+}
+
+template<typename ReturnType, typename ForwardIterator1, typename ForwardIterator2>
+ReturnType two_sample_kolmogorov_smirnov_test_impl(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2)
+{
+    using Real = typename std::tuple_element<0, ReturnType>::type;
+    const auto n = static_cast<std::uintmax_t>(std::distance(first1, last1));
+    const auto m = static_cast<std::uintmax_t>(std::distance(first2, last2));
+    if (n == 0 || m == 0)
+    {
+        throw std::domain_error("Both samples must contain at least one observation.");
+    }
+    const std::uintmax_t c = ks_two_sample_merge(first1, last1, n, first2, last2, m);
+    const Real statistic = static_cast<Real>(c) / (static_cast<Real>(n) * static_cast<Real>(m));
+    return std::make_pair(statistic, ks_two_sample_pvalue<Real>(n, m, c));
+}
+
+} // namespace detail
+
+// The two-sample Kolmogorov-Smirnov test of whether two samples, each sorted in increasing order,
+// come from the same distribution.  Returns the statistic D = sup |F_1(x) - F_2(x)| and its p-value.
+template<typename ForwardIterator1, typename ForwardIterator2, typename Real = typename std::iterator_traits<ForwardIterator1>::value_type,
+         typename ReturnType = typename std::conditional<std::is_integral<Real>::value, std::pair<double, double>, std::pair<Real, Real>>::type>
+inline ReturnType two_sample_kolmogorov_smirnov_test(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2, ForwardIterator2 last2)
+{
+    return detail::two_sample_kolmogorov_smirnov_test_impl<ReturnType>(first1, last1, first2, last2);
+}
+
+template<typename Container, typename Real = typename Container::value_type,
+         typename ReturnType = typename std::conditional<std::is_integral<Real>::value, std::pair<double, double>, std::pair<Real, Real>>::type>
+inline ReturnType two_sample_kolmogorov_smirnov_test(const Container& u, const Container& v)
+{
+    return detail::two_sample_kolmogorov_smirnov_test_impl<ReturnType>(std::begin(u), std::end(u), std::begin(v), std::end(v));
+}
+
+template<typename Container, typename Real = typename Container::value_type,
+         typename ReturnType = typename std::conditional<std::is_integral<Real>::value, double, Real>::type>
+inline ReturnType two_sample_kolmogorov_smirnov_statistic(const Container& u, const Container& v)
+{
+    const auto n = static_cast<std::uintmax_t>(std::distance(std::begin(u), std::end(u)));
+    const auto m = static_cast<std::uintmax_t>(std::distance(std::begin(v), std::end(v)));
+    if (n == 0 || m == 0)
+    {
+        throw std::domain_error("Both samples must contain at least one observation.");
+    }
+    const std::uintmax_t c = detail::ks_two_sample_merge(std::begin(u), std::end(u), n, std::begin(v), std::end(v), m);
+    return static_cast<ReturnType>(c) / (static_cast<ReturnType>(n) * static_cast<ReturnType>(m));
+}
+
+}}} // namespace boost::math::statistics
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+namespace boost::math::statistics {
+
+// Samples in any order: sorted copies are made with the execution policy, then merged.
+template<typename ExecutionPolicy, typename Container, typename Real = typename Container::value_type,
+         typename ReturnType = std::conditional_t<std::is_integral_v<Real>, std::pair<double, double>, std::pair<Real, Real>>>
+inline ReturnType two_sample_kolmogorov_smirnov_test(ExecutionPolicy&& exec, const Container& u, const Container& v)
+{
+    std::vector<Real> su(std::begin(u), std::end(u));
+    std::vector<Real> sv(std::begin(v), std::end(v));
+    std::sort(exec, su.begin(), su.end());
+    std::sort(exec, sv.begin(), sv.end());
+    return detail::two_sample_kolmogorov_smirnov_test_impl<ReturnType>(su.cbegin(), su.cend(), sv.cbegin(), sv.cend());
+}
+
+} // namespace boost::math::statistics
+
+#endif
+
+#endif // BOOST_MATH_STATISTICS_KOLMOGOROV_SMIRNOV_TEST_HPP
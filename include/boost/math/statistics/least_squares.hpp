@@ -0,0 +1,628 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_LEAST_SQUARES_HPP
+#define BOOST_MATH_STATISTICS_LEAST_SQUARES_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// Multiple linear regression by QR factorization, y ~ c_0 + c_1 x_1 + ... + c_p x_p, with optional weights
+// and ridge penalty.  The accumulator keeps only the upper triangular factor R of the augmented matrix
+// [1 X y] (scaled by the square roots of the weights), which has (p+2)^2 entries however many rows
+// have been added:  the coefficients solve R_11 c = z, where z is the last column of R above the
+// diagonal, and the last diagonal entry is the root of the residual sum of squares.
+//
+// Rows are added in panels by Householder reflections, or one at a time by Givens rotations, and
+// removed by the LINPACK downdating algorithm (dchdd), so that a window may slide through the data.
+// Two accumulators of disjoint rows merge by reducing the one R against the other, which is the tall
+// skinny QR (TSQR) reduction the parallel fits use to combine the row blocks of their threads.
+//
+
+namespace boost { namespace math { namespace statistics {
+
+namespace detail {
+
+// Reduces the b x q panel, stored by columns, into the q x q upper triangular R, stored by rows:
+// [R; panel] = Q [R'; 0].  The reflectors keep the diagonal of R non-negative (Golub and Van Loan, Algorithm 5.1.1).
+template<class Real>
+void householder_panel_reduce(Real* r, std::size_t q, Real* panel, std::size_t b)
+{
+    using std::sqrt;
+    for (std::size_t j = 0; j < q; ++j)
+    {
+        Real* pj = panel + j*b;
+        Real sigma = 0;
+        for (std::size_t i = 0; i < b; ++i)
+        {
+            sigma += pj[i]*pj[i];
+        }
+        if (sigma == 0)
+        {
+            continue;
+        }
+        const Real alpha = r[j*q + j];
+        const Real norm = sqrt(alpha*alpha + sigma);
+        // v = [v0; pj], to be scaled so that v0 = 1; the second form avoids cancellation:
+        const Real v0 = alpha <= 0 ? alpha - norm : -sigma/(alpha + norm);
+        const Real tau = 2*v0*v0/(sigma + v0*v0);
+        const Real inv_v0 = 1/v0;
+        r[j*q + j] = norm;
+        for (std::size_t k = j + 1; k < q; ++k)
+        {
+            Real* pk = panel + k*b;
+            Real dot = 0;
+            for (std::size_t i = 0; i < b; ++i)
+            {
+                dot += pj[i]*pk[i];
+            }
+            const Real s = tau*(r[j*q + k] + inv_v0*dot);
+            r[j*q + k] -= s;
+            const Real t = s*inv_v0;
+            for (std::size_t i = 0; i < b; ++i)
+            {
+                pk[i] -= t*pj[i];
+            }
+        }
+    }
+}
+
+// Adds the row u to the q x q upper triangular R by Givens rotations; u is overwritten.
+template<class Real>
+void givens_row_update(Real* r, std::size_t q, Real* u)
+{
+    using std::sqrt;
+    for (std::size_t j = 0; j < q; ++j)
+    {
+        if (u[j] == 0)
+        {
+            continue;
+        }
+        const Real rjj = r[j*q + j];
+        const Real h = sqrt(rjj*rjj + u[j]*u[j]);
+        const Real c = rjj/h;
+        const Real s = u[j]/h;
+        r[j*q + j] = h;
+        for (std::size_t k = j + 1; k < q; ++k)
+        {
+            const Real t = r[j*q + k];
+            r[j*q + k] = c*t + s*u[k];
+            u[k] = c*u[k] - s*t;
+        }
+    }
+}
+
+// Solves R_11 c = z, the first q - 1 rows and columns of R against its last column:
+template<class Real>
+std::vector<Real> triangular_solve(const std::vector<Real>& r, std::size_t q)
+{
+    using std::abs;
+    const std::size_t p = q - 1;
+    Real max_diagonal = 0;
+    for (std::size_t j = 0; j < p; ++j)
+    {
+        max_diagonal = (std::max)(max_diagonal, abs(r[j*q + j]));
+    }
+    std::vector<Real> c(p);
+    for (std::size_t j = p; j-- > 0;)
+    {
+        if (!(abs(r[j*q + j]) > q*std::numeric_limits<Real>::epsilon()*max_diagonal))
+        {
+            throw std::domain_error("The predictors are collinear, or there are fewer rows than coefficients.");
+        }
+        Real s = r[j*q + p];
+        for (std::size_t k = j + 1; k < p; ++k)
+        {
+            s -= r[j*q + k]*c[k];
+        }
+        c[j] = s/r[j*q + j];
+    }
+    return c;
+}
+
+} // namespace detail
+
+template<class Real = double>
+class least_squares_accumulator
+{
+public:
+    using value_type = Real;
+
+    explicit least_squares_accumulator(std::size_t predictors = 1, bool intercept = true)
+        : m_predictors(predictors), m_intercept(intercept), m_q(predictors + (intercept ? 2 : 1)), m_r(m_q*m_q, Real(0))
+    {
+        if (predictors == 0)
+        {
+            throw std::domain_error("At least one predictor is required.");
+        }
+    }
+
+    // x holds the predictors of one row:
+    template<class RandomAccessContainer>
+    void add_row(RandomAccessContainer const & x, const Real y, const Real weight = 1)
+    {
+        std::vector<Real> u = scaled_row(x, y, weight);
+        detail::givens_row_update(m_r.data(), m_q, u.data());
+        update_totals(y, weight);
+        ++m_n;
+    }
+
+    //
+    // Removes a row added before, for a sliding window.  Downdating is less stable than updating: each removal
+    // loses accuracy in proportion to the condition of the remaining rows, so a window which runs for very long
+    // should be rebuilt from its rows from time to time.
+    //
+    template<class RandomAccessContainer>
+    void remove_row(RandomAccessContainer const & x, const Real y, const Real weight = 1)
+    {
+        using std::abs;
+        using std::sqrt;
+        if (m_n == 0)
+        {
+            throw std::domain_error("No rows have been added.");
+        }
+        const std::vector<Real> u = scaled_row(x, y, weight);
+        const std::size_t p = m_q - 1;
+        // Solve R_11^T a = u_1:
+        std::vector<Real> a(p);
+        Real norm2 = 0;
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            Real s = u[j];
+            for (std::size_t i = 0; i < j; ++i)
+            {
+                s -= m_r[i*m_q + j]*a[i];
+            }
+            if (m_r[j*m_q + j] == 0)
+            {
+                throw std::domain_error("The row cannot be removed, since the remaining rows would not determine the coefficients.");
+            }
+            a[j] = s/m_r[j*m_q + j];
+            norm2 += a[j]*a[j];
+        }
+        // norm2 is the leverage of the row.  Near 1 the remaining rows barely determine the coefficients, and the
+        // downdate would lose more than half the working precision:
+        if (!(1 - norm2 > sqrt(std::numeric_limits<Real>::epsilon())))
+        {
+            throw std::domain_error("The row cannot be removed, since the remaining rows would not determine the coefficients.");
+        }
+
+        // The rotations which take [a; alpha] to [0; 1], applied to [R_11 z; 0 u_y]:
+        std::vector<Real> c(p);
+        std::vector<Real> s(p);
+        Real alpha = sqrt(1 - norm2);
+        for (std::size_t i = p; i-- > 0;)
+        {
+            const Real scale = alpha + abs(a[i]);
+            const Real aa = alpha/scale;
+            const Real bb = a[i]/scale;
+            const Real norm = sqrt(aa*aa + bb*bb);
+            c[i] = aa/norm;
+            s[i] = bb/norm;
+            alpha = scale*norm;
+        }
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            Real xx = 0;
+            for (std::size_t i = j + 1; i-- > 0;)
+            {
+                const Real t = c[i]*xx + s[i]*m_r[i*m_q + j];
+                m_r[i*m_q + j] = c[i]*m_r[i*m_q + j] - s[i]*xx;
+                xx = t;
+            }
+        }
+        Real zeta = u[p];
+        for (std::size_t i = 0; i < p; ++i)
+        {
+            Real& z = m_r[i*m_q + p];
+            z = (z - s[i]*zeta)/c[i];
+            zeta = c[i]*zeta - s[i]*z;
+        }
+        const Real rho = m_r[p*m_q + p];
+        m_r[p*m_q + p] = sqrt((std::max)(rho*rho - zeta*zeta, Real(0)));
+
+        remove_totals(y, weight);
+        --m_n;
+    }
+
+    // The rows of predictors are stored one after another in [x_first, x_last), with their responses from y_first:
+    template<class RandomAccessIterator, class YIterator>
+    void add_rows(RandomAccessIterator x_first, RandomAccessIterator x_last, YIterator y_first)
+    {
+        add_rows_impl(x_first, x_last, y_first, [](std::size_t) { return Real(1); });
+    }
+
+    template<class RandomAccessIterator, class YIterator, class WIterator>
+    void add_rows(RandomAccessIterator x_first, RandomAccessIterator x_last, YIterator y_first, WIterator w_first)
+    {
+        add_rows_impl(x_first, x_last, y_first, [w_first](std::size_t i) { return static_cast<Real>(w_first[i]); });
+    }
+
+    void merge(least_squares_accumulator const & other)
+    {
+        if (other.m_q != m_q || other.m_intercept != m_intercept)
+        {
+            throw std::domain_error("Only fits of the same predictors can be merged.");
+        }
+        // Reduce a copy, since other may be *this:
+        std::vector<Real> panel(m_q*m_q);
+        for (std::size_t i = 0; i < m_q; ++i)
+        {
+            for (std::size_t j = 0; j < m_q; ++j)
+            {
+                panel[j*m_q + i] = other.m_r[i*m_q + j];
+            }
+        }
+        detail::householder_panel_reduce(m_r.data(), m_q, panel.data(), m_q);
+        merge_totals(other.m_sum_w, other.m_mean_y, other.m_M2_y);
+        m_n += other.m_n;
+    }
+
+    std::size_t predictors() const
+    {
+        return m_predictors;
+    }
+
+    bool has_intercept() const
+    {
+        return m_intercept;
+    }
+
+    std::size_t count() const
+    {
+        return m_n;
+    }
+
+    // c_0, c_1, ..., c_p with the intercept, or c_1, ..., c_p without:
+    std::vector<Real> coefficients() const
+    {
+        return detail::triangular_solve(m_r, m_q);
+    }
+
+    // The minimizer of the weighted sum of squared residuals plus lambda times the sum of the squared slopes.
+    // The intercept is not penalized.
+    std::vector<Real> ridge_coefficients(const Real lambda) const
+    {
+        using std::sqrt;
+        if (!(lambda >= 0))
+        {
+            throw std::domain_error("The ridge penalty must be non-negative.");
+        }
+        std::vector<Real> r = m_r;
+        std::vector<Real> u(m_q);
+        const Real root_lambda = sqrt(lambda);
+        for (std::size_t j = m_intercept ? 1 : 0; j + 1 < m_q; ++j)
+        {
+            std::fill(u.begin(), u.end(), Real(0));
+            u[j] = root_lambda;
+            detail::givens_row_update(r.data(), m_q, u.data());
+        }
+        return detail::triangular_solve(r, m_q);
+    }
+
+    Real residual_sum_of_squares() const
+    {
+        const Real rho = m_r[m_q*m_q - 1];
+        return rho*rho;
+    }
+
+    // 1 - RSS/TSS, with the total sum of squares about the mean with an intercept and about zero without,
+    // as in R's lm.  As for simple_ordinary_least_squares_with_R_squared, a constant response fits perfectly.
+    Real R_squared() const
+    {
+        const Real tss = m_intercept ? m_M2_y : m_M2_y + m_sum_w*m_mean_y*m_mean_y;
+        if (tss == 0)
+        {
+            return Real(1);
+        }
+        return 1 - residual_sum_of_squares()/tss;
+    }
+
+private:
+    template<class RandomAccessContainer>
+    std::vector<Real> scaled_row(RandomAccessContainer const & x, const Real y, const Real weight) const
+    {
+        using std::sqrt;
+        if (static_cast<std::size_t>(std::distance(std::cbegin(x), std::cend(x))) != m_predictors)
+        {
+            throw std::domain_error("The row must have one value for each predictor.");
+        }
+        if (!(weight >= 0))
+        {
+            throw std::domain_error("The weights must be non-negative.");
+        }
+        const Real sw = sqrt(weight);
+        std::vector<Real> u(m_q);
+        std::size_t j = 0;
+        if (m_intercept)
+        {
+            u[j++] = sw;
+        }
+        for (auto it = std::cbegin(x); it != std::cend(x); ++it)
+        {
+            u[j++] = sw*static_cast<Real>(*it);
+        }
+        u[j] = sw*y;
+        return u;
+    }
+
+    template<class RandomAccessIterator, class YIterator, class Weight>
+    void add_rows_impl(RandomAccessIterator x_first, RandomAccessIterator x_last, YIterator y_first, Weight weight)
+    {
+        using std::sqrt;
+        const std::size_t values = static_cast<std::size_t>(std::distance(x_first, x_last));
+        const std::size_t rows = values/m_predictors;
+        if (rows*m_predictors != values)
+        {
+            throw std::domain_error("The number of predictor values must be a multiple of the number of predictors.");
+        }
+        // Panels of a few thousand values, copied by columns so that the reflections run with unit stride:
+        const std::size_t b = (std::min)(rows, (std::max)(std::size_t(32), std::size_t(8192)/m_q));
+        std::vector<Real> panel(b*m_q);
+        for (std::size_t first = 0; first < rows; first += b)
+        {
+            const std::size_t n = (std::min)(b, rows - first);
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const std::size_t row = first + i;
+                const Real w = weight(row);
+                if (!(w >= 0))
+                {
+                    throw std::domain_error("The weights must be non-negative.");
+                }
+                const Real sw = sqrt(w);
+                const Real y = static_cast<Real>(y_first[row]);
+                std::size_t j = 0;
+                if (m_intercept)
+                {
+                    panel[i] = sw;
+                    ++j;
+                }
+                for (std::size_t k = 0; k < m_predictors; ++k, ++j)
+                {
+                    panel[j*n + i] = sw*static_cast<Real>(x_first[row*m_predictors + k]);
+                }
+                panel[j*n + i] = sw*y;
+                update_totals(y, w);
+            }
+            detail::householder_panel_reduce(m_r.data(), m_q, panel.data(), n);
+            m_n += n;
+        }
+    }
+
+    // The weighted mean and sum of squared deviations of the response, for R^2 (West's algorithm):
+    void update_totals(const Real y, const Real w)
+    {
+        if (w == 0)
+        {
+            return;
+        }
+        m_sum_w += w;
+        const Real delta = y - m_mean_y;
+        m_mean_y += w*delta/m_sum_w;
+        m_M2_y += w*delta*(y - m_mean_y);
+    }
+
+    void remove_totals(const Real y, const Real w)
+    {
+        if (w == 0)
+        {
+            return;
+        }
+        const Real sum_w = m_sum_w - w;
+        if (!(sum_w > 0))
+        {
+            m_sum_w = 0;
+            m_mean_y = 0;
+            m_M2_y = 0;
+            return;
+        }
+        const Real mean = (m_sum_w*m_mean_y - w*y)/sum_w;
+        m_M2_y = (std::max)(m_M2_y - w*(y - mean)*(y - m_mean_y), Real(0));
+        m_mean_y = mean;
+        m_sum_w = sum_w;
+    }
+
+    void merge_totals(const Real sum_w, const Real mean_y, const Real M2_y)
+    {
+        const Real total = m_sum_w + sum_w;
+        if (total == 0)
+        {
+            return;
+        }
+        const Real delta = mean_y - m_mean_y;
+        const Real M2 = m_M2_y + M2_y + delta*delta*m_sum_w*sum_w/total;
+        m_mean_y += delta*sum_w/total;
+        m_M2_y = M2;
+        m_sum_w = total;
+    }
+
+    std::size_t m_predictors;
+    bool m_intercept;
+    std::size_t m_q;
+    std::vector<Real> m_r;
+    std::size_t m_n = 0;
+    Real m_sum_w = 0;
+    Real m_mean_y = 0;
+    Real m_M2_y = 0;
+};
+
+namespace detail {
+
+template<class T>
+using least_squares_real_t = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+template<class Real, class Container>
+std::size_t least_squares_predictors(Container const & x, Container const & y)
+{
+    const std::size_t values = static_cast<std::size_t>(std::distance(std::cbegin(x), std::cend(x)));
+    const std::size_t rows = static_cast<std::size_t>(std::distance(std::cbegin(y), std::cend(y)));
+    if (rows == 0 || values % rows != 0)
+    {
+        throw std::domain_error("The predictors must hold the same number of values for each response.");
+    }
+    return values/rows;
+}
+
+// Rows [first, last), without weights if w is null:
+template<class Real, class XIterator, class YIterator>
+void least_squares_add_rows(least_squares_accumulator<Real>& fit, XIterator x, std::size_t first, std::size_t last, YIterator y, std::nullptr_t)
+{
+    const std::size_t p = fit.predictors();
+    fit.add_rows(x + first*p, x + last*p, y + first);
+}
+
+template<class Real, class XIterator, class YIterator, class WIterator>
+void least_squares_add_rows(least_squares_accumulator<Real>& fit, XIterator x, std::size_t first, std::size_t last, YIterator y, WIterator w)
+{
+    const std::size_t p = fit.predictors();
+    fit.add_rows(x + first*p, x + last*p, y + first, w + first);
+}
+
+template<class Real, class XIterator, class YIterator, class WIterator>
+least_squares_accumulator<Real> least_squares_seq_impl(XIterator x, YIterator y, WIterator w, std::size_t rows, std::size_t p, bool intercept)
+{
+    least_squares_accumulator<Real> fit(p, intercept);
+    least_squares_add_rows(fit, x, 0, rows, y, w);
+    return fit;
+}
+
+#ifdef BOOST_MATH_HAS_THREADS
+
+struct least_squares_tag {};
+
+// Each chunk of rows is reduced to its own R, and the R's are merged in order:
+template<class Real, class Executor, class XIterator, class YIterator, class WIterator>
+least_squares_accumulator<Real> least_squares_parallel_impl(Executor& ex, XIterator x, YIterator y, WIterator w, std::size_t rows, std::size_t p, bool intercept)
+{
+    // The cost of a row grows as the square of the number of columns, so time per row and column squared:
+    const std::size_t q = p + (intercept ? 2 : 1);
+    const std::size_t elements = rows*q*q;
+    auto& cost = cost_per_element<least_squares_tag, Real>();
+    const std::size_t chunks = (std::min)(chunk_count(ex, elements, cost), rows);
+    if (chunks <= 1)
+    {
+        return timed_sequential(cost, elements, [&]() { return least_squares_seq_impl<Real>(x, y, w, rows, p, intercept); });
+    }
+    auto parts = run_chunks(ex, cost, elements, chunks, least_squares_accumulator<Real>(p, intercept), [&](std::size_t i)
+    {
+        least_squares_accumulator<Real> fit(p, intercept);
+        least_squares_add_rows(fit, x, chunk_begin(rows, chunks, i), chunk_begin(rows, chunks, i + 1), y, w);
+        return fit;
+    });
+    for (std::size_t i = 1; i < parts.size(); ++i)
+    {
+        parts[0].merge(parts[i]);
+    }
+    return parts[0];
+}
+
+#endif // BOOST_MATH_HAS_THREADS
+
+} // namespace detail
+
+//
+// Fits of all the rows at once.  x holds the predictors of each row one after another, so that it has
+// p values for each value of y.
+//
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+namespace detail {
+
+template<class Real, class ExecutionPolicy, class XIterator, class YIterator, class WIterator>
+least_squares_accumulator<Real> least_squares_impl(ExecutionPolicy&& exec, XIterator x, YIterator y, WIterator w, std::size_t rows, std::size_t p, bool intercept)
+{
+#ifdef BOOST_MATH_HAS_THREADS
+    if constexpr (!std::is_same_v<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>, std::remove_cv_t<decltype(std::execution::seq)>>)
+    {
+        return least_squares_parallel_impl<Real>(executor_of(exec), x, y, w, rows, p, intercept);
+    }
+#endif
+    (void)exec;
+    return least_squares_seq_impl<Real>(x, y, w, rows, p, intercept);
+}
+
+} // namespace detail
+
+template<class ExecutionPolicy, class RandomAccessContainer>
+inline auto fit_least_squares(ExecutionPolicy&& exec, RandomAccessContainer const & x, RandomAccessContainer const & y, bool intercept = true)
+{
+    using Real = detail::least_squares_real_t<typename RandomAccessContainer::value_type>;
+    const std::size_t p = detail::least_squares_predictors<Real>(x, y);
+    return detail::least_squares_impl<Real>(exec, std::cbegin(x), std::cbegin(y), nullptr, y.size(), p, intercept);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer>
+inline auto fit_weighted_least_squares(ExecutionPolicy&& exec, RandomAccessContainer const & x, RandomAccessContainer const & y,
+                                       RandomAccessContainer const & w, bool intercept = true)
+{
+    using Real = detail::least_squares_real_t<typename RandomAccessContainer::value_type>;
+    const std::size_t p = detail::least_squares_predictors<Real>(x, y);
+    if (w.size() != y.size())
+    {
+        throw std::domain_error("There must be one weight for each response.");
+    }
+    return detail::least_squares_impl<Real>(exec, std::cbegin(x), std::cbegin(y), std::cbegin(w), y.size(), p, intercept);
+}
+
+template<class RandomAccessContainer>
+inline auto fit_least_squares(RandomAccessContainer const & x, RandomAccessContainer const & y, bool intercept = true)
+{
+    return fit_least_squares(std::execution::seq, x, y, intercept);
+}
+
+template<class RandomAccessContainer>
+inline auto fit_weighted_least_squares(RandomAccessContainer const & x, RandomAccessContainer const & y,
+                                       RandomAccessContainer const & w, bool intercept = true)
+{
+    return fit_weighted_least_squares(std::execution::seq, x, y, w, intercept);
+}
+
+#else // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class RandomAccessContainer>
+inline auto fit_least_squares(RandomAccessContainer const & x, RandomAccessContainer const & y, bool intercept = true)
+    -> least_squares_accumulator<detail::least_squares_real_t<typename RandomAccessContainer::value_type>>
+{
+    using Real = detail::least_squares_real_t<typename RandomAccessContainer::value_type>;
+    const std::size_t p = detail::least_squares_predictors<Real>(x, y);
+    return detail::least_squares_seq_impl<Real>(std::cbegin(x), std::cbegin(y), nullptr, y.size(), p, intercept);
+}
+
+template<class RandomAccessContainer>
+inline auto fit_weighted_least_squares(RandomAccessContainer const & x, RandomAccessContainer const & y,
+                                       RandomAccessContainer const & w, bool intercept = true)
+    -> least_squares_accumulator<detail::least_squares_real_t<typename RandomAccessContainer::value_type>>
+{
+    using Real = detail::least_squares_real_t<typename RandomAccessContainer::value_type>;
+    const std::size_t p = detail::least_squares_predictors<Real>(x, y);
+    if (w.size() != y.size())
+    {
+        throw std::domain_error("There must be one weight for each response.");
+    }
+    return detail::least_squares_seq_impl<Real>(std::cbegin(x), std::cbegin(y), std::cbegin(w), y.size(), p, intercept);
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_LEAST_SQUARES_HPP
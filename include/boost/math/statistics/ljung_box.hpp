@@ -11,36 +11,51 @@
 #include <utility>
 #include <boost/math/distributions/chi_squared.hpp>
 #include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/autocorrelation.hpp>
 
 namespace boost::math::statistics {
 
-template<class RandomAccessIterator>
-auto ljung_box(RandomAccessIterator begin, RandomAccessIterator end, int64_t lags = -1, int64_t fit_dof = 0) {
-    using Real = typename std::iterator_traits<RandomAccessIterator>::value_type;
-    int64_t n = std::distance(begin, end);
+namespace detail {
+
+inline int64_t portmanteau_lags(int64_t n, int64_t lags) {
     if (lags >= n) {
       throw std::domain_error("Number of lags must be < number of elements in array.");
     }
 
     if (lags == -1) {
       // This is the same default as Mathematica; it seems sensible enough . . .
-      lags = static_cast<int64_t>(std::ceil(std::log(Real(n))));
+      lags = static_cast<int64_t>(std::ceil(std::log(double(n))));
     }
 
     if (lags <= 0) {
       throw std::domain_error("Must have at least one lag.");
     }
+    return lags;
+}
 
-    auto mu = boost::math::statistics::mean(begin, end);
+template<class Real>
+Real portmanteau_pvalue(Real Q, int64_t lags, int64_t fit_dof) {
+    typedef boost::math::policies::policy<
+          boost::math::policies::promote_float<false>,
+          boost::math::policies::promote_double<false> >
+          no_promote_policy;
 
-    std::vector<Real> r(lags + 1, Real(0));
-    for (size_t i = 0; i < r.size(); ++i) {
-      for (auto it = begin + i; it != end; ++it) {
-        Real ak = *(it) - mu;
-        Real akml = *(it-i) - mu;
-        r[i] += ak*akml;
-      }
-    }
+    auto chi = boost::math::chi_squared_distribution<Real, no_promote_policy>(Real(lags - fit_dof));
+
+    return 1 - boost::math::cdf(chi, Q);
+}
+
+}
+
+template<class RandomAccessIterator>
+auto ljung_box(RandomAccessIterator begin, RandomAccessIterator end, int64_t lags = -1, int64_t fit_dof = 0) {
+    using Real = detail::autocorrelation_real_t<typename std::iterator_traits<RandomAccessIterator>::value_type>;
+    int64_t n = std::distance(begin, end);
+    lags = detail::portmanteau_lags(n, lags);
+
+    // Large lag counts take the sums from the power spectrum, in O(n log n) rather than O(n lags):
+    detail::autocovariance_workspace<Real> workspace;
+    const std::vector<Real>& r = workspace.sums(begin, end, static_cast<std::size_t>(lags));
 
     Real Q = 0;
 
@@ -49,14 +64,7 @@ auto ljung_box(RandomAccessIterator begin, RandomAccessIterator end, int64_t lag
     }
     Q *= n*(n+2);
 
-    typedef boost::math::policies::policy<
-          boost::math::policies::promote_float<false>,
-          boost::math::policies::promote_double<false> >
-          no_promote_policy;
-
-    auto chi = boost::math::chi_squared_distribution<Real, no_promote_policy>(Real(lags - fit_dof));
-
-    Real pvalue = 1 - boost::math::cdf(chi, Q);
+    Real pvalue = detail::portmanteau_pvalue(Q, lags, fit_dof);
     return std::make_pair(Q, pvalue);
 }
 
@@ -66,5 +74,32 @@ auto ljung_box(RandomAccessContainer const & v, int64_t lags = -1, int64_t fit_d
     return ljung_box(v.begin(), v.end(), lags, fit_dof);
 }
 
+// The Box-Pierce statistic n sum_k rho_k^2, of which Ljung-Box is the small sample refinement:
+template<class RandomAccessIterator>
+auto box_pierce(RandomAccessIterator begin, RandomAccessIterator end, int64_t lags = -1, int64_t fit_dof = 0) {
+    using Real = detail::autocorrelation_real_t<typename std::iterator_traits<RandomAccessIterator>::value_type>;
+    int64_t n = std::distance(begin, end);
+    lags = detail::portmanteau_lags(n, lags);
+
+    detail::autocovariance_workspace<Real> workspace;
+    const std::vector<Real>& r = workspace.sums(begin, end, static_cast<std::size_t>(lags));
+
+    Real Q = 0;
+
+    for (size_t k = 1; k < r.size(); ++k) {
+      Q += r[k]*r[k];
+    }
+    Q *= n/(r[0]*r[0]);
+
+    Real pvalue = detail::portmanteau_pvalue(Q, lags, fit_dof);
+    return std::make_pair(Q, pvalue);
+}
+
+
+template<class RandomAccessContainer>
+auto box_pierce(RandomAccessContainer const & v, int64_t lags = -1, int64_t fit_dof = 0) {
+    return box_pierce(v.begin(), v.end(), lags, fit_dof);
+}
+
 }
 #endif
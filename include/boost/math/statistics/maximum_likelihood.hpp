@@ -0,0 +1,1328 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_MAXIMUM_LIKELIHOOD_HPP
+#define BOOST_MATH_STATISTICS_MAXIMUM_LIKELIHOOD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/statistics/detail/single_pass.hpp>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/special_functions/trigamma.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/lognormal.hpp>
+#include <boost/math/distributions/exponential.hpp>
+#include <boost/math/distributions/poisson.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/weibull.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/negative_binomial.hpp>
+#include <boost/math/distributions/skew_normal.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+namespace boost { namespace math { namespace statistics {
+
+// The maximum likelihood estimates of the parameters of Dist, in the order its constructor takes them,
+// with their asymptotic covariance: the inverse of the observed Fisher information at the estimate.
+template<class Dist, std::size_t N>
+struct fit_result
+{
+    using value_type = typename Dist::value_type;
+    static constexpr std::size_t parameter_count = N;
+
+    std::array<value_type, N> parameters;
+    std::array<std::array<value_type, N>, N> covariance;
+    value_type log_likelihood;
+    std::uint64_t sample_size;
+    std::size_t iterations;
+
+    Dist distribution() const;
+
+    std::array<value_type, N> standard_errors() const
+    {
+        using std::sqrt;
+        std::array<value_type, N> se;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            se[i] = sqrt(covariance[i][i]);
+        }
+        return se;
+    }
+};
+
+namespace detail {
+
+// The model of the log-likelihood of each supported distribution; see the specializations below.
+template<class Dist>
+struct likelihood_model;
+
+// Running central moments, mergeable across threads (Chan, Golub and LeVeque; Pebay):
+template<class Real>
+struct mle_moments
+{
+    std::uint64_t n = 0;
+    Real mean = 0;
+    Real m2 = 0;
+    Real m3 = 0;
+    Real m4 = 0;
+
+    void operator()(Real x)
+    {
+        ++n;
+        update_first_four_moments(mean, m2, m3, m4, static_cast<Real>(n), x);
+    }
+
+    void merge(const mle_moments& b)
+    {
+        Real n_a = static_cast<Real>(n);
+        merge_first_four_moments(mean, m2, m3, m4, n_a, b.mean, b.m2, b.m3, b.m4, static_cast<Real>(b.n));
+        n += b.n;
+    }
+
+    Real variance() const
+    {
+        return m2 / static_cast<Real>(n);
+    }
+
+    Real skewness() const
+    {
+        using std::sqrt;
+        const Real v = variance();
+        return (m3 / static_cast<Real>(n)) / (v * sqrt(v));
+    }
+
+    Real excess_kurtosis() const
+    {
+        const Real v = variance();
+        return (m4 / static_cast<Real>(n)) / (v * v) - 3;
+    }
+};
+
+// Observations outside the support are recorded rather than thrown, since they may be found on any thread:
+template<class Real>
+struct mle_domain
+{
+    bool valid = true;
+    Real bad_value = 0;
+
+    void reject(Real x)
+    {
+        if (valid)
+        {
+            valid = false;
+            bad_value = x;
+        }
+    }
+
+    void merge(const mle_domain& b)
+    {
+        if (valid && !b.valid)
+        {
+            *this = b;
+        }
+    }
+
+    void check(const char* function, const char* support) const
+    {
+        if (!valid)
+        {
+            throw std::domain_error(std::string(function) + ": the observation " + std::to_string(static_cast<double>(bad_value)) + " lies outside the support " + support + ".");
+        }
+    }
+};
+
+// The log-likelihood with its gradient and Hessian at one point:
+template<class Real, std::size_t N>
+struct mle_terms
+{
+    Real log_likelihood = 0;
+    std::array<Real, N> gradient{};
+    std::array<std::array<Real, N>, N> hessian{};
+
+    void merge(const mle_terms& b)
+    {
+        log_likelihood += b.log_likelihood;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            gradient[i] += b.gradient[i];
+            for (std::size_t j = 0; j < N; ++j)
+            {
+                hessian[i][j] += b.hessian[i][j];
+            }
+        }
+    }
+
+    void symmetrize()
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                hessian[j][i] = hessian[i][j];
+            }
+        }
+    }
+};
+
+template<class Accumulator, class ForwardIterator>
+Accumulator mle_accumulate_sequential(Accumulator acc, ForwardIterator first, ForwardIterator last)
+{
+    using Real = typename Accumulator::value_type;
+    for (; first != last; ++first)
+    {
+        acc(static_cast<Real>(*first));
+    }
+    return acc;
+}
+
+// One pass over the data, split across the shared pool's threads when there is enough of it to pay for them,
+// with the partial results combined through Accumulator::merge:
+template<class Accumulator, class ForwardIterator>
+Accumulator mle_accumulate(const Accumulator& init, ForwardIterator first, ForwardIterator last, bool parallel)
+{
+#ifdef BOOST_MATH_HAS_THREADS
+    if (parallel)
+    {
+        using Real = typename Accumulator::value_type;
+        thread_pool& ex = thread_pool::shared();
+        const std::size_t elements = static_cast<std::size_t>(std::distance(first, last));
+        running_estimate& cost = cost_per_element<Accumulator, Real>();
+        const std::size_t chunks = chunk_count(ex, elements, cost);
+        if (chunks > 1)
+        {
+            const auto boundaries = chunk_iterators(first, elements, chunks);
+            const auto results = run_chunks(ex, cost, elements, chunks, init, [&init, &boundaries](std::size_t i)
+            {
+                return mle_accumulate_sequential(init, boundaries[i], boundaries[i + 1]);
+            });
+            Accumulator result = results[0];
+            for (std::size_t i = 1; i < results.size(); ++i)
+            {
+                result.merge(results[i]);
+            }
+            return result;
+        }
+        return timed_sequential(cost, elements, [&init, first, last]() { return mle_accumulate_sequential(init, first, last); });
+    }
+#else
+    (void)parallel;
+#endif
+    return mle_accumulate_sequential(init, first, last);
+}
+
+// Wraps a model's per-observation terms for the models whose log-likelihood has no fixed sufficient statistics:
+template<class Model>
+struct mle_pass
+{
+    using value_type = typename Model::value_type;
+    using parameters = typename Model::parameters;
+
+    parameters theta;
+    mle_terms<value_type, Model::parameter_count> terms;
+
+    explicit mle_pass(const parameters& t) : theta(t) {}
+
+    void operator()(value_type x)
+    {
+        Model::add_observation(theta, x, terms);
+    }
+
+    void merge(const mle_pass& b)
+    {
+        terms.merge(b.terms);
+    }
+};
+
+template<class Model, class ForwardIterator>
+mle_terms<typename Model::value_type, Model::parameter_count> mle_evaluate(const typename Model::parameters& theta, const typename Model::summary& s,
+    ForwardIterator, ForwardIterator, bool, const std::false_type&)
+{
+    mle_terms<typename Model::value_type, Model::parameter_count> t;
+    Model::evaluate(theta, s, t);
+    t.symmetrize();
+    return t;
+}
+
+template<class Model, class ForwardIterator>
+mle_terms<typename Model::value_type, Model::parameter_count> mle_evaluate(const typename Model::parameters& theta, const typename Model::summary& s,
+    ForwardIterator first, ForwardIterator last, bool parallel, const std::true_type&)
+{
+    auto t = mle_accumulate(mle_pass<Model>(theta), first, last, parallel).terms;
+    Model::add_constant_terms(theta, s, t);
+    t.symmetrize();
+    return t;
+}
+
+// Cholesky factorization of a symmetric positive definite A in place; false if A is not positive definite:
+template<class Real, std::size_t N>
+bool mle_cholesky(std::array<std::array<Real, N>, N>& a)
+{
+    using std::sqrt;
+    for (std::size_t j = 0; j < N; ++j)
+    {
+        Real d = a[j][j];
+        for (std::size_t k = 0; k < j; ++k)
+        {
+            d -= a[j][k] * a[j][k];
+        }
+        if (!(d > 0))
+        {
+            return false;
+        }
+        a[j][j] = sqrt(d);
+        for (std::size_t i = j + 1; i < N; ++i)
+        {
+            Real s = a[i][j];
+            for (std::size_t k = 0; k < j; ++k)
+            {
+                s -= a[i][k] * a[j][k];
+            }
+            a[i][j] = s / a[j][j];
+        }
+    }
+    return true;
+}
+
+template<class Real, std::size_t N>
+std::array<Real, N> mle_cholesky_solve(const std::array<std::array<Real, N>, N>& l, std::array<Real, N> b)
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t k = 0; k < i; ++k)
+        {
+            b[i] -= l[i][k] * b[k];
+        }
+        b[i] /= l[i][i];
+    }
+    for (std::size_t i = N; i-- > 0;)
+    {
+        for (std::size_t k = i + 1; k < N; ++k)
+        {
+            b[i] -= l[k][i] * b[k];
+        }
+        b[i] /= l[i][i];
+    }
+    return b;
+}
+
+template<class Dist, class Model, class ForwardIterator>
+fit_result<Dist, Model::parameter_count> fit_impl(ForwardIterator first, ForwardIterator last, bool parallel)
+{
+    using std::fabs;
+    using Real = typename Model::value_type;
+    constexpr std::size_t N = Model::parameter_count;
+    using parameters = typename Model::parameters;
+    using needs_pass = std::integral_constant<bool, Model::needs_pass>;
+    static const char* function = "boost::math::statistics::fit<Dist>";
+
+    if (first == last)
+    {
+        throw std::domain_error(std::string(function) + ": at least one observation is required.");
+    }
+    const typename Model::summary s = mle_accumulate(typename Model::summary(), first, last, parallel);
+    s.domain.check(function, Model::support());
+
+    parameters theta = Model::start(s, function);
+    auto t = mle_evaluate<Model>(theta, s, first, last, parallel, needs_pass());
+    const Real tolerance = tools::root_epsilon<Real>();
+    const std::size_t max_iterations = 200;
+    std::size_t iterations = 0;
+    for (;; ++iterations)
+    {
+        if (iterations >= max_iterations)
+        {
+            throw boost::math::evaluation_error(std::string(function) + ": the Newton iteration did not converge; the maximum likelihood estimate may not exist for this data.");
+        }
+        // Newton's method on the log-likelihood, falling back towards steepest ascent (Levenberg-Marquardt)
+        // wherever the Hessian is not negative definite:
+        std::array<std::array<Real, N>, N> a;
+        Real scale = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            scale = (std::max)(scale, fabs(t.hessian[i][i]));
+        }
+        Real damping = 0;
+        for (;;)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                for (std::size_t j = 0; j < N; ++j)
+                {
+                    a[i][j] = -t.hessian[i][j];
+                }
+                a[i][i] += damping * (std::max)(fabs(t.hessian[i][i]), scale * tools::epsilon<Real>());
+            }
+            if (mle_cholesky(a))
+            {
+                break;
+            }
+            damping = damping == 0 ? Real(1e-3) : damping * 10;
+            if (!(damping < 1e30))
+            {
+                throw boost::math::evaluation_error(std::string(function) + ": the log-likelihood has no usable curvature at the current estimate.");
+            }
+        }
+        const std::array<Real, N> step = mle_cholesky_solve(a, t.gradient);
+
+        // Converged when the step is negligible, or the Newton decrement says the likelihood can't rise
+        // by more than rounding (needed for parameters that are zero at the optimum):
+        bool converged = true;
+        Real decrement = 0;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            if (fabs(step[i]) > tolerance * fabs(theta[i]))
+            {
+                converged = false;
+            }
+            decrement += step[i] * t.gradient[i];
+        }
+        if (decrement <= 4 * tools::epsilon<Real>() * fabs(t.log_likelihood))
+        {
+            converged = true;
+        }
+        // Backtrack until the step stays in the parameter space and does not decrease the likelihood,
+        // allowing for rounding once we are at the maximum:
+        const Real slack = 64 * tools::epsilon<Real>() * fabs(t.log_likelihood);
+        Real lambda = 1;
+        bool improved = false;
+        parameters trial;
+        decltype(t) trial_terms;
+        for (int halvings = 0; halvings < 60; ++halvings, lambda /= 2)
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                trial[i] = theta[i] + lambda * step[i];
+            }
+            if (!Model::feasible(trial))
+            {
+                continue;
+            }
+            trial_terms = mle_evaluate<Model>(trial, s, first, last, parallel, needs_pass());
+            if (trial_terms.log_likelihood >= t.log_likelihood - slack)
+            {
+                improved = true;
+                break;
+            }
+        }
+        if (improved)
+        {
+            theta = trial;
+            t = trial_terms;
+        }
+        if (converged || !improved)
+        {
+            break;
+        }
+    }
+
+    // The covariance is the inverse of the observed information -H:
+    std::array<std::array<Real, N>, N> information;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            information[i][j] = -t.hessian[i][j];
+        }
+    }
+    fit_result<Dist, N> result;
+    result.parameters = theta;
+    result.log_likelihood = t.log_likelihood;
+    result.sample_size = s.moments.n;
+    result.iterations = iterations + 1;
+    if (mle_cholesky(information))
+    {
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            std::array<Real, N> e{};
+            e[j] = 1;
+            const auto column = mle_cholesky_solve(information, e);
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                result.covariance[i][j] = column[i];
+            }
+        }
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            for (std::size_t j = 0; j < i; ++j)
+            {
+                result.covariance[i][j] = result.covariance[j][i] = (result.covariance[i][j] + result.covariance[j][i]) / 2;
+            }
+        }
+    }
+    else
+    {
+        // A singular information matrix: some parameter is not identified by the data.
+        for (auto& row : result.covariance)
+        {
+            row.fill(std::numeric_limits<Real>::infinity());
+        }
+    }
+    return result;
+}
+
+template<class Real>
+inline bool mle_positive(Real x)
+{
+    using std::isfinite;
+    return (x > 0) && isfinite(x);
+}
+
+// Normal: closed form, (mean, standard deviation).
+template<class Real, class Policy>
+struct likelihood_model<normal_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 2;
+    static constexpr bool needs_pass = false;
+    using parameters = std::array<Real, 2>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        mle_domain<Real> domain;
+        void operator()(Real x)
+        {
+            using std::isfinite;
+            if (!isfinite(x))
+            {
+                domain.reject(x);
+                return;
+            }
+            moments(x);
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "(-inf, inf)"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        using std::sqrt;
+        if (!(s.moments.m2 > 0))
+        {
+            throw std::domain_error(std::string(function) + ": the observations have no variance.");
+        }
+        return parameters{{s.moments.mean, sqrt(s.moments.variance())}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[1]);
+    }
+
+    static void evaluate(const parameters& p, const summary& s, mle_terms<Real, 2>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real mu = p[0];
+        const Real sigma = p[1];
+        const Real d = s.moments.mean - mu;
+        const Real ss = s.moments.m2 + n * d * d;
+        const Real s2 = sigma * sigma;
+        t.log_likelihood = -n * (log(sigma) + constants::log_root_two_pi<Real>()) - ss / (2 * s2);
+        t.gradient[0] = n * d / s2;
+        t.gradient[1] = -n / sigma + ss / (s2 * sigma);
+        t.hessian[0][0] = -n / s2;
+        t.hessian[1][0] = -2 * n * d / (s2 * sigma);
+        t.hessian[1][1] = n / s2 - 3 * ss / (s2 * s2);
+    }
+
+    static normal_distribution<Real, Policy> make(const parameters& p)
+    {
+        return normal_distribution<Real, Policy>(p[0], p[1]);
+    }
+};
+
+// Lognormal: the normal model applied to log(x), (location, scale).
+template<class Real, class Policy>
+struct likelihood_model<lognormal_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    using normal_model = likelihood_model<normal_distribution<Real, Policy>>;
+    static constexpr std::size_t parameter_count = 2;
+    static constexpr bool needs_pass = false;
+    using parameters = std::array<Real, 2>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        mle_domain<Real> domain;
+        void operator()(Real x)
+        {
+            using std::log;
+            if (!mle_positive(x))
+            {
+                domain.reject(x);
+                return;
+            }
+            moments(log(x));
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "(0, inf)"; }
+
+    static typename normal_model::summary as_normal(const summary& s)
+    {
+        typename normal_model::summary n;
+        n.moments = s.moments;
+        return n;
+    }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        return normal_model::start(as_normal(s), function);
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return normal_model::feasible(p);
+    }
+
+    static void evaluate(const parameters& p, const summary& s, mle_terms<Real, 2>& t)
+    {
+        normal_model::evaluate(p, as_normal(s), t);
+        // The Jacobian of the change of variables:
+        t.log_likelihood -= static_cast<Real>(s.moments.n) * s.moments.mean;
+    }
+
+    static lognormal_distribution<Real, Policy> make(const parameters& p)
+    {
+        return lognormal_distribution<Real, Policy>(p[0], p[1]);
+    }
+};
+
+// Exponential: closed form, (lambda).
+template<class Real, class Policy>
+struct likelihood_model<exponential_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 1;
+    static constexpr bool needs_pass = false;
+    using parameters = std::array<Real, 1>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        mle_domain<Real> domain;
+        void operator()(Real x)
+        {
+            using std::isfinite;
+            if (!(x >= 0) || !isfinite(x))
+            {
+                domain.reject(x);
+                return;
+            }
+            moments(x);
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "[0, inf)"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        if (!(s.moments.mean > 0))
+        {
+            throw std::domain_error(std::string(function) + ": every observation is zero.");
+        }
+        return parameters{{1 / s.moments.mean}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[0]);
+    }
+
+    static void evaluate(const parameters& p, const summary& s, mle_terms<Real, 1>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real lambda = p[0];
+        t.log_likelihood = n * (log(lambda) - lambda * s.moments.mean);
+        t.gradient[0] = n * (1 / lambda - s.moments.mean);
+        t.hessian[0][0] = -n / (lambda * lambda);
+    }
+
+    static exponential_distribution<Real, Policy> make(const parameters& p)
+    {
+        return exponential_distribution<Real, Policy>(p[0]);
+    }
+};
+
+// Poisson: closed form, (mean).
+template<class Real, class Policy>
+struct likelihood_model<poisson_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 1;
+    static constexpr bool needs_pass = false;
+    using parameters = std::array<Real, 1>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        Real sum_log_factorial = 0;
+        mle_domain<Real> domain;
+        void operator()(Real k)
+        {
+            using std::floor;
+            using std::isfinite;
+            if (!(k >= 0) || !isfinite(k) || (floor(k) != k))
+            {
+                domain.reject(k);
+                return;
+            }
+            moments(k);
+            sum_log_factorial += boost::math::lgamma(k + 1, Policy());
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            sum_log_factorial += b.sum_log_factorial;
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "{0, 1, 2, ...}"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        if (!(s.moments.mean > 0))
+        {
+            throw std::domain_error(std::string(function) + ": every observation is zero.");
+        }
+        return parameters{{s.moments.mean}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[0]);
+    }
+
+    static void evaluate(const parameters& p, const summary& s, mle_terms<Real, 1>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real m = p[0];
+        const Real sum = n * s.moments.mean;
+        t.log_likelihood = sum * log(m) - n * m - s.sum_log_factorial;
+        t.gradient[0] = sum / m - n;
+        t.hessian[0][0] = -sum / (m * m);
+    }
+
+    static poisson_distribution<Real, Policy> make(const parameters& p)
+    {
+        return poisson_distribution<Real, Policy>(p[0]);
+    }
+};
+
+// Gamma: sufficient statistics sum(x) and sum(log(x)), (shape, scale).
+template<class Real, class Policy>
+struct likelihood_model<gamma_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 2;
+    static constexpr bool needs_pass = false;
+    using parameters = std::array<Real, 2>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        Real sum_log = 0;
+        mle_domain<Real> domain;
+        void operator()(Real x)
+        {
+            using std::log;
+            if (!mle_positive(x))
+            {
+                domain.reject(x);
+                return;
+            }
+            moments(x);
+            sum_log += log(x);
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            sum_log += b.sum_log;
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "(0, inf)"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        using std::log;
+        using std::sqrt;
+        const Real mean = s.moments.mean;
+        const Real d = log(mean) - s.sum_log / static_cast<Real>(s.moments.n);
+        if (!(d > 0))
+        {
+            throw std::domain_error(std::string(function) + ": the observations have no variance.");
+        }
+        // Minka's approximation to the solution of log(a) - digamma(a) = d:
+        const Real a = (3 - d + sqrt((d - 3) * (d - 3) + 24 * d)) / (12 * d);
+        return parameters{{a, mean / a}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[0]) && mle_positive(p[1]);
+    }
+
+    static void evaluate(const parameters& p, const summary& s, mle_terms<Real, 2>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real a = p[0];
+        const Real theta = p[1];
+        const Real sum = n * s.moments.mean;
+        t.log_likelihood = -n * (boost::math::lgamma(a, Policy()) + a * log(theta)) + (a - 1) * s.sum_log - sum / theta;
+        t.gradient[0] = -n * (boost::math::digamma(a, Policy()) + log(theta)) + s.sum_log;
+        t.gradient[1] = (sum / theta - n * a) / theta;
+        t.hessian[0][0] = -n * boost::math::trigamma(a, Policy());
+        t.hessian[1][0] = -n / theta;
+        t.hessian[1][1] = (n * a - 2 * sum / theta) / (theta * theta);
+    }
+
+    static gamma_distribution<Real, Policy> make(const parameters& p)
+    {
+        return gamma_distribution<Real, Policy>(p[0], p[1]);
+    }
+};
+
+// Beta: sufficient statistics sum(log(x)) and sum(log(1-x)), (alpha, beta).
+template<class Real, class Policy>
+struct likelihood_model<beta_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 2;
+    static constexpr bool needs_pass = false;
+    using parameters = std::array<Real, 2>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        Real sum_log = 0;
+        Real sum_log1m = 0;
+        mle_domain<Real> domain;
+        void operator()(Real x)
+        {
+            using std::log;
+            if (!(x > 0) || !(x < 1))
+            {
+                domain.reject(x);
+                return;
+            }
+            moments(x);
+            sum_log += log(x);
+            sum_log1m += boost::math::log1p(-x, Policy());
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            sum_log += b.sum_log;
+            sum_log1m += b.sum_log1m;
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "(0, 1)"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        const Real m = s.moments.mean;
+        const Real v = s.moments.variance();
+        if (!(v > 0))
+        {
+            throw std::domain_error(std::string(function) + ": the observations have no variance.");
+        }
+        // The method of moments, which always gives a feasible point:
+        const Real c = (std::max)(Real(m * (1 - m) / v - 1), Real(tools::root_epsilon<Real>()));
+        return parameters{{m * c, (1 - m) * c}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[0]) && mle_positive(p[1]);
+    }
+
+    static void evaluate(const parameters& p, const summary& s, mle_terms<Real, 2>& t)
+    {
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real a = p[0];
+        const Real b = p[1];
+        const Real psi_ab = boost::math::digamma(a + b, Policy());
+        const Real tri_ab = boost::math::trigamma(a + b, Policy());
+        t.log_likelihood = n * (boost::math::lgamma(a + b, Policy()) - boost::math::lgamma(a, Policy()) - boost::math::lgamma(b, Policy()))
+                         + (a - 1) * s.sum_log + (b - 1) * s.sum_log1m;
+        t.gradient[0] = n * (psi_ab - boost::math::digamma(a, Policy())) + s.sum_log;
+        t.gradient[1] = n * (psi_ab - boost::math::digamma(b, Policy())) + s.sum_log1m;
+        t.hessian[0][0] = n * (tri_ab - boost::math::trigamma(a, Policy()));
+        t.hessian[1][0] = n * tri_ab;
+        t.hessian[1][1] = n * (tri_ab - boost::math::trigamma(b, Policy()));
+    }
+
+    static beta_distribution<Real, Policy> make(const parameters& p)
+    {
+        return beta_distribution<Real, Policy>(p[0], p[1]);
+    }
+};
+
+// Negative binomial: the counts are their own sufficient statistic, kept as a histogram
+// so that each iteration costs one term per distinct count rather than per observation.
+// (successes r, success fraction p).
+template<class Real, class Policy>
+struct likelihood_model<negative_binomial_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 2;
+    static constexpr bool needs_pass = false;
+    using parameters = std::array<Real, 2>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        std::map<Real, std::uint64_t> histogram;
+        mle_domain<Real> domain;
+        void operator()(Real k)
+        {
+            using std::floor;
+            using std::isfinite;
+            if (!(k >= 0) || !isfinite(k) || (floor(k) != k))
+            {
+                domain.reject(k);
+                return;
+            }
+            moments(k);
+            ++histogram[k];
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            for (const auto& e : b.histogram)
+            {
+                histogram[e.first] += e.second;
+            }
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "{0, 1, 2, ...}"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        const Real m = s.moments.mean;
+        const Real v = s.moments.variance();
+        if (!(v > m) || !(m > 0))
+        {
+            throw std::domain_error(std::string(function) + ": the observations are not overdispersed (variance " + std::to_string(static_cast<double>(v)) + " <= mean " + std::to_string(static_cast<double>(m)) + "), so the maximum likelihood estimate of r is infinite.");
+        }
+        const Real p = m / v;
+        return parameters{{m * p / (1 - p), p}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[0]) && (p[1] > 0) && (p[1] < 1);
+    }
+
+    static void evaluate(const parameters& p, const summary& s, mle_terms<Real, 2>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real r = p[0];
+        const Real q = p[1];
+        const Real sum = n * s.moments.mean;
+        const Real lg_r = boost::math::lgamma(r, Policy());
+        const Real psi_r = boost::math::digamma(r, Policy());
+        const Real tri_r = boost::math::trigamma(r, Policy());
+        Real ll = 0;
+        Real g = 0;
+        Real h = 0;
+        for (const auto& e : s.histogram)
+        {
+            const Real c = static_cast<Real>(e.second);
+            const Real k = e.first;
+            ll += c * (boost::math::lgamma(k + r, Policy()) - lg_r - boost::math::lgamma(k + 1, Policy()));
+            g += c * (boost::math::digamma(k + r, Policy()) - psi_r);
+            h += c * (boost::math::trigamma(k + r, Policy()) - tri_r);
+        }
+        t.log_likelihood = ll + n * r * log(q) + sum * boost::math::log1p(-q, Policy());
+        t.gradient[0] = g + n * log(q);
+        t.gradient[1] = n * r / q - sum / (1 - q);
+        t.hessian[0][0] = h;
+        t.hessian[1][0] = n / q;
+        t.hessian[1][1] = -n * r / (q * q) - sum / ((1 - q) * (1 - q));
+    }
+
+    static negative_binomial_distribution<Real, Policy> make(const parameters& p)
+    {
+        return negative_binomial_distribution<Real, Policy>(p[0], p[1]);
+    }
+};
+
+// Weibull: sum(x^k log(x)^j) depends on the shape k, so each iteration is another pass over the data.
+// (shape, scale).
+template<class Real, class Policy>
+struct likelihood_model<weibull_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 2;
+    static constexpr bool needs_pass = true;
+    using parameters = std::array<Real, 2>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        mle_domain<Real> domain;
+        void operator()(Real x)
+        {
+            using std::log;
+            if (!mle_positive(x))
+            {
+                domain.reject(x);
+                return;
+            }
+            moments(log(x));
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "(0, inf)"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        using std::sqrt;
+        using std::exp;
+        const Real v = s.moments.variance();
+        if (!(v > 0))
+        {
+            throw std::domain_error(std::string(function) + ": the observations have no variance.");
+        }
+        // log(x) follows a Gumbel distribution with variance pi^2/(6k^2):
+        const Real k = constants::pi<Real>() / sqrt(6 * v);
+        return parameters{{k, exp(s.moments.mean + constants::euler<Real>() / k)}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[0]) && mle_positive(p[1]);
+    }
+
+    static void add_observation(const parameters& p, Real x, mle_terms<Real, 2>& t)
+    {
+        using std::log;
+        using std::exp;
+        const Real k = p[0];
+        const Real lambda = p[1];
+        const Real l = log(x / lambda);
+        const Real w = exp(k * l);
+        t.log_likelihood += (k - 1) * l - w;
+        t.gradient[0] += l - w * l;
+        t.gradient[1] += w;
+        t.hessian[0][0] -= w * l * l;
+        t.hessian[1][0] += w * (1 + k * l);
+        t.hessian[1][1] -= w;
+    }
+
+    static void add_constant_terms(const parameters& p, const summary& s, mle_terms<Real, 2>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real k = p[0];
+        const Real lambda = p[1];
+        // The passes accumulate sums of w = (x/lambda)^k and l = log(x/lambda) only:
+        const Real sum_w = t.gradient[1];
+        const Real sum_w_kl1 = t.hessian[1][0];
+        const Real sum_w_self = -t.hessian[1][1];
+        t.log_likelihood += n * (log(k) - log(lambda));
+        t.gradient[0] += n / k;
+        t.gradient[1] = k * (sum_w - n) / lambda;
+        t.hessian[0][0] -= n / (k * k);
+        t.hessian[1][0] = (sum_w_kl1 - n) / lambda;
+        t.hessian[1][1] = k * (n - (k + 1) * sum_w_self) / (lambda * lambda);
+    }
+
+    static weibull_distribution<Real, Policy> make(const parameters& p)
+    {
+        return weibull_distribution<Real, Policy>(p[0], p[1]);
+    }
+};
+
+// Student's t, which in this library is standardized: (degrees of freedom).
+template<class Real, class Policy>
+struct likelihood_model<students_t_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 1;
+    static constexpr bool needs_pass = true;
+    using parameters = std::array<Real, 1>;
+
+    struct summary
+    {
+        using value_type = Real;
+        mle_moments<Real> moments;
+        mle_domain<Real> domain;
+        void operator()(Real x)
+        {
+            using std::isfinite;
+            if (!isfinite(x))
+            {
+                domain.reject(x);
+                return;
+            }
+            moments(x);
+        }
+        void merge(const summary& b)
+        {
+            moments.merge(b.moments);
+            domain.merge(b.domain);
+        }
+    };
+
+    static const char* support() { return "(-inf, inf)"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        // The second moment about zero is v/(v-2) for v > 2, and the tails are heavier than any such
+        // data for v <= 2, so start from whichever is the better guide:
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real second = s.moments.m2 / n + s.moments.mean * s.moments.mean;
+        if (!(second > 0))
+        {
+            throw std::domain_error(std::string(function) + ": every observation is zero.");
+        }
+        return parameters{{second > 1 ? Real(2 * second / (second - 1)) : Real(1 / tools::root_epsilon<Real>())}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        return mle_positive(p[0]);
+    }
+
+    static void add_observation(const parameters& p, Real x, mle_terms<Real, 1>& t)
+    {
+        const Real v = p[0];
+        const Real x2 = x * x;
+        const Real w = x2 / (v + x2);
+        const Real l = boost::math::log1p(x2 / v, Policy());
+        // The passes accumulate sums of log(1 + x^2/v), w and w / (v + x^2) only:
+        t.log_likelihood += l;
+        t.gradient[0] += w;
+        t.hessian[0][0] += w / (v + x2);
+    }
+
+    static void add_constant_terms(const parameters& p, const summary& s, mle_terms<Real, 1>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real v = p[0];
+        const Real sum_l = t.log_likelihood;
+        const Real sum_w = t.gradient[0];
+        const Real sum_w2 = t.hessian[0][0];
+        t.log_likelihood = n * (boost::math::lgamma((v + 1) / 2, Policy()) - boost::math::lgamma(v / 2, Policy()) - log(v * constants::pi<Real>()) / 2)
+                         - (v + 1) * sum_l / 2;
+        t.gradient[0] = n * (boost::math::digamma((v + 1) / 2, Policy()) - boost::math::digamma(v / 2, Policy()) - 1 / v) / 2
+                      - sum_l / 2 + (v + 1) * sum_w / (2 * v);
+        t.hessian[0][0] = n * ((boost::math::trigamma((v + 1) / 2, Policy()) - boost::math::trigamma(v / 2, Policy())) / 4 + 1 / (2 * v * v))
+                        + sum_w / (2 * v) - sum_w / (2 * v * v) - (v + 1) * sum_w2 / (2 * v);
+    }
+
+    static students_t_distribution<Real, Policy> make(const parameters& p)
+    {
+        return students_t_distribution<Real, Policy>(p[0]);
+    }
+};
+
+// Skew normal: (location, scale, shape).  The information is singular at shape = 0, and the estimate
+// of the shape can diverge for small or nearly symmetric samples, in which case fit throws.
+template<class Real, class Policy>
+struct likelihood_model<skew_normal_distribution<Real, Policy>>
+{
+    using value_type = Real;
+    static constexpr std::size_t parameter_count = 3;
+    static constexpr bool needs_pass = true;
+    using parameters = std::array<Real, 3>;
+    using summary = typename likelihood_model<normal_distribution<Real, Policy>>::summary;
+
+    static const char* support() { return "(-inf, inf)"; }
+
+    static parameters start(const summary& s, const char* function)
+    {
+        using std::sqrt;
+        using std::pow;
+        using std::fabs;
+        using std::copysign;
+        const Real v = s.moments.variance();
+        if (!(v > 0))
+        {
+            throw std::domain_error(std::string(function) + ": the observations have no variance.");
+        }
+        // The method of moments, with the skewness kept inside the range the family can reach:
+        const Real pi = constants::pi<Real>();
+        const Real max_skew = Real(0.99527);
+        Real g = s.moments.skewness();
+        g = (std::max)(Real(-0.9 * max_skew), (std::min)(Real(0.9 * max_skew), g));
+        const Real g23 = pow(fabs(g), Real(2) / 3);
+        const Real delta = copysign(sqrt(pi / 2 * g23 / (g23 + pow((4 - pi) / 2, Real(2) / 3))), g);
+        const Real omega = sqrt(v / (1 - 2 * delta * delta / pi));
+        const Real xi = s.moments.mean - omega * delta * sqrt(2 / pi);
+        return parameters{{xi, omega, delta / sqrt(1 - delta * delta)}};
+    }
+
+    static bool feasible(const parameters& p)
+    {
+        using std::isfinite;
+        return isfinite(p[0]) && mle_positive(p[1]) && isfinite(p[2]);
+    }
+
+    // phi(u)/Phi(u), the derivative of log(Phi(u)):
+    static Real mills(Real u)
+    {
+        using std::exp;
+        if (u < -30)
+        {
+            const Real r = 1 / (u * u);
+            return -u / (1 - r * (1 - 3 * r * (1 - 5 * r)));
+        }
+        return exp(-u * u / 2) / (constants::root_two_pi<Real>() * boost::math::erfc(-u * constants::one_div_root_two<Real>(), Policy()) / 2);
+    }
+
+    static void add_observation(const parameters& p, Real x, mle_terms<Real, 3>& t)
+    {
+        const Real omega = p[1];
+        const Real alpha = p[2];
+        const Real z = (x - p[0]) / omega;
+        const Real u = alpha * z;
+        const Real z1 = mills(u);
+        const Real z2 = -z1 * (u + z1);
+        const Real o2 = omega * omega;
+        t.log_likelihood += logcdf(normal_distribution<Real, Policy>(), u) - z * z / 2;
+        t.gradient[0] += (z - alpha * z1) / omega;
+        t.gradient[1] += (z * z - u * z1) / omega;
+        t.gradient[2] += z * z1;
+        t.hessian[0][0] += (alpha * alpha * z2 - 1) / o2;
+        t.hessian[1][0] += (alpha * z1 + alpha * alpha * z * z2 - 2 * z) / o2;
+        t.hessian[1][1] += (2 * u * z1 + u * u * z2 - 3 * z * z) / o2;
+        t.hessian[2][0] -= (z1 + u * z2) / omega;
+        t.hessian[2][1] -= z * (z1 + u * z2) / omega;
+        t.hessian[2][2] += z * z * z2;
+    }
+
+    static void add_constant_terms(const parameters& p, const summary& s, mle_terms<Real, 3>& t)
+    {
+        using std::log;
+        const Real n = static_cast<Real>(s.moments.n);
+        const Real omega = p[1];
+        t.log_likelihood += n * (constants::ln_two<Real>() - constants::log_root_two_pi<Real>() - log(omega));
+        t.gradient[1] -= n / omega;
+        t.hessian[1][1] += n / (omega * omega);
+    }
+
+    static skew_normal_distribution<Real, Policy> make(const parameters& p)
+    {
+        return skew_normal_distribution<Real, Policy>(p[0], p[1], p[2]);
+    }
+};
+
+template<class Dist, class ForwardIterator>
+inline auto fit_dispatch(ForwardIterator first, ForwardIterator last, bool parallel)
+{
+    return fit_impl<Dist, likelihood_model<Dist>>(first, last, parallel);
+}
+
+} // namespace detail
+
+template<class Dist, std::size_t N>
+Dist fit_result<Dist, N>::distribution() const
+{
+    return detail::likelihood_model<Dist>::make(parameters);
+}
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Dist, class ExecutionPolicy, class ForwardIterator>
+inline auto fit(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last)
+{
+    constexpr bool parallel = !std::is_same<std::remove_cv_t<std::remove_reference_t<ExecutionPolicy>>, std::remove_cv_t<decltype(std::execution::seq)>>::value;
+    (void)exec;
+    return detail::fit_dispatch<Dist>(first, last, parallel);
+}
+
+template<class Dist, class ExecutionPolicy, class Container>
+inline auto fit(ExecutionPolicy&& exec, Container const & v)
+{
+    return fit<Dist>(exec, std::cbegin(v), std::cend(v));
+}
+
+#endif
+
+template<class Dist, class ForwardIterator>
+inline auto fit(ForwardIterator first, ForwardIterator last)
+{
+    return detail::fit_dispatch<Dist>(first, last, false);
+}
+
+template<class Dist, class Container>
+inline auto fit(Container const & v)
+{
+    return detail::fit_dispatch<Dist>(std::cbegin(v), std::cend(v), false);
+}
+
+}}} // namespaces
+
+#endif
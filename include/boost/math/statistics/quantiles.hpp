@@ -0,0 +1,771 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_QUANTILES_HPP
+#define BOOST_MATH_STATISTICS_QUANTILES_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/statistics/detail/batch.hpp>
+#include <boost/math/statistics/detail/philox.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// Many quantiles of a sample at once, without sorting it and without modifying it.
+//
+// quantiles is exact.  The order statistics it needs are bracketed by the order statistics of a random
+// sample, as in the select of Floyd and Rivest, and one pass over the data, run in chunks in parallel,
+// counts the values below each bracket and copies those inside it.  The brackets hold a small fraction
+// of the data, and multiselect finds every order statistic of a bracket in one recursive partition.
+// A bracket which misses its order statistic, which is rare, costs a second pass over the data.
+//
+// approximate_quantiles, for float and double, copies nothing: it histograms 11 bits of the sortable
+// integer keys of the values at a time, in three passes which each refine only the buckets holding the
+// order statistics.  That is every bit of a float, and all but the last 31 bits of a double.
+//
+
+namespace boost { namespace math { namespace statistics {
+
+namespace detail {
+
+template<class T>
+using quantiles_real_t = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+template<class Container>
+using quantiles_value_t = typename std::iterator_traits<decltype(std::cbegin(std::declval<const Container&>()))>::value_type;
+
+// Samples this small are copied and selected from directly:
+constexpr std::size_t quantiles_copy_limit = 65536;
+
+//
+// Rearranges [first, last) so that the element at each of the sorted, distinct ranks is the one a sort would
+// put there, with the elements before it no greater and those after it no less.  The ranks are counted from
+// offset, the rank of *first.  Selecting the middle rank first halves the ranks left on each side, so m ranks
+// of n elements cost O(n log m) rather than the O(n m) of m calls to nth_element.
+//
+template<class RandomAccessIterator>
+void multiselect(RandomAccessIterator first, RandomAccessIterator last, std::size_t offset, const std::size_t* rank_first, const std::size_t* rank_last)
+{
+    while (rank_first != rank_last)
+    {
+        if (last - first <= 16)
+        {
+            std::sort(first, last);
+            return;
+        }
+        const std::size_t* middle = rank_first + (rank_last - rank_first)/2;
+        const RandomAccessIterator nth = first + static_cast<std::ptrdiff_t>(*middle - offset);
+        std::nth_element(first, nth, last);
+        multiselect(first, nth, offset, rank_first, middle);
+        first = nth + 1;
+        offset = *middle + 1;
+        rank_first = middle + 1;
+    }
+}
+
+template<class Real>
+void check_probabilities(const std::vector<Real>& p)
+{
+    for (auto q : p)
+    {
+        if (!(q >= 0 && q <= 1))
+        {
+            throw std::domain_error("The quantile must be in [0, 1].");
+        }
+    }
+}
+
+// The sorted, distinct ranks of the order statistics that the quantiles of type 7 of Hyndman and Fan need:
+template<class Real>
+std::vector<std::size_t> quantile_ranks(const std::vector<Real>& p, std::size_t n)
+{
+    using std::floor;
+    std::vector<std::size_t> ranks;
+    ranks.reserve(2*p.size());
+    for (auto q : p)
+    {
+        const Real h = q*static_cast<Real>(n - 1);
+        const std::size_t k = (std::min)(static_cast<std::size_t>(floor(h)), n - 1);
+        ranks.push_back(k);
+        if (k + 1 < n)
+        {
+            ranks.push_back(k + 1);
+        }
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    return ranks;
+}
+
+// Q(p) = x_(k) + (h - k)(x_(k+1) - x_(k)), h = (n - 1)p, k = floor(h), from the order statistics at the ranks:
+template<class Result, class Real, class T>
+std::vector<Result> interpolate_quantiles(const std::vector<Real>& p, std::size_t n, const std::vector<std::size_t>& ranks, const std::vector<T>& order_statistics)
+{
+    using std::floor;
+    auto at = [&](std::size_t k)
+    {
+        return static_cast<Result>(order_statistics[static_cast<std::size_t>(std::lower_bound(ranks.begin(), ranks.end(), k) - ranks.begin())]);
+    };
+    std::vector<Result> result;
+    result.reserve(p.size());
+    for (auto q : p)
+    {
+        const Result h = static_cast<Result>(q)*static_cast<Result>(n - 1);
+        const std::size_t k = (std::min)(static_cast<std::size_t>(floor(h)), n - 1);
+        const Result lower = at(k);
+        if (k + 1 == n || h == static_cast<Result>(k))
+        {
+            result.push_back(lower);
+        }
+        else
+        {
+            result.push_back(lower + (h - static_cast<Result>(k))*(at(k + 1) - lower));
+        }
+    }
+    return result;
+}
+
+// The values between two order statistics of the random sample, or beyond one of them:
+template<class T>
+struct quantile_bracket
+{
+    T lower;
+    T upper;
+    bool has_lower;
+    bool has_upper;
+    bool open;
+
+    // Evaluated in full, without the branches of && and ||, which a random order of values mispredicts:
+    bool below(const T& x) const
+    {
+        return has_upper & (open ? !(x < upper) : upper < x);
+    }
+
+    bool contains(const T& x) const
+    {
+        return !has_lower || (open ? lower < x : !(x < lower));
+    }
+};
+
+template<class T>
+struct bracket_counts
+{
+    std::vector<std::size_t> gaps;            // The values before each bracket, and after the last, outside any bracket.
+    std::vector<std::vector<T>> candidates;   // The values in each bracket.
+};
+
+// One pass over [first, last): the brackets are sorted and disjoint.
+template<class T, class ForwardIterator>
+bracket_counts<T> count_brackets(ForwardIterator first, ForwardIterator last, const std::vector<quantile_bracket<T>>& brackets)
+{
+    bracket_counts<T> result;
+    result.gaps.assign(brackets.size() + 1, 0);
+    result.candidates.resize(brackets.size());
+    const auto b_first = brackets.begin();
+    const auto b_last = brackets.end();
+    for (; first != last; ++first)
+    {
+        const T& x = *first;
+        std::size_t j = 0;
+        if (brackets.size() <= 8)
+        {
+            // The brackets below x are a prefix, so their number is its end:
+            for (const auto& bracket : brackets)
+            {
+                j += bracket.below(x);
+            }
+        }
+        else
+        {
+            j = static_cast<std::size_t>(std::partition_point(b_first, b_last, [&x](const quantile_bracket<T>& bracket) { return bracket.below(x); }) - b_first);
+        }
+        if (j < brackets.size() && brackets[j].contains(x))
+        {
+            result.candidates[j].push_back(x);
+        }
+        else
+        {
+            ++result.gaps[j];
+        }
+    }
+    return result;
+}
+
+template<class T>
+bracket_counts<T> merge_bracket_counts(std::vector<bracket_counts<T>>&& parts)
+{
+    bracket_counts<T> result = std::move(parts.front());
+    for (std::size_t c = 1; c < parts.size(); ++c)
+    {
+        for (std::size_t j = 0; j < result.gaps.size(); ++j)
+        {
+            result.gaps[j] += parts[c].gaps[j];
+        }
+        for (std::size_t j = 0; j < result.candidates.size(); ++j)
+        {
+            result.candidates[j].insert(result.candidates[j].end(), parts[c].candidates[j].begin(), parts[c].candidates[j].end());
+        }
+    }
+    return result;
+}
+
+// The order statistics at the ranks, of the candidates of brackets which start after `below` smaller values:
+template<class T>
+void select_in_brackets(bracket_counts<T>& counts, const std::vector<std::size_t>& below, const std::vector<std::size_t>& ranks,
+                        const std::vector<std::size_t>& bracket_of, std::vector<T>& order_statistics)
+{
+    std::size_t i = 0;
+    while (i < ranks.size())
+    {
+        const std::size_t j = bracket_of[i];
+        std::size_t end = i;
+        std::vector<std::size_t> local;
+        while (end < ranks.size() && bracket_of[end] == j)
+        {
+            local.push_back(ranks[end] - below[j]);
+            ++end;
+        }
+        auto& c = counts.candidates[j];
+        multiselect(c.begin(), c.end(), 0, local.data(), local.data() + local.size());
+        for (std::size_t k = 0; k < local.size(); ++k)
+        {
+            order_statistics[i + k] = c[local[k]];
+        }
+        i = end;
+    }
+}
+
+inline std::size_t quantile_sample_size(std::size_t n)
+{
+    using std::cbrt;
+    const double cube_root = cbrt(static_cast<double>(n));
+    return (std::min)(n, (std::max)(std::size_t(1) << 12, (std::min)(std::size_t(1) << 20, static_cast<std::size_t>(cube_root*cube_root))));
+}
+
+// The sorted values at random indices, the same for every call:
+template<class T, class RandomAccessIterator>
+std::vector<T> quantile_sample(RandomAccessIterator first, std::size_t n, std::size_t s)
+{
+    philox4x32 gen(0, 0);
+    std::vector<T> sample(s);
+    for (auto& x : sample)
+    {
+        x = first[static_cast<std::ptrdiff_t>(uniform_index(gen, n))];
+    }
+    std::sort(sample.begin(), sample.end());
+    return sample;
+}
+
+//
+// The order statistics at the sorted, distinct ranks.  map(kernel) returns kernel(chunk_first, chunk_last)
+// for chunks of the data, in order.  The sample is n^(2/3) values, between 2^12 and 2^20, and the bracket of
+// x_(k) is 4 standard deviations of the sample quantile either side of k/n, so it misses with probability
+// about 6e-5, and holds about 8 n sqrt(q(1 - q)/s) values.
+//
+template<class T, class RandomAccessIterator, class Map>
+std::vector<T> order_statistics(RandomAccessIterator first, std::size_t n, const std::vector<std::size_t>& ranks, Map map)
+{
+    using std::sqrt;
+    std::vector<T> result(ranks.size());
+    if (n <= quantiles_copy_limit)
+    {
+        std::vector<T> copy(first, first + static_cast<std::ptrdiff_t>(n));
+        multiselect(copy.begin(), copy.end(), 0, ranks.data(), ranks.data() + ranks.size());
+        for (std::size_t i = 0; i < ranks.size(); ++i)
+        {
+            result[i] = copy[ranks[i]];
+        }
+        return result;
+    }
+
+    const std::size_t s = quantile_sample_size(n);
+    const auto sample = quantile_sample<T>(first, n, s);
+
+    // The brackets of the ranks, merged where they overlap:
+    std::vector<quantile_bracket<T>> raw;
+    for (auto k : ranks)
+    {
+        const double q = (static_cast<double>(k) + 0.5)/static_cast<double>(n);
+        const double t = q*static_cast<double>(s);
+        const double d = 4*sqrt(static_cast<double>(s)*q*(1 - q)) + 2;
+        const bool has_lower = t - d >= 0;
+        const bool has_upper = t + d < static_cast<double>(s - 1);
+        raw.push_back(quantile_bracket<T>{has_lower ? sample[static_cast<std::size_t>(t - d)] : T(0),
+                                          has_upper ? sample[static_cast<std::size_t>(t + d) + 1] : T(0), has_lower, has_upper, false});
+    }
+    std::sort(raw.begin(), raw.end(), [](const quantile_bracket<T>& a, const quantile_bracket<T>& b)
+    {
+        return a.has_lower && b.has_lower ? a.lower < b.lower : !a.has_lower && b.has_lower;
+    });
+    std::vector<quantile_bracket<T>> brackets;
+    for (const auto& b : raw)
+    {
+        auto* last = brackets.empty() ? nullptr : &brackets.back();
+        if (last && (!last->has_upper || !b.has_lower || !(last->upper < b.lower)))
+        {
+            if (last->has_upper && (!b.has_upper || last->upper < b.upper))
+            {
+                last->upper = b.upper;
+                last->has_upper = b.has_upper;
+            }
+        }
+        else
+        {
+            brackets.push_back(b);
+        }
+    }
+
+    auto counts = map([&brackets](RandomAccessIterator a, RandomAccessIterator b) { return count_brackets<T>(a, b, brackets); });
+    auto merged = merge_bracket_counts(std::move(counts));
+
+    // The values below each bracket, and those up to its end:
+    std::vector<std::size_t> below(brackets.size());
+    std::vector<std::size_t> through(brackets.size());
+    std::size_t running = 0;
+    for (std::size_t j = 0; j < brackets.size(); ++j)
+    {
+        running += merged.gaps[j];
+        below[j] = running;
+        running += merged.candidates[j].size();
+        through[j] = running;
+    }
+
+    // Where the counts put each order statistic, which is usually in its own bracket:
+    std::vector<std::size_t> hit_ranks;
+    std::vector<std::size_t> hit_brackets;
+    std::vector<std::size_t> hit_index;
+    std::vector<std::size_t> missed;
+    std::vector<std::size_t> missed_gaps;
+    for (std::size_t i = 0; i < ranks.size(); ++i)
+    {
+        const std::size_t g = static_cast<std::size_t>(std::upper_bound(below.begin(), below.end(), ranks[i]) - below.begin());
+        if (g > 0 && ranks[i] < through[g - 1])
+        {
+            hit_ranks.push_back(ranks[i]);
+            hit_brackets.push_back(g - 1);
+            hit_index.push_back(i);
+        }
+        else
+        {
+            missed.push_back(i);
+            missed_gaps.push_back(g);
+        }
+    }
+    std::vector<T> hits(hit_ranks.size());
+    select_in_brackets(merged, below, hit_ranks, hit_brackets, hits);
+    for (std::size_t k = 0; k < hits.size(); ++k)
+    {
+        result[hit_index[k]] = hits[k];
+    }
+    if (missed.empty())
+    {
+        return result;
+    }
+
+    // The others are in the gaps between the brackets, which a second pass selects from:
+    std::vector<quantile_bracket<T>> gaps;
+    std::vector<std::size_t> gap_below;
+    std::vector<std::size_t> gap_of(missed.size());
+    std::vector<std::size_t> missed_ranks(missed.size());
+    for (std::size_t m = 0; m < missed.size(); ++m)
+    {
+        const std::size_t g = missed_gaps[m];
+        if (m == 0 || g != missed_gaps[m - 1])
+        {
+            gaps.push_back(quantile_bracket<T>{g > 0 ? brackets[g - 1].upper : T(0), g < brackets.size() ? brackets[g].lower : T(0),
+                                               g > 0 && brackets[g - 1].has_upper, g < brackets.size() && brackets[g].has_lower, true});
+            gap_below.push_back(g > 0 ? through[g - 1] : 0);
+        }
+        gap_of[m] = gaps.size() - 1;
+        missed_ranks[m] = ranks[missed[m]];
+    }
+    auto gap_counts = map([&gaps](RandomAccessIterator a, RandomAccessIterator b) { return count_brackets<T>(a, b, gaps); });
+    auto merged_gaps = merge_bracket_counts(std::move(gap_counts));
+    std::vector<T> misses(missed.size());
+    select_in_brackets(merged_gaps, gap_below, missed_ranks, gap_of, misses);
+    for (std::size_t m = 0; m < missed.size(); ++m)
+    {
+        result[missed[m]] = misses[m];
+    }
+    return result;
+}
+
+// The unsigned integers whose order is that of the floating point values, negative values having every bit flipped:
+template<class Real>
+struct sortable_key
+{
+    static_assert(std::is_same<Real, float>::value || std::is_same<Real, double>::value, "approximate_quantiles needs float or double data.");
+    using type = typename std::conditional<std::is_same<Real, float>::value, std::uint32_t, std::uint64_t>::type;
+    static constexpr int bits = std::numeric_limits<type>::digits;
+    static constexpr type sign = type(1) << (bits - 1);
+
+    static type key(Real x) noexcept
+    {
+        type u;
+        std::memcpy(&u, &x, sizeof(u));
+        return (u & sign) ? type(~u) : type(u | sign);
+    }
+
+    static Real value(type k) noexcept
+    {
+        const type u = (k & sign) ? type(k ^ sign) : type(~k);
+        Real x;
+        std::memcpy(&x, &u, sizeof(x));
+        return x;
+    }
+};
+
+constexpr int radix_digit_bits = 11;
+constexpr int radix_passes = 3;
+
+template<class Key>
+struct radix_counts
+{
+    std::vector<std::size_t> counts;
+    std::vector<Key> lowest;     // The least and greatest keys in each bucket, in the last pass of a double.
+    std::vector<Key> highest;
+};
+
+//
+// The slot of each of the sorted prefixes of a pass, found from 11 bits of the key at a time, each level of the
+// lookup being tables of 2048 entries.  Every other prefix leads to the slot after the last, whose counts are
+// discarded, so a value is counted without a branch: whether its prefix is wanted is unpredictable.
+//
+template<class Key>
+struct prefix_slots
+{
+    int levels;
+    std::vector<std::uint32_t> entries;
+
+    prefix_slots(const std::vector<Key>& prefixes, int levels_) : levels(levels_)
+    {
+        const std::size_t size = std::size_t(1) << radix_digit_bits;
+        const std::uint32_t discard = static_cast<std::uint32_t>(prefixes.size());
+        // Node l, for l < levels, leads every digit to the discarded slot through node l + 1; the root follows them:
+        for (int l = 0; l < levels; ++l)
+        {
+            entries.insert(entries.end(), size, l + 1 < levels ? static_cast<std::uint32_t>(l + 1) : discard);
+        }
+        const std::uint32_t root = add_node(fill_of_level(0, discard));
+        for (std::size_t slot = 0; slot < prefixes.size(); ++slot)
+        {
+            std::uint32_t node = root;
+            for (int l = 0; l < levels; ++l)
+            {
+                const std::size_t digit = static_cast<std::size_t>(prefixes[slot] >> (radix_digit_bits*(levels - 1 - l))) & (size - 1);
+                const std::size_t entry = node*size + digit;
+                if (l + 1 == levels)
+                {
+                    entries[entry] = static_cast<std::uint32_t>(slot);
+                }
+                else
+                {
+                    if (entries[entry] == static_cast<std::uint32_t>(l + 1))
+                    {
+                        const std::uint32_t child = add_node(fill_of_level(l + 1, discard));
+                        entries[entry] = child;
+                    }
+                    node = entries[entry];
+                }
+            }
+        }
+        m_root = root;
+    }
+
+    std::uint32_t slot(Key k, int key_bits) const noexcept
+    {
+        const Key mask = (Key(1) << radix_digit_bits) - 1;
+        std::uint32_t node = m_root;
+        for (int l = 0; l < levels; ++l)
+        {
+            node = entries[(static_cast<std::size_t>(node) << radix_digit_bits) + static_cast<std::size_t>((k >> (key_bits - radix_digit_bits*(l + 1))) & mask)];
+        }
+        return node;
+    }
+
+private:
+    // The entry that a new node at level l gives every digit:
+    std::uint32_t fill_of_level(int l, std::uint32_t discard) const noexcept
+    {
+        return l + 1 < levels ? static_cast<std::uint32_t>(l + 1) : discard;
+    }
+
+    std::uint32_t add_node(std::uint32_t fill)
+    {
+        const std::size_t size = std::size_t(1) << radix_digit_bits;
+        entries.insert(entries.end(), size, fill);
+        return static_cast<std::uint32_t>(entries.size()/size - 1);
+    }
+
+    std::uint32_t m_root = 0;
+};
+
+// For pass `pass`, the counts of the digits following each of the sorted prefixes, side by side:
+template<class Real, class ForwardIterator>
+radix_counts<typename sortable_key<Real>::type> radix_histogram(ForwardIterator first, ForwardIterator last, int pass,
+                                                               const prefix_slots<typename sortable_key<Real>::type>& slots, std::size_t prefixes)
+{
+    using key = sortable_key<Real>;
+    using type = typename key::type;
+    const int known = radix_digit_bits*pass;
+    const int width = (std::min)(radix_digit_bits, key::bits - known);
+    const int shift = key::bits - known - width;
+    const type mask = (type(1) << width) - 1;
+    const bool extremes = pass + 1 == radix_passes && shift > 0;
+    radix_counts<type> result;
+    result.counts.assign((prefixes + 1) << width, 0);
+    if (extremes)
+    {
+        result.lowest.assign(result.counts.size(), (std::numeric_limits<type>::max)());
+        result.highest.assign(result.counts.size(), 0);
+    }
+    if (pass == 0)
+    {
+        for (; first != last; ++first)
+        {
+            ++result.counts[static_cast<std::size_t>(key::key(*first) >> shift)];
+        }
+        return result;
+    }
+    for (; first != last; ++first)
+    {
+        const type k = key::key(*first);
+        const std::size_t i = (static_cast<std::size_t>(slots.slot(k, key::bits)) << width) + static_cast<std::size_t>((k >> shift) & mask);
+        ++result.counts[i];
+        if (extremes)
+        {
+            result.lowest[i] = (std::min)(result.lowest[i], k);
+            result.highest[i] = (std::max)(result.highest[i], k);
+        }
+    }
+    return result;
+}
+
+template<class Key>
+radix_counts<Key> merge_radix_counts(std::vector<radix_counts<Key>>&& parts)
+{
+    radix_counts<Key> result = std::move(parts.front());
+    for (std::size_t c = 1; c < parts.size(); ++c)
+    {
+        for (std::size_t i = 0; i < result.counts.size(); ++i)
+        {
+            result.counts[i] += parts[c].counts[i];
+        }
+        for (std::size_t i = 0; i < result.lowest.size(); ++i)
+        {
+            result.lowest[i] = (std::min)(result.lowest[i], parts[c].lowest[i]);
+            result.highest[i] = (std::max)(result.highest[i], parts[c].highest[i]);
+        }
+    }
+    return result;
+}
+
+//
+// The order statistics at the ranks.  The keys of a float are found whole.  Those of a double are found to 33
+// bits: the sign, the exponent and 21 bits of the significand.  The last pass also finds the least and greatest
+// key in each bucket, which is the order statistic when it is the first or last in its bucket, or when the
+// bucket holds copies of one value; otherwise the middle of the bucket, clamped to these, is within 2^-22 of
+// it, relatively, for normal numbers.  map(kernel) is as for order_statistics.
+//
+template<class Real, class Map>
+std::vector<Real> approximate_order_statistics(const std::vector<std::size_t>& ranks, Map map)
+{
+    using key = sortable_key<Real>;
+    using type = typename key::type;
+    std::vector<type> prefix(ranks.size(), 0);
+    std::vector<std::size_t> within(ranks.begin(), ranks.end());
+    std::vector<std::size_t> bucket(ranks.size(), 0);
+    radix_counts<type> counts;
+    int known = 0;
+    for (int pass = 0; pass < radix_passes; ++pass)
+    {
+        const int width = (std::min)(radix_digit_bits, key::bits - known);
+        std::vector<type> prefixes(prefix);
+        std::sort(prefixes.begin(), prefixes.end());
+        prefixes.erase(std::unique(prefixes.begin(), prefixes.end()), prefixes.end());
+        const prefix_slots<type> slots(prefixes, pass);
+        counts = merge_radix_counts(map([&](auto a, auto b) { return radix_histogram<Real>(a, b, pass, slots, prefixes.size()); }));
+        for (std::size_t i = 0; i < ranks.size(); ++i)
+        {
+            const std::size_t slot = static_cast<std::size_t>(std::lower_bound(prefixes.begin(), prefixes.end(), prefix[i]) - prefixes.begin());
+            std::size_t b = slot << width;
+            while (within[i] >= counts.counts[b])
+            {
+                within[i] -= counts.counts[b];
+                ++b;
+            }
+            bucket[i] = b;
+            prefix[i] = type((prefix[i] << width) | type(b - (slot << width)));
+        }
+        known += width;
+    }
+    std::vector<Real> result(ranks.size());
+    const int rest = key::bits - known;
+    for (std::size_t i = 0; i < ranks.size(); ++i)
+    {
+        if (rest == 0)
+        {
+            result[i] = key::value(prefix[i]);
+            continue;
+        }
+        const type lowest = counts.lowest[bucket[i]];
+        const type highest = counts.highest[bucket[i]];
+        if (within[i] == 0)
+        {
+            result[i] = key::value(lowest);
+        }
+        else if (within[i] + 1 == counts.counts[bucket[i]])
+        {
+            result[i] = key::value(highest);
+        }
+        else
+        {
+            const type middle = type((prefix[i] << rest) | (type(1) << (rest - 1)));
+            result[i] = key::value((std::min)((std::max)(middle, lowest), highest));
+        }
+    }
+    return result;
+}
+
+template<class Real, class Container>
+std::size_t quantiles_size(const Container& v)
+{
+    const std::size_t n = static_cast<std::size_t>(std::distance(std::cbegin(v), std::cend(v)));
+    if (n == 0)
+    {
+        throw std::domain_error("At least one sample is required to compute quantiles.");
+    }
+    return n;
+}
+
+struct quantiles_tag {};
+struct approximate_quantiles_tag {};
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Tag, class T, class ExecutionPolicy, class Iterator>
+struct quantiles_map
+{
+    ExecutionPolicy& exec;
+    Iterator first;
+    std::size_t n;
+
+    template<class Kernel>
+    auto operator()(Kernel kernel) const
+    {
+        return map_chunks<Tag, T>(exec, first, n, kernel);
+    }
+};
+
+#else
+
+template<class Iterator>
+struct quantiles_map
+{
+    Iterator first;
+    std::size_t n;
+
+    template<class Kernel>
+    auto operator()(Kernel kernel) const -> std::vector<decltype(kernel(first, first))>
+    {
+        return std::vector<decltype(kernel(first, first))>(1, kernel(first, std::next(first, n)));
+    }
+};
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+} // namespace detail
+
+//
+// The quantiles of type 7 of Hyndman and Fan, the default of R and NumPy, of v at each of the probabilities
+// in [0, 1], in their order.  v is not modified, and need not be sorted.  Integer data gives double results.
+//
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class ExecutionPolicy, class RandomAccessContainer, class Probabilities>
+auto quantiles(ExecutionPolicy&& exec, const RandomAccessContainer& v, const Probabilities& probabilities)
+{
+    using T = detail::quantiles_value_t<RandomAccessContainer>;
+    using Real = detail::quantiles_real_t<T>;
+    const std::size_t n = detail::quantiles_size<Real>(v);
+    const std::vector<Real> p(std::cbegin(probabilities), std::cend(probabilities));
+    detail::check_probabilities(p);
+    const auto ranks = detail::quantile_ranks(p, n);
+    using iterator = decltype(std::cbegin(v));
+    const auto x = detail::order_statistics<T>(std::cbegin(v), n, ranks, detail::quantiles_map<detail::quantiles_tag, T, ExecutionPolicy, iterator>{exec, std::cbegin(v), n});
+    return detail::interpolate_quantiles<Real>(p, n, ranks, x);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, class Probabilities>
+auto approximate_quantiles(ExecutionPolicy&& exec, const RandomAccessContainer& v, const Probabilities& probabilities)
+{
+    using Real = detail::quantiles_value_t<RandomAccessContainer>;
+    const std::size_t n = detail::quantiles_size<Real>(v);
+    const std::vector<Real> p(std::cbegin(probabilities), std::cend(probabilities));
+    detail::check_probabilities(p);
+    const auto ranks = detail::quantile_ranks(p, n);
+    using iterator = decltype(std::cbegin(v));
+    const auto x = detail::approximate_order_statistics<Real>(ranks, detail::quantiles_map<detail::approximate_quantiles_tag, Real, ExecutionPolicy, iterator>{exec, std::cbegin(v), n});
+    return detail::interpolate_quantiles<Real>(p, n, ranks, x);
+}
+
+template<class RandomAccessContainer, class Probabilities>
+inline auto quantiles(const RandomAccessContainer& v, const Probabilities& probabilities)
+{
+    return quantiles(std::execution::seq, v, probabilities);
+}
+
+template<class RandomAccessContainer, class Probabilities>
+inline auto approximate_quantiles(const RandomAccessContainer& v, const Probabilities& probabilities)
+{
+    return approximate_quantiles(std::execution::seq, v, probabilities);
+}
+
+#else // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class RandomAccessContainer, class Probabilities>
+auto quantiles(const RandomAccessContainer& v, const Probabilities& probabilities)
+{
+    using T = detail::quantiles_value_t<RandomAccessContainer>;
+    using Real = detail::quantiles_real_t<T>;
+    const std::size_t n = detail::quantiles_size<Real>(v);
+    const std::vector<Real> p(std::cbegin(probabilities), std::cend(probabilities));
+    detail::check_probabilities(p);
+    const auto ranks = detail::quantile_ranks(p, n);
+    using iterator = decltype(std::cbegin(v));
+    const auto x = detail::order_statistics<T>(std::cbegin(v), n, ranks, detail::quantiles_map<iterator>{std::cbegin(v), n});
+    return detail::interpolate_quantiles<Real>(p, n, ranks, x);
+}
+
+template<class RandomAccessContainer, class Probabilities>
+auto approximate_quantiles(const RandomAccessContainer& v, const Probabilities& probabilities)
+{
+    using Real = detail::quantiles_value_t<RandomAccessContainer>;
+    const std::size_t n = detail::quantiles_size<Real>(v);
+    const std::vector<Real> p(std::cbegin(probabilities), std::cend(probabilities));
+    detail::check_probabilities(p);
+    const auto ranks = detail::quantile_ranks(p, n);
+    using iterator = decltype(std::cbegin(v));
+    const auto x = detail::approximate_order_statistics<Real>(ranks, detail::quantiles_map<iterator>{std::cbegin(v), n});
+    return detail::interpolate_quantiles<Real>(p, n, ranks, x);
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_QUANTILES_HPP
@@ -0,0 +1,603 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_RANK_CORRELATION_HPP
+#define BOOST_MATH_STATISTICS_RANK_CORRELATION_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/statistics/detail/rank.hpp>
+#include <boost/math/statistics/detail/batch.hpp>
+#include <boost/math/statistics/chatterjee_correlation.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// Spearman's rho and Kendall's tau-b of a pair of samples, and the matrices of them, and of Chatterjee's
+// xi, for every pair of a set of columns.  The matrices rank each column once, then compute the pairs in
+// chunks on the thread pool; each entry is the same as for the pair alone, however the chunks are run.
+//
+
+namespace boost { namespace math { namespace statistics {
+
+namespace detail {
+
+template<class T>
+using rank_correlation_real_t = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+// The ranks of a column, with the positions sorted by them:
+struct column_ranks
+{
+    std::vector<std::size_t> rank;   // Dense, from 0: equal values share a rank.
+    std::vector<std::size_t> start;  // start[r] is the number of values ranked below r, and start.back() the number of values.
+    std::vector<std::size_t> order;  // The positions in increasing order of the values, ties in order of position.
+    std::uint64_t tied_pairs = 0;    // The number of pairs of equal values.
+};
+
+template<class ForwardIterator>
+column_ranks rank_column(ForwardIterator first, ForwardIterator last)
+{
+    column_ranks c;
+    c.rank = dense_rank(first, last);
+    const std::size_t n = c.rank.size();
+    std::size_t distinct = 0;
+    for (std::size_t r : c.rank)
+    {
+        distinct = (std::max)(distinct, r + 1);
+    }
+    c.start.assign(distinct + 1, 0);
+    for (std::size_t r : c.rank)
+    {
+        ++c.start[r + 1];
+    }
+    for (std::size_t r = 0; r < distinct; ++r)
+    {
+        const std::uint64_t t = c.start[r + 1];
+        c.tied_pairs += t*(t - 1)/2;
+        c.start[r + 1] += c.start[r];
+    }
+    // A counting sort by rank, stable so that ties stay in order of position:
+    std::vector<std::size_t> next(c.start.begin(), c.start.end() - 1);
+    c.order.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        c.order[next[c.rank[i]]++] = i;
+    }
+    return c;
+}
+
+struct rank_workspace {};
+
+struct rank_columns_kernel
+{
+    template<class ForwardIterator>
+    column_ranks operator()(rank_workspace&, ForwardIterator first, ForwardIterator last) const
+    {
+        return rank_column(first, last);
+    }
+};
+
+template<class Container>
+void check_columns(const Container& columns)
+{
+    auto it = std::cbegin(columns);
+    if (it == std::cend(columns))
+    {
+        return;
+    }
+    const auto n = std::distance(std::cbegin(*it), std::cend(*it));
+    for (; it != std::cend(columns); ++it)
+    {
+        if (std::distance(std::cbegin(*it), std::cend(*it)) != n)
+        {
+            throw std::domain_error("All the columns must be of the same length.");
+        }
+    }
+}
+
+template<class ForwardIterator>
+void check_pair(ForwardIterator u_first, ForwardIterator u_last, ForwardIterator v_first, ForwardIterator v_last)
+{
+    if (std::distance(u_first, u_last) != std::distance(v_first, v_last))
+    {
+        throw std::domain_error("The samples must be of the same length.");
+    }
+}
+
+// numerator/sqrt(a*b) in [-1, 1], which is exactly 1 for numerator = a = b:
+template<class Real>
+Real normalized_correlation(Real numerator, Real a, Real b)
+{
+    using std::sqrt;
+    using std::isfinite;
+    Real denominator = sqrt(a*b);
+    if (!isfinite(denominator))
+    {
+        denominator = sqrt(a)*sqrt(b);
+    }
+    const Real r = numerator/denominator;
+    if (r > 1)
+    {
+        return 1;
+    }
+    if (r < -1)
+    {
+        return -1;
+    }
+    return r;
+}
+
+//
+// Spearman's rho is Pearson's correlation of the midranks, the mean of the ranks from 1 that tied values
+// would take.  Twice the midrank less the mean rank is an integer, so the sums of products of these are
+// exact for all but very long samples, and a perfect correlation is exactly 1 or -1.  A constant column
+// has no spread, and gives NaN.
+//
+template<class Real>
+struct centered_midranks
+{
+    std::vector<Real> d;
+    Real sum_of_squares = 0;
+};
+
+template<class Real>
+centered_midranks<Real> center_midranks(const column_ranks& c)
+{
+    const std::size_t n = c.rank.size();
+    centered_midranks<Real> m;
+    m.d.resize(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const std::size_t r = c.rank[i];
+        m.d[i] = static_cast<Real>(c.start[r] + c.start[r + 1]) - static_cast<Real>(n);
+        m.sum_of_squares += m.d[i]*m.d[i];
+    }
+    return m;
+}
+
+template<class Real>
+struct center_midranks_kernel
+{
+    template<class ForwardIterator>
+    centered_midranks<Real> operator()(rank_workspace&, ForwardIterator first, ForwardIterator last) const
+    {
+        return center_midranks<Real>(rank_column(first, last));
+    }
+};
+
+template<class Real>
+Real dot_product(const Real* x, const Real* y, std::size_t n)
+{
+    Real s0 = 0;
+    Real s1 = 0;
+    Real s2 = 0;
+    Real s3 = 0;
+    std::size_t k = 0;
+    for (; k + 4 <= n; k += 4)
+    {
+        s0 += x[k]*y[k];
+        s1 += x[k + 1]*y[k + 1];
+        s2 += x[k + 2]*y[k + 2];
+        s3 += x[k + 3]*y[k + 3];
+    }
+    for (; k < n; ++k)
+    {
+        s0 += x[k]*y[k];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+//
+// The rows are taken in stretches of spearman_rows, and the columns in blocks of spearman_block, so that
+// the two blocks of a tile stay in cache while every pair of their columns is multiplied.  A pair alone
+// sums its stretches in the same order, so it gives the same result as in the matrix.
+//
+constexpr std::size_t spearman_rows = 256;
+constexpr std::size_t spearman_block = 32;
+
+template<class Real>
+Real spearman_dot(const Real* x, const Real* y, std::size_t n)
+{
+    Real sum = 0;
+    for (std::size_t r = 0; r < n; r += spearman_rows)
+    {
+        sum += dot_product(x + r, y + r, (std::min)(spearman_rows, n - r));
+    }
+    return sum;
+}
+
+// Fills the tile of the matrix of the columns in blocks I and J >= I, and its mirror image:
+template<class Real>
+void spearman_tile(const std::vector<centered_midranks<Real>>& z, std::size_t n, std::size_t I, std::size_t J, std::vector<Real>& sums, Real* matrix)
+{
+    const std::size_t p = z.size();
+    const std::size_t a_first = I*spearman_block;
+    const std::size_t a_last = (std::min)(a_first + spearman_block, p);
+    const std::size_t b_first = J*spearman_block;
+    const std::size_t b_last = (std::min)(b_first + spearman_block, p);
+    sums.assign(spearman_block*spearman_block, Real(0));
+    for (std::size_t r = 0; r < n; r += spearman_rows)
+    {
+        const std::size_t len = (std::min)(spearman_rows, n - r);
+        for (std::size_t a = a_first; a < a_last; ++a)
+        {
+            for (std::size_t b = (I == J ? a + 1 : b_first); b < b_last; ++b)
+            {
+                sums[(a - a_first)*spearman_block + (b - b_first)] += dot_product(z[a].d.data() + r, z[b].d.data() + r, len);
+            }
+        }
+    }
+    for (std::size_t a = a_first; a < a_last; ++a)
+    {
+        for (std::size_t b = (I == J ? a + 1 : b_first); b < b_last; ++b)
+        {
+            const Real rho = normalized_correlation(sums[(a - a_first)*spearman_block + (b - b_first)], z[a].sum_of_squares, z[b].sum_of_squares);
+            matrix[a*p + b] = rho;
+            matrix[b*p + a] = rho;
+        }
+    }
+}
+
+//
+// Kendall's tau-b by Knight's algorithm: with the pairs sorted by x and then by y, the discordant pairs are
+// the inversions of the sequence of y, counted by merge sort in O(n log n).  Then
+//   tau_b = (n0 - n1 - n2 + n3 - 2 swaps)/sqrt((n0 - n1)(n0 - n2)),
+// where n0 = n(n - 1)/2, n1 and n2 are the pairs tied in x and in y, and n3 those tied in both.
+//
+struct kendall_workspace
+{
+    std::vector<std::size_t> sequence;
+    std::vector<std::size_t> buffer;
+};
+
+// Sorts a, returning the number of pairs out of order:
+inline std::uint64_t count_inversions(std::vector<std::size_t>& a, std::vector<std::size_t>& buffer)
+{
+    const std::size_t n = a.size();
+    std::uint64_t swaps = 0;
+    // Insertion sort of short runs first, where each shift is an inversion:
+    constexpr std::size_t run = 8;
+    for (std::size_t lo = 0; lo < n; lo += run)
+    {
+        const std::size_t hi = (std::min)(lo + run, n);
+        for (std::size_t i = lo + 1; i < hi; ++i)
+        {
+            const std::size_t x = a[i];
+            std::size_t j = i;
+            for (; j > lo && a[j - 1] > x; --j)
+            {
+                a[j] = a[j - 1];
+            }
+            swaps += i - j;
+            a[j] = x;
+        }
+    }
+    buffer.resize(n);
+    for (std::size_t width = run; width < n; width *= 2)
+    {
+        for (std::size_t lo = 0; lo < n; lo += 2*width)
+        {
+            const std::size_t mid = (std::min)(lo + width, n);
+            const std::size_t hi = (std::min)(lo + 2*width, n);
+            std::size_t i = lo;
+            std::size_t j = mid;
+            std::size_t k = lo;
+            // Without branches, which would be mispredicted half the time on random data:
+            while (i < mid && j < hi)
+            {
+                // If a[j] is taken, it is out of order with each of a[i], ..., a[mid - 1]:
+                const bool right = a[j] < a[i];
+                buffer[k++] = right ? a[j] : a[i];
+                swaps += right ? mid - i : 0;
+                j += right;
+                i += !right;
+            }
+            std::copy(a.begin() + i, a.begin() + mid, buffer.begin() + k);
+            std::copy(a.begin() + j, a.begin() + hi, buffer.begin() + k + (mid - i));
+        }
+        a.swap(buffer);
+    }
+    return swaps;
+}
+
+template<class Real>
+Real kendall_tau_pair(const column_ranks& x, const column_ranks& y, kendall_workspace& ws)
+{
+    const std::size_t n = x.rank.size();
+    auto& seq = ws.sequence;
+    seq.resize(n);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        seq[k] = y.rank[x.order[k]];
+    }
+    // Sort each run of ties in x by y, and count the pairs tied in both:
+    std::uint64_t joint_ties = 0;
+    for (std::size_t r = 0; r + 1 < x.start.size(); ++r)
+    {
+        const auto first = seq.begin() + x.start[r];
+        const auto last = seq.begin() + x.start[r + 1];
+        if (last - first < 2)
+        {
+            continue;
+        }
+        std::sort(first, last);
+        for (auto it = first; it != last;)
+        {
+            auto tie_end = std::upper_bound(it, last, *it);
+            const std::uint64_t t = static_cast<std::uint64_t>(tie_end - it);
+            joint_ties += t*(t - 1)/2;
+            it = tie_end;
+        }
+    }
+    const std::uint64_t swaps = count_inversions(seq, ws.buffer);
+    const std::uint64_t n0 = static_cast<std::uint64_t>(n)*(n - (n > 0 ? 1 : 0))/2;
+    const std::int64_t numerator = static_cast<std::int64_t>(n0) - static_cast<std::int64_t>(x.tied_pairs) - static_cast<std::int64_t>(y.tied_pairs)
+                                 + static_cast<std::int64_t>(joint_ties) - 2*static_cast<std::int64_t>(swaps);
+    return normalized_correlation(static_cast<Real>(numerator), static_cast<Real>(n0 - x.tied_pairs), static_cast<Real>(n0 - y.tied_pairs));
+}
+
+// Chatterjee's xi of y on x, as chatterjee_correlation gives for x sorted, ties in x taken in order of position:
+template<class Real>
+Real chatterjee_pair(const column_ranks& x, const column_ranks& y)
+{
+    const std::size_t n = x.rank.size();
+    std::size_t sum = 0;
+    for (std::size_t k = 1; k < n; ++k)
+    {
+        const std::size_t a = y.rank[x.order[k - 1]];
+        const std::size_t b = y.rank[x.order[k]];
+        sum += a > b ? a - b : b - a;
+    }
+    return chatterjee_from_sum<Real>(sum, n);
+}
+
+//
+// The kernels of the matrices, each filling the entries of the pairs [t_first, t_last) of its own
+// enumeration, with a workspace of its own, so that chunks of the pairs may run on any thread.
+//
+template<class Real>
+struct spearman_matrix_kernel
+{
+    const std::vector<centered_midranks<Real>>& z;
+    std::size_t n;
+    Real* matrix;
+
+    void operator()(std::size_t t_first, std::size_t t_last) const
+    {
+        const std::size_t blocks = (z.size() + spearman_block - 1)/spearman_block;
+        std::vector<Real> sums;
+        auto IJ = upper_pair(blocks, t_first, true);
+        for (std::size_t t = t_first; t < t_last; ++t, next_upper_pair(IJ, blocks, true))
+        {
+            spearman_tile(z, n, IJ.first, IJ.second, sums, matrix);
+        }
+    }
+};
+
+template<class Real>
+struct kendall_matrix_kernel
+{
+    const std::vector<column_ranks>& columns;
+    Real* matrix;
+
+    void operator()(std::size_t t_first, std::size_t t_last) const
+    {
+        const std::size_t p = columns.size();
+        kendall_workspace ws;
+        auto ij = upper_pair(p, t_first, false);
+        for (std::size_t t = t_first; t < t_last; ++t, next_upper_pair(ij, p, false))
+        {
+            const Real tau = kendall_tau_pair<Real>(columns[ij.first], columns[ij.second], ws);
+            matrix[ij.first*p + ij.second] = tau;
+            matrix[ij.second*p + ij.first] = tau;
+        }
+    }
+};
+
+// Every ordered pair, row by row, so that consecutive pairs share the ordering of x.  The diagonal is not
+// 1: xi of a column on itself is (n - 2)/(n + 1).
+template<class Real>
+struct chatterjee_matrix_kernel
+{
+    const std::vector<column_ranks>& columns;
+    Real* matrix;
+
+    void operator()(std::size_t t_first, std::size_t t_last) const
+    {
+        const std::size_t p = columns.size();
+        for (std::size_t t = t_first; t < t_last; ++t)
+        {
+            matrix[t] = chatterjee_pair<Real>(columns[t/p], columns[t % p]);
+        }
+    }
+};
+
+// The diagonals of Spearman's and Kendall's matrices: 1, unless the column is constant.
+template<class Real>
+void unit_diagonal(const std::vector<column_ranks>& columns, std::vector<Real>& matrix)
+{
+    const std::size_t p = columns.size();
+    for (std::size_t i = 0; i < p; ++i)
+    {
+        matrix[i*p + i] = columns[i].start.size() > 2 ? Real(1) : std::numeric_limits<Real>::quiet_NaN();
+    }
+}
+
+template<class Real>
+void unit_diagonal(const std::vector<centered_midranks<Real>>& z, std::vector<Real>& matrix)
+{
+    const std::size_t p = z.size();
+    for (std::size_t i = 0; i < p; ++i)
+    {
+        matrix[i*p + i] = z[i].sum_of_squares > 0 ? Real(1) : std::numeric_limits<Real>::quiet_NaN();
+    }
+}
+
+struct spearman_matrix_tag {};
+struct kendall_matrix_tag {};
+struct chatterjee_matrix_tag {};
+struct rank_columns_tag {};
+
+template<class Container>
+using rank_correlation_matrix_real_t = rank_correlation_real_t<batch_value_t<Container>>;
+
+} // namespace detail
+
+template<class Container, class Real = typename Container::value_type,
+         class ReturnType = typename std::conditional<std::is_integral<Real>::value, double, Real>::type>
+inline ReturnType spearman_correlation(const Container& u, const Container& v)
+{
+    detail::check_pair(std::cbegin(u), std::cend(u), std::cbegin(v), std::cend(v));
+    const auto x = detail::center_midranks<ReturnType>(detail::rank_column(std::cbegin(u), std::cend(u)));
+    const auto y = detail::center_midranks<ReturnType>(detail::rank_column(std::cbegin(v), std::cend(v)));
+    return detail::normalized_correlation(detail::spearman_dot(x.d.data(), y.d.data(), x.d.size()), x.sum_of_squares, y.sum_of_squares);
+}
+
+template<class Container, class Real = typename Container::value_type,
+         class ReturnType = typename std::conditional<std::is_integral<Real>::value, double, Real>::type>
+inline ReturnType kendall_tau(const Container& u, const Container& v)
+{
+    detail::check_pair(std::cbegin(u), std::cend(u), std::cbegin(v), std::cend(v));
+    detail::kendall_workspace ws;
+    return detail::kendall_tau_pair<ReturnType>(detail::rank_column(std::cbegin(u), std::cend(u)),
+                                                detail::rank_column(std::cbegin(v), std::cend(v)), ws);
+}
+
+//
+// The p by p matrices of a set of p columns of equal length, in a std::vector, row by row.  Entry (i, j)
+// of the Chatterjee matrix is xi of column j on column i, which need not equal xi of column i on column j.
+//
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class ExecutionPolicy, class Container>
+auto spearman_correlation_matrix(ExecutionPolicy&& exec, const Container& columns)
+{
+    using Real = detail::rank_correlation_matrix_real_t<Container>;
+    detail::check_columns(columns);
+    const auto z = detail::series_batch<detail::rank_columns_tag, detail::centered_midranks<Real>, detail::rank_workspace>(exec, columns, detail::center_midranks_kernel<Real>());
+    const std::size_t p = z.size();
+    const std::size_t n = p > 0 ? z[0].d.size() : 0;
+    std::vector<Real> matrix(p*p, std::numeric_limits<Real>::quiet_NaN());
+    if (n < 2)
+    {
+        return matrix;
+    }
+    detail::unit_diagonal(z, matrix);
+    const std::size_t blocks = (p + detail::spearman_block - 1)/detail::spearman_block;
+    const std::size_t tile_width = (std::min)(p, detail::spearman_block);
+    detail::for_each_chunk<detail::spearman_matrix_tag, Real>(exec, blocks*(blocks + 1)/2, tile_width*tile_width*n,
+                                                                detail::spearman_matrix_kernel<Real>{z, n, matrix.data()});
+    return matrix;
+}
+
+template<class ExecutionPolicy, class Container>
+auto kendall_tau_matrix(ExecutionPolicy&& exec, const Container& columns)
+{
+    using Real = detail::rank_correlation_matrix_real_t<Container>;
+    detail::check_columns(columns);
+    const auto ranked = detail::series_batch<detail::rank_columns_tag, detail::column_ranks, detail::rank_workspace>(exec, columns, detail::rank_columns_kernel());
+    const std::size_t p = ranked.size();
+    const std::size_t n = p > 0 ? ranked[0].rank.size() : 0;
+    std::vector<Real> matrix(p*p, std::numeric_limits<Real>::quiet_NaN());
+    detail::unit_diagonal(ranked, matrix);
+    detail::for_each_chunk<detail::kendall_matrix_tag, Real>(exec, p*(p - (p > 0 ? 1 : 0))/2, n,
+                                                              detail::kendall_matrix_kernel<Real>{ranked, matrix.data()});
+    return matrix;
+}
+
+template<class ExecutionPolicy, class Container>
+auto chatterjee_correlation_matrix(ExecutionPolicy&& exec, const Container& columns)
+{
+    using Real = detail::rank_correlation_matrix_real_t<Container>;
+    detail::check_columns(columns);
+    const auto ranked = detail::series_batch<detail::rank_columns_tag, detail::column_ranks, detail::rank_workspace>(exec, columns, detail::rank_columns_kernel());
+    const std::size_t p = ranked.size();
+    const std::size_t n = p > 0 ? ranked[0].rank.size() : 0;
+    std::vector<Real> matrix(p*p, std::numeric_limits<Real>::quiet_NaN());
+    detail::for_each_chunk<detail::chatterjee_matrix_tag, Real>(exec, p*p, n,
+                                                                 detail::chatterjee_matrix_kernel<Real>{ranked, matrix.data()});
+    return matrix;
+}
+
+template<class Container>
+inline auto spearman_correlation_matrix(const Container& columns)
+{
+    return spearman_correlation_matrix(std::execution::seq, columns);
+}
+
+template<class Container>
+inline auto kendall_tau_matrix(const Container& columns)
+{
+    return kendall_tau_matrix(std::execution::seq, columns);
+}
+
+template<class Container>
+inline auto chatterjee_correlation_matrix(const Container& columns)
+{
+    return chatterjee_correlation_matrix(std::execution::seq, columns);
+}
+
+#else // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Container>
+auto spearman_correlation_matrix(const Container& columns)
+{
+    using Real = detail::rank_correlation_matrix_real_t<Container>;
+    detail::check_columns(columns);
+    const auto z = detail::series_batch<detail::centered_midranks<Real>, detail::rank_workspace>(columns, detail::center_midranks_kernel<Real>());
+    const std::size_t p = z.size();
+    const std::size_t n = p > 0 ? z[0].d.size() : 0;
+    std::vector<Real> matrix(p*p, std::numeric_limits<Real>::quiet_NaN());
+    if (n < 2)
+    {
+        return matrix;
+    }
+    detail::unit_diagonal(z, matrix);
+    const std::size_t blocks = (p + detail::spearman_block - 1)/detail::spearman_block;
+    detail::spearman_matrix_kernel<Real>{z, n, matrix.data()}(0, blocks*(blocks + 1)/2);
+    return matrix;
+}
+
+template<class Container>
+auto kendall_tau_matrix(const Container& columns)
+{
+    using Real = detail::rank_correlation_matrix_real_t<Container>;
+    detail::check_columns(columns);
+    const auto ranked = detail::series_batch<detail::column_ranks, detail::rank_workspace>(columns, detail::rank_columns_kernel());
+    const std::size_t p = ranked.size();
+    std::vector<Real> matrix(p*p, std::numeric_limits<Real>::quiet_NaN());
+    detail::unit_diagonal(ranked, matrix);
+    detail::kendall_matrix_kernel<Real>{ranked, matrix.data()}(0, p*(p - (p > 0 ? 1 : 0))/2);
+    return matrix;
+}
+
+template<class Container>
+auto chatterjee_correlation_matrix(const Container& columns)
+{
+    using Real = detail::rank_correlation_matrix_real_t<Container>;
+    detail::check_columns(columns);
+    const auto ranked = detail::series_batch<detail::column_ranks, detail::rank_workspace>(columns, detail::rank_columns_kernel());
+    const std::size_t p = ranked.size();
+    std::vector<Real> matrix(p*p, std::numeric_limits<Real>::quiet_NaN());
+    detail::chatterjee_matrix_kernel<Real>{ranked, matrix.data()}(0, p*p);
+    return matrix;
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_RANK_CORRELATION_HPP
@@ -0,0 +1,561 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_RESAMPLING_HPP
+#define BOOST_MATH_STATISTICS_RESAMPLING_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/statistics/detail/batch.hpp>
+#include <boost/math/statistics/detail/philox.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// Bootstrap confidence intervals and permutation tests for any statistic.  The statistic is a functor
+// called as statistic(first, last) on random access iterators over a sample, or as
+// statistic(x_first, x_last, y_first, y_last) on two samples, and may return any floating point type.
+// A resample is a vector of indices into the data, read through a resample_iterator, so the values are
+// never copied.  Resample r draws its indices from stream r of the seed, so the results depend on the
+// seed alone, whatever the number of threads.  Each chunk of resamples calls its own copy of the
+// statistic, which may therefore keep a buffer: to sort or partition the values, as median does.
+//
+
+namespace boost { namespace math { namespace statistics {
+
+namespace detail {
+
+// The values data[index[k]] of a resample, in order:
+template<class RandomAccessIterator>
+class resample_iterator
+{
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = typename std::iterator_traits<RandomAccessIterator>::reference;
+    using pointer = typename std::iterator_traits<RandomAccessIterator>::pointer;
+
+    resample_iterator() = default;
+    resample_iterator(RandomAccessIterator data, const std::size_t* index) noexcept : m_data(data), m_index(index) {}
+
+    reference operator*() const { return m_data[static_cast<difference_type>(*m_index)]; }
+    reference operator[](difference_type k) const { return m_data[static_cast<difference_type>(m_index[k])]; }
+
+    resample_iterator& operator++() noexcept { ++m_index; return *this; }
+    resample_iterator& operator--() noexcept { --m_index; return *this; }
+    resample_iterator operator++(int) noexcept { auto t = *this; ++m_index; return t; }
+    resample_iterator operator--(int) noexcept { auto t = *this; --m_index; return t; }
+    resample_iterator& operator+=(difference_type k) noexcept { m_index += k; return *this; }
+    resample_iterator& operator-=(difference_type k) noexcept { m_index -= k; return *this; }
+    friend resample_iterator operator+(resample_iterator it, difference_type k) noexcept { return it += k; }
+    friend resample_iterator operator+(difference_type k, resample_iterator it) noexcept { return it += k; }
+    friend resample_iterator operator-(resample_iterator it, difference_type k) noexcept { return it -= k; }
+    friend difference_type operator-(const resample_iterator& a, const resample_iterator& b) noexcept { return a.m_index - b.m_index; }
+
+    friend bool operator==(const resample_iterator& a, const resample_iterator& b) noexcept { return a.m_index == b.m_index; }
+    friend bool operator!=(const resample_iterator& a, const resample_iterator& b) noexcept { return a.m_index != b.m_index; }
+    friend bool operator<(const resample_iterator& a, const resample_iterator& b) noexcept { return a.m_index < b.m_index; }
+    friend bool operator>(const resample_iterator& a, const resample_iterator& b) noexcept { return a.m_index > b.m_index; }
+    friend bool operator<=(const resample_iterator& a, const resample_iterator& b) noexcept { return a.m_index <= b.m_index; }
+    friend bool operator>=(const resample_iterator& a, const resample_iterator& b) noexcept { return a.m_index >= b.m_index; }
+
+private:
+    RandomAccessIterator m_data {};
+    const std::size_t* m_index = nullptr;
+};
+
+template<class Container>
+using resample_iterator_t = resample_iterator<decltype(std::cbegin(std::declval<const Container&>()))>;
+
+template<class T>
+using resampling_real_t = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+template<class Statistic, class Container>
+using one_sample_statistic_t = resampling_real_t<typename std::decay<decltype(std::declval<Statistic&>()(
+    std::declval<resample_iterator_t<Container>>(), std::declval<resample_iterator_t<Container>>()))>::type>;
+
+template<class Statistic, class Container>
+using two_sample_statistic_t = resampling_real_t<typename std::decay<decltype(std::declval<Statistic&>()(
+    std::declval<resample_iterator_t<Container>>(), std::declval<resample_iterator_t<Container>>(),
+    std::declval<resample_iterator_t<Container>>(), std::declval<resample_iterator_t<Container>>()))>::type>;
+
+// The statistic of the values data[index[0]], ..., data[index[size - 1]]:
+template<class Real, class Statistic, class RandomAccessIterator>
+Real indexed_statistic(Statistic& statistic, RandomAccessIterator data, const std::size_t* index, std::size_t size)
+{
+    using iterator = resample_iterator<RandomAccessIterator>;
+    return static_cast<Real>(statistic(iterator(data, index), iterator(data, index + size)));
+}
+
+template<class Container>
+std::size_t resampling_size(const Container& v)
+{
+    const std::size_t n = static_cast<std::size_t>(std::distance(std::cbegin(v), std::cend(v)));
+    if (n == 0)
+    {
+        throw std::domain_error("At least one sample is required to resample.");
+    }
+    return n;
+}
+
+inline void check_resamples(std::size_t resamples)
+{
+    if (resamples == 0)
+    {
+        throw std::domain_error("At least one resample is required.");
+    }
+}
+
+template<class Real>
+void check_confidence_level(Real confidence_level)
+{
+    if (!(confidence_level > 0 && confidence_level < 1))
+    {
+        throw std::domain_error("The confidence level must be in (0, 1).");
+    }
+}
+
+// Resamples [first, last) of n values with replacement, each drawn from its own stream of the seed:
+template<class Real, class Statistic, class RandomAccessIterator>
+struct bootstrap_kernel
+{
+    const Statistic& statistic;
+    RandomAccessIterator data;
+    std::size_t n;
+    std::uint64_t seed;
+    Real* replicates;
+
+    void operator()(std::size_t first, std::size_t last) const
+    {
+        Statistic s = statistic;
+        std::vector<std::size_t> index(n);
+        for (std::size_t r = first; r < last; ++r)
+        {
+            philox4x32 gen(seed, r);
+            for (auto& i : index)
+            {
+                i = uniform_index(gen, n);
+            }
+            replicates[r] = indexed_statistic<Real>(s, data, index.data(), n);
+        }
+    }
+};
+
+//
+// The statistic of the data with each of the groups [0, groups) left out in turn, group g being the values
+// whose index is g modulo groups.  With a group for each value, this is the jackknife; with fewer, each
+// group is a systematic sample of the data, which a sorted input does not bias.
+//
+template<class Real, class Statistic, class RandomAccessIterator>
+struct jackknife_kernel
+{
+    const Statistic& statistic;
+    RandomAccessIterator data;
+    std::size_t n;
+    std::size_t groups;
+    Real* replicates;
+
+    void operator()(std::size_t first, std::size_t last) const
+    {
+        Statistic s = statistic;
+        std::vector<std::size_t> index;
+        index.reserve(n);
+        for (std::size_t g = first; g < last; ++g)
+        {
+            index.clear();
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                if (i % groups != g)
+                {
+                    index.push_back(i);
+                }
+            }
+            replicates[g] = indexed_statistic<Real>(s, data, index.data(), index.size());
+        }
+    }
+};
+
+//
+// Permutes the pooled samples [first, last) times, assigning a random subset of the smaller size to the
+// smaller sample by a partial Fisher-Yates shuffle.  The swaps are then undone, so each permutation starts
+// from the identity and depends on its own stream alone.
+//
+template<class Real, class Statistic, class RandomAccessIterator>
+struct permutation_kernel
+{
+    const Statistic& statistic;
+    RandomAccessIterator pooled;
+    std::size_t nx;
+    std::size_t ny;
+    std::uint64_t seed;
+    Real* replicates;
+
+    void operator()(std::size_t first, std::size_t last) const
+    {
+        using iterator = resample_iterator<RandomAccessIterator>;
+        Statistic s = statistic;
+        const std::size_t n = nx + ny;
+        const std::size_t k = (std::min)(nx, ny);
+        std::vector<std::size_t> index(n);
+        std::iota(index.begin(), index.end(), std::size_t(0));
+        std::vector<std::size_t> swaps(k);
+        const std::size_t* x = index.data() + (nx <= ny ? 0 : ny);
+        const std::size_t* y = index.data() + (nx <= ny ? nx : 0);
+        for (std::size_t r = first; r < last; ++r)
+        {
+            philox4x32 gen(seed, r);
+            for (std::size_t i = 0; i < k; ++i)
+            {
+                swaps[i] = i + uniform_index(gen, n - i);
+                std::swap(index[i], index[swaps[i]]);
+            }
+            replicates[r] = static_cast<Real>(s(iterator(pooled, x), iterator(pooled, x + nx), iterator(pooled, y), iterator(pooled, y + ny)));
+            for (std::size_t i = k; i-- > 0;)
+            {
+                std::swap(index[i], index[swaps[i]]);
+            }
+        }
+    }
+};
+
+struct bootstrap_tag {};
+struct jackknife_tag {};
+struct permutation_tag {};
+
+// Enough groups that the acceleration of the BCa interval is a good estimate, and few enough to compute quickly:
+constexpr std::size_t jackknife_groups = 1000;
+
+// The q quantile of the sorted values, interpolating linearly between order statistics:
+template<class Real>
+Real sorted_quantile(const std::vector<Real>& sorted, Real q)
+{
+    using std::floor;
+    if (!(q >= 0 && q <= 1))
+    {
+        return std::numeric_limits<Real>::quiet_NaN();
+    }
+    const Real position = q*static_cast<Real>(sorted.size() - 1);
+    const std::size_t i = (std::min)(static_cast<std::size_t>(floor(position)), sorted.size() - 1);
+    if (i + 1 == sorted.size())
+    {
+        return sorted[i];
+    }
+    const Real t = position - static_cast<Real>(i);
+    return sorted[i] + t*(sorted[i + 1] - sorted[i]);
+}
+
+template<class Real>
+std::pair<Real, Real> percentile_interval(std::vector<Real> replicates, Real confidence_level)
+{
+    replicates.erase(std::remove_if(replicates.begin(), replicates.end(), [](Real t) { return (boost::math::isnan)(t); }), replicates.end());
+    if (replicates.empty())
+    {
+        return std::make_pair(std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN());
+    }
+    std::sort(replicates.begin(), replicates.end());
+    const Real alpha = (1 - confidence_level)/2;
+    return std::make_pair(sorted_quantile(replicates, alpha), sorted_quantile(replicates, 1 - alpha));
+}
+
+//
+// Efron's bias corrected and accelerated interval: the percentile interval at the levels which correct for
+// the median bias of the replicates, z0, and for the rate at which the standard error of the statistic
+// changes with its value, the acceleration a, estimated by the (grouped) jackknife.
+//
+template<class Real>
+std::pair<Real, Real> bca_interval(std::vector<Real> replicates, const std::vector<Real>& jackknife, Real observed, Real confidence_level)
+{
+    using no_promote_policy = boost::math::policies::policy<boost::math::policies::promote_float<false>, boost::math::policies::promote_double<false>>;
+    using std::sqrt;
+    const Real nan = std::numeric_limits<Real>::quiet_NaN();
+    replicates.erase(std::remove_if(replicates.begin(), replicates.end(), [](Real t) { return (boost::math::isnan)(t); }), replicates.end());
+    if (replicates.empty() || (boost::math::isnan)(observed))
+    {
+        return std::make_pair(nan, nan);
+    }
+    std::sort(replicates.begin(), replicates.end());
+    const auto below = std::lower_bound(replicates.begin(), replicates.end(), observed) - replicates.begin();
+    const auto equal = std::upper_bound(replicates.begin(), replicates.end(), observed) - replicates.begin() - below;
+    const Real proportion = (static_cast<Real>(below) + static_cast<Real>(equal)/2)/static_cast<Real>(replicates.size());
+    if (!(proportion > 0 && proportion < 1))
+    {
+        // Every replicate is on one side of the statistic, so the bias cannot be estimated:
+        return std::make_pair(nan, nan);
+    }
+
+    Real mean = 0;
+    for (auto t : jackknife)
+    {
+        mean += t;
+    }
+    mean /= static_cast<Real>(jackknife.size());
+    Real sum_squares = 0;
+    Real sum_cubes = 0;
+    for (auto t : jackknife)
+    {
+        const Real d = mean - t;
+        sum_squares += d*d;
+        sum_cubes += d*d*d;
+    }
+    const Real a = sum_squares > 0 ? sum_cubes/(6*sum_squares*sqrt(sum_squares)) : Real(0);
+
+    const boost::math::normal_distribution<Real, no_promote_policy> normal;
+    const Real z0 = boost::math::quantile(normal, proportion);
+    auto level = [&](Real p)
+    {
+        const Real z = z0 + boost::math::quantile(normal, p);
+        return boost::math::cdf(normal, z0 + z/(1 - a*z));
+    };
+    const Real alpha = (1 - confidence_level)/2;
+    return std::make_pair(sorted_quantile(replicates, level(alpha)), sorted_quantile(replicates, level(1 - alpha)));
+}
+
+// The two sided p-value: the proportion of the permutations, with the data itself, whose statistic is at
+// least as far from zero as the observed one, allowing for the rounding of statistics of equal value.
+template<class Real>
+Real permutation_p_value(const std::vector<Real>& replicates, Real observed)
+{
+    using std::abs;
+    const Real threshold = abs(observed)*(1 - 64*std::numeric_limits<Real>::epsilon());
+    std::size_t extreme = 0;
+    for (auto t : replicates)
+    {
+        extreme += abs(t) >= threshold;
+    }
+    return static_cast<Real>(extreme + 1)/static_cast<Real>(replicates.size() + 1);
+}
+
+template<class Container>
+std::vector<typename std::iterator_traits<decltype(std::cbegin(std::declval<const Container&>()))>::value_type>
+pool_samples(const Container& x, const Container& y)
+{
+    std::vector<typename std::iterator_traits<decltype(std::cbegin(std::declval<const Container&>()))>::value_type> pooled(std::cbegin(x), std::cend(x));
+    pooled.insert(pooled.end(), std::cbegin(y), std::cend(y));
+    return pooled;
+}
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Real, class ExecutionPolicy, class Container, class Statistic>
+std::vector<Real> bootstrap_replicates_impl(ExecutionPolicy&& exec, const Container& v, const Statistic& statistic, std::size_t resamples, std::uint64_t seed)
+{
+    const std::size_t n = resampling_size(v);
+    check_resamples(resamples);
+    std::vector<Real> replicates(resamples);
+    for_each_chunk<bootstrap_tag, Real>(exec, resamples, n,
+                                        bootstrap_kernel<Real, Statistic, decltype(std::cbegin(v))>{statistic, std::cbegin(v), n, seed, replicates.data()});
+    return replicates;
+}
+
+template<class Real, class ExecutionPolicy, class Container, class Statistic>
+std::vector<Real> jackknife_replicates(ExecutionPolicy&& exec, const Container& v, const Statistic& statistic)
+{
+    const std::size_t n = resampling_size(v);
+    const std::size_t groups = (std::min)(n, jackknife_groups);
+    std::vector<Real> replicates(groups);
+    for_each_chunk<jackknife_tag, Real>(exec, groups, n,
+                                        jackknife_kernel<Real, Statistic, decltype(std::cbegin(v))>{statistic, std::cbegin(v), n, groups, replicates.data()});
+    return replicates;
+}
+
+template<class Real, class ExecutionPolicy, class Container, class Statistic>
+std::pair<Real, Real> permutation_test_impl(ExecutionPolicy&& exec, const Container& x, const Container& y, const Statistic& statistic,
+                                            std::size_t resamples, std::uint64_t seed)
+{
+    const std::size_t nx = resampling_size(x);
+    const std::size_t ny = resampling_size(y);
+    check_resamples(resamples);
+    const auto pooled = pool_samples(x, y);
+    std::vector<std::size_t> identity(nx + ny);
+    std::iota(identity.begin(), identity.end(), std::size_t(0));
+    using iterator = resample_iterator<decltype(pooled.cbegin())>;
+    Statistic s = statistic;
+    const Real observed = static_cast<Real>(s(iterator(pooled.cbegin(), identity.data()), iterator(pooled.cbegin(), identity.data() + nx),
+                                              iterator(pooled.cbegin(), identity.data() + nx), iterator(pooled.cbegin(), identity.data() + nx + ny)));
+    std::vector<Real> replicates(resamples);
+    for_each_chunk<permutation_tag, Real>(exec, resamples, nx + ny,
+                                          permutation_kernel<Real, Statistic, decltype(pooled.cbegin())>{statistic, pooled.cbegin(), nx, ny, seed, replicates.data()});
+    return std::make_pair(observed, permutation_p_value(replicates, observed));
+}
+
+#else
+
+template<class Real, class Container, class Statistic>
+std::vector<Real> bootstrap_replicates_impl(const Container& v, const Statistic& statistic, std::size_t resamples, std::uint64_t seed)
+{
+    const std::size_t n = resampling_size(v);
+    check_resamples(resamples);
+    std::vector<Real> replicates(resamples);
+    bootstrap_kernel<Real, Statistic, decltype(std::cbegin(v))>{statistic, std::cbegin(v), n, seed, replicates.data()}(0, resamples);
+    return replicates;
+}
+
+template<class Real, class Container, class Statistic>
+std::vector<Real> jackknife_replicates(const Container& v, const Statistic& statistic)
+{
+    const std::size_t n = resampling_size(v);
+    const std::size_t groups = (std::min)(n, jackknife_groups);
+    std::vector<Real> replicates(groups);
+    jackknife_kernel<Real, Statistic, decltype(std::cbegin(v))>{statistic, std::cbegin(v), n, groups, replicates.data()}(0, groups);
+    return replicates;
+}
+
+template<class Real, class Container, class Statistic>
+std::pair<Real, Real> permutation_test_impl(const Container& x, const Container& y, const Statistic& statistic, std::size_t resamples, std::uint64_t seed)
+{
+    const std::size_t nx = resampling_size(x);
+    const std::size_t ny = resampling_size(y);
+    check_resamples(resamples);
+    const auto pooled = pool_samples(x, y);
+    std::vector<std::size_t> identity(nx + ny);
+    std::iota(identity.begin(), identity.end(), std::size_t(0));
+    using iterator = resample_iterator<decltype(pooled.cbegin())>;
+    Statistic s = statistic;
+    const Real observed = static_cast<Real>(s(iterator(pooled.cbegin(), identity.data()), iterator(pooled.cbegin(), identity.data() + nx),
+                                              iterator(pooled.cbegin(), identity.data() + nx), iterator(pooled.cbegin(), identity.data() + nx + ny)));
+    std::vector<Real> replicates(resamples);
+    permutation_kernel<Real, Statistic, decltype(pooled.cbegin())>{statistic, pooled.cbegin(), nx, ny, seed, replicates.data()}(0, resamples);
+    return std::make_pair(observed, permutation_p_value(replicates, observed));
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Real, class Container, class Statistic>
+Real observed_statistic(const Container& v, const Statistic& statistic)
+{
+    const std::size_t n = resampling_size(v);
+    std::vector<std::size_t> identity(n);
+    std::iota(identity.begin(), identity.end(), std::size_t(0));
+    Statistic s = statistic;
+    return indexed_statistic<Real>(s, std::cbegin(v), identity.data(), n);
+}
+
+} // namespace detail
+
+//
+// bootstrap_replicates returns the statistic of each of the resamples, drawn with replacement from v;
+// the intervals are the percentile and BCa intervals at the confidence level, in (0, 1).
+// permutation_test returns the statistic of the samples x and y and the two sided p-value of the
+// hypothesis that they come from the same distribution, as estimated from random permutations.
+//
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class ExecutionPolicy, class RandomAccessContainer, class Statistic>
+inline auto bootstrap_replicates(ExecutionPolicy&& exec, const RandomAccessContainer& v, Statistic statistic, std::size_t resamples, std::uint64_t seed)
+{
+    using Real = detail::one_sample_statistic_t<Statistic, RandomAccessContainer>;
+    return detail::bootstrap_replicates_impl<Real>(exec, v, statistic, resamples, seed);
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, class Statistic, class Real>
+auto bootstrap_percentile_interval(ExecutionPolicy&& exec, const RandomAccessContainer& v, Statistic statistic, Real confidence_level,
+                                   std::size_t resamples, std::uint64_t seed)
+{
+    using Result = detail::one_sample_statistic_t<Statistic, RandomAccessContainer>;
+    detail::check_confidence_level(confidence_level);
+    auto replicates = detail::bootstrap_replicates_impl<Result>(exec, v, statistic, resamples, seed);
+    return detail::percentile_interval(std::move(replicates), static_cast<Result>(confidence_level));
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, class Statistic, class Real>
+auto bootstrap_bca_interval(ExecutionPolicy&& exec, const RandomAccessContainer& v, Statistic statistic, Real confidence_level,
+                            std::size_t resamples, std::uint64_t seed)
+{
+    using Result = detail::one_sample_statistic_t<Statistic, RandomAccessContainer>;
+    detail::check_confidence_level(confidence_level);
+    auto replicates = detail::bootstrap_replicates_impl<Result>(exec, v, statistic, resamples, seed);
+    const auto jackknife = detail::jackknife_replicates<Result>(exec, v, statistic);
+    const Result observed = detail::observed_statistic<Result>(v, statistic);
+    return detail::bca_interval(std::move(replicates), jackknife, observed, static_cast<Result>(confidence_level));
+}
+
+template<class ExecutionPolicy, class RandomAccessContainer, class Statistic>
+inline auto permutation_test(ExecutionPolicy&& exec, const RandomAccessContainer& x, const RandomAccessContainer& y, Statistic statistic,
+                             std::size_t resamples, std::uint64_t seed)
+{
+    using Real = detail::two_sample_statistic_t<Statistic, std::vector<typename RandomAccessContainer::value_type>>;
+    return detail::permutation_test_impl<Real>(exec, x, y, statistic, resamples, seed);
+}
+
+template<class RandomAccessContainer, class Statistic>
+inline auto bootstrap_replicates(const RandomAccessContainer& v, Statistic statistic, std::size_t resamples, std::uint64_t seed)
+{
+    return bootstrap_replicates(std::execution::seq, v, statistic, resamples, seed);
+}
+
+template<class RandomAccessContainer, class Statistic, class Real>
+inline auto bootstrap_percentile_interval(const RandomAccessContainer& v, Statistic statistic, Real confidence_level, std::size_t resamples, std::uint64_t seed)
+{
+    return bootstrap_percentile_interval(std::execution::seq, v, statistic, confidence_level, resamples, seed);
+}
+
+template<class RandomAccessContainer, class Statistic, class Real>
+inline auto bootstrap_bca_interval(const RandomAccessContainer& v, Statistic statistic, Real confidence_level, std::size_t resamples, std::uint64_t seed)
+{
+    return bootstrap_bca_interval(std::execution::seq, v, statistic, confidence_level, resamples, seed);
+}
+
+template<class RandomAccessContainer, class Statistic>
+inline auto permutation_test(const RandomAccessContainer& x, const RandomAccessContainer& y, Statistic statistic, std::size_t resamples, std::uint64_t seed)
+{
+    return permutation_test(std::execution::seq, x, y, statistic, resamples, seed);
+}
+
+#else // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class RandomAccessContainer, class Statistic>
+inline auto bootstrap_replicates(const RandomAccessContainer& v, Statistic statistic, std::size_t resamples, std::uint64_t seed)
+{
+    using Real = detail::one_sample_statistic_t<Statistic, RandomAccessContainer>;
+    return detail::bootstrap_replicates_impl<Real>(v, statistic, resamples, seed);
+}
+
+template<class RandomAccessContainer, class Statistic, class Real>
+auto bootstrap_percentile_interval(const RandomAccessContainer& v, Statistic statistic, Real confidence_level, std::size_t resamples, std::uint64_t seed)
+{
+    using Result = detail::one_sample_statistic_t<Statistic, RandomAccessContainer>;
+    detail::check_confidence_level(confidence_level);
+    auto replicates = detail::bootstrap_replicates_impl<Result>(v, statistic, resamples, seed);
+    return detail::percentile_interval(std::move(replicates), static_cast<Result>(confidence_level));
+}
+
+template<class RandomAccessContainer, class Statistic, class Real>
+auto bootstrap_bca_interval(const RandomAccessContainer& v, Statistic statistic, Real confidence_level, std::size_t resamples, std::uint64_t seed)
+{
+    using Result = detail::one_sample_statistic_t<Statistic, RandomAccessContainer>;
+    detail::check_confidence_level(confidence_level);
+    auto replicates = detail::bootstrap_replicates_impl<Result>(v, statistic, resamples, seed);
+    const auto jackknife = detail::jackknife_replicates<Result>(v, statistic);
+    const Result observed = detail::observed_statistic<Result>(v, statistic);
+    return detail::bca_interval(std::move(replicates), jackknife, observed, static_cast<Result>(confidence_level));
+}
+
+template<class RandomAccessContainer, class Statistic>
+inline auto permutation_test(const RandomAccessContainer& x, const RandomAccessContainer& y, Statistic statistic, std::size_t resamples, std::uint64_t seed)
+{
+    using Real = detail::two_sample_statistic_t<Statistic, std::vector<typename RandomAccessContainer::value_type>>;
+    return detail::permutation_test_impl<Real>(x, y, statistic, resamples, seed);
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_RESAMPLING_HPP
@@ -0,0 +1,683 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_ROLLING_STATISTICS_HPP
+#define BOOST_MATH_STATISTICS_ROLLING_STATISTICS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/statistics/detail/batch.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+//
+// Statistics of each window of w consecutive values of a series: the i-th result is that of
+// [first + i, first + i + w), for i = 0, ..., n - w.  The mean and variance are updated in O(1) as the
+// window slides; the median, quantiles and median absolute deviation are order statistics of a
+// Fenwick tree over the ranks of the values, updated in O(log w).  The input is never modified.
+//
+
+namespace boost { namespace math { namespace statistics {
+
+namespace detail {
+
+template<class T>
+using rolling_real_t = typename std::conditional<std::is_integral<T>::value, double, T>::type;
+
+inline void check_window(std::size_t n, std::size_t window)
+{
+    if (window == 0)
+    {
+        throw std::domain_error("The window must hold at least one value.");
+    }
+    if (window > n)
+    {
+        throw std::domain_error("The window must not be longer than the series.");
+    }
+}
+
+//
+// Calls emit(mean, M2) for each window, M2 being the sum of squared deviations from the mean.  Each
+// slide replaces the oldest value by the newest, as Welford's update followed by its inverse:
+//   mean' = mean + (x_new - x_old)/w,   M2' = M2 + (x_new - x_old)(x_new - mean' + x_old - mean).
+// The rounding errors of the updates would accumulate along the series, so every w slides the
+// window is summed afresh, which at most doubles the cost.
+//
+template<class Real, class RandomAccessIterator, class Emit>
+void rolling_moments_impl(RandomAccessIterator first, RandomAccessIterator last, std::size_t window, Emit emit)
+{
+    const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    check_window(n, window);
+    const Real w = static_cast<Real>(window);
+    Real mean = 0;
+    Real M2 = 0;
+    auto exact = [&](std::size_t start)
+    {
+        Real sum = 0;
+        for (std::size_t i = start; i < start + window; ++i)
+        {
+            sum += static_cast<Real>(first[i]);
+        }
+        mean = sum/w;
+        M2 = 0;
+        for (std::size_t i = start; i < start + window; ++i)
+        {
+            const Real d = static_cast<Real>(first[i]) - mean;
+            M2 += d*d;
+        }
+    };
+
+    exact(0);
+    emit(mean, M2);
+    for (std::size_t start = 1; start + window <= n; ++start)
+    {
+        if (start % window == 0)
+        {
+            exact(start);
+        }
+        else
+        {
+            const Real x_new = static_cast<Real>(first[start + window - 1]);
+            const Real x_old = static_cast<Real>(first[start - 1]);
+            const Real delta = x_new - x_old;
+            const Real mean_new = mean + delta/w;
+            M2 += delta*((x_new - mean_new) + (x_old - mean));
+            M2 = (std::max)(M2, Real(0));
+            mean = mean_new;
+        }
+        emit(mean, M2);
+    }
+}
+
+//
+// The values of a stretch of the series in sorted order, and a Fenwick tree of counts over their ranks,
+// so that inserting or erasing a value and selecting the k-th smallest of those inserted each cost
+// O(log n) for a stretch of n values.  Ties are ranked by position, so every value has a rank of its own.
+// The buffers are kept from one stretch to the next.
+//
+template<class Real>
+class rolling_order_statistics
+{
+public:
+    template<class RandomAccessIterator>
+    void reset(RandomAccessIterator first, std::size_t n)
+    {
+        m_pairs.resize(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            m_pairs[i] = std::make_pair(static_cast<Real>(first[i]), i);
+        }
+        std::sort(m_pairs.begin(), m_pairs.end());
+        m_sorted.resize(n);
+        m_rank.resize(n);
+        for (std::size_t r = 0; r < n; ++r)
+        {
+            m_sorted[r] = m_pairs[r].first;
+            m_rank[m_pairs[r].second] = r;
+        }
+        m_tree.assign(n + 1, 0);
+        m_top = 1;
+        while (2*m_top <= n)
+        {
+            m_top *= 2;
+        }
+    }
+
+    // Insert or erase the i-th value of the series:
+    void insert(std::size_t i)
+    {
+        for (std::size_t r = m_rank[i] + 1; r < m_tree.size(); r += r & (~r + 1))
+        {
+            ++m_tree[r];
+        }
+    }
+
+    void erase(std::size_t i)
+    {
+        for (std::size_t r = m_rank[i] + 1; r < m_tree.size(); r += r & (~r + 1))
+        {
+            --m_tree[r];
+        }
+    }
+
+    // The k-th smallest, counting from 0, of the values inserted:
+    Real select(std::size_t k) const
+    {
+        std::size_t pos = 0;
+        for (std::size_t step = m_top; step > 0; step /= 2)
+        {
+            if (pos + step < m_tree.size() && m_tree[pos + step] <= k)
+            {
+                pos += step;
+                k -= m_tree[pos];
+            }
+        }
+        return m_sorted[pos];
+    }
+
+private:
+    std::vector<std::pair<Real, std::size_t>> m_pairs;
+    std::vector<std::size_t> m_rank;
+    std::vector<Real> m_sorted;
+    std::vector<std::size_t> m_tree;
+    std::size_t m_top = 1;
+};
+
+//
+// Calls emit(tree) with the values of each window inserted.  The series is taken in stretches of the
+// values of segment + 1 windows, each with its own tree: a tree over the whole series would cost
+// O(log n) cache misses per update, where one over a stretch of a few windows costs O(log w) and
+// stays in cache.  Sorting each stretch and filling its first window at most doubles the cost.
+//
+template<class Real, class RandomAccessIterator, class Emit>
+void rolling_order_impl(rolling_order_statistics<Real>& tree, RandomAccessIterator first, RandomAccessIterator last, std::size_t window, Emit emit)
+{
+    const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+    check_window(n, window);
+    const std::size_t segment = (std::max)(window, std::size_t(4096));
+    for (std::size_t begin = 0; begin + window <= n; begin += segment + 1)
+    {
+        const std::size_t length = (std::min)(n - begin, segment + window);
+        auto x = first + begin;
+        tree.reset(x, length);
+        for (std::size_t i = 0; i < window; ++i)
+        {
+            tree.insert(i);
+        }
+        emit(tree);
+        for (std::size_t start = 1; start + window <= length; ++start)
+        {
+            tree.erase(start - 1);
+            tree.insert(start + window - 1);
+            emit(tree);
+        }
+    }
+}
+
+template<class Real>
+Real window_median(const rolling_order_statistics<Real>& tree, std::size_t window)
+{
+    if (window & 1)
+    {
+        return tree.select(window/2);
+    }
+    return (tree.select(window/2 - 1) + tree.select(window/2))/2;
+}
+
+// Linear interpolation between the order statistics, Hyndman and Fan's type 7, the default of R and NumPy:
+template<class Real>
+Real window_quantile(const rolling_order_statistics<Real>& tree, std::size_t window, Real p)
+{
+    using std::floor;
+    const Real h = (window - 1)*p;
+    const Real lo = floor(h);
+    const std::size_t k = static_cast<std::size_t>(lo);
+    const Real frac = h - lo;
+    const Real a = tree.select(k);
+    if (frac == 0 || k + 1 >= window)
+    {
+        return a;
+    }
+    return a + frac*(tree.select(k + 1) - a);
+}
+
+//
+// With the window sorted as s_0 <= ... <= s_{w-1}, m its median and j = w/2, the deviations from m are
+// the union of the increasing sequences m - s_{j-1}, m - s_{j-2}, ..., m - s_0 and s_j - m, ..., s_{w-1} - m.
+// The k-th smallest of the union is found by bisection on how many come from the first, in O(log w) selections.
+//
+template<class Real>
+Real kth_deviation(const rolling_order_statistics<Real>& tree, std::size_t window, Real m, std::size_t k)
+{
+    const std::size_t j = window/2;
+    const std::size_t a_size = j;
+    const std::size_t b_size = window - j;
+    auto A = [&](std::size_t t) { return m - tree.select(j - 1 - t); };
+    auto B = [&](std::size_t t) { return tree.select(j + t) - m; };
+    std::size_t lo = k + 1 > b_size ? k + 1 - b_size : 0;
+    std::size_t hi = (std::min)(k + 1, a_size);
+    while (lo < hi)
+    {
+        const std::size_t t = lo + (hi - lo)/2;
+        if (A(t) < B(k - t))
+        {
+            lo = t + 1;
+        }
+        else
+        {
+            hi = t;
+        }
+    }
+    if (lo == 0)
+    {
+        return B(k);
+    }
+    if (lo == k + 1)
+    {
+        return A(k);
+    }
+    return (std::max)(A(lo - 1), B(k - lo));
+}
+
+// As median_absolute_deviation, about the median of the window:
+template<class Real>
+Real window_median_absolute_deviation(const rolling_order_statistics<Real>& tree, std::size_t window)
+{
+    const Real m = window_median(tree, window);
+    if (window & 1)
+    {
+        return kth_deviation(tree, window, m, window/2);
+    }
+    return (kth_deviation(tree, window, m, window/2 - 1) + kth_deviation(tree, window, m, window/2))/2;
+}
+
+template<class Real>
+struct rolling_workspace
+{
+    rolling_order_statistics<Real> tree;
+};
+
+struct rolling_moments_tag {};
+struct rolling_order_tag {};
+
+template<class Real>
+struct rolling_mean_kernel
+{
+    std::size_t window;
+
+    template<class RandomAccessIterator, class OutputIterator>
+    OutputIterator operator()(RandomAccessIterator first, RandomAccessIterator last, OutputIterator out) const
+    {
+        rolling_moments_impl<Real>(first, last, window, [&out](Real mean, Real) { *out++ = mean; });
+        return out;
+    }
+};
+
+template<class Real>
+struct rolling_variance_kernel
+{
+    std::size_t window;
+    std::size_t correction;
+
+    template<class RandomAccessIterator, class OutputIterator>
+    OutputIterator operator()(RandomAccessIterator first, RandomAccessIterator last, OutputIterator out) const
+    {
+        const Real divisor = static_cast<Real>(window - correction);
+        rolling_moments_impl<Real>(first, last, window, [&out, divisor](Real, Real M2) { *out++ = M2/divisor; });
+        return out;
+    }
+};
+
+template<class Real>
+struct rolling_median_kernel
+{
+    std::size_t window;
+
+    template<class RandomAccessIterator, class OutputIterator>
+    OutputIterator operator()(rolling_workspace<Real>& ws, RandomAccessIterator first, RandomAccessIterator last, OutputIterator out) const
+    {
+        const std::size_t w = window;
+        rolling_order_impl(ws.tree, first, last, w, [&out, w](const rolling_order_statistics<Real>& tree) { *out++ = window_median(tree, w); });
+        return out;
+    }
+};
+
+template<class Real>
+struct rolling_quantile_kernel
+{
+    std::size_t window;
+    Real p;
+
+    template<class RandomAccessIterator, class OutputIterator>
+    OutputIterator operator()(rolling_workspace<Real>& ws, RandomAccessIterator first, RandomAccessIterator last, OutputIterator out) const
+    {
+        if (!(p >= 0 && p <= 1))
+        {
+            throw std::domain_error("The quantile must be in [0, 1].");
+        }
+        const std::size_t w = window;
+        const Real q = p;
+        rolling_order_impl(ws.tree, first, last, w, [&out, w, q](const rolling_order_statistics<Real>& tree) { *out++ = window_quantile(tree, w, q); });
+        return out;
+    }
+};
+
+template<class Real>
+struct rolling_median_absolute_deviation_kernel
+{
+    std::size_t window;
+
+    template<class RandomAccessIterator, class OutputIterator>
+    OutputIterator operator()(rolling_workspace<Real>& ws, RandomAccessIterator first, RandomAccessIterator last, OutputIterator out) const
+    {
+        const std::size_t w = window;
+        rolling_order_impl(ws.tree, first, last, w, [&out, w](const rolling_order_statistics<Real>& tree) { *out++ = window_median_absolute_deviation(tree, w); });
+        return out;
+    }
+};
+
+// Adapts a kernel which writes through an output iterator to one which returns a vector, for the batches:
+template<class Real, class Kernel, bool Ordered>
+struct rolling_vector_kernel
+{
+    Kernel kernel;
+
+    template<class RandomAccessIterator>
+    std::vector<Real> operator()(rolling_workspace<Real>& ws, RandomAccessIterator first, RandomAccessIterator last) const
+    {
+        const std::size_t n = static_cast<std::size_t>(std::distance(first, last));
+        std::vector<Real> result(n >= kernel.window ? n - kernel.window + 1 : 0);
+        call(ws, first, last, result.begin(), std::integral_constant<bool, Ordered>());
+        return result;
+    }
+
+private:
+    template<class RandomAccessIterator, class OutputIterator>
+    void call(rolling_workspace<Real>& ws, RandomAccessIterator first, RandomAccessIterator last, OutputIterator out, const std::true_type&) const
+    {
+        kernel(ws, first, last, out);
+    }
+
+    template<class RandomAccessIterator, class OutputIterator>
+    void call(rolling_workspace<Real>&, RandomAccessIterator first, RandomAccessIterator last, OutputIterator out, const std::false_type&) const
+    {
+        kernel(first, last, out);
+    }
+};
+
+template<class RandomAccessIterator>
+using rolling_iterator_real_t = rolling_real_t<typename std::iterator_traits<RandomAccessIterator>::value_type>;
+
+template<class Container>
+using rolling_batch_real_t = rolling_real_t<batch_value_t<Container>>;
+
+} // namespace detail
+
+//
+// The rolling statistics of one series, written through out, which must have room for n - window + 1 values.
+// Each returns the output iterator past the last value written.
+//
+template<class RandomAccessIterator, class OutputIterator>
+inline OutputIterator rolling_mean(RandomAccessIterator first, RandomAccessIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_iterator_real_t<RandomAccessIterator>;
+    return detail::rolling_mean_kernel<Real>{window}(first, last, out);
+}
+
+template<class RandomAccessIterator, class OutputIterator>
+inline OutputIterator rolling_variance(RandomAccessIterator first, RandomAccessIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_iterator_real_t<RandomAccessIterator>;
+    return detail::rolling_variance_kernel<Real>{window, 0}(first, last, out);
+}
+
+template<class RandomAccessIterator, class OutputIterator>
+inline OutputIterator rolling_sample_variance(RandomAccessIterator first, RandomAccessIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_iterator_real_t<RandomAccessIterator>;
+    if (window < 2)
+    {
+        throw std::domain_error("The sample variance needs a window of at least two values.");
+    }
+    return detail::rolling_variance_kernel<Real>{window, 1}(first, last, out);
+}
+
+template<class RandomAccessIterator, class OutputIterator>
+inline OutputIterator rolling_median(RandomAccessIterator first, RandomAccessIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_iterator_real_t<RandomAccessIterator>;
+    detail::rolling_workspace<Real> ws;
+    return detail::rolling_median_kernel<Real>{window}(ws, first, last, out);
+}
+
+template<class RandomAccessIterator, class OutputIterator, class Real>
+inline OutputIterator rolling_quantile(RandomAccessIterator first, RandomAccessIterator last, std::size_t window, Real p, OutputIterator out)
+{
+    using R = detail::rolling_iterator_real_t<RandomAccessIterator>;
+    detail::rolling_workspace<R> ws;
+    return detail::rolling_quantile_kernel<R>{window, static_cast<R>(p)}(ws, first, last, out);
+}
+
+template<class RandomAccessIterator, class OutputIterator>
+inline OutputIterator rolling_median_absolute_deviation(RandomAccessIterator first, RandomAccessIterator last, std::size_t window, OutputIterator out)
+{
+    using Real = detail::rolling_iterator_real_t<RandomAccessIterator>;
+    detail::rolling_workspace<Real> ws;
+    return detail::rolling_median_absolute_deviation_kernel<Real>{window}(ws, first, last, out);
+}
+
+// The same, returning a vector of the results:
+namespace detail {
+
+template<class RandomAccessContainer>
+inline auto rolling_result(RandomAccessContainer const & v, std::size_t window)
+{
+    using Real = rolling_iterator_real_t<decltype(std::cbegin(v))>;
+    const std::size_t n = static_cast<std::size_t>(std::distance(std::cbegin(v), std::cend(v)));
+    return std::vector<Real>(n >= window && window > 0 ? n - window + 1 : 0);
+}
+
+} // namespace detail
+
+template<class RandomAccessContainer>
+inline auto rolling_mean(RandomAccessContainer const & v, std::size_t window)
+{
+    auto result = detail::rolling_result(v, window);
+    rolling_mean(std::cbegin(v), std::cend(v), window, result.begin());
+    return result;
+}
+
+template<class RandomAccessContainer>
+inline auto rolling_variance(RandomAccessContainer const & v, std::size_t window)
+{
+    auto result = detail::rolling_result(v, window);
+    rolling_variance(std::cbegin(v), std::cend(v), window, result.begin());
+    return result;
+}
+
+template<class RandomAccessContainer>
+inline auto rolling_sample_variance(RandomAccessContainer const & v, std::size_t window)
+{
+    auto result = detail::rolling_result(v, window);
+    rolling_sample_variance(std::cbegin(v), std::cend(v), window, result.begin());
+    return result;
+}
+
+template<class RandomAccessContainer>
+inline auto rolling_median(RandomAccessContainer const & v, std::size_t window)
+{
+    auto result = detail::rolling_result(v, window);
+    rolling_median(std::cbegin(v), std::cend(v), window, result.begin());
+    return result;
+}
+
+template<class RandomAccessContainer, class Real>
+inline auto rolling_quantile(RandomAccessContainer const & v, std::size_t window, Real p)
+{
+    auto result = detail::rolling_result(v, window);
+    rolling_quantile(std::cbegin(v), std::cend(v), window, p, result.begin());
+    return result;
+}
+
+template<class RandomAccessContainer>
+inline auto rolling_median_absolute_deviation(RandomAccessContainer const & v, std::size_t window)
+{
+    auto result = detail::rolling_result(v, window);
+    rolling_median_absolute_deviation(std::cbegin(v), std::cend(v), window, result.begin());
+    return result;
+}
+
+//
+// The rolling statistics of each of a batch of series, which may differ in length.  The parallel
+// versions run the series on the thread pool.
+//
+namespace detail {
+
+template<class Real, class Kernel>
+using rolling_moments_batch_kernel = rolling_vector_kernel<Real, Kernel, false>;
+
+template<class Real, class Kernel>
+using rolling_order_batch_kernel = rolling_vector_kernel<Real, Kernel, true>;
+
+} // namespace detail
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+
+template<class ExecutionPolicy, class Container>
+inline auto rolling_means(ExecutionPolicy&& exec, Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<detail::rolling_moments_tag, std::vector<Real>, detail::rolling_workspace<Real>>(
+        exec, series, detail::rolling_moments_batch_kernel<Real, detail::rolling_mean_kernel<Real>>{{window}});
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto rolling_variances(ExecutionPolicy&& exec, Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<detail::rolling_moments_tag, std::vector<Real>, detail::rolling_workspace<Real>>(
+        exec, series, detail::rolling_moments_batch_kernel<Real, detail::rolling_variance_kernel<Real>>{{window, 0}});
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto rolling_sample_variances(ExecutionPolicy&& exec, Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    if (window < 2)
+    {
+        throw std::domain_error("The sample variance needs a window of at least two values.");
+    }
+    return detail::series_batch<detail::rolling_moments_tag, std::vector<Real>, detail::rolling_workspace<Real>>(
+        exec, series, detail::rolling_moments_batch_kernel<Real, detail::rolling_variance_kernel<Real>>{{window, 1}});
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto rolling_medians(ExecutionPolicy&& exec, Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<detail::rolling_order_tag, std::vector<Real>, detail::rolling_workspace<Real>>(
+        exec, series, detail::rolling_order_batch_kernel<Real, detail::rolling_median_kernel<Real>>{{window}});
+}
+
+template<class ExecutionPolicy, class Container, class Real>
+inline auto rolling_quantiles(ExecutionPolicy&& exec, Container const & series, std::size_t window, Real p)
+{
+    using R = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<detail::rolling_order_tag, std::vector<R>, detail::rolling_workspace<R>>(
+        exec, series, detail::rolling_order_batch_kernel<R, detail::rolling_quantile_kernel<R>>{{window, static_cast<R>(p)}});
+}
+
+template<class ExecutionPolicy, class Container>
+inline auto rolling_median_absolute_deviations(ExecutionPolicy&& exec, Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<detail::rolling_order_tag, std::vector<Real>, detail::rolling_workspace<Real>>(
+        exec, series, detail::rolling_order_batch_kernel<Real, detail::rolling_median_absolute_deviation_kernel<Real>>{{window}});
+}
+
+template<class Container>
+inline auto rolling_means(Container const & series, std::size_t window)
+{
+    return rolling_means(std::execution::seq, series, window);
+}
+
+template<class Container>
+inline auto rolling_variances(Container const & series, std::size_t window)
+{
+    return rolling_variances(std::execution::seq, series, window);
+}
+
+template<class Container>
+inline auto rolling_sample_variances(Container const & series, std::size_t window)
+{
+    return rolling_sample_variances(std::execution::seq, series, window);
+}
+
+template<class Container>
+inline auto rolling_medians(Container const & series, std::size_t window)
+{
+    return rolling_medians(std::execution::seq, series, window);
+}
+
+template<class Container, class Real>
+inline auto rolling_quantiles(Container const & series, std::size_t window, Real p)
+{
+    return rolling_quantiles(std::execution::seq, series, window, p);
+}
+
+template<class Container>
+inline auto rolling_median_absolute_deviations(Container const & series, std::size_t window)
+{
+    return rolling_median_absolute_deviations(std::execution::seq, series, window);
+}
+
+#else // BOOST_MATH_EXEC_COMPATIBLE
+
+template<class Container>
+inline auto rolling_means(Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<std::vector<Real>, detail::rolling_workspace<Real>>(
+        series, detail::rolling_moments_batch_kernel<Real, detail::rolling_mean_kernel<Real>>{{window}});
+}
+
+template<class Container>
+inline auto rolling_variances(Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<std::vector<Real>, detail::rolling_workspace<Real>>(
+        series, detail::rolling_moments_batch_kernel<Real, detail::rolling_variance_kernel<Real>>{{window, 0}});
+}
+
+template<class Container>
+inline auto rolling_sample_variances(Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    if (window < 2)
+    {
+        throw std::domain_error("The sample variance needs a window of at least two values.");
+    }
+    return detail::series_batch<std::vector<Real>, detail::rolling_workspace<Real>>(
+        series, detail::rolling_moments_batch_kernel<Real, detail::rolling_variance_kernel<Real>>{{window, 1}});
+}
+
+template<class Container>
+inline auto rolling_medians(Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<std::vector<Real>, detail::rolling_workspace<Real>>(
+        series, detail::rolling_order_batch_kernel<Real, detail::rolling_median_kernel<Real>>{{window}});
+}
+
+template<class Container, class Real>
+inline auto rolling_quantiles(Container const & series, std::size_t window, Real p)
+{
+    using R = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<std::vector<R>, detail::rolling_workspace<R>>(
+        series, detail::rolling_order_batch_kernel<R, detail::rolling_quantile_kernel<R>>{{window, static_cast<R>(p)}});
+}
+
+template<class Container>
+inline auto rolling_median_absolute_deviations(Container const & series, std::size_t window)
+{
+    using Real = detail::rolling_batch_real_t<Container>;
+    return detail::series_batch<std::vector<Real>, detail::rolling_workspace<Real>>(
+        series, detail::rolling_order_batch_kernel<Real, detail::rolling_median_absolute_deviation_kernel<Real>>{{window}});
+}
+
+#endif // BOOST_MATH_EXEC_COMPATIBLE
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_STATISTICS_ROLLING_STATISTICS_HPP
@@ -0,0 +1,394 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_STATISTICS_THREAD_POOL_HPP
+#define BOOST_MATH_STATISTICS_THREAD_POOL_HPP
+
+#include <boost/math/tools/config.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/is_detected.hpp>
+
+namespace boost { namespace math { namespace statistics {
+
+//
+// A fixed set of worker threads, shared by the parallel statistics so that a call costs a hand over
+// to a waiting thread rather than the creation of new ones.  The parallel algorithms also do part
+// of the work on the calling thread, and only hand chunks to workers that are waiting, so that many
+// concurrent callers do not oversubscribe the machine: when every worker is busy, a call simply runs
+// on its own thread.
+//
+class thread_pool
+{
+public:
+    explicit thread_pool(std::size_t threads = default_size())
+    {
+        m_threads.reserve(threads);
+        for(std::size_t i = 0; i < threads; ++i)
+        {
+            m_threads.emplace_back([this]() { work(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    // Runs the tasks already submitted, then joins the workers:
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        for(auto& t : m_threads)
+        {
+            t.join();
+        }
+    }
+
+    std::size_t size() const noexcept
+    {
+        return m_threads.size();
+    }
+
+    // The number of workers waiting for a task, less the tasks queued for them:
+    std::size_t idle() const noexcept
+    {
+        const std::ptrdiff_t available = m_available.load(std::memory_order_relaxed);
+        return available > 0 ? static_cast<std::size_t>(available) : 0;
+    }
+
+    // Queues f() to run on a worker, or runs it at once if there are none.  f must not throw.
+    template<class F>
+    void submit(F&& f)
+    {
+        if(m_threads.empty())
+        {
+            f();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_tasks.emplace_back(std::forward<F>(f));
+        }
+        m_available.fetch_sub(1, std::memory_order_relaxed);
+        m_cv.notify_one();
+    }
+
+    // The pool the parallel statistics use when not given one: one worker fewer than there are
+    // hardware threads, since the calling thread works too.
+    static thread_pool& shared()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    static std::size_t default_size() noexcept
+    {
+        const unsigned n = std::thread::hardware_concurrency();
+        return n > 1 ? n - 1 : 0;
+    }
+
+private:
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for(;;)
+        {
+            m_available.fetch_add(1, std::memory_order_relaxed);
+            m_cv.wait(lock, [this]() { return m_stop || !m_tasks.empty(); });
+            if(m_tasks.empty())
+            {
+                return;
+            }
+            std::function<void()> task = std::move(m_tasks.front());
+            m_tasks.pop_front();
+            lock.unlock();
+            task();
+            lock.lock();
+        }
+    }
+
+    std::vector<std::thread> m_threads;
+    std::deque<std::function<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::atomic<std::ptrdiff_t> m_available {0};
+    bool m_stop = false;
+};
+
+namespace detail {
+
+//
+// Any type with members submit(f), which runs f() some time on some thread, and size(), the number
+// of threads it runs tasks on, may be passed to the parallel statistics in place of an execution policy.
+// If it also has idle(), the number of those threads free to start a task now, chunks are only handed
+// to that many.
+//
+template<class Executor>
+using executor_submit_t = decltype(std::declval<Executor&>().submit(std::declval<void(*)()>()));
+
+template<class Executor>
+using executor_size_t = decltype(std::declval<const Executor&>().size());
+
+template<class Executor>
+using executor_idle_t = decltype(std::declval<const Executor&>().idle());
+
+template<class T, class U = typename std::remove_cv<typename std::remove_reference<T>::type>::type>
+struct is_executor : std::integral_constant<bool, boost::math::tools::is_detected<executor_submit_t, U>::value &&
+                                                  boost::math::tools::is_detected<executor_size_t, U>::value>
+{};
+
+template<class Executor>
+inline Executor& executor_of_impl(Executor& ex, const std::true_type&)
+{
+    return ex;
+}
+
+template<class ExecutionPolicy>
+inline thread_pool& executor_of_impl(ExecutionPolicy&, const std::false_type&)
+{
+    return thread_pool::shared();
+}
+
+// The executor to run a parallel algorithm on: the one given in place of the execution policy, or the shared pool.
+template<class ExecutionPolicy>
+inline auto executor_of(ExecutionPolicy& exec) -> decltype(executor_of_impl(exec, is_executor<ExecutionPolicy>()))
+{
+    return executor_of_impl(exec, is_executor<ExecutionPolicy>());
+}
+
+template<class Executor>
+inline std::size_t available_workers_impl(const Executor& ex, const std::true_type&)
+{
+    return (std::min)(static_cast<std::size_t>(ex.idle()), static_cast<std::size_t>(ex.size()));
+}
+
+template<class Executor>
+inline std::size_t available_workers_impl(const Executor& ex, const std::false_type&)
+{
+    return static_cast<std::size_t>(ex.size());
+}
+
+template<class Executor>
+inline std::size_t available_workers(const Executor& ex)
+{
+    return available_workers_impl(ex, boost::math::tools::is_detected<executor_idle_t, Executor>());
+}
+
+// A running average, updated without a lock: concurrent updates may be lost, which is harmless for an estimate.
+class running_estimate
+{
+public:
+    explicit running_estimate(double initial) noexcept : m_value(initial) {}
+
+    double get() const noexcept
+    {
+        return m_value.load(std::memory_order_relaxed);
+    }
+
+    void update(double sample) noexcept
+    {
+        const double old = get();
+        m_value.store(old + (sample - old) / 8, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<double> m_value;
+};
+
+// Nanoseconds from handing a chunk to a worker to the worker starting it:
+inline running_estimate& dispatch_latency()
+{
+    static running_estimate estimate(20000);
+    return estimate;
+}
+
+// Nanoseconds per element of the kernel identified by Tag, working in type Real:
+template<class Tag, class Real>
+running_estimate& cost_per_element()
+{
+    static running_estimate estimate(1);
+    return estimate;
+}
+
+//
+// The grain size: each chunk must take at least twice as long as handing it to a worker, and there are
+// at most four chunks per thread, so that a worker which is slow to start costs little.  With both
+// estimates measured as the statistics run, this adapts to the kernel, the type and the machine, rather
+// than to the fixed costs of one benchmark.
+//
+template<class Executor>
+inline std::size_t chunk_count(const Executor& ex, std::size_t elements, const running_estimate& cost)
+{
+    const std::size_t workers = available_workers(ex);
+    if(workers == 0)
+    {
+        return 1;
+    }
+    const double min_chunk = (std::max)(2 * dispatch_latency().get() / cost.get(), 1.0);
+    const double chunks = static_cast<double>(elements) / min_chunk;
+    if(chunks < 2)
+    {
+        return 1;
+    }
+    return (std::min)(static_cast<std::size_t>(chunks), 4 * (workers + 1));
+}
+
+inline std::size_t chunk_begin(std::size_t elements, std::size_t chunks, std::size_t i)
+{
+    return (elements / chunks) * i + (std::min)(i, elements % chunks);
+}
+
+// The chunks + 1 boundaries of the chunks of [first, first + elements), found in one pass:
+template<class ForwardIterator>
+std::vector<ForwardIterator> chunk_iterators(ForwardIterator first, std::size_t elements, std::size_t chunks)
+{
+    std::vector<ForwardIterator> boundaries(chunks + 1, first);
+    for(std::size_t i = 1; i <= chunks; ++i)
+    {
+        boundaries[i] = std::next(boundaries[i - 1], chunk_begin(elements, chunks, i) - chunk_begin(elements, chunks, i - 1));
+    }
+    return boundaries;
+}
+
+inline double elapsed_ns(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs a kernel on the whole range on the calling thread, timing it when it is long enough to measure:
+template<class Kernel>
+auto timed_sequential(running_estimate& cost, std::size_t elements, Kernel kernel) -> decltype(kernel())
+{
+    if(elements < 1024)
+    {
+        return kernel();
+    }
+    const auto start = std::chrono::steady_clock::now();
+    auto result = kernel();
+    cost.update(elapsed_ns(start) / static_cast<double>(elements));
+    return result;
+}
+
+// The chunks of one call, claimed in turn by the calling thread and by any workers which start in time:
+template<class Result, class Kernel>
+class chunk_job
+{
+public:
+    chunk_job(running_estimate& cost, std::size_t elements, std::size_t chunks, const Result& init, Kernel& kernel)
+        : m_cost(&cost), m_elements(elements), m_chunks(chunks), m_kernel(&kernel), m_results(chunks, init)
+    {}
+
+    void run() noexcept
+    {
+        for(;;)
+        {
+            const std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed);
+            if(i >= m_chunks)
+            {
+                // The kernel may refer to the caller's stack, so once every chunk is claimed it must not be touched.
+                return;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            try
+            {
+                m_results[i] = (*m_kernel)(i);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(!m_error)
+                {
+                    m_error = std::current_exception();
+                }
+            }
+            const std::size_t size = chunk_begin(m_elements, m_chunks, i + 1) - chunk_begin(m_elements, m_chunks, i);
+            m_cost->update(elapsed_ns(start) / static_cast<double>(size));
+            if(m_done.fetch_add(1, std::memory_order_acq_rel) + 1 == m_chunks)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_cv.notify_all();
+            }
+        }
+    }
+
+    std::vector<Result> wait()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_done.load(std::memory_order_acquire) == m_chunks; });
+        if(m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+        return std::move(m_results);
+    }
+
+private:
+    running_estimate* m_cost;
+    std::size_t m_elements;
+    std::size_t m_chunks;
+    Kernel* m_kernel;
+    std::vector<Result> m_results;
+    std::atomic<std::size_t> m_next {0};
+    std::atomic<std::size_t> m_done {0};
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::exception_ptr m_error;
+};
+
+//
+// Returns kernel(i) for each chunk i, in order, so that merging them in order gives the same result
+// however the chunks were scheduled.  The calling thread works through the chunks too, so the call
+// completes even if no worker ever starts, and may be made from a worker itself.
+//
+template<class Result, class Executor, class Kernel>
+std::vector<Result> run_chunks(Executor& ex, running_estimate& cost, std::size_t elements, std::size_t chunks, const Result& init, Kernel kernel)
+{
+    if(chunks <= 1)
+    {
+        return std::vector<Result>(1, timed_sequential(cost, elements, [&kernel]() { return kernel(0); }));
+    }
+
+    using job_type = chunk_job<Result, Kernel>;
+    const auto job = std::make_shared<job_type>(cost, elements, chunks, init, kernel);
+    const std::size_t helpers = (std::min)(available_workers(ex), chunks - 1);
+    for(std::size_t i = 0; i < helpers; ++i)
+    {
+        const auto submitted = std::chrono::steady_clock::now();
+        ex.submit([job, submitted]()
+        {
+            dispatch_latency().update(elapsed_ns(submitted));
+            job->run();
+        });
+    }
+    job->run();
+    return job->wait();
+}
+
+} // namespace detail
+
+}}} // namespace boost::math::statistics
+
+#endif // BOOST_MATH_HAS_THREADS
+
+#endif // BOOST_MATH_STATISTICS_THREAD_POOL_HPP
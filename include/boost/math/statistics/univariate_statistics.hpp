@@ -37,6 +37,10 @@ inline auto mean(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator
         {
             return detail::mean_sequential_impl<double>(first, last);
         }
+        else if constexpr (detail::is_executor<ExecutionPolicy>::value)
+        {
+            return detail::mean_parallel_impl<double>(exec, first, last);
+        }
         else
         {
             return std::reduce(exec, first, last, 0.0) / std::distance(first, last);
@@ -48,6 +52,10 @@ inline auto mean(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator
         {
             return detail::mean_sequential_impl<Real>(first, last);
         }
+        else if constexpr (detail::is_executor<ExecutionPolicy>::value)
+        {
+            return detail::mean_parallel_impl<Real>(exec, first, last);
+        }
         else
         {
             return std::reduce(exec, first, last, Real(0.0)) / Real(std::distance(first, last));
@@ -86,7 +94,7 @@ inline auto variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardItera
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(detail::executor_of(exec), first, last);
             return std::get<1>(results) / std::get<4>(results);
         }
     }
@@ -98,7 +106,7 @@ inline auto variance(ExecutionPolicy&& exec, ForwardIterator first, ForwardItera
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(detail::executor_of(exec), first, last);
             return std::get<1>(results) / std::get<4>(results);
         }
     }
@@ -162,7 +170,7 @@ inline auto mean_and_sample_variance(ExecutionPolicy&& exec, ForwardIterator fir
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(detail::executor_of(exec), first, last);
             return std::make_pair(std::get<0>(results), std::get<1>(results) / (std::get<4>(results)-1.0));
         }
     }
@@ -175,7 +183,7 @@ inline auto mean_and_sample_variance(ExecutionPolicy&& exec, ForwardIterator fir
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(detail::executor_of(exec), first, last);
             return std::make_pair(std::get<0>(results), std::get<1>(results) / (std::get<4>(results)-Real(1)));
         }
     }
@@ -214,7 +222,7 @@ inline auto first_four_moments(ExecutionPolicy&& exec, ForwardIterator first, Fo
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<double, double, double, double, double>>(detail::executor_of(exec), first, last);
             return std::make_tuple(std::get<0>(results), std::get<1>(results) / std::get<4>(results), std::get<2>(results) / std::get<4>(results),
                                    std::get<3>(results) / std::get<4>(results));
         }
@@ -229,7 +237,7 @@ inline auto first_four_moments(ExecutionPolicy&& exec, ForwardIterator first, Fo
         }
         else
         {
-            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(first, last);
+            const auto results = detail::first_four_moments_parallel_impl<std::tuple<Real, Real, Real, Real, Real>>(detail::executor_of(exec), first, last);
             return std::make_tuple(std::get<0>(results), std::get<1>(results) / std::get<4>(results), std::get<2>(results) / std::get<4>(results),
                                    std::get<3>(results) / std::get<4>(results));
         }
@@ -274,9 +282,8 @@ inline auto skewness(ExecutionPolicy&& exec, ForwardIterator first, ForwardItera
     }
     else
     {
+        // The central moments, not their sums, so that the skewness is M3/M2^(3/2) as in the sequential case:
         const auto [M1, M2, M3, M4] = first_four_moments(exec, first, last);
-        const auto n = std::distance(first, last);
-        const auto var = M2/(n-1);
 
         if (M2 == 0)
         {
@@ -293,7 +300,7 @@ inline auto skewness(ExecutionPolicy&& exec, ForwardIterator first, ForwardItera
         }
         else
         {
-            return M3/(M2*sqrt(var)) / Real(2);
+            return M3/(M2*sqrt(M2));
         }
     }
 }
@@ -695,6 +702,167 @@ inline auto mode(Container & v)
     return mode(std::execution::seq, std::begin(v), std::end(v));
 }
 
+// The weighted statistics, with the weights in a container of the same size as the data:
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_mean(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    using Real = detail::weighted_real_t<Container>;
+    const std::size_t n = detail::weighted_size(v, weights);
+
+    std::pair<Real, Real> results;
+    if constexpr (std::is_same_v<std::remove_reference_t<decltype(exec)>, decltype(std::execution::seq)>)
+    {
+        results = detail::weighted_mean_sequential_impl<Real>(std::cbegin(v), std::cend(v), std::cbegin(weights));
+    }
+    else
+    {
+        results = detail::weighted_mean_parallel_impl<Real>(detail::executor_of(exec), std::cbegin(v), n, std::cbegin(weights));
+    }
+    detail::check_weight_sum(results.second);
+    return results.first;
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_mean(Container const & v, WeightContainer const & weights)
+{
+    return weighted_mean(std::execution::seq, v, weights);
+}
+
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_first_four_moments(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    using Real = detail::weighted_real_t<Container>;
+    const std::size_t n = detail::weighted_size(v, weights);
+
+    std::tuple<Real, Real, Real, Real, Real> results;
+    if constexpr (std::is_same_v<std::remove_reference_t<decltype(exec)>, decltype(std::execution::seq)>)
+    {
+        results = detail::weighted_first_four_moments_sequential_impl<Real>(std::cbegin(v), std::cend(v), std::cbegin(weights));
+    }
+    else
+    {
+        results = detail::weighted_first_four_moments_parallel_impl<Real>(detail::executor_of(exec), std::cbegin(v), n, std::cbegin(weights));
+    }
+    detail::check_weight_sum(std::get<4>(results));
+    return std::make_tuple(std::get<0>(results), std::get<1>(results) / std::get<4>(results), std::get<2>(results) / std::get<4>(results),
+                           std::get<3>(results) / std::get<4>(results));
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_first_four_moments(Container const & v, WeightContainer const & weights)
+{
+    return weighted_first_four_moments(std::execution::seq, v, weights);
+}
+
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_variance(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    return std::get<1>(weighted_first_four_moments(exec, v, weights));
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_variance(Container const & v, WeightContainer const & weights)
+{
+    return weighted_variance(std::execution::seq, v, weights);
+}
+
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_skewness(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    using std::sqrt;
+    const auto [M1, M2, M3, M4] = weighted_first_four_moments(exec, v, weights);
+    if (M2 == 0)
+    {
+        // A constant dataset has no skewness, as in the unweighted case:
+        return M2;
+    }
+    return M3/(M2*sqrt(M2));
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_skewness(Container const & v, WeightContainer const & weights)
+{
+    return weighted_skewness(std::execution::seq, v, weights);
+}
+
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_kurtosis(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    const auto [M1, M2, M3, M4] = weighted_first_four_moments(exec, v, weights);
+    if (M2 == 0)
+    {
+        return M2;
+    }
+    return M4/(M2*M2);
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_kurtosis(Container const & v, WeightContainer const & weights)
+{
+    return weighted_kurtosis(std::execution::seq, v, weights);
+}
+
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_excess_kurtosis(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    return weighted_kurtosis(exec, v, weights) - 3;
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_excess_kurtosis(Container const & v, WeightContainer const & weights)
+{
+    return weighted_excess_kurtosis(std::execution::seq, v, weights);
+}
+
+// The selection is sequential, on a copy of the values and weights, so neither container is modified:
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_quantile(ExecutionPolicy&&, Container const & v, WeightContainer const & weights, detail::weighted_real_t<Container> p)
+{
+    using Real = detail::weighted_real_t<Container>;
+    auto pairs = detail::weighted_pairs<Real>(v, weights);
+    return detail::weighted_quantile_impl(pairs, p);
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_quantile(Container const & v, WeightContainer const & weights, detail::weighted_real_t<Container> p)
+{
+    return weighted_quantile(std::execution::seq, v, weights, p);
+}
+
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_median(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    return weighted_quantile(exec, v, weights, detail::weighted_real_t<Container>(0.5));
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_median(Container const & v, WeightContainer const & weights)
+{
+    return weighted_median(std::execution::seq, v, weights);
+}
+
+template<class ExecutionPolicy, class Container, class WeightContainer>
+inline auto weighted_gini_coefficient(ExecutionPolicy&& exec, Container const & v, WeightContainer const & weights)
+{
+    using Real = detail::weighted_real_t<Container>;
+    auto pairs = detail::weighted_pairs<Real>(v, weights);
+    if constexpr (detail::is_executor<ExecutionPolicy>::value)
+    {
+        std::sort(pairs.begin(), pairs.end());
+    }
+    else
+    {
+        std::sort(exec, pairs.begin(), pairs.end());
+    }
+    return detail::weighted_gini_coefficient_impl(pairs);
+}
+
+template<class Container, class WeightContainer>
+inline auto weighted_gini_coefficient(Container const & v, WeightContainer const & weights)
+{
+    return weighted_gini_coefficient(std::execution::seq, v, weights);
+}
+
 } // Namespace boost::math::statistics
 
 #else // Backwards compatible bindings for C++11 or execution is not implemented
@@ -1179,6 +1347,89 @@ inline std::list<Real> mode(Container& c)
 {
     return mode(std::begin(c), std::end(c));
 }
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_mean(const Container& v, const WeightContainer& weights)
+{
+    detail::weighted_size(v, weights);
+    const std::pair<Real, Real> results = detail::weighted_mean_sequential_impl<Real>(std::begin(v), std::end(v), std::begin(weights));
+    detail::check_weight_sum(results.second);
+    return results.first;
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline std::tuple<Real, Real, Real, Real> weighted_first_four_moments(const Container& v, const WeightContainer& weights)
+{
+    detail::weighted_size(v, weights);
+    const auto results = detail::weighted_first_four_moments_sequential_impl<Real>(std::begin(v), std::end(v), std::begin(weights));
+    detail::check_weight_sum(std::get<4>(results));
+    return std::make_tuple(std::get<0>(results), std::get<1>(results) / std::get<4>(results), std::get<2>(results) / std::get<4>(results),
+                           std::get<3>(results) / std::get<4>(results));
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_variance(const Container& v, const WeightContainer& weights)
+{
+    return std::get<1>(weighted_first_four_moments(v, weights));
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_skewness(const Container& v, const WeightContainer& weights)
+{
+    using std::sqrt;
+    std::tuple<Real, Real, Real, Real> M = weighted_first_four_moments(v, weights);
+
+    if(std::get<1>(M) == 0)
+    {
+        return std::get<1>(M);
+    }
+    else
+    {
+        return std::get<2>(M)/(std::get<1>(M)*sqrt(std::get<1>(M)));
+    }
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_kurtosis(const Container& v, const WeightContainer& weights)
+{
+    std::tuple<Real, Real, Real, Real> M = weighted_first_four_moments(v, weights);
+
+    if(std::get<1>(M) == 0)
+    {
+        return std::get<1>(M);
+    }
+    else
+    {
+        return std::get<3>(M)/(std::get<1>(M)*std::get<1>(M));
+    }
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_excess_kurtosis(const Container& v, const WeightContainer& weights)
+{
+    return weighted_kurtosis(v, weights) - 3;
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_quantile(const Container& v, const WeightContainer& weights, detail::weighted_real_t<Container> p)
+{
+    std::vector<std::pair<Real, Real>> pairs = detail::weighted_pairs<Real>(v, weights);
+    return detail::weighted_quantile_impl(pairs, p);
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_median(const Container& v, const WeightContainer& weights)
+{
+    return weighted_quantile(v, weights, Real(0.5));
+}
+
+template<class Container, class WeightContainer, typename Real = detail::weighted_real_t<Container>>
+inline Real weighted_gini_coefficient(const Container& v, const WeightContainer& weights)
+{
+    std::vector<std::pair<Real, Real>> pairs = detail::weighted_pairs<Real>(v, weights);
+    std::sort(pairs.begin(), pairs.end());
+    return detail::weighted_gini_coefficient_impl(pairs);
+}
 }}}
 #endif
 #endif // BOOST_MATH_STATISTICS_UNIVARIATE_STATISTICS_HPP
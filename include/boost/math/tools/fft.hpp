@@ -0,0 +1,535 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_FFT_HPP
+#define BOOST_MATH_TOOLS_FFT_HPP
+
+#include <cstddef>
+#include <complex>
+#include <vector>
+#include <memory>
+#include <map>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <boost/math/tools/config.hpp>
+#include <boost/math/special_functions/cos_pi.hpp>
+#include <boost/math/special_functions/sin_pi.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <mutex>
+#endif
+
+// A header-only, type-generic FFT used as the default backend of chebyshev_transform and cardinal_trigonometric.
+// Transform lengths which factor into 2, 3, 4 and 5 are computed by a Stockham autosort algorithm,
+// whose innermost loops run with unit stride over contiguous data so that they vectorize.
+// All other lengths are mapped onto a power-of-two convolution via Bluestein's algorithm.
+
+namespace boost { namespace math { namespace tools {
+
+namespace detail {
+
+// std::complex multiplication performs C99 Annex G NaN recovery, which is far too slow for a butterfly:
+template<class Real>
+inline std::complex<Real> fft_mul(const std::complex<Real>& a, const std::complex<Real>& b)
+{
+    return std::complex<Real>(a.real()*b.real() - a.imag()*b.imag(), a.real()*b.imag() + a.imag()*b.real());
+}
+
+// -i*z:
+template<class Real>
+inline std::complex<Real> fft_mul_minus_i(const std::complex<Real>& z)
+{
+    return std::complex<Real>(z.imag(), -z.real());
+}
+
+// exp(-2 pi i k/n), with k reduced modulo n so that the argument is exact:
+template<class Real>
+std::complex<Real> fft_root_of_unity(std::size_t k, std::size_t n)
+{
+    k %= n;
+    Real x = Real(2*k)/Real(n);
+    return std::complex<Real>(boost::math::cos_pi(x), -boost::math::sin_pi(x));
+}
+
+template<class Plan>
+std::shared_ptr<const Plan> cached_fft_plan(std::size_t n)
+{
+    // Plans are immutable once built, so a single cache can be shared by all threads:
+    static std::map<std::size_t, std::shared_ptr<const Plan>> cache;
+#ifdef BOOST_MATH_HAS_THREADS
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+#endif
+    auto it = cache.find(n);
+    if (it != cache.end())
+    {
+        return it->second;
+    }
+    // Don't let a caller who walks through many lengths grow the cache without bound:
+    if (cache.size() >= 64)
+    {
+        cache.clear();
+    }
+    auto plan = std::make_shared<const Plan>(n);
+    cache.emplace(n, plan);
+    return plan;
+}
+
+} // namespace detail
+
+template<class Real>
+class fft_plan
+{
+public:
+    using complex_type = std::complex<Real>;
+
+    explicit fft_plan(std::size_t n) : m_n(n)
+    {
+        if (n == 0)
+        {
+            throw std::domain_error("The transform length must be positive.");
+        }
+        std::size_t r = n;
+        while (r % 4 == 0)
+        {
+            m_radices.push_back(4);
+            r /= 4;
+        }
+        for (std::size_t p : {2, 3, 5})
+        {
+            while (r % p == 0)
+            {
+                m_radices.push_back(p);
+                r /= p;
+            }
+        }
+
+        if (r != 1)
+        {
+            // Bluestein: X_k = w_k sum_j (x_j w_j) conj(w_{k-j}), where w_k = exp(-pi i k^2/n).
+            m_radices.clear();
+            std::size_t m = 1;
+            while (m < 2*n - 1)
+            {
+                m *= 2;
+            }
+            m_convolution_plan = std::make_shared<const fft_plan>(m);
+            m_chirp.resize(n);
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                m_chirp[k] = detail::fft_root_of_unity<Real>((k*k) % (2*n), 2*n);
+            }
+            m_kernel.assign(m, complex_type(0, 0));
+            m_kernel[0] = std::conj(m_chirp[0]);
+            for (std::size_t k = 1; k < n; ++k)
+            {
+                m_kernel[k] = std::conj(m_chirp[k]);
+                m_kernel[m - k] = std::conj(m_chirp[k]);
+            }
+            m_convolution_plan->forward(m_kernel.data());
+            // Fold the normalization of the inverse transform into the kernel:
+            Real inv_m = 1/Real(m);
+            for (auto & z : m_kernel)
+            {
+                z *= inv_m;
+            }
+            return;
+        }
+
+        std::size_t stage_length = n;
+        for (std::size_t p : m_radices)
+        {
+            std::size_t m = stage_length/p;
+            std::vector<complex_type> w(m*(p - 1));
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                for (std::size_t k = 1; k < p; ++k)
+                {
+                    w[j*(p - 1) + k - 1] = detail::fft_root_of_unity<Real>(j*k, stage_length);
+                }
+            }
+            m_twiddles.push_back(std::move(w));
+            stage_length = m;
+        }
+        m_c3 = boost::math::sin_pi(Real(2)/3);
+        m_c51 = boost::math::cos_pi(Real(2)/5);
+        m_c52 = boost::math::cos_pi(Real(4)/5);
+        m_s51 = boost::math::sin_pi(Real(2)/5);
+        m_s52 = boost::math::sin_pi(Real(4)/5);
+    }
+
+    std::size_t size() const
+    {
+        return m_n;
+    }
+
+    // X_k = sum_j x_j exp(-2 pi i jk/n), in place.
+    void forward(complex_type* data) const
+    {
+        if (m_convolution_plan)
+        {
+            bluestein(data);
+        }
+        else
+        {
+            stockham(data);
+        }
+    }
+
+    // x_j = sum_k X_k exp(2 pi i jk/n), in place. As with FFTW, the result is not divided by n.
+    void inverse(complex_type* data) const
+    {
+        for (std::size_t i = 0; i < m_n; ++i)
+        {
+            data[i] = std::conj(data[i]);
+        }
+        forward(data);
+        for (std::size_t i = 0; i < m_n; ++i)
+        {
+            data[i] = std::conj(data[i]);
+        }
+    }
+
+private:
+    void stockham(complex_type* data) const
+    {
+        std::vector<complex_type> work(m_n);
+        complex_type* x = data;
+        complex_type* y = work.data();
+        std::size_t n = m_n;
+        std::size_t s = 1;
+        for (std::size_t stage = 0; stage < m_radices.size(); ++stage)
+        {
+            const std::size_t p = m_radices[stage];
+            const std::size_t m = n/p;
+            const complex_type* w = m_twiddles[stage].data();
+            switch (p)
+            {
+            case 2:
+                radix_2(x, y, m, s, w);
+                break;
+            case 3:
+                radix_3(x, y, m, s, w);
+                break;
+            case 4:
+                radix_4(x, y, m, s, w);
+                break;
+            default:
+                radix_5(x, y, m, s, w);
+                break;
+            }
+            std::swap(x, y);
+            n = m;
+            s *= p;
+        }
+        if (x != data)
+        {
+            std::copy(x, x + m_n, data);
+        }
+    }
+
+    // Each stage splits the length n = p*m transforms at stride s into p transforms of length m at stride p*s:
+    //   y[q + s(p j + k)] = W_n^{jk} sum_r x[q + s(j + r m)] W_p^{rk}.
+    static void radix_2(const complex_type* x, complex_type* y, std::size_t m, std::size_t s, const complex_type* w)
+    {
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            const complex_type w1 = w[j];
+            const complex_type* x0 = x + s*j;
+            const complex_type* x1 = x + s*(j + m);
+            complex_type* y0 = y + s*(2*j);
+            complex_type* y1 = y + s*(2*j + 1);
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                const complex_type a = x0[q];
+                const complex_type b = x1[q];
+                y0[q] = a + b;
+                y1[q] = detail::fft_mul(a - b, w1);
+            }
+        }
+    }
+
+    void radix_3(const complex_type* x, complex_type* y, std::size_t m, std::size_t s, const complex_type* w) const
+    {
+        const Real c3 = m_c3;
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            const complex_type w1 = w[2*j];
+            const complex_type w2 = w[2*j + 1];
+            const complex_type* x0 = x + s*j;
+            const complex_type* x1 = x + s*(j + m);
+            const complex_type* x2 = x + s*(j + 2*m);
+            complex_type* y0 = y + s*(3*j);
+            complex_type* y1 = y + s*(3*j + 1);
+            complex_type* y2 = y + s*(3*j + 2);
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                const complex_type a0 = x0[q];
+                const complex_type t1 = x1[q] + x2[q];
+                const complex_type m1 = a0 - t1*Real(0.5);
+                const complex_type m2 = detail::fft_mul_minus_i(complex_type(x1[q] - x2[q])*c3);
+                y0[q] = a0 + t1;
+                y1[q] = detail::fft_mul(m1 + m2, w1);
+                y2[q] = detail::fft_mul(m1 - m2, w2);
+            }
+        }
+    }
+
+    static void radix_4(const complex_type* x, complex_type* y, std::size_t m, std::size_t s, const complex_type* w)
+    {
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            const complex_type w1 = w[3*j];
+            const complex_type w2 = w[3*j + 1];
+            const complex_type w3 = w[3*j + 2];
+            const complex_type* x0 = x + s*j;
+            const complex_type* x1 = x + s*(j + m);
+            const complex_type* x2 = x + s*(j + 2*m);
+            const complex_type* x3 = x + s*(j + 3*m);
+            complex_type* y0 = y + s*(4*j);
+            complex_type* y1 = y + s*(4*j + 1);
+            complex_type* y2 = y + s*(4*j + 2);
+            complex_type* y3 = y + s*(4*j + 3);
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                const complex_type t0 = x0[q] + x2[q];
+                const complex_type t1 = x0[q] - x2[q];
+                const complex_type t2 = x1[q] + x3[q];
+                const complex_type t3 = detail::fft_mul_minus_i(complex_type(x1[q] - x3[q]));
+                y0[q] = t0 + t2;
+                y1[q] = detail::fft_mul(t1 + t3, w1);
+                y2[q] = detail::fft_mul(t0 - t2, w2);
+                y3[q] = detail::fft_mul(t1 - t3, w3);
+            }
+        }
+    }
+
+    void radix_5(const complex_type* x, complex_type* y, std::size_t m, std::size_t s, const complex_type* w) const
+    {
+        const Real c1 = m_c51;
+        const Real c2 = m_c52;
+        const Real s1 = m_s51;
+        const Real s2 = m_s52;
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            const complex_type w1 = w[4*j];
+            const complex_type w2 = w[4*j + 1];
+            const complex_type w3 = w[4*j + 2];
+            const complex_type w4 = w[4*j + 3];
+            const complex_type* x0 = x + s*j;
+            const complex_type* x1 = x + s*(j + m);
+            const complex_type* x2 = x + s*(j + 2*m);
+            const complex_type* x3 = x + s*(j + 3*m);
+            const complex_type* x4 = x + s*(j + 4*m);
+            complex_type* y0 = y + s*(5*j);
+            complex_type* y1 = y + s*(5*j + 1);
+            complex_type* y2 = y + s*(5*j + 2);
+            complex_type* y3 = y + s*(5*j + 3);
+            complex_type* y4 = y + s*(5*j + 4);
+            for (std::size_t q = 0; q < s; ++q)
+            {
+                const complex_type a0 = x0[q];
+                const complex_type p14 = x1[q] + x4[q];
+                const complex_type m14 = x1[q] - x4[q];
+                const complex_type p23 = x2[q] + x3[q];
+                const complex_type m23 = x2[q] - x3[q];
+                const complex_type r1 = a0 + p14*c1 + p23*c2;
+                const complex_type r2 = a0 + p14*c2 + p23*c1;
+                const complex_type i1 = detail::fft_mul_minus_i(complex_type(m14*s1 + m23*s2));
+                const complex_type i2 = detail::fft_mul_minus_i(complex_type(m14*s2 - m23*s1));
+                y0[q] = a0 + p14 + p23;
+                y1[q] = detail::fft_mul(r1 + i1, w1);
+                y2[q] = detail::fft_mul(r2 + i2, w2);
+                y3[q] = detail::fft_mul(r2 - i2, w3);
+                y4[q] = detail::fft_mul(r1 - i1, w4);
+            }
+        }
+    }
+
+    void bluestein(complex_type* data) const
+    {
+        const std::size_t m = m_kernel.size();
+        std::vector<complex_type> a(m, complex_type(0, 0));
+        for (std::size_t k = 0; k < m_n; ++k)
+        {
+            a[k] = detail::fft_mul(data[k], m_chirp[k]);
+        }
+        m_convolution_plan->forward(a.data());
+        for (std::size_t k = 0; k < m; ++k)
+        {
+            a[k] = detail::fft_mul(a[k], m_kernel[k]);
+        }
+        m_convolution_plan->inverse(a.data());
+        for (std::size_t k = 0; k < m_n; ++k)
+        {
+            data[k] = detail::fft_mul(a[k], m_chirp[k]);
+        }
+    }
+
+    std::size_t m_n;
+    std::vector<std::size_t> m_radices;
+    std::vector<std::vector<complex_type>> m_twiddles;
+    Real m_c3 = 0;
+    Real m_c51 = 0;
+    Real m_c52 = 0;
+    Real m_s51 = 0;
+    Real m_s52 = 0;
+    std::vector<complex_type> m_chirp;
+    std::vector<complex_type> m_kernel;
+    std::shared_ptr<const fft_plan> m_convolution_plan;
+};
+
+// Transform of real data, returning the n/2 + 1 non-redundant coefficients (the FFTW r2c convention).
+template<class Real>
+class real_fft_plan
+{
+public:
+    using complex_type = std::complex<Real>;
+
+    explicit real_fft_plan(std::size_t n) : m_n(n)
+    {
+        if (n == 0)
+        {
+            throw std::domain_error("The transform length must be positive.");
+        }
+        if (n % 2 == 0)
+        {
+            // Pack the even and odd samples into a complex transform of half the length:
+            m_plan = detail::cached_fft_plan<fft_plan<Real>>(n/2);
+            m_twiddles.resize(n/2 + 1);
+            for (std::size_t k = 0; k <= n/2; ++k)
+            {
+                m_twiddles[k] = detail::fft_root_of_unity<Real>(k, n);
+            }
+        }
+        else
+        {
+            m_plan = detail::cached_fft_plan<fft_plan<Real>>(n);
+        }
+    }
+
+    std::size_t size() const
+    {
+        return m_n;
+    }
+
+    void execute(const Real* in, complex_type* out) const
+    {
+        if (m_n % 2 != 0)
+        {
+            std::vector<complex_type> z(in, in + m_n);
+            m_plan->forward(z.data());
+            std::copy(z.begin(), z.begin() + (m_n/2 + 1), out);
+            return;
+        }
+        const std::size_t h = m_n/2;
+        std::vector<complex_type> z(h);
+        for (std::size_t j = 0; j < h; ++j)
+        {
+            z[j] = complex_type(in[2*j], in[2*j + 1]);
+        }
+        m_plan->forward(z.data());
+        // With E and O the transforms of the even and odd samples, Z = E + iO and X_k = E_k + W_n^k O_k:
+        for (std::size_t k = 0; k <= h; ++k)
+        {
+            const complex_type zk = z[k % h];
+            const complex_type zc = std::conj(z[(h - k) % h]);
+            const complex_type e = (zk + zc)*Real(0.5);
+            const complex_type o = detail::fft_mul_minus_i(complex_type(zk - zc))*Real(0.5);
+            out[k] = e + detail::fft_mul(m_twiddles[k], o);
+        }
+    }
+
+private:
+    std::size_t m_n;
+    std::shared_ptr<const fft_plan<Real>> m_plan;
+    std::vector<complex_type> m_twiddles;
+};
+
+// Type II discrete cosine transform, y_k = 2 sum_j x_j cos(pi k(2j + 1)/2n) (the FFTW REDFT10 convention),
+// computed with a single real transform of length n following Makhoul.
+template<class Real>
+class dct_2_plan
+{
+public:
+    explicit dct_2_plan(std::size_t n) : m_n(n)
+    {
+        if (n == 0)
+        {
+            throw std::domain_error("The transform length must be positive.");
+        }
+        m_plan = detail::cached_fft_plan<real_fft_plan<Real>>(n);
+        m_twiddles.resize(n/2 + 1);
+        for (std::size_t k = 0; k <= n/2; ++k)
+        {
+            m_twiddles[k] = detail::fft_root_of_unity<Real>(k, 4*n);
+        }
+    }
+
+    std::size_t size() const
+    {
+        return m_n;
+    }
+
+    void execute(const Real* in, Real* out) const
+    {
+        std::vector<Real> v(m_n);
+        for (std::size_t j = 0; 2*j < m_n; ++j)
+        {
+            v[j] = in[2*j];
+        }
+        for (std::size_t j = 0; 2*j + 1 < m_n; ++j)
+        {
+            v[m_n - 1 - j] = in[2*j + 1];
+        }
+        std::vector<std::complex<Real>> V(m_n/2 + 1);
+        m_plan->execute(v.data(), V.data());
+        // y_k = 2 Re(exp(-i pi k/2n) V_k); for k > n/2 use V_k = conj(V_{n-k}) and exp(-i pi k/2n) = -i conj(exp(-i pi (n-k)/2n)):
+        for (std::size_t k = 0; k <= m_n/2; ++k)
+        {
+            out[k] = 2*detail::fft_mul(m_twiddles[k], V[k]).real();
+        }
+        for (std::size_t k = m_n/2 + 1; k < m_n; ++k)
+        {
+            const std::size_t l = m_n - k;
+            const std::complex<Real> t = detail::fft_mul_minus_i(std::conj(m_twiddles[l]));
+            out[k] = 2*detail::fft_mul(t, std::conj(V[l])).real();
+        }
+    }
+
+private:
+    std::size_t m_n;
+    std::shared_ptr<const real_fft_plan<Real>> m_plan;
+    std::vector<std::complex<Real>> m_twiddles;
+};
+
+template<class Real>
+void fft(std::complex<Real>* data, std::size_t n)
+{
+    detail::cached_fft_plan<fft_plan<Real>>(n)->forward(data);
+}
+
+template<class Real>
+void ifft(std::complex<Real>* data, std::size_t n)
+{
+    detail::cached_fft_plan<fft_plan<Real>>(n)->inverse(data);
+}
+
+template<class Real>
+void real_fft(const Real* in, std::size_t n, std::complex<Real>* out)
+{
+    detail::cached_fft_plan<real_fft_plan<Real>>(n)->execute(in, out);
+}
+
+template<class Real>
+void dct_2(const Real* in, std::size_t n, Real* out)
+{
+    detail::cached_fft_plan<dct_2_plan<Real>>(n)->execute(in, out);
+}
+
+}}} // namespace boost::math::tools
+
+#endif // BOOST_MATH_TOOLS_FFT_HPP
@@ -0,0 +1,98 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions.hpp>
+#include <boost/math/distributions/sampler.hpp>
+#include <boost/math/distributions/discrete_table.hpp>
+
+using namespace boost::math;
+
+template<class Dist>
+void DistributionQuantile(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto & v : x)
+        {
+            v = quantile(dist, unif(gen));
+        }
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TableQuantile(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    discrete_table<Dist> table(dist);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto & v : x)
+        {
+            v = table.quantile(unif(gen));
+        }
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void Sampler(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    sampler<Dist> s(dist);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        s.fill(gen, x.begin(), x.end());
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TableSampler(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    discrete_table<Dist> table(dist);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        table.fill(gen, x.begin(), x.end());
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+// The default policy rounds quantiles outwards, which the table handles without calling the distribution:
+BENCHMARK_CAPTURE(DistributionQuantile, poisson, poisson_distribution<double>(25))->Arg(4096);
+BENCHMARK_CAPTURE(TableQuantile, poisson, poisson_distribution<double>(25))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, poisson, poisson_distribution<double>(25))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, poisson, poisson_distribution<double>(25))->Arg(4096);
+BENCHMARK_CAPTURE(DistributionQuantile, binomial, binomial_distribution<double>(100, 0.3))->Arg(4096);
+BENCHMARK_CAPTURE(TableQuantile, binomial, binomial_distribution<double>(100, 0.3))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, binomial, binomial_distribution<double>(100, 0.3))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, binomial, binomial_distribution<double>(100, 0.3))->Arg(4096);
+BENCHMARK_CAPTURE(DistributionQuantile, negative_binomial, negative_binomial_distribution<double>(5, 0.2))->Arg(4096);
+BENCHMARK_CAPTURE(TableQuantile, negative_binomial, negative_binomial_distribution<double>(5, 0.2))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, negative_binomial, negative_binomial_distribution<double>(5, 0.2))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, negative_binomial, negative_binomial_distribution<double>(5, 0.2))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, hypergeometric, hypergeometric_distribution<double>(50, 200, 500))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, hypergeometric, hypergeometric_distribution<double>(50, 200, 500))->Arg(4096);
+
+BENCHMARK_MAIN();
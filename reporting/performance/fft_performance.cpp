@@ -0,0 +1,58 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <complex>
+#include <benchmark/benchmark.h>
+#include <boost/math/tools/fft.hpp>
+
+template<class Real>
+void ComplexFFT(benchmark::State& state)
+{
+    std::size_t n = state.range(0);
+    std::vector<std::complex<Real>> v(n);
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<Real> unif(-1, 1);
+    for (auto & z : v)
+    {
+        z = std::complex<Real>(unif(mt), unif(mt));
+    }
+    boost::math::tools::fft_plan<Real> plan(n);
+    for (auto _ : state)
+    {
+        plan.forward(v.data());
+        benchmark::DoNotOptimize(v.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+template<class Real>
+void DCT2(benchmark::State& state)
+{
+    std::size_t n = state.range(0);
+    std::vector<Real> v(n);
+    std::vector<Real> w(n);
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<Real> unif(-1, 1);
+    for (auto & x : v)
+    {
+        x = unif(mt);
+    }
+    for (auto _ : state)
+    {
+        boost::math::tools::dct_2(v.data(), n, w.data());
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+// Powers of two exercise the radix 4/2 path:
+BENCHMARK_TEMPLATE(ComplexFFT, double)->RangeMultiplier(2)->Range(1<<4, 1<<20)->Complexity(benchmark::oNLogN);
+// 3^k*5 exercises radix 3 and 5, and primes go through Bluestein:
+BENCHMARK_TEMPLATE(ComplexFFT, double)->Arg(1215)->Arg(3645)->Arg(10935)->Arg(1021)->Arg(65537);
+BENCHMARK_TEMPLATE(DCT2, double)->RangeMultiplier(2)->Range(1<<4, 1<<20)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/lambert_w.hpp>
+
+template<class Real>
+std::vector<Real> random_arguments(Real a, Real b, std::size_t n)
+{
+    std::vector<Real> v(n);
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<Real> unif(a, b);
+    for (auto & x : v)
+    {
+        x = unif(mt);
+    }
+    return v;
+}
+
+template<class Real>
+void LambertW0Scalar(benchmark::State& state)
+{
+    auto z = random_arguments<Real>(Real(-0.3), Real(state.range(1)), state.range(0));
+    std::vector<Real> w(z.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < z.size(); ++i)
+        {
+            w[i] = boost::math::lambert_w0(z[i]);
+        }
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetItemsProcessed(state.iterations()*z.size());
+}
+
+template<class Real>
+void LambertW0Batch(benchmark::State& state)
+{
+    auto z = random_arguments<Real>(Real(-0.3), Real(state.range(1)), state.range(0));
+    std::vector<Real> w(z.size());
+    for (auto _ : state)
+    {
+        boost::math::lambert_w0(z.begin(), z.end(), w.begin());
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetItemsProcessed(state.iterations()*z.size());
+}
+
+template<class Real>
+void LambertWm1Scalar(benchmark::State& state)
+{
+    auto z = random_arguments<Real>(Real(-0.25), Real(-1e-10), state.range(0));
+    std::vector<Real> w(z.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < z.size(); ++i)
+        {
+            w[i] = boost::math::lambert_wm1(z[i]);
+        }
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetItemsProcessed(state.iterations()*z.size());
+}
+
+template<class Real>
+void LambertWm1Batch(benchmark::State& state)
+{
+    auto z = random_arguments<Real>(Real(-0.25), Real(-1e-10), state.range(0));
+    std::vector<Real> w(z.size());
+    for (auto _ : state)
+    {
+        boost::math::lambert_wm1(z.begin(), z.end(), w.begin());
+        benchmark::DoNotOptimize(w.data());
+    }
+    state.SetItemsProcessed(state.iterations()*z.size());
+}
+
+BENCHMARK_TEMPLATE(LambertW0Scalar, float)->Args({4096, 10})->Args({4096, 1000});
+BENCHMARK_TEMPLATE(LambertW0Batch, float)->Args({4096, 10})->Args({4096, 1000});
+BENCHMARK_TEMPLATE(LambertW0Scalar, double)->Args({4096, 10})->Args({4096, 1000})->Args({65536, 1000});
+BENCHMARK_TEMPLATE(LambertW0Batch, double)->Args({4096, 10})->Args({4096, 1000})->Args({65536, 1000});
+BENCHMARK_TEMPLATE(LambertW0Scalar, long double)->Args({4096, 1000});
+BENCHMARK_TEMPLATE(LambertW0Batch, long double)->Args({4096, 1000});
+BENCHMARK_TEMPLATE(LambertWm1Scalar, double)->Arg(4096);
+BENCHMARK_TEMPLATE(LambertWm1Batch, double)->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,106 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/log_factorial_cache.hpp>
+
+using namespace boost::math;
+
+// Shuffled points spread over the bulk of the distribution, as in a table of p-values:
+std::vector<double> points(double first, double last, std::size_t n)
+{
+    std::vector<double> x(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = std::floor(first + (last - first) * i / n);
+    }
+    std::shuffle(x.begin(), x.end(), std::mt19937_64(1));
+    return x;
+}
+
+template<class Dist>
+void DistributionPdf(benchmark::State& state, Dist dist, double first, double last)
+{
+    std::vector<double> x = points(first, last, state.range(0));
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = pdf(dist, x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void CachedPdf(benchmark::State& state, Dist dist, double first, double last)
+{
+    const log_factorial_cache<double>& cache = log_factorial_cache<double>::shared();
+    std::vector<double> x = points(first, last, state.range(0));
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = pdf(dist, x[i], cache);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void DistributionCdf(benchmark::State& state, Dist dist, double first, double last)
+{
+    std::vector<double> x = points(first, last, state.range(0));
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            y[i] = cdf(dist, x[i]);
+        }
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void BatchedCdf(benchmark::State& state, Dist dist, double first, double last)
+{
+    std::vector<double> x = points(first, last, state.range(0));
+    std::vector<double> y(x.size());
+    for (auto _ : state)
+    {
+        cdf(dist, x.begin(), x.end(), y.begin());
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+BENCHMARK_CAPTURE(DistributionPdf, binomial, binomial_distribution<double>(1000, 0.3), 250, 350)->Arg(1024);
+BENCHMARK_CAPTURE(CachedPdf, binomial, binomial_distribution<double>(1000, 0.3), 250, 350)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionPdf, negative_binomial, negative_binomial_distribution<double>(20, 0.1), 50, 350)->Arg(1024);
+BENCHMARK_CAPTURE(CachedPdf, negative_binomial, negative_binomial_distribution<double>(20, 0.1), 50, 350)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionPdf, hypergeometric, hypergeometric_distribution<double>(400, 600, 1000), 200, 280)->Arg(1024);
+BENCHMARK_CAPTURE(CachedPdf, hypergeometric, hypergeometric_distribution<double>(400, 600, 1000), 200, 280)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionPdf, large_hypergeometric, hypergeometric_distribution<double>(100000, 300000, 1000000), 29000, 31000)->Arg(1024);
+BENCHMARK_CAPTURE(CachedPdf, large_hypergeometric, hypergeometric_distribution<double>(100000, 300000, 1000000), 29000, 31000)->Arg(1024);
+
+BENCHMARK_CAPTURE(DistributionCdf, binomial, binomial_distribution<double>(1000, 0.3), 250, 350)->Arg(1024);
+BENCHMARK_CAPTURE(BatchedCdf, binomial, binomial_distribution<double>(1000, 0.3), 250, 350)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionCdf, negative_binomial, negative_binomial_distribution<double>(20, 0.1), 50, 350)->Arg(1024);
+BENCHMARK_CAPTURE(BatchedCdf, negative_binomial, negative_binomial_distribution<double>(20, 0.1), 50, 350)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionCdf, hypergeometric, hypergeometric_distribution<double>(400, 600, 1000), 200, 280)->Arg(1024);
+BENCHMARK_CAPTURE(BatchedCdf, hypergeometric, hypergeometric_distribution<double>(400, 600, 1000), 200, 280)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionCdf, large_hypergeometric, hypergeometric_distribution<double>(100000, 300000, 1000000), 29000, 31000)->Arg(1024);
+BENCHMARK_CAPTURE(BatchedCdf, large_hypergeometric, hypergeometric_distribution<double>(100000, 300000, 1000000), 29000, 31000)->Arg(1024);
+
+BENCHMARK_MAIN();
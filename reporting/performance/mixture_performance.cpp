@@ -0,0 +1,100 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/mixture.hpp>
+
+using namespace boost::math;
+
+mixture_distribution<normal_distribution<double>> make_mixture(std::size_t k)
+{
+    std::vector<normal_distribution<double>> components;
+    std::vector<double> weights;
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        components.emplace_back(0.3 * i, 0.5 + 0.01 * i);
+        weights.push_back(1 + i % 7);
+    }
+    return mixture_distribution<normal_distribution<double>>(weights, components);
+}
+
+std::vector<double> grid(double lo, double hi, std::size_t n)
+{
+    std::vector<double> x(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = lo + (hi - lo)*(i + 0.5)/n;
+    }
+    return x;
+}
+
+void SummedPdf(benchmark::State& state)
+{
+    auto mix = make_mixture(state.range(0));
+    auto x = grid(-2, 0.3 * state.range(0) + 2, 1024);
+    std::vector<double> f(x.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            double s = 0;
+            for (std::size_t j = 0; j < mix.num_components(); ++j)
+            {
+                s += mix.weights()[j] * pdf(mix.components()[j], x[i]);
+            }
+            f[i] = s;
+        }
+        benchmark::DoNotOptimize(f.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+void MixturePdf(benchmark::State& state)
+{
+    auto mix = make_mixture(state.range(0));
+    auto x = grid(-2, 0.3 * state.range(0) + 2, 1024);
+    std::vector<double> f(x.size());
+    for (auto _ : state)
+    {
+        pdf(mix, x.begin(), x.end(), f.begin());
+        benchmark::DoNotOptimize(f.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+void MixtureCdf(benchmark::State& state)
+{
+    auto mix = make_mixture(state.range(0));
+    auto x = grid(-2, 0.3 * state.range(0) + 2, 1024);
+    std::vector<double> p(x.size());
+    for (auto _ : state)
+    {
+        cdf(mix, x.begin(), x.end(), p.begin());
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+void MixtureQuantile(benchmark::State& state)
+{
+    auto mix = make_mixture(state.range(0));
+    auto p = grid(0, 1, 64);
+    for (auto _ : state)
+    {
+        for (double q : p)
+        {
+            benchmark::DoNotOptimize(quantile(mix, q));
+        }
+    }
+    state.SetItemsProcessed(state.iterations()*p.size());
+}
+
+BENCHMARK(SummedPdf)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(MixturePdf)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(MixtureCdf)->RangeMultiplier(4)->Range(4, 256);
+BENCHMARK(MixtureQuantile)->RangeMultiplier(4)->Range(4, 256);
+
+BENCHMARK_MAIN();
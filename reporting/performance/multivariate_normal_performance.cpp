@@ -0,0 +1,114 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/multivariate_normal.hpp>
+
+using no_promote_policy = boost::math::policies::policy<boost::math::policies::promote_double<false>>;
+
+template<class Real>
+std::vector<Real> random_arguments(Real a, Real b, std::size_t n, std::uint64_t seed)
+{
+    std::vector<Real> v(n);
+    std::mt19937_64 mt(seed);
+    std::uniform_real_distribution<Real> unif(a, b);
+    for (auto & x : v)
+    {
+        x = unif(mt);
+    }
+    return v;
+}
+
+// The reduction to Owen's T function, as it is usually written by hand:
+template<class Real, class Policy>
+Real owens_t_bivariate(Real h, Real k, Real rho, const Policy& pol)
+{
+    using std::sqrt;
+    Real s = sqrt((1 - rho)*(1 + rho));
+    Real result = (boost::math::erfc(-h/boost::math::constants::root_two<Real>(), pol) + boost::math::erfc(-k/boost::math::constants::root_two<Real>(), pol))/4
+        - boost::math::owens_t(h, (k - rho*h)/(h*s), pol) - boost::math::owens_t(k, (h - rho*k)/(k*s), pol);
+    return h*k < 0 ? result - Real(0.5) : result;
+}
+
+template<class Real, class Policy>
+void BivariateOwensT(benchmark::State& state)
+{
+    auto h = random_arguments<Real>(Real(-3), Real(1), state.range(0), 1);
+    auto k = random_arguments<Real>(Real(-3), Real(1), state.range(0), 2);
+    auto rho = random_arguments<Real>(Real(-0.95), Real(0.95), state.range(0), 3);
+    std::vector<Real> p(h.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < h.size(); ++i)
+        {
+            p[i] = owens_t_bivariate(h[i], k[i], rho[i], Policy());
+        }
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*h.size());
+}
+
+template<class Real, class Policy>
+void BivariateScalar(benchmark::State& state)
+{
+    auto h = random_arguments<Real>(Real(-3), Real(1), state.range(0), 1);
+    auto k = random_arguments<Real>(Real(-3), Real(1), state.range(0), 2);
+    auto rho = random_arguments<Real>(Real(-0.95), Real(0.95), state.range(0), 3);
+    std::vector<Real> p(h.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < h.size(); ++i)
+        {
+            p[i] = boost::math::bivariate_normal_cdf(h[i], k[i], rho[i], Policy());
+        }
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*h.size());
+}
+
+// One factor copula: every pair shares the same correlation.
+template<class Real, class Policy>
+void BivariateBatchCommonRho(benchmark::State& state)
+{
+    auto h = random_arguments<Real>(Real(-3), Real(1), state.range(0), 1);
+    auto k = random_arguments<Real>(Real(-3), Real(1), state.range(0), 2);
+    std::vector<Real> rho(h.size(), Real(0.35));
+    std::vector<Real> p(h.size());
+    for (auto _ : state)
+    {
+        boost::math::bivariate_normal_cdf(h.begin(), h.end(), k.begin(), rho.begin(), p.begin(), Policy());
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*h.size());
+}
+
+template<class Real>
+void Multivariate(benchmark::State& state)
+{
+    std::size_t n = state.range(0);
+    std::vector<Real> sigma(n*n, Real(0.5));
+    std::vector<Real> upper(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        sigma[i*n + i] = 1;
+        upper[i] = Real(i % 3) - Real(0.5);
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(boost::math::multivariate_normal_cdf(upper, sigma, Real(1e-5)));
+    }
+}
+
+BENCHMARK_TEMPLATE(BivariateOwensT, double, boost::math::policies::policy<>)->Arg(4096);
+BENCHMARK_TEMPLATE(BivariateScalar, double, boost::math::policies::policy<>)->Arg(4096);
+BENCHMARK_TEMPLATE(BivariateBatchCommonRho, double, boost::math::policies::policy<>)->Arg(4096);
+BENCHMARK_TEMPLATE(BivariateOwensT, double, no_promote_policy)->Arg(4096);
+BENCHMARK_TEMPLATE(BivariateScalar, double, no_promote_policy)->Arg(4096);
+BENCHMARK_TEMPLATE(BivariateBatchCommonRho, double, no_promote_policy)->Arg(4096);
+BENCHMARK_TEMPLATE(Multivariate, double)->DenseRange(3, 7, 2)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
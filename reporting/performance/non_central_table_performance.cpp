@@ -0,0 +1,109 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/non_central_table.hpp>
+
+using namespace boost::math;
+
+template<class Real>
+std::vector<Real> grid(Real lo, Real hi, std::size_t n)
+{
+    std::vector<Real> x(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = lo + (hi - lo)*(i + Real(0.5))/n;
+    }
+    return x;
+}
+
+template<class Dist>
+void DistributionCdf(benchmark::State& state, Dist dist, typename Dist::value_type lo, typename Dist::value_type hi)
+{
+    auto x = grid(lo, hi, state.range(0));
+    std::vector<typename Dist::value_type> p(x.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            p[i] = cdf(dist, x[i]);
+        }
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TableCdf(benchmark::State& state, Dist dist, typename Dist::value_type lo, typename Dist::value_type hi)
+{
+    auto x = grid(lo, hi, state.range(0));
+    std::vector<typename Dist::value_type> p(x.size());
+    non_central_table<Dist> table(dist);
+    for (auto _ : state)
+    {
+        table.cdf(x.begin(), x.end(), p.begin());
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void DistributionPdf(benchmark::State& state, Dist dist, typename Dist::value_type lo, typename Dist::value_type hi)
+{
+    auto x = grid(lo, hi, state.range(0));
+    std::vector<typename Dist::value_type> p(x.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            p[i] = pdf(dist, x[i]);
+        }
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TablePdf(benchmark::State& state, Dist dist, typename Dist::value_type lo, typename Dist::value_type hi)
+{
+    auto x = grid(lo, hi, state.range(0));
+    std::vector<typename Dist::value_type> p(x.size());
+    non_central_table<Dist> table(dist);
+    for (auto _ : state)
+    {
+        table.pdf(x.begin(), x.end(), p.begin());
+        benchmark::DoNotOptimize(p.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TableBuild(benchmark::State& state, Dist dist)
+{
+    for (auto _ : state)
+    {
+        non_central_table<Dist> table(dist);
+        benchmark::DoNotOptimize(table.is_tabulated());
+    }
+}
+
+BENCHMARK_CAPTURE(DistributionCdf, chi_squared_500, non_central_chi_squared_distribution<double>(4, 500), 250.0, 800.0)->Arg(1024);
+BENCHMARK_CAPTURE(TableCdf, chi_squared_500, non_central_chi_squared_distribution<double>(4, 500), 250.0, 800.0)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionPdf, chi_squared_500, non_central_chi_squared_distribution<double>(4, 500), 250.0, 800.0)->Arg(1024);
+BENCHMARK_CAPTURE(TablePdf, chi_squared_500, non_central_chi_squared_distribution<double>(4, 500), 250.0, 800.0)->Arg(1024);
+BENCHMARK_CAPTURE(TableBuild, chi_squared_500, non_central_chi_squared_distribution<double>(4, 500));
+BENCHMARK_CAPTURE(DistributionCdf, chi_squared_5000, non_central_chi_squared_distribution<double>(4, 5000), 2500.0, 7500.0)->Arg(1024);
+BENCHMARK_CAPTURE(TableCdf, chi_squared_5000, non_central_chi_squared_distribution<double>(4, 5000), 2500.0, 7500.0)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionCdf, beta_500, non_central_beta_distribution<double>(3, 8, 500), 0.05, 0.99)->Arg(1024);
+BENCHMARK_CAPTURE(TableCdf, beta_500, non_central_beta_distribution<double>(3, 8, 500), 0.05, 0.99)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionPdf, beta_500, non_central_beta_distribution<double>(3, 8, 500), 0.05, 0.99)->Arg(1024);
+BENCHMARK_CAPTURE(TablePdf, beta_500, non_central_beta_distribution<double>(3, 8, 500), 0.05, 0.99)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionCdf, f_500, non_central_f_distribution<double>(4, 20, 500), 0.5, 40.0)->Arg(1024);
+BENCHMARK_CAPTURE(TableCdf, f_500, non_central_f_distribution<double>(4, 20, 500), 0.5, 40.0)->Arg(1024);
+BENCHMARK_CAPTURE(DistributionCdf, t_20, non_central_t_distribution<double>(10, 20), -2.0, 45.0)->Arg(1024);
+BENCHMARK_CAPTURE(TableCdf, t_20, non_central_t_distribution<double>(10, 20), -2.0, 45.0)->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,81 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/piecewise_chebyshev.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/erf.hpp>
+
+template<class Real>
+std::vector<Real> random_arguments(Real a, Real b)
+{
+    std::vector<Real> v(1024);
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<Real> unif(a, b);
+    for (auto & x : v)
+    {
+        x = unif(mt);
+    }
+    return v;
+}
+
+template<class Real>
+void Lgamma(benchmark::State& state)
+{
+    auto v = random_arguments<Real>(Real(0.5), Real(40));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(boost::math::lgamma(v[i++ & 1023]));
+    }
+}
+
+template<class Real>
+void PiecewiseChebyshevLgamma(benchmark::State& state)
+{
+    auto f = [](Real x) { return boost::math::lgamma(x); };
+    boost::math::piecewise_chebyshev<Real> table(f, Real(0.5), Real(40), Real(1e-12), Real(1e-12), state.range(0));
+    auto v = random_arguments<Real>(Real(0.5), Real(40));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table(v[i++ & 1023]));
+    }
+    state.counters["intervals"] = static_cast<double>(table.intervals());
+}
+
+template<class Real>
+void ErfInv(benchmark::State& state)
+{
+    auto v = random_arguments<Real>(Real(-0.999), Real(0.999));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(boost::math::erf_inv(v[i++ & 1023]));
+    }
+}
+
+template<class Real>
+void PiecewiseChebyshevErfInv(benchmark::State& state)
+{
+    auto f = [](Real x) { return boost::math::erf_inv(x); };
+    boost::math::piecewise_chebyshev<Real> table(f, Real(-0.999), Real(0.999), Real(1e-12), Real(1e-12), state.range(0));
+    auto v = random_arguments<Real>(Real(-0.999), Real(0.999));
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(table(v[i++ & 1023]));
+    }
+    state.counters["intervals"] = static_cast<double>(table.intervals());
+}
+
+BENCHMARK_TEMPLATE(Lgamma, double);
+BENCHMARK_TEMPLATE(PiecewiseChebyshevLgamma, double)->DenseRange(4, 16, 2);
+BENCHMARK_TEMPLATE(ErfInv, double);
+BENCHMARK_TEMPLATE(PiecewiseChebyshevErfInv, double)->DenseRange(4, 16, 2);
+
+BENCHMARK_MAIN();
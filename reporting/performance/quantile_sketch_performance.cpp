@@ -0,0 +1,78 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/quantile_sketch.hpp>
+
+using boost::math::quantile_sketch;
+
+template<class Real>
+void SketchInsert(benchmark::State& state)
+{
+    std::mt19937_64 gen(1);
+    std::lognormal_distribution<Real> dis(2, 1);
+    std::vector<Real> x(1 << 16);
+    for (auto & v : x)
+    {
+        v = dis(gen);
+    }
+    quantile_sketch<Real> sketch(state.range(0));
+    for (auto _ : state)
+    {
+        sketch.insert(x.begin(), x.end());
+        benchmark::DoNotOptimize(sketch.retained());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void SketchMerge(benchmark::State& state)
+{
+    std::mt19937_64 gen(1);
+    std::lognormal_distribution<Real> dis(2, 1);
+    std::vector<quantile_sketch<Real>> shards(64, quantile_sketch<Real>(state.range(0)));
+    for (auto & s : shards)
+    {
+        for (int i = 0; i < 100000; ++i)
+        {
+            s.insert(dis(gen));
+        }
+    }
+    for (auto _ : state)
+    {
+        quantile_sketch<Real> total(state.range(0));
+        for (auto const & s : shards)
+        {
+            total.merge(s);
+        }
+        benchmark::DoNotOptimize(total.retained());
+    }
+    state.SetItemsProcessed(state.iterations()*shards.size());
+}
+
+template<class Real>
+void SketchQuantile(benchmark::State& state)
+{
+    std::mt19937_64 gen(1);
+    std::lognormal_distribution<Real> dis(2, 1);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    quantile_sketch<Real> sketch(state.range(0));
+    for (int i = 0; i < 1000000; ++i)
+    {
+        sketch.insert(dis(gen));
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(sketch.quantile(unif(gen)));
+    }
+}
+
+BENCHMARK_TEMPLATE(SketchInsert, double)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(SketchMerge, double)->RangeMultiplier(4)->Range(64, 4096);
+BENCHMARK_TEMPLATE(SketchQuantile, double)->RangeMultiplier(4)->Range(64, 4096);
+
+BENCHMARK_MAIN();
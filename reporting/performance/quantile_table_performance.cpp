@@ -0,0 +1,113 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions/landau.hpp>
+#include <boost/math/distributions/holtsmark.hpp>
+#include <boost/math/distributions/saspoint5.hpp>
+#include <boost/math/distributions/mapairy.hpp>
+#include <boost/math/distributions/quantile_table.hpp>
+
+using namespace boost::math;
+
+template<class Dist>
+std::vector<typename Dist::value_type> probabilities(std::size_t n)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    std::vector<Real> p(n);
+    for (auto & v : p)
+    {
+        v = unif(gen);
+    }
+    return p;
+}
+
+template<class Dist>
+void DistributionQuantile(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::vector<Real> p = probabilities<Dist>(state.range(0));
+    std::vector<Real> x(p.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < p.size(); ++i)
+        {
+            x[i] = quantile(dist, p[i]);
+        }
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TableQuantile(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    quantile_table<Dist> table(dist);
+    std::vector<Real> p = probabilities<Dist>(state.range(0));
+    std::vector<Real> x(p.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < p.size(); ++i)
+        {
+            x[i] = table.quantile(p[i]);
+        }
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TableBatchedQuantile(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    quantile_table<Dist> table(dist);
+    std::vector<Real> p = probabilities<Dist>(state.range(0));
+    std::vector<Real> x(p.size());
+    for (auto _ : state)
+    {
+        table.quantile(p.begin(), p.end(), x.begin());
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void TableSampler(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    quantile_table<Dist> table(dist);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        table.fill(gen, x.begin(), x.end());
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+BENCHMARK_CAPTURE(DistributionQuantile, landau, landau_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableQuantile, landau, landau_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableBatchedQuantile, landau, landau_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, landau, landau_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(DistributionQuantile, holtsmark, holtsmark_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableQuantile, holtsmark, holtsmark_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableBatchedQuantile, holtsmark, holtsmark_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, holtsmark, holtsmark_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(DistributionQuantile, saspoint5, saspoint5_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableQuantile, saspoint5, saspoint5_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableBatchedQuantile, saspoint5, saspoint5_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, saspoint5, saspoint5_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(DistributionQuantile, mapairy, mapairy_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableQuantile, mapairy, mapairy_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableBatchedQuantile, mapairy, mapairy_distribution<double>(0, 1))->Arg(4096);
+BENCHMARK_CAPTURE(TableSampler, mapairy, mapairy_distribution<double>(0, 1))->Arg(4096);
+
+BENCHMARK_MAIN();
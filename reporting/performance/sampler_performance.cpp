@@ -0,0 +1,89 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/distributions.hpp>
+#include <boost/math/distributions/sampler.hpp>
+
+using namespace boost::math;
+
+// What we had before: invert the quantile at a uniform variate.
+template<class Dist>
+void QuantileInversion(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto & v : x)
+        {
+            v = quantile(dist, unif(gen));
+        }
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Dist>
+void Sampler(benchmark::State& state, Dist dist)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(1);
+    sampler<Dist> s(dist);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        s.fill(gen, x.begin(), x.end());
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+// The standard library's own normal and gamma distributions, for comparison:
+template<class StdDist>
+void StandardLibrary(benchmark::State& state, StdDist dist)
+{
+    using Real = typename StdDist::result_type;
+    std::mt19937_64 gen(1);
+    std::vector<Real> x(state.range(0));
+    for (auto _ : state)
+    {
+        for (auto & v : x)
+        {
+            v = dist(gen);
+        }
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+BENCHMARK_CAPTURE(QuantileInversion, normal, normal_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, normal, normal_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(StandardLibrary, normal, std::normal_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, exponential, exponential_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, exponential, exponential_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, gamma, gamma_distribution<double>(2.5))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, gamma, gamma_distribution<double>(2.5))->Arg(4096);
+BENCHMARK_CAPTURE(StandardLibrary, gamma, std::gamma_distribution<double>(2.5))->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, beta, beta_distribution<double>(2, 5))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, beta, beta_distribution<double>(2, 5))->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, students_t, students_t_distribution<double>(5))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, students_t, students_t_distribution<double>(5))->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, non_central_chi_squared, non_central_chi_squared_distribution<double>(4, 3))->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, non_central_chi_squared, non_central_chi_squared_distribution<double>(4, 3))->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, landau, landau_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, landau, landau_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, holtsmark, holtsmark_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, holtsmark, holtsmark_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, saspoint5, saspoint5_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, saspoint5, saspoint5_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(QuantileInversion, mapairy, mapairy_distribution<double>())->Arg(4096);
+BENCHMARK_CAPTURE(Sampler, mapairy, mapairy_distribution<double>())->Arg(4096);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,118 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+//  Throughput of the parallel statistics with many concurrent callers, as under a request serving load.
+//  Each benchmark runs on 1, 4 and 16 caller threads at once; items/s is the total over all callers.
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <future>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <boost/math/tools/random_vector.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+#include <benchmark/benchmark.h>
+
+using boost::math::generate_random_vector;
+using namespace boost::math::statistics;
+
+// The former strategy, for comparison: new std::async tasks on every call, one per hardware thread
+// once the data is over a fixed size.
+template<typename T>
+std::tuple<T, T, T, T, T> async_per_call_moments(const std::vector<T>& v)
+{
+    using ReturnType = std::tuple<T, T, T, T, T>;
+    const unsigned threads = (std::max)(std::thread::hardware_concurrency(), 2u);
+    if (v.size() < 20000)
+    {
+        return detail::first_four_moments_sequential_impl<ReturnType>(v.begin(), v.end());
+    }
+    const std::size_t per_thread = v.size() / threads;
+    std::vector<std::future<ReturnType>> futures;
+    for (unsigned i = 0; i < threads; ++i)
+    {
+        const auto first = v.begin() + i * per_thread;
+        const auto last = (i + 1 == threads) ? v.end() : first + per_thread;
+        futures.emplace_back(std::async(std::launch::async, [first, last]() { return detail::first_four_moments_sequential_impl<ReturnType>(first, last); }));
+    }
+    ReturnType result = futures[0].get();
+    for (unsigned i = 1; i < threads; ++i)
+    {
+        const ReturnType b = futures[i].get();
+        detail::merge_first_four_moments(std::get<0>(result), std::get<1>(result), std::get<2>(result), std::get<3>(result), std::get<4>(result),
+                                         std::get<0>(b), std::get<1>(b), std::get<2>(b), std::get<3>(b), std::get<4>(b));
+    }
+    return result;
+}
+
+template<typename T>
+void async_moments(benchmark::State& state)
+{
+    const std::vector<T> v = generate_random_vector<T>(state.range(0), 1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(async_per_call_moments(v));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void seq_moments(benchmark::State& state)
+{
+    const std::vector<T> v = generate_random_vector<T>(state.range(0), 1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(first_four_moments(std::execution::seq, v));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void par_moments(benchmark::State& state)
+{
+    const std::vector<T> v = generate_random_vector<T>(state.range(0), 1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(first_four_moments(std::execution::par, v));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// A pool of the caller's own, shared by all the calls:
+template<typename T>
+void pool_covariance(benchmark::State& state)
+{
+    static thread_pool pool(thread_pool::default_size());
+    const std::vector<T> u = generate_random_vector<T>(state.range(0), 1);
+    const std::vector<T> v = generate_random_vector<T>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(covariance(pool, u, v));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void seq_covariance(benchmark::State& state)
+{
+    const std::vector<T> u = generate_random_vector<T>(state.range(0), 1);
+    const std::vector<T> v = generate_random_vector<T>(state.range(0), 2);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(covariance(std::execution::seq, u, v));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(seq_moments, double)->RangeMultiplier(16)->Range(1 << 8, 1 << 20)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(async_moments, double)->RangeMultiplier(16)->Range(1 << 8, 1 << 20)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(par_moments, double)->RangeMultiplier(16)->Range(1 << 8, 1 << 20)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(seq_covariance, double)->RangeMultiplier(16)->Range(1 << 8, 1 << 20)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(pool_covariance, double)->RangeMultiplier(16)->Range(1 << 8, 1 << 20)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
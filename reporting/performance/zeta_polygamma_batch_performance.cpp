@@ -0,0 +1,90 @@
+//  (C) Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+#include <random>
+#include <benchmark/benchmark.h>
+#include <boost/math/special_functions/zeta.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+
+template<class Real>
+std::vector<Real> random_arguments(Real a, Real b, std::size_t n)
+{
+    std::vector<Real> v(n);
+    std::mt19937_64 mt(12345);
+    std::uniform_real_distribution<Real> unif(a, b);
+    for (auto & x : v)
+    {
+        x = unif(mt);
+    }
+    return v;
+}
+
+template<class Real>
+void ZetaScalar(benchmark::State& state)
+{
+    auto s = random_arguments<Real>(Real(-20), Real(80), state.range(0));
+    std::vector<Real> out(s.size());
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            out[i] = boost::math::zeta(s[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations()*s.size());
+}
+
+template<class Real>
+void ZetaBatch(benchmark::State& state)
+{
+    auto s = random_arguments<Real>(Real(-20), Real(80), state.range(0));
+    std::vector<Real> out(s.size());
+    for (auto _ : state)
+    {
+        boost::math::zeta(s.begin(), s.end(), out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations()*s.size());
+}
+
+template<class Real>
+void PolygammaScalar(benchmark::State& state)
+{
+    auto x = random_arguments<Real>(Real(0.5), Real(30), 4096);
+    std::vector<Real> out(x.size());
+    int n = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < x.size(); ++i)
+        {
+            out[i] = boost::math::polygamma(n, x[i]);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+template<class Real>
+void PolygammaBatch(benchmark::State& state)
+{
+    auto x = random_arguments<Real>(Real(0.5), Real(30), 4096);
+    std::vector<Real> out(x.size());
+    int n = static_cast<int>(state.range(0));
+    for (auto _ : state)
+    {
+        boost::math::polygamma(n, x.begin(), x.end(), out.begin());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations()*x.size());
+}
+
+BENCHMARK_TEMPLATE(ZetaScalar, double)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_TEMPLATE(ZetaBatch, double)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_TEMPLATE(PolygammaScalar, double)->DenseRange(2, 10, 4);
+BENCHMARK_TEMPLATE(PolygammaBatch, double)->DenseRange(2, 10, 4);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,220 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstddef>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <boost/math/statistics/accumulators.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+
+using boost::math::statistics::moments_accumulator;
+using boost::math::statistics::covariance_accumulator;
+using boost::math::statistics::gini_accumulator;
+
+template<class Real>
+std::vector<Real> random_data(std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::lognormal_distribution<Real> dis(Real(1), Real(0.75));
+    std::vector<Real> v(n);
+    for (auto& x : v)
+    {
+        x = dis(gen);
+    }
+    return v;
+}
+
+template<class Real>
+void test_moments()
+{
+    const Real tol = 64 * std::numeric_limits<Real>::epsilon();
+    const std::vector<Real> v = random_data<Real>(1000, 1);
+    const auto expected = boost::math::statistics::first_four_moments(v);
+
+    // One value at a time:
+    moments_accumulator<Real> single;
+    for (Real x : v)
+    {
+        single.update(x);
+    }
+    CHECK_EQUAL(single.count(), v.size());
+    const auto s = single.result();
+    CHECK_ULP_CLOSE(std::get<0>(expected), std::get<0>(s), 32);
+    CHECK_LE(std::abs(std::get<1>(s) - std::get<1>(expected)), tol * std::get<1>(expected));
+    CHECK_LE(std::abs(std::get<2>(s) - std::get<2>(expected)), tol * std::get<2>(expected));
+    CHECK_LE(std::abs(std::get<3>(s) - std::get<3>(expected)), tol * std::get<3>(expected));
+
+    // Uneven shards, merged out of order:
+    const std::size_t cuts[] = {0, 1, 17, 400, 401, 999, 1000};
+    std::vector<moments_accumulator<Real>> shards(6);
+    for (std::size_t i = 0; i < 6; ++i)
+    {
+        shards[i].update(v.begin() + cuts[i], v.begin() + cuts[i + 1]);
+    }
+    moments_accumulator<Real> merged;
+    for (std::size_t i : {3, 0, 5, 1, 4, 2})
+    {
+        merged.merge(shards[i]);
+    }
+    CHECK_EQUAL(merged.count(), v.size());
+    const auto m = merged.result();
+    CHECK_ULP_CLOSE(std::get<0>(expected), std::get<0>(m), 32);
+    CHECK_LE(std::abs(std::get<1>(m) - std::get<1>(expected)), tol * std::get<1>(expected));
+    CHECK_LE(std::abs(std::get<2>(m) - std::get<2>(expected)), tol * std::get<2>(expected));
+    CHECK_LE(std::abs(std::get<3>(m) - std::get<3>(expected)), tol * std::get<3>(expected));
+
+    CHECK_LE(std::abs(merged.skewness() - boost::math::statistics::skewness(v)), tol);
+    CHECK_LE(std::abs(merged.kurtosis() - boost::math::statistics::kurtosis(v)), tol * merged.kurtosis());
+    CHECK_LE(std::abs(merged.sample_variance() - boost::math::statistics::sample_variance(v)), tol * merged.sample_variance());
+
+    // A container, and a constant dataset:
+    moments_accumulator<Real> constant;
+    constant.update(std::list<Real>(10, Real(3)));
+    CHECK_ULP_CLOSE(Real(3), constant.mean(), 0);
+    CHECK_EQUAL(constant.variance(), Real(0));
+    CHECK_EQUAL(constant.skewness(), Real(0));
+    CHECK_EQUAL(constant.kurtosis(), Real(0));
+
+    // Empty accumulators merge as the identity:
+    moments_accumulator<Real> empty;
+    CHECK_NAN(empty.mean());
+    CHECK_NAN(std::get<1>(empty.result()));
+    empty.merge(moments_accumulator<Real>());
+    CHECK_EQUAL(empty.count(), std::size_t(0));
+    empty.merge(constant);
+    CHECK_EQUAL(empty.count(), std::size_t(10));
+    CHECK_ULP_CLOSE(Real(3), empty.mean(), 0);
+}
+
+template<class Real>
+void test_covariance()
+{
+    const Real tol = 64 * std::numeric_limits<Real>::epsilon();
+    const std::vector<Real> u = random_data<Real>(1000, 2);
+    std::vector<Real> v = random_data<Real>(1000, 3);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] += u[i] / 2;
+    }
+    const auto expected = boost::math::statistics::means_and_covariance(u, v);
+    const Real expected_rho = boost::math::statistics::correlation_coefficient(u, v);
+
+    covariance_accumulator<Real> single;
+    for (std::size_t i = 0; i < u.size(); ++i)
+    {
+        single.update(u[i], v[i]);
+    }
+    CHECK_EQUAL(single.count(), u.size());
+    CHECK_ULP_CLOSE(std::get<0>(expected), std::get<0>(single.result()), 32);
+    CHECK_ULP_CLOSE(std::get<1>(expected), std::get<1>(single.result()), 32);
+    CHECK_LE(std::abs(single.covariance() - std::get<2>(expected)), tol * std::get<2>(expected));
+    CHECK_LE(std::abs(single.correlation_coefficient() - expected_rho), tol);
+
+    const std::size_t cuts[] = {0, 3, 250, 251, 700, 1000};
+    std::vector<covariance_accumulator<Real>> shards(5);
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        shards[i].update(u.cbegin() + cuts[i], u.cbegin() + cuts[i + 1], v.cbegin() + cuts[i], v.cbegin() + cuts[i + 1]);
+    }
+    covariance_accumulator<Real> merged;
+    for (std::size_t i : {4, 2, 0, 3, 1})
+    {
+        merged.merge(shards[i]);
+    }
+    CHECK_EQUAL(merged.count(), u.size());
+    CHECK_ULP_CLOSE(std::get<0>(expected), std::get<0>(merged.result()), 32);
+    CHECK_ULP_CLOSE(std::get<1>(expected), std::get<1>(merged.result()), 32);
+    CHECK_LE(std::abs(merged.covariance() - std::get<2>(expected)), tol * std::get<2>(expected));
+    CHECK_LE(std::abs(merged.correlation_coefficient() - expected_rho), tol);
+
+    covariance_accumulator<Real> whole;
+    whole.update(u, v);
+    CHECK_LE(std::abs(whole.covariance() - std::get<2>(expected)), tol * std::get<2>(expected));
+
+    // Perfectly correlated, constant and mismatched samples:
+    covariance_accumulator<Real> line;
+    line.update(std::vector<Real>{1, 2, 3, 4}, std::vector<Real>{-2, -4, -6, -8});
+    CHECK_ULP_CLOSE(Real(-1), line.correlation_coefficient(), 2);
+    CHECK_ULP_CLOSE(Real(-2.5), line.covariance(), 2);
+    covariance_accumulator<Real> flat;
+    flat.update(std::vector<Real>{1, 1, 1}, std::vector<Real>{1, 2, 3});
+    CHECK_NAN(flat.correlation_coefficient());
+    CHECK_THROW(flat.update(std::vector<Real>{1, 2}, std::vector<Real>{1, 2, 3}), std::domain_error);
+    CHECK_EQUAL(flat.count(), std::size_t(3));
+    CHECK_NAN(std::get<2>(covariance_accumulator<Real>().result()));
+}
+
+template<class Real>
+void test_gini()
+{
+    std::vector<Real> v = random_data<Real>(1000, 4);
+    gini_accumulator<Real> single;
+    for (Real x : v)
+    {
+        single.update(x);
+    }
+    gini_accumulator<Real> a, b;
+    a.update(v.begin(), v.begin() + 300);
+    b.update(v.begin() + 300, v.end());
+    // A result in the middle of the stream must not disturb later updates:
+    CHECK_LE(a.result(), Real(1));
+    b.merge(a);
+
+    std::vector<Real> w = v;
+    const Real expected = boost::math::statistics::gini_coefficient(w);
+    w = v;
+    const Real expected_sample = boost::math::statistics::sample_gini_coefficient(w);
+    CHECK_EQUAL(single.count(), v.size());
+    CHECK_EQUAL(b.count(), v.size());
+    CHECK_ULP_CLOSE(expected, single.result(), 4);
+    CHECK_ULP_CLOSE(expected, b.result(), 4);
+    CHECK_ULP_CLOSE(expected_sample, b.sample_result(), 4);
+
+    // Merging with itself doubles each value's multiplicity, which leaves the population Gini unchanged:
+    gini_accumulator<Real> twice = b;
+    twice.merge(twice);
+    CHECK_EQUAL(twice.count(), 2 * v.size());
+    CHECK_ULP_CLOSE(expected, twice.result(), 256);
+
+    // A const shard, with values still to be sorted in, merges into several accumulators unchanged:
+    gini_accumulator<Real> shard_data;
+    shard_data.update(v.begin() + 300, v.end());
+    const gini_accumulator<Real>& shard = shard_data;
+    gini_accumulator<Real> c, d;
+    c.update(v.begin(), v.begin() + 300);
+    d.update(v.begin(), v.begin() + 300);
+    c.merge(shard);
+    d.merge(shard);
+    CHECK_EQUAL(shard.count(), v.size() - 300);
+    CHECK_ULP_CLOSE(expected, c.result(), 4);
+    CHECK_EQUAL(c.result(), d.result());
+
+    gini_accumulator<Real> equal;
+    equal.update(std::vector<Real>(5, Real(2)));
+    CHECK_EQUAL(equal.result(), Real(0));
+    CHECK_NAN(gini_accumulator<Real>().result());
+}
+
+int main()
+{
+    test_moments<float>();
+    test_moments<double>();
+    test_moments<long double>();
+    test_covariance<float>();
+    test_covariance<double>();
+    test_covariance<long double>();
+    test_gini<float>();
+    test_gini<double>();
+    test_gini<long double>();
+    return boost::math::test::report_errors();
+}
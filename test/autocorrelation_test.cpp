@@ -0,0 +1,297 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/autocorrelation.hpp>
+#include <boost/math/statistics/ljung_box.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::autocovariance;
+using boost::math::statistics::autocorrelation;
+using boost::math::statistics::partial_autocorrelation;
+using boost::math::statistics::autocorrelations;
+using boost::math::statistics::partial_autocorrelations;
+using boost::math::statistics::ljung_box;
+using boost::math::statistics::box_pierce;
+
+template<class Real>
+std::vector<Real> ar1(std::size_t n, Real phi, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> v(n);
+    Real x = 0;
+    for (auto& y : v)
+    {
+        x = phi*x + dis(gen);
+        y = x + 3;
+    }
+    return v;
+}
+
+template<class Real>
+std::vector<Real> naive_autocovariance(const std::vector<Real>& v, std::size_t max_lag)
+{
+    Real mu = 0;
+    for (auto x : v)
+    {
+        mu += x;
+    }
+    mu /= v.size();
+    std::vector<Real> gamma(max_lag + 1, Real(0));
+    for (std::size_t k = 0; k <= max_lag; ++k)
+    {
+        for (std::size_t t = k; t < v.size(); ++t)
+        {
+            gamma[k] += (v[t] - mu)*(v[t - k] - mu);
+        }
+        gamma[k] /= v.size();
+    }
+    return gamma;
+}
+
+void test_fft_friendly_length()
+{
+    using boost::math::statistics::detail::fft_friendly_length;
+    for (std::size_t n = 1; n < 2000; ++n)
+    {
+        const std::size_t m = fft_friendly_length(n);
+        CHECK_LE(n, m);
+        std::size_t r = m;
+        for (std::size_t p : {2, 3, 5})
+        {
+            while (r % p == 0)
+            {
+                r /= p;
+            }
+        }
+        CHECK_EQUAL(r, std::size_t(1));
+        // No 5-smooth length lies in between:
+        for (std::size_t k = n; k < m; ++k)
+        {
+            std::size_t s = k;
+            for (std::size_t p : {2, 3, 5})
+            {
+                while (s % p == 0)
+                {
+                    s /= p;
+                }
+            }
+            CHECK_EQUAL(s == 1, false);
+        }
+    }
+}
+
+// Lengths which are smooth, prime, or neither, and both the direct and the spectral sums:
+template<class Real>
+void test_autocovariance()
+{
+    const Real tol = 64*std::numeric_limits<Real>::epsilon()*std::log2(Real(4096));
+    for (std::size_t n : {1, 2, 3, 7, 64, 97, 250, 1000, 1009, 4095})
+    {
+        const auto v = ar1<Real>(n, Real(0.6), static_cast<unsigned>(n));
+        for (std::size_t max_lag : {std::size_t(0), std::size_t(1), n/3, n - 1})
+        {
+            if (max_lag >= n)
+            {
+                continue;
+            }
+            const auto expected = naive_autocovariance(v, max_lag);
+            const auto computed = autocovariance(v, max_lag);
+            CHECK_EQUAL(computed.size(), max_lag + 1);
+            for (std::size_t k = 0; k <= max_lag; ++k)
+            {
+                CHECK_LE(std::abs(computed[k] - expected[k]), tol*expected[0]);
+            }
+            const auto rho = autocorrelation(v.begin(), v.end(), max_lag);
+            if (n > 1)
+            {
+                CHECK_EQUAL(rho[0], Real(1));
+                for (std::size_t k = 1; k <= max_lag; ++k)
+                {
+                    CHECK_LE(std::abs(rho[k] - expected[k]/expected[0]), tol);
+                }
+            }
+        }
+    }
+
+    // A long AR(1) series has rho_k near phi^k:
+    const auto v = ar1<Real>(1 << 16, Real(0.6), 7);
+    const auto rho = autocorrelation(v, 200);
+    CHECK_LE(std::abs(rho[1] - Real(0.6)), Real(0.02));
+    CHECK_LE(std::abs(rho[2] - Real(0.36)), Real(0.02));
+    CHECK_LE(std::abs(rho[150]), Real(0.03));
+
+    // As for correlation_coefficient, a constant series gives NaNs:
+    const std::vector<Real> constant(100, Real(2));
+    CHECK_NAN(autocorrelation(constant, 5)[1]);
+    CHECK_NAN(partial_autocorrelation(constant, 5)[1]);
+    CHECK_EQUAL(autocovariance(constant, 5)[0], Real(0));
+
+    CHECK_THROW(autocorrelation(v.begin(), v.begin() + 10, 10), std::domain_error);
+    CHECK_THROW(autocorrelation(v.begin(), v.begin(), 0), std::domain_error);
+}
+
+// The order k Yule-Walker equations sum_j phi_j rho_{|i-j|} = rho_i, i = 1..k, solved by elimination:
+template<class Real>
+Real yule_walker_last(const std::vector<Real>& rho, std::size_t k)
+{
+    std::vector<std::vector<Real>> a(k, std::vector<Real>(k + 1));
+    for (std::size_t i = 0; i < k; ++i)
+    {
+        for (std::size_t j = 0; j < k; ++j)
+        {
+            a[i][j] = rho[i > j ? i - j : j - i];
+        }
+        a[i][k] = rho[i + 1];
+    }
+    for (std::size_t c = 0; c < k; ++c)
+    {
+        for (std::size_t i = c + 1; i < k; ++i)
+        {
+            const Real f = a[i][c]/a[c][c];
+            for (std::size_t j = c; j <= k; ++j)
+            {
+                a[i][j] -= f*a[c][j];
+            }
+        }
+    }
+    std::vector<Real> x(k);
+    for (std::size_t i = k; i-- > 0;)
+    {
+        Real s = a[i][k];
+        for (std::size_t j = i + 1; j < k; ++j)
+        {
+            s -= a[i][j]*x[j];
+        }
+        x[i] = s/a[i][i];
+    }
+    return x[k - 1];
+}
+
+template<class Real>
+void test_partial_autocorrelation()
+{
+    using boost::math::statistics::detail::levinson_durbin;
+    // An AR(1) autocorrelation function rho_k = a^k has partial autocorrelations a, 0, 0, ...:
+    const Real a = Real(-0.7);
+    std::vector<Real> rho(12);
+    for (std::size_t k = 0; k < rho.size(); ++k)
+    {
+        rho[k] = std::pow(a, Real(k));
+    }
+    const auto pacf = levinson_durbin(rho);
+    CHECK_EQUAL(pacf[0], Real(1));
+    CHECK_ULP_CLOSE(a, pacf[1], 2);
+    for (std::size_t k = 2; k < pacf.size(); ++k)
+    {
+        CHECK_LE(std::abs(pacf[k]), 8*std::numeric_limits<Real>::epsilon());
+    }
+
+    const auto v = ar1<Real>(5000, Real(0.5), 11);
+    const auto r = autocorrelation(v, 20);
+    const auto computed = partial_autocorrelation(v, 20);
+    CHECK_EQUAL(computed.size(), std::size_t(21));
+    CHECK_ULP_CLOSE(r[1], computed[1], 2);
+    for (std::size_t k = 2; k <= 20; ++k)
+    {
+        CHECK_LE(std::abs(computed[k] - yule_walker_last(r, k)), 1000*std::numeric_limits<Real>::epsilon());
+    }
+}
+
+// The batched functions agree exactly with the single series ones, however the series are scheduled:
+template<class ExecutionPolicy>
+void test_batch(ExecutionPolicy&& exec)
+{
+    std::vector<std::vector<double>> series;
+    for (std::size_t i = 0; i < 40; ++i)
+    {
+        series.push_back(ar1<double>(300 + 997*i, 0.3, static_cast<unsigned>(i)));
+    }
+    const std::size_t max_lag = 250;
+    const auto acfs = autocorrelations(exec, series, max_lag);
+    const auto pacfs = partial_autocorrelations(exec, series, max_lag);
+    CHECK_EQUAL(acfs.size(), series.size());
+    CHECK_EQUAL(pacfs.size(), series.size());
+    for (std::size_t i = 0; i < series.size(); ++i)
+    {
+        const auto expected = autocorrelation(series[i], max_lag);
+        const auto expected_pacf = partial_autocorrelation(series[i], max_lag);
+        CHECK_EQUAL(acfs[i] == expected, true);
+        CHECK_EQUAL(pacfs[i] == expected_pacf, true);
+    }
+
+    const std::vector<std::vector<double>> none;
+    CHECK_EQUAL(autocorrelations(exec, none, 3).size(), std::size_t(0));
+}
+
+void test_ljung_box_and_box_pierce()
+{
+    // Validate in R:
+    // > Box.test(c(1,2), lag=1)
+    // X-squared = 0.5, df = 1, p-value = 0.4795
+    const std::vector<double> v {1, 2};
+    const auto [Q, p] = box_pierce(v, 1);
+    CHECK_ULP_CLOSE(0.5, Q, 2);
+    CHECK_ULP_CLOSE(std::erfc(0.5), p, 30);
+
+    // Many lags, computed from the power spectrum, against the definitions:
+    const auto w = ar1<double>(20000, 0.05, 5);
+    const std::size_t lags = 400;
+    const auto gamma = naive_autocovariance(w, lags);
+    double expected_lb = 0;
+    double expected_bp = 0;
+    for (std::size_t k = 1; k <= lags; ++k)
+    {
+        const double rho = gamma[k]/gamma[0];
+        expected_lb += rho*rho/(w.size() - k);
+        expected_bp += rho*rho;
+    }
+    expected_lb *= w.size()*(w.size() + 2.0);
+    expected_bp *= w.size();
+    const auto [Q_lb, p_lb] = ljung_box(w, lags);
+    const auto [Q_bp, p_bp] = box_pierce(w, lags, 1);
+    CHECK_LE(std::abs(Q_lb - expected_lb), 1e-9*expected_lb);
+    CHECK_LE(std::abs(Q_bp - expected_bp), 1e-9*expected_bp);
+    CHECK_LE(Q_bp, Q_lb);
+    CHECK_LE(0.0, p_lb);
+    CHECK_LE(p_bp, 1.0);
+
+    // Integer data:
+    const std::vector<int> i {1, 4, 2, 8, 5, 7, 3, 6};
+    const std::vector<double> d(i.begin(), i.end());
+    CHECK_ULP_CLOSE(ljung_box(d, 3).first, ljung_box(i, 3).first, 0);
+    CHECK_ULP_CLOSE(autocorrelation(d, 7)[3], autocorrelation(i, 7)[3], 0);
+
+    CHECK_THROW(box_pierce(v, 2), std::domain_error);
+}
+
+int main()
+{
+    test_fft_friendly_length();
+    test_autocovariance<float>();
+    test_autocovariance<double>();
+    test_partial_autocorrelation<double>();
+    test_batch(std::execution::seq);
+    test_batch(std::execution::par);
+#ifdef BOOST_MATH_HAS_THREADS
+    boost::math::statistics::thread_pool pool(3);
+    test_batch(pool);
+#endif
+    test_ljung_box_and_box_pierce();
+    return boost::math::test::report_errors();
+}
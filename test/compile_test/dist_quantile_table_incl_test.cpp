@@ -0,0 +1,21 @@
+//  Copyright Matt Borland 2024.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/distributions/quantile_table.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/distributions/quantile_table.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+//
+// A distribution to instantiate the table with, included last so that the
+// header above is compiled with nothing but its own includes:
+//
+#include <boost/math/distributions/landau.hpp>
+
+template class boost::math::quantile_table<boost::math::landau_distribution<double> >;
@@ -0,0 +1,142 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/covariance_matrix.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::covariance_matrix;
+using boost::math::statistics::correlation_matrix;
+
+// Correlated columns with large and differing means:
+template<class Real>
+std::vector<std::vector<Real>> random_columns(std::size_t p, std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<std::vector<Real>> columns(p, std::vector<Real>(n));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const Real common = dis(gen);
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            columns[j][i] = static_cast<Real>(1000*j) + static_cast<Real>(j % 3)*common + dis(gen);
+        }
+    }
+    return columns;
+}
+
+template<class Real>
+void test_against_pairs(std::size_t p, std::size_t n)
+{
+    auto columns = random_columns<Real>(p, n, static_cast<unsigned>(p + n));
+    auto cov = covariance_matrix(columns);
+    auto cor = correlation_matrix(columns);
+    CHECK_EQUAL(cov.size(), p*p);
+    std::vector<Real> means;
+    for (const auto& column : columns)
+    {
+        means.push_back(boost::math::statistics::mean(column));
+    }
+    const Real tol = std::sqrt(static_cast<Real>(n))*64*std::numeric_limits<Real>::epsilon();
+    for (std::size_t i = 0; i < p; ++i)
+    {
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            const Real expected = boost::math::statistics::covariance(columns[i], columns[j]);
+            const Real sigma_i = std::sqrt(cov[i*p + i]);
+            const Real sigma_j = std::sqrt(cov[j*p + j]);
+            // Centering rounds each deviation by about epsilon times the mean:
+            const Real centering = std::abs(means[i])*sigma_j + std::abs(means[j])*sigma_i;
+            CHECK_LE(std::abs(cov[i*p + j] - expected), tol*(sigma_i*sigma_j + centering));
+            CHECK_EQUAL(cov[i*p + j], cov[j*p + i]);
+            CHECK_LE(std::abs(cor[i*p + j] - boost::math::statistics::correlation_coefficient(columns[i], columns[j])), tol*(1 + centering/(sigma_i*sigma_j)));
+            CHECK_EQUAL(cor[i*p + j], cor[j*p + i]);
+        }
+        CHECK_EQUAL(cor[i*p + i], Real(1));
+    }
+}
+
+void test_exact()
+{
+    // Blocks of rows of different means, where the merge terms carry the covariance:
+    std::vector<std::vector<double>> columns(2, std::vector<double>(600));
+    for (std::size_t r = 0; r < 600; ++r)
+    {
+        columns[0][r] = r < 300 ? 1 : 3;
+        columns[1][r] = r < 300 ? 10 : 4;
+    }
+    auto cov = covariance_matrix(columns);
+    CHECK_ULP_CLOSE(1.0, cov[0], 2);
+    CHECK_ULP_CLOSE(9.0, cov[3], 2);
+    CHECK_ULP_CLOSE(-3.0, cov[1], 2);
+    auto cor = correlation_matrix(columns);
+    CHECK_EQUAL(cor[1], -1.0);
+
+    // A constant column has no correlation:
+    columns.push_back(std::vector<double>(600, 7.0));
+    cor = correlation_matrix(columns);
+    CHECK_NAN(cor[2]);
+    CHECK_NAN(cor[8]);
+    CHECK_EQUAL(covariance_matrix(columns)[8], 0.0);
+
+    // Integer data gives double results:
+    std::vector<std::vector<int>> u{{1, 2, 3, 4}, {2, 4, 6, 9}};
+    auto int_cov = covariance_matrix(u);
+    CHECK_ULP_CLOSE(1.25, int_cov[0], 2);
+    CHECK_ULP_CLOSE(boost::math::statistics::covariance(u[0], u[1]), int_cov[1], 4);
+}
+
+void test_parallel()
+{
+    // Several tiles and blocks:
+    auto columns = random_columns<double>(75, 2000, 5);
+    auto cov = covariance_matrix(columns);
+    auto cor = correlation_matrix(columns);
+    CHECK_EQUAL(cov == covariance_matrix(std::execution::par, columns), true);
+    CHECK_EQUAL(cor == correlation_matrix(std::execution::par, columns), true);
+#ifdef BOOST_MATH_HAS_THREADS
+    // Force the parallel path, whatever the hardware:
+    boost::math::statistics::thread_pool pool(3);
+    CHECK_EQUAL(cov == covariance_matrix(pool, columns), true);
+    CHECK_EQUAL(cor == correlation_matrix(pool, columns), true);
+#endif
+}
+
+void test_errors()
+{
+    std::vector<std::vector<double>> columns{{1, 2, 3}, {1, 2}};
+    CHECK_THROW(covariance_matrix(columns), std::domain_error);
+    CHECK_THROW(correlation_matrix(std::execution::par, columns), std::domain_error);
+    std::vector<std::vector<double>> none;
+    CHECK_EQUAL(covariance_matrix(none).size(), std::size_t(0));
+}
+
+int main()
+{
+    test_against_pairs<double>(1, 10);
+    test_against_pairs<double>(3, 1000);
+    test_against_pairs<double>(37, 300);
+    test_against_pairs<float>(6, 700);
+    test_exact();
+    test_parallel();
+    test_errors();
+    return boost::math::test::report_errors();
+}
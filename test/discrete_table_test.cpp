@@ -0,0 +1,255 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+#include <boost/math/distributions.hpp>
+#include <boost/math/distributions/discrete_table.hpp>
+
+using boost::math::discrete_table;
+using namespace boost::math::policies;
+
+template<class Dist>
+void test_tabulated_values(const Dist& dist)
+{
+    using Real = typename Dist::value_type;
+    discrete_table<Dist> table(dist);
+    auto range = table.table_range();
+    CHECK_LE(range.first, range.second);
+    // The untabulated tails carry no more than epsilon each:
+    if (range.first > Real(support(dist).first))
+    {
+        CHECK_LE(cdf(dist, Real(range.first - 1)), std::numeric_limits<Real>::epsilon());
+    }
+    CHECK_LE(cdf(complement(dist, range.second)), std::numeric_limits<Real>::epsilon());
+    for (Real k = range.first; k <= range.second; ++k)
+    {
+        CHECK_EQUAL(table.pdf(k), pdf(dist, k));
+        CHECK_EQUAL(table.cdf(k), cdf(dist, k));
+    }
+    // Outside the table we get whatever the distribution gives:
+    Real beyond = (std::min)(Real(range.second + 3), Real(support(dist).second));
+    CHECK_EQUAL(table.pdf(beyond), pdf(dist, beyond));
+    CHECK_EQUAL(table.cdf(beyond), cdf(dist, beyond));
+}
+
+// The table rounds exactly as the definitions of the policies require, and agrees with the distribution's
+// own quantile except where cdf(k) is within the distribution's root-finding tolerance of p:
+template<class Dist>
+void test_quantiles(const Dist& dist)
+{
+    using Real = typename Dist::value_type;
+    using std::abs;
+    discrete_table<Dist> table(dist);
+    std::mt19937_64 gen(17);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    std::vector<Real> p;
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        p.push_back(unif(gen));
+    }
+    // Probabilities exactly at the tabulated cdf values, and deep in both tails:
+    auto range = table.table_range();
+    for (Real k = range.first; k <= range.second; ++k)
+    {
+        if (table.cdf(k) < 1)
+        {
+            p.push_back(table.cdf(k));
+        }
+    }
+    p.push_back(Real(1e-30));
+    p.push_back(Real(1e-17));
+    p.push_back(1 - std::numeric_limits<Real>::epsilon()/2);
+    p.push_back(0);
+
+    for (Real x : p)
+    {
+        Real k = table.quantile(x);
+        Real expected = quantile(dist, x);
+        if (k != expected)
+        {
+            CHECK_EQUAL(k, std::floor(k));
+            // Only allowed at a near tie between p and the cdf:
+            Real c = cdf(dist, (std::min)(k, expected));
+            CHECK_LE(Real(abs(c - x)), 64*std::numeric_limits<Real>::epsilon()*x);
+        }
+    }
+}
+
+template<class Dist>
+void check_definition(const discrete_table<Dist>& table, bool up)
+{
+    using Real = typename Dist::value_type;
+    const Dist& dist = table.distribution();
+    std::mt19937_64 gen(5);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        Real x = unif(gen);
+        Real k = table.quantile(x);
+        if (up)
+        {
+            // The smallest k with cdf(k) >= p:
+            CHECK_LE(x, cdf(dist, k));
+            if (k > Real(support(dist).first))
+            {
+                CHECK_LE(cdf(dist, Real(k - 1)), x);
+            }
+        }
+        else
+        {
+            // The largest k with cdf(k) <= p, unless there is none:
+            if (x >= cdf(dist, Real(support(dist).first)))
+            {
+                CHECK_LE(cdf(dist, k), x);
+            }
+            CHECK_LE(x, cdf(dist, Real(k + 1)));
+        }
+    }
+}
+
+void test_policies()
+{
+    using up_policy = policy<discrete_quantile<integer_round_up>>;
+    using down_policy = policy<discrete_quantile<integer_round_down>>;
+    using in_policy = policy<discrete_quantile<integer_round_inwards>>;
+    using real_policy = policy<discrete_quantile<real>>;
+
+    test_quantiles(boost::math::poisson_distribution<double, up_policy>(6.5));
+    test_quantiles(boost::math::poisson_distribution<double, down_policy>(6.5));
+    test_quantiles(boost::math::poisson_distribution<double, in_policy>(250));
+    test_quantiles(boost::math::binomial_distribution<double, up_policy>(40, 0.3));
+    test_quantiles(boost::math::binomial_distribution<double, down_policy>(1000, 0.01));
+    test_quantiles(boost::math::negative_binomial_distribution<double, in_policy>(5, 0.4));
+    test_quantiles(boost::math::negative_binomial_distribution<double, real_policy>(5, 0.4));
+
+    // The geometric distribution's quantile is never rounded, but the table's is:
+    check_definition(discrete_table<boost::math::geometric_distribution<double, up_policy>>(boost::math::geometric_distribution<double, up_policy>(0.15)), true);
+    check_definition(discrete_table<boost::math::geometric_distribution<double, down_policy>>(boost::math::geometric_distribution<double, down_policy>(0.15)), false);
+    check_definition(discrete_table<boost::math::hypergeometric_distribution<double, up_policy>>(boost::math::hypergeometric_distribution<double, up_policy>(50, 200, 500)), true);
+    check_definition(discrete_table<boost::math::hypergeometric_distribution<double, down_policy>>(boost::math::hypergeometric_distribution<double, down_policy>(50, 200, 500)), false);
+}
+
+// Pearson's chi-squared statistic of a sample, with cells of small expected counts pooled:
+template<class Dist>
+void test_sampling(const Dist& dist, typename Dist::value_type tail = std::numeric_limits<typename Dist::value_type>::epsilon())
+{
+    using Real = typename Dist::value_type;
+    discrete_table<Dist> table(dist, tail);
+    const std::size_t n = 200000;
+    std::vector<Real> x(n);
+    std::mt19937_64 gen(42);
+    table.fill(gen, x.begin(), x.end());
+    std::mt19937_64 gen2(42);
+    for (std::size_t i = 0; i < 50; ++i)
+    {
+        CHECK_EQUAL(table(gen2), x[i]);
+    }
+
+    Real lowest = Real(support(dist).first);
+    std::vector<std::size_t> counts;
+    for (Real k : x)
+    {
+        CHECK_EQUAL(k, std::floor(k));
+        CHECK_LE(lowest, k);
+        std::size_t i = static_cast<std::size_t>(k - lowest);
+        if (i >= counts.size())
+        {
+            counts.resize(i + 1);
+        }
+        ++counts[i];
+    }
+    double chi2 = 0;
+    std::size_t cells = 0;
+    double observed = 0;
+    double expected = 0;
+    for (std::size_t i = 0; i < counts.size() + 1; ++i)
+    {
+        observed += i < counts.size() ? counts[i] : 0;
+        expected += i < counts.size() ? n*static_cast<double>(pdf(dist, Real(lowest + i))) : n*static_cast<double>(cdf(complement(dist, Real(lowest + i - 1))));
+        if (expected >= 20 || i == counts.size())
+        {
+            chi2 += (observed - expected)*(observed - expected)/expected;
+            observed = expected = 0;
+            ++cells;
+        }
+    }
+    // The 99.9th percentile of the chi-squared distribution with cells - 1 degrees of freedom:
+    double bound = quantile(complement(boost::math::chi_squared_distribution<double>(static_cast<double>(cells - 1)), 1e-3));
+    if (!CHECK_LE(chi2, bound))
+    {
+        std::cerr << "  Chi-squared test failed for " << typeid(Dist).name() << "\n";
+    }
+}
+
+void test_samplers()
+{
+    using namespace boost::math;
+    test_sampling(poisson_distribution<double>(3.5));
+    test_sampling(poisson_distribution<double>(800));
+    test_sampling(binomial_distribution<double>(30, 0.6));
+    test_sampling(negative_binomial_distribution<double>(3, 0.25));
+    test_sampling(geometric_distribution<double>(0.05));
+    test_sampling(hypergeometric_distribution<double>(20, 60, 100));
+    test_sampling(poisson_distribution<float>(12.5f));
+    test_sampling(binomial_distribution<long double>(100, 0.05L));
+    // A deliberately short table, so that a fair share of the draws comes from the tails:
+    test_sampling(poisson_distribution<double>(20), 0.05);
+    test_sampling(binomial_distribution<double>(200, 0.4), 0.1);
+}
+
+void test_errors()
+{
+    using namespace boost::math;
+    CHECK_THROW(discrete_table<poisson_distribution<double>>(poisson_distribution<double>(3), 0), std::domain_error);
+    CHECK_THROW(discrete_table<poisson_distribution<double>>(poisson_distribution<double>(3), 0.5), std::domain_error);
+    CHECK_THROW(discrete_table<poisson_distribution<double>>(poisson_distribution<double>(1e8), 1e-15, 1000), std::domain_error);
+    discrete_table<poisson_distribution<double>> table(poisson_distribution<double>(3));
+    CHECK_THROW(table.quantile(-0.5), std::domain_error);
+    CHECK_THROW(table.quantile(1.5), std::domain_error);
+
+    // Without exceptions a failed construction leaves an empty table that forwards to the distribution:
+    using quiet_policy = policy<domain_error<ignore_error>>;
+    using quiet_poisson = poisson_distribution<double, quiet_policy>;
+    const quiet_poisson dist(3);
+    for (double tail : {0.0, 0.5})
+    {
+        discrete_table<quiet_poisson> quiet(dist, tail);
+        CHECK_LE(quiet.table_range().second, quiet.table_range().first);
+        CHECK_EQUAL(quiet.pdf(2), pdf(dist, 2.0));
+        CHECK_EQUAL(quiet.cdf(4), cdf(dist, 4.0));
+        CHECK_EQUAL(quiet.quantile(0.3), quantile(dist, 0.3));
+        std::mt19937_64 gen(7);
+        double mean = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            const double k = quiet(gen);
+            CHECK_EQUAL(k, std::floor(k));
+            mean += k/1000;
+        }
+        CHECK_ABSOLUTE_ERROR(3.0, mean, 0.3);
+    }
+}
+
+int main()
+{
+    using namespace boost::math;
+    test_tabulated_values(poisson_distribution<double>(4.5));
+    test_tabulated_values(binomial_distribution<double>(60, 0.25));
+    test_tabulated_values(negative_binomial_distribution<float>(4, 0.3f));
+    test_tabulated_values(hypergeometric_distribution<double>(30, 80, 200));
+    test_quantiles(poisson_distribution<double>(4.5));
+    test_quantiles(poisson_distribution<long double>(37));
+    test_quantiles(binomial_distribution<double>(60, 0.25));
+    test_quantiles(negative_binomial_distribution<float>(4, 0.3f));
+    test_policies();
+    test_samplers();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+#include <boost/math/tools/fft.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/tools/precision.hpp>
+#include <boost/math/concepts/real_concept.hpp>
+
+using boost::math::tools::fft;
+using boost::math::tools::ifft;
+using boost::math::tools::real_fft;
+using boost::math::tools::dct_2;
+
+template<class Real>
+std::vector<std::complex<Real>> naive_dft(std::vector<std::complex<Real>> const & x)
+{
+    using std::cos;
+    using std::sin;
+    using boost::math::constants::two_pi;
+    std::size_t n = x.size();
+    std::vector<std::complex<Real>> X(n);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        std::complex<Real> sum(0, 0);
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            Real theta = two_pi<Real>()*Real((j*k) % n)/Real(n);
+            sum += x[j]*std::complex<Real>(cos(theta), -sin(theta));
+        }
+        X[k] = sum;
+    }
+    return X;
+}
+
+template<class Real>
+Real max_abs(std::vector<std::complex<Real>> const & v)
+{
+    using std::abs;
+    Real m = 0;
+    for (auto const & z : v)
+    {
+        m = (std::max)(m, abs(z));
+    }
+    return m;
+}
+
+template<class Real>
+void test_complex_fft(std::size_t n, Real tol)
+{
+    using std::abs;
+    std::mt19937_64 gen(n);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    std::vector<std::complex<Real>> x(n);
+    for (auto & z : x)
+    {
+        z = std::complex<Real>(Real(dis(gen)), Real(dis(gen)));
+    }
+    auto expected = naive_dft(x);
+    auto computed = x;
+    fft(computed.data(), n);
+    Real scale = max_abs(expected);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        if (!CHECK_LE(Real(abs(computed[k] - expected[k])), tol*scale))
+        {
+            std::cerr << "  Forward transform of length " << n << " failed at k = " << k << "\n";
+            break;
+        }
+    }
+    // The inverse is unnormalized:
+    ifft(computed.data(), n);
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        if (!CHECK_LE(Real(abs(computed[k]/Real(n) - x[k])), tol))
+        {
+            std::cerr << "  Round trip of length " << n << " failed at k = " << k << "\n";
+            break;
+        }
+    }
+}
+
+template<class Real>
+void test_real_transforms(std::size_t n, Real tol)
+{
+    using std::abs;
+    using std::cos;
+    using boost::math::constants::pi;
+    std::mt19937_64 gen(3*n + 1);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    std::vector<Real> x(n);
+    std::vector<std::complex<Real>> xc(n);
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        x[j] = Real(dis(gen));
+        xc[j] = std::complex<Real>(x[j], 0);
+    }
+    auto expected = naive_dft(xc);
+    std::vector<std::complex<Real>> computed(n/2 + 1);
+    real_fft(x.data(), n, computed.data());
+    Real scale = max_abs(expected);
+    for (std::size_t k = 0; k <= n/2; ++k)
+    {
+        CHECK_LE(Real(abs(computed[k] - expected[k])), tol*scale);
+    }
+
+    std::vector<Real> y(n);
+    dct_2(x.data(), n, y.data());
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        Real sum = 0;
+        for (std::size_t j = 0; j < n; ++j)
+        {
+            sum += x[j]*cos(pi<Real>()*Real((k*(2*j + 1)) % (4*n))/Real(2*n));
+        }
+        CHECK_LE(Real(abs(y[k] - 2*sum)), tol*scale);
+    }
+}
+
+template<class Real>
+void test_lengths()
+{
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    // Every small length exercises a different mixture of radix 2, 3, 4, 5 stages and Bluestein:
+    for (std::size_t n = 1; n <= 64; ++n)
+    {
+        test_complex_fft<Real>(n, tol);
+        test_real_transforms<Real>(n, tol);
+    }
+    for (std::size_t n : {97, 100, 127, 243, 256, 625, 1000, 1021})
+    {
+        test_complex_fft<Real>(n, 4*tol);
+        test_real_transforms<Real>(n, 4*tol);
+    }
+}
+
+template<class Real>
+void test_impulse_and_constant()
+{
+    // The transform of a unit impulse is identically one, and the transform of a constant is an impulse:
+    for (std::size_t n : {1, 2, 7, 16, 30, 31})
+    {
+        std::vector<std::complex<Real>> x(n, std::complex<Real>(0, 0));
+        x[0] = 1;
+        fft(x.data(), n);
+        for (auto const & z : x)
+        {
+            CHECK_ULP_CLOSE(Real(1), z.real(), 4*n);
+            CHECK_ABSOLUTE_ERROR(Real(0), z.imag(), 8*n*std::numeric_limits<Real>::epsilon());
+        }
+        fft(x.data(), n);
+        CHECK_ULP_CLOSE(Real(n), x[0].real(), 8*n);
+        for (std::size_t k = 1; k < n; ++k)
+        {
+            CHECK_ABSOLUTE_ERROR(Real(0), x[k].real(), 16*n*std::numeric_limits<Real>::epsilon());
+        }
+    }
+}
+
+int main()
+{
+    test_lengths<float>();
+    test_lengths<double>();
+    test_lengths<long double>();
+    test_impulse_and_constant<float>();
+    test_impulse_and_constant<double>();
+    // The transforms are generic, so any Real type with the usual arithmetic and std::complex support works:
+    using boost::math::concepts::real_concept;
+    for (std::size_t n : {12, 17, 40})
+    {
+        test_complex_fft<real_concept>(n, 256*boost::math::tools::epsilon<real_concept>());
+        test_real_transforms<real_concept>(n, 256*boost::math::tools::epsilon<real_concept>());
+    }
+    return boost::math::test::report_errors();
+}
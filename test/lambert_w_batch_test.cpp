@@ -0,0 +1,124 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <list>
+#include <random>
+#include <vector>
+#include <boost/math/special_functions/lambert_w.hpp>
+#include <boost/math/concepts/real_concept.hpp>
+
+// Compares against the scalar function evaluated in a wider type:
+template<class Real, class Wide>
+void test_w0(Real tol)
+{
+    using std::abs;
+    std::mt19937_64 gen(1618);
+    std::uniform_real_distribution<double> dis(0, 1);
+    std::vector<Real> z;
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        double r = dis(gen);
+        // Cover the whole table, both sides of the origin, and the scalar fallbacks at either end:
+        switch (i % 4)
+        {
+        case 0:
+            z.push_back(Real(-0.3678 + 0.4*r));
+            break;
+        case 1:
+            z.push_back(Real(std::exp(-30 + 50*r)));
+            break;
+        case 2:
+            z.push_back(Real(-std::exp(-30 + 28.9*r)));
+            break;
+        default:
+            z.push_back(Real(r*r*r*4e7));
+        }
+    }
+    z.push_back(Real(0));
+    z.push_back(-boost::math::constants::exp_minus_one<Real>());
+    std::vector<Real> w(z.size());
+    auto it = boost::math::lambert_w0(z.begin(), z.end(), w.begin());
+    CHECK_EQUAL(it == w.end(), true);
+    // The branch point itself is checked separately, as it is below -1/e in the wider type:
+    for (std::size_t i = 0; i + 1 < z.size(); ++i)
+    {
+        Real expected = static_cast<Real>(boost::math::lambert_w0(static_cast<Wide>(z[i])));
+        // Close to the branch point the function itself is ill-conditioned:
+        Real scale = z[i] < Real(-0.34) ? Real(64) : Real(1);
+        if (!CHECK_LE(Real(abs(w[i] - expected)), scale*tol*abs(expected)))
+        {
+            std::cerr << "  lambert_w0 batch failed at z = " << z[i] << "\n";
+        }
+    }
+    CHECK_EQUAL(w[z.size() - 2], Real(0));
+    CHECK_EQUAL(w[z.size() - 1], Real(-1));
+}
+
+template<class Real, class Wide>
+void test_wm1(Real tol)
+{
+    using std::abs;
+    std::mt19937_64 gen(2718);
+    std::uniform_real_distribution<double> dis(0, 1);
+    std::vector<Real> z;
+    for (std::size_t i = 0; i < 3000; ++i)
+    {
+        double r = dis(gen);
+        z.push_back(i % 2 ? Real(-std::exp(-60*r)*0.3678) : Real(-0.3678 + 0.3677*r));
+    }
+    std::list<Real> zl(z.begin(), z.end());
+    std::vector<Real> w;
+    boost::math::lambert_wm1(zl.begin(), zl.end(), std::back_inserter(w));
+    CHECK_EQUAL(w.size(), z.size());
+    for (std::size_t i = 0; i < z.size(); ++i)
+    {
+        Real expected = static_cast<Real>(boost::math::lambert_wm1(static_cast<Wide>(z[i])));
+        // Below -0.25 the batch uses the scalar code, which is a few epsilon less accurate:
+        Real scale = z[i] < Real(-0.25) ? Real(64) : Real(1);
+        if (!CHECK_LE(Real(abs(w[i] - expected)), scale*tol*abs(expected)))
+        {
+            std::cerr << "  lambert_wm1 batch failed at z = " << z[i] << "\n";
+        }
+    }
+}
+
+template<class Real>
+void test_errors()
+{
+    // Errors are raised just as for the scalar functions:
+    std::vector<Real> bad{Real(1), Real(-1)};
+    std::vector<Real> w(2);
+    CHECK_THROW(boost::math::lambert_w0(bad.begin(), bad.end(), w.begin()), std::domain_error);
+    CHECK_THROW(boost::math::lambert_wm1(bad.begin(), bad.end(), w.begin()), std::domain_error);
+    bad = {Real(1), std::numeric_limits<Real>::quiet_NaN()};
+    CHECK_THROW(boost::math::lambert_w0(bad.begin(), bad.end(), w.begin()), std::domain_error);
+}
+
+int main()
+{
+    test_w0<float, double>(4*std::numeric_limits<float>::epsilon());
+    test_w0<double, long double>(4*std::numeric_limits<double>::epsilon());
+    test_w0<long double, long double>(8*std::numeric_limits<long double>::epsilon());
+    test_wm1<float, double>(4*std::numeric_limits<float>::epsilon());
+    test_wm1<double, long double>(4*std::numeric_limits<double>::epsilon());
+    test_wm1<long double, long double>(8*std::numeric_limits<long double>::epsilon());
+    test_errors<float>();
+    test_errors<double>();
+
+    // Types without a table use the scalar code throughout:
+    using boost::math::concepts::real_concept;
+    std::vector<real_concept> z{real_concept(0.5), real_concept(2), real_concept(-0.2)};
+    std::vector<real_concept> w(3);
+    boost::math::lambert_w0(z.begin(), z.end(), w.begin());
+    for (std::size_t i = 0; i < z.size(); ++i)
+    {
+        CHECK_EQUAL(boost::math::lambert_w0(z[i]), w[i]);
+    }
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,369 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <boost/math/statistics/least_squares.hpp>
+#include <boost/math/statistics/linear_regression.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::least_squares_accumulator;
+using boost::math::statistics::fit_least_squares;
+using boost::math::statistics::fit_weighted_least_squares;
+
+// Rows of p predictors, one after another, and y = c_0 + sum_k c_k x_k + sigma*noise:
+template<class Real>
+std::tuple<std::vector<Real>, std::vector<Real>> regression_data(std::size_t rows, const std::vector<Real>& c, Real sigma, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_real_distribution<Real> unif(-1, 1);
+    std::normal_distribution<Real> noise(0, 1);
+    const std::size_t p = c.size() - 1;
+    std::vector<Real> x(rows*p);
+    std::vector<Real> y(rows);
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        y[i] = c[0] + sigma*noise(gen);
+        for (std::size_t k = 0; k < p; ++k)
+        {
+            x[i*p + k] = (k + 1)*unif(gen) + k;
+            y[i] += c[k + 1]*x[i*p + k];
+        }
+    }
+    return std::make_tuple(x, y);
+}
+
+// The solution of the normal equations (X^T W X + lambda D) c = X^T W y, in long double, as a reference:
+std::vector<long double> normal_equations(const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& w, double lambda = 0)
+{
+    const std::size_t p = x.size()/y.size();
+    const std::size_t m = p + 1;
+    std::vector<std::vector<long double>> a(m, std::vector<long double>(m + 1, 0));
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        std::vector<long double> row(m + 1, 1);
+        for (std::size_t k = 0; k < p; ++k)
+        {
+            row[k + 1] = x[i*p + k];
+        }
+        row[m] = y[i];
+        const long double wi = w.empty() ? 1 : w[i];
+        for (std::size_t j = 0; j < m; ++j)
+        {
+            for (std::size_t k = 0; k <= m; ++k)
+            {
+                a[j][k] += wi*row[j]*row[k];
+            }
+        }
+    }
+    for (std::size_t j = 1; j < m; ++j)
+    {
+        a[j][j] += lambda;
+    }
+    for (std::size_t c = 0; c < m; ++c)
+    {
+        for (std::size_t i = c + 1; i < m; ++i)
+        {
+            const long double f = a[i][c]/a[c][c];
+            for (std::size_t k = c; k <= m; ++k)
+            {
+                a[i][k] -= f*a[c][k];
+            }
+        }
+    }
+    std::vector<long double> c(m);
+    for (std::size_t i = m; i-- > 0;)
+    {
+        long double s = a[i][m];
+        for (std::size_t k = i + 1; k < m; ++k)
+        {
+            s -= a[i][k]*c[k];
+        }
+        c[i] = s/a[i][i];
+    }
+    return c;
+}
+
+template<class Real>
+void test_exact()
+{
+    const std::vector<Real> c {Real(1.5), Real(-2), Real(0.25), Real(4)};
+    const auto [x, y] = regression_data<Real>(1000, c, Real(0), 1);
+    const Real tol = 400*std::numeric_limits<Real>::epsilon();
+
+    auto check = [&](const least_squares_accumulator<Real>& fit)
+    {
+        const auto computed = fit.coefficients();
+        CHECK_EQUAL(computed.size(), c.size());
+        for (std::size_t k = 0; k < c.size(); ++k)
+        {
+            CHECK_LE(std::abs(computed[k] - c[k]), tol*4);
+        }
+        CHECK_LE(fit.residual_sum_of_squares(), tol);
+        CHECK_LE(std::abs(fit.R_squared() - 1), tol);
+        CHECK_EQUAL(fit.count(), y.size());
+    };
+
+    check(fit_least_squares(x, y));
+
+    // One row at a time, by rotations:
+    least_squares_accumulator<Real> by_rows(3);
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        by_rows.add_row(std::vector<Real>(x.begin() + 3*i, x.begin() + 3*i + 3), y[i]);
+    }
+    check(by_rows);
+
+    // Shards of unequal size, merged:
+    least_squares_accumulator<Real> a(3);
+    least_squares_accumulator<Real> b(3);
+    a.add_rows(x.begin(), x.begin() + 3*17, y.begin());
+    b.add_rows(x.begin() + 3*17, x.end(), y.begin() + 17);
+    a.merge(b);
+    check(a);
+}
+
+void test_against_normal_equations()
+{
+    const std::vector<double> c {3, 1, -1, 0.5, 2, -0.125};
+    const auto [x, y] = regression_data<double>(20000, c, 0.5, 2);
+    const auto expected = normal_equations(x, y, {});
+    const auto fit = fit_least_squares(x, y);
+    const auto computed = fit.coefficients();
+    for (std::size_t k = 0; k < c.size(); ++k)
+    {
+        CHECK_LE(std::abs(computed[k] - static_cast<double>(expected[k])), 1e-11);
+    }
+
+    double rss = 0;
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        double r = y[i] - computed[0];
+        for (std::size_t k = 0; k < 5; ++k)
+        {
+            r -= computed[k + 1]*x[i*5 + k];
+        }
+        rss += r*r;
+    }
+    CHECK_LE(std::abs(fit.residual_sum_of_squares() - rss), 1e-9*rss);
+
+    // Without an intercept, the coefficients are the slopes only:
+    const auto through_origin = fit_least_squares(x, y, false);
+    CHECK_EQUAL(through_origin.coefficients().size(), std::size_t(5));
+    CHECK_EQUAL(through_origin.has_intercept(), false);
+}
+
+// One predictor agrees with simple_ordinary_least_squares_with_R_squared:
+void test_simple()
+{
+    const auto [x, y] = regression_data<double>(500, {2, 3}, 1, 3);
+    const auto [c0, c1, R2] = boost::math::statistics::simple_ordinary_least_squares_with_R_squared(x, y);
+    const auto fit = fit_least_squares(x, y);
+    const auto c = fit.coefficients();
+    CHECK_LE(std::abs(c[0] - c0), 1e-12);
+    CHECK_LE(std::abs(c[1] - c1), 1e-12);
+    CHECK_LE(std::abs(fit.R_squared() - R2), 1e-12);
+}
+
+void test_weighted()
+{
+    // An integer weight is the same as repeating the row:
+    const auto [x, y] = regression_data<double>(300, {1, 2, -3}, 1, 4);
+    std::vector<double> w(y.size());
+    std::vector<double> x_repeated;
+    std::vector<double> y_repeated;
+    for (std::size_t i = 0; i < y.size(); ++i)
+    {
+        w[i] = static_cast<double>(i % 4);
+        for (std::size_t r = 0; r < i % 4; ++r)
+        {
+            x_repeated.push_back(x[2*i]);
+            x_repeated.push_back(x[2*i + 1]);
+            y_repeated.push_back(y[i]);
+        }
+    }
+    const auto weighted = fit_weighted_least_squares(x, y, w);
+    const auto repeated = fit_least_squares(x_repeated, y_repeated);
+    const auto cw = weighted.coefficients();
+    const auto cr = repeated.coefficients();
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        CHECK_LE(std::abs(cw[k] - cr[k]), 1e-12);
+    }
+    CHECK_LE(std::abs(weighted.residual_sum_of_squares() - repeated.residual_sum_of_squares()), 1e-10*repeated.residual_sum_of_squares());
+    CHECK_LE(std::abs(weighted.R_squared() - repeated.R_squared()), 1e-12);
+
+    const auto expected = normal_equations(x, y, w);
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+        CHECK_LE(std::abs(cw[k] - static_cast<double>(expected[k])), 1e-12);
+    }
+
+    w[5] = -1;
+    CHECK_THROW(fit_weighted_least_squares(x, y, w), std::domain_error);
+}
+
+void test_ridge()
+{
+    const auto [x, y] = regression_data<double>(400, {1, 2, -3, 0.5}, 1, 5);
+    const auto fit = fit_least_squares(x, y);
+    const auto ols = fit.coefficients();
+    const auto zero = fit.ridge_coefficients(0);
+    for (std::size_t k = 0; k < ols.size(); ++k)
+    {
+        CHECK_LE(std::abs(zero[k] - ols[k]), 1e-12);
+    }
+    for (double lambda : {0.1, 10.0, 1000.0})
+    {
+        const auto computed = fit.ridge_coefficients(lambda);
+        const auto expected = normal_equations(x, y, {}, lambda);
+        for (std::size_t k = 0; k < computed.size(); ++k)
+        {
+            CHECK_LE(std::abs(computed[k] - static_cast<double>(expected[k])), 1e-11);
+        }
+    }
+    // A huge penalty leaves only the intercept, which is the mean of y:
+    const auto flat = fit.ridge_coefficients(1e20);
+    double mu = 0;
+    for (double v : y)
+    {
+        mu += v;
+    }
+    mu /= y.size();
+    CHECK_LE(std::abs(flat[0] - mu), 1e-9);
+    CHECK_LE(std::abs(flat[1]), 1e-9);
+    CHECK_THROW(fit.ridge_coefficients(-1), std::domain_error);
+}
+
+// A window of rows sliding through the data agrees with a fresh fit of the rows in it:
+void test_sliding_window()
+{
+    const std::size_t p = 4;
+    const std::size_t window = 150;
+    const auto [x, y] = regression_data<double>(3000, {0.5, 1, 2, 3, 4}, 0.25, 6);
+    auto row = [&x](std::size_t i) { return std::vector<double>(x.begin() + p*i, x.begin() + p*(i + 1)); };
+
+    least_squares_accumulator<double> sliding(p);
+    sliding.add_rows(x.begin(), x.begin() + p*window, y.begin());
+    for (std::size_t i = window; i < y.size(); ++i)
+    {
+        sliding.add_row(row(i), y[i]);
+        sliding.remove_row(row(i - window), y[i - window]);
+        if (i % 500 == 0 || i + 1 == y.size())
+        {
+            least_squares_accumulator<double> fresh(p);
+            fresh.add_rows(x.begin() + p*(i + 1 - window), x.begin() + p*(i + 1), y.begin() + (i + 1 - window));
+            const auto expected = fresh.coefficients();
+            const auto computed = sliding.coefficients();
+            for (std::size_t k = 0; k <= p; ++k)
+            {
+                CHECK_LE(std::abs(computed[k] - expected[k]), 1e-9);
+            }
+            CHECK_LE(std::abs(sliding.residual_sum_of_squares() - fresh.residual_sum_of_squares()), 1e-9*fresh.residual_sum_of_squares());
+            CHECK_LE(std::abs(sliding.R_squared() - fresh.R_squared()), 1e-9);
+            CHECK_EQUAL(sliding.count(), window);
+        }
+    }
+
+    // Weighted rows come out with their weights:
+    least_squares_accumulator<double> weighted(p);
+    weighted.add_rows(x.begin(), x.begin() + p*window, y.begin());
+    weighted.add_row(row(window), y[window], 3);
+    weighted.remove_row(row(window), y[window], 3);
+    least_squares_accumulator<double> fresh(p);
+    fresh.add_rows(x.begin(), x.begin() + p*window, y.begin());
+    CHECK_LE(std::abs(weighted.coefficients()[2] - fresh.coefficients()[2]), 1e-10);
+
+    // Too few rows left to determine the coefficients:
+    least_squares_accumulator<double> small(p);
+    for (std::size_t i = 0; i <= p; ++i)
+    {
+        small.add_row(row(i), y[i]);
+    }
+    CHECK_THROW(small.remove_row(row(0), y[0]), std::domain_error);
+    least_squares_accumulator<double> empty(p);
+    CHECK_THROW(empty.remove_row(row(0), y[0]), std::domain_error);
+}
+
+template<class ExecutionPolicy>
+void test_parallel(ExecutionPolicy&& exec)
+{
+    const std::vector<double> c {1, -1, 2, -2, 3, -3, 4, -4, 5};
+    const auto [x, y] = regression_data<double>(200000, c, 0.1, 7);
+    const auto expected = fit_least_squares(x, y).coefficients();
+    const auto fit = fit_least_squares(exec, x, y);
+    const auto computed = fit.coefficients();
+    for (std::size_t k = 0; k < c.size(); ++k)
+    {
+        CHECK_LE(std::abs(computed[k] - expected[k]), 1e-11);
+    }
+    CHECK_EQUAL(fit.count(), y.size());
+    const std::vector<double> w(y.size(), 2.0);
+    const auto weighted = fit_weighted_least_squares(exec, x, y, w);
+    CHECK_LE(std::abs(weighted.residual_sum_of_squares() - 2*fit.residual_sum_of_squares()), 1e-9*fit.residual_sum_of_squares());
+}
+
+void test_errors()
+{
+    // Collinear predictors:
+    std::vector<double> x;
+    std::vector<double> y;
+    for (std::size_t i = 0; i < 50; ++i)
+    {
+        x.push_back(i);
+        x.push_back(2.0*i);
+        y.push_back(i % 3);
+    }
+    const auto collinear = fit_least_squares(x, y);
+    CHECK_THROW(collinear.coefficients(), std::domain_error);
+    // Fewer rows than coefficients:
+    least_squares_accumulator<double> short_fit(2);
+    short_fit.add_row(std::vector<double>{1, 2}, 3);
+    CHECK_THROW(short_fit.coefficients(), std::domain_error);
+
+    CHECK_THROW(short_fit.add_row(std::vector<double>{1, 2, 3}, 3), std::domain_error);
+    CHECK_THROW(short_fit.add_row(std::vector<double>{1, 2}, 3, -1), std::domain_error);
+    CHECK_THROW(least_squares_accumulator<double>(0), std::domain_error);
+    y.pop_back();
+    CHECK_THROW(fit_least_squares(x, y), std::domain_error);
+    least_squares_accumulator<double> three(3);
+    CHECK_THROW(three.merge(short_fit), std::domain_error);
+
+    // Integer data:
+    const std::vector<int> xi {1, 2, 3, 4, 5, 6};
+    const std::vector<int> yi {3, 5, 7, 9, 11, 13};
+    const auto ci = fit_least_squares(xi, yi).coefficients();
+    CHECK_LE(std::abs(ci[0] - 1.0), 1e-13);
+    CHECK_LE(std::abs(ci[1] - 2.0), 1e-13);
+}
+
+int main()
+{
+    test_exact<float>();
+    test_exact<double>();
+    test_against_normal_equations();
+    test_simple();
+    test_weighted();
+    test_ridge();
+    test_sliding_window();
+    test_parallel(std::execution::par);
+#ifdef BOOST_MATH_HAS_THREADS
+    boost::math::statistics::thread_pool pool(3);
+    test_parallel(pool);
+#endif
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/log_factorial_cache.hpp>
+
+using namespace boost::math;
+
+// The pmfs are exp of sums of logarithms, so their relative error grows with |log(pmf)|:
+template<class Real>
+Real pmf_tolerance(Real expected)
+{
+    using std::log;
+    return 8 * std::numeric_limits<Real>::epsilon() * (1 - log(expected));
+}
+
+template<class Real>
+void test_cache()
+{
+    using std::fabs;
+    using std::log;
+    log_factorial_cache<Real> cache(3000);
+    CHECK_EQUAL(cache.size(), std::size_t(0));
+    CHECK_EQUAL(cache.max_size(), std::size_t(3072));
+    const log_factorial_cache<long double> reference;
+    for (std::uintmax_t n = 0; n < 5000; n += (n < 40) ? 1 : 37)
+    {
+        CHECK_ULP_CLOSE(static_cast<Real>(boost::math::lgamma(static_cast<long double>(n) + 1)), cache.log_factorial(n), 2);
+        if (n > 0)
+        {
+            CHECK_ULP_CLOSE(static_cast<Real>(reference.stirling_error(n)), cache.stirling_error(n), 4);
+        }
+    }
+    CHECK_EQUAL(cache.size(), std::size_t(3072));
+    // delta(1) = 1 - log(sqrt(2 pi)):
+    CHECK_ULP_CLOSE(static_cast<Real>(1 - log(boost::math::constants::root_two_pi<long double>())), cache.stirling_error(1), 2);
+    CHECK_ULP_CLOSE(Real(1) / (12 * Real(1e15)), cache.stirling_error(std::uintmax_t(1000000000000000)), 1);
+}
+
+template<class Real>
+void test_binomial()
+{
+    log_factorial_cache<Real> cache;
+    for (Real n : {Real(1), Real(2), Real(10), Real(100), Real(1000), Real(30000)})
+    {
+        for (Real p : {Real(1e-6), Real(0.01), Real(0.3), Real(0.5), Real(0.9), Real(0.999999), Real(0), Real(1)})
+        {
+            binomial_distribution<Real> dist(n, p);
+            binomial_distribution<long double> reference(n, p);
+            std::vector<Real> k;
+            for (Real x = 0; x <= n; x += (std::max)(Real(1), Real(std::floor(n / 100))))
+            {
+                k.push_back(x);
+            }
+            k.push_back(n);
+            std::vector<Real> batch(k.size());
+            pdf(dist, k.begin(), k.end(), batch.begin(), cache);
+            for (std::size_t i = 0; i < k.size(); ++i)
+            {
+                const Real expected = static_cast<Real>(pdf(reference, static_cast<long double>(k[i])));
+                CHECK_EQUAL(batch[i], pdf(dist, k[i], cache));
+                if (expected > std::numeric_limits<Real>::min())
+                {
+                    CHECK_LE(std::fabs(batch[i] - expected), pmf_tolerance(expected) * expected);
+                }
+            }
+        }
+    }
+    // Non-integer trials go to the distribution:
+    binomial_distribution<Real> dist(Real(10.5), Real(0.25));
+    CHECK_EQUAL(pdf(dist, Real(3), cache), pdf(dist, Real(3)));
+}
+
+// Far beyond where the distribution's own pdf is accurate to a few epsilon, successive values
+// must still satisfy the recurrence:
+void test_binomial_recurrence()
+{
+    const log_factorial_cache<double> cache;
+    for (double n : {1e6, 1e9, 1e12})
+    {
+        for (double p : {0.01, 0.3, 0.999999})
+        {
+            binomial_distribution<double> dist(n, p);
+            const double mode = std::floor(n * p);
+            for (double k = mode - 5; k < (std::min)(mode + 5, n); ++k)
+            {
+                const long double ratio = static_cast<long double>(n - k) / (k + 1) * p / (1 - static_cast<long double>(p));
+                const double expected = static_cast<double>(pdf(dist, k, cache) * ratio);
+                CHECK_ULP_CLOSE(expected, pdf(dist, k + 1, cache), 16);
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_negative_binomial()
+{
+    log_factorial_cache<Real> cache;
+    for (Real r : {Real(1), Real(3), Real(50), Real(1000), Real(2.5)})
+    {
+        for (Real p : {Real(0.01), Real(0.5), Real(0.9), Real(0.999)})
+        {
+            negative_binomial_distribution<Real> dist(r, p);
+            negative_binomial_distribution<long double> reference(r, p);
+            for (Real k : {Real(0), Real(1), Real(5), Real(50), Real(1000), Real(100000)})
+            {
+                const Real expected = static_cast<Real>(pdf(reference, static_cast<long double>(k)));
+                if (expected > std::numeric_limits<Real>::min())
+                {
+                    CHECK_LE(std::fabs(pdf(dist, k, cache) - expected), pmf_tolerance(expected) * expected);
+                }
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_hypergeometric()
+{
+    log_factorial_cache<Real> cache;
+    for (auto params : {std::vector<std::uint64_t>{5, 10, 20}, {50, 100, 1000}, {400, 600, 1000}, {10000, 30000, 100000},
+                        {3, 20000, 50000}, {999, 1, 1000}, {0, 5, 10}, {10, 10, 10}, {0, 0, 0}})
+    {
+        hypergeometric_distribution<Real> dist(params[0], params[1], params[2]);
+        hypergeometric_distribution<long double> reference(params[0], params[1], params[2]);
+        const auto support = range(dist);
+        for (std::uint64_t x = support.first; x <= support.second; x += (std::max)(std::uint64_t(1), (support.second - support.first) / 97))
+        {
+            const Real expected = static_cast<Real>(pdf(reference, x));
+            if (expected > std::numeric_limits<Real>::min())
+            {
+                CHECK_LE(std::fabs(pdf(dist, x, cache) - expected), pmf_tolerance(expected) * expected);
+            }
+        }
+    }
+}
+
+// The batched cdf against the distribution's own, at shuffled points with repeats:
+template<class Dist>
+void test_cdf(const Dist& dist, std::vector<typename Dist::value_type> x)
+{
+    using Real = typename Dist::value_type;
+    std::mt19937_64 gen(12345);
+    x.push_back(x[x.size() / 2]);
+    std::shuffle(x.begin(), x.end(), gen);
+    std::vector<Real> batch(x.size());
+    cdf(dist, x.begin(), x.end(), batch.begin());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        const Real expected = cdf(dist, x[i]);
+        if (expected > std::numeric_limits<Real>::min())
+        {
+            CHECK_LE(std::fabs(batch[i] - expected), 2 * pmf_tolerance(expected) * expected);
+        }
+        else
+        {
+            CHECK_LE(batch[i], 4 * std::numeric_limits<Real>::min());
+        }
+    }
+}
+
+template<class Real>
+void test_cdfs()
+{
+    std::vector<Real> x;
+    for (int k = 0; k <= 1000; ++k)
+    {
+        x.push_back(Real(k));
+    }
+    test_cdf(hypergeometric_distribution<Real>(400, 600, 1000), std::vector<Real>(x.begin(), x.begin() + 401));
+    test_cdf(hypergeometric_distribution<Real>(30, 60, 100), std::vector<Real>(x.begin(), x.begin() + 31));
+    test_cdf(hypergeometric_distribution<Real>(30, 960, 1000), std::vector<Real>(x.begin(), x.begin() + 31));
+    test_cdf(binomial_distribution<Real>(1000, Real(0.3)), x);
+    test_cdf(binomial_distribution<Real>(100, Real(0.999)), std::vector<Real>(x.begin(), x.begin() + 101));
+    test_cdf(negative_binomial_distribution<Real>(20, Real(0.1)), x);
+    test_cdf(negative_binomial_distribution<Real>(2.5, Real(0.1)), x);
+    test_cdf(negative_binomial_distribution<Real>(1, Real(0.5)), std::vector<Real>(x.begin(), x.begin() + 100));
+    // Small p, where the cdf below 1/2 is summed from below and the geometric tail decays slowly:
+    test_cdf(negative_binomial_distribution<Real>(1, Real(1e-4)), {Real(0), Real(1), Real(2), Real(50), Real(1000), Real(7000), Real(20000), Real(100000)});
+    if (std::numeric_limits<Real>::digits > 27)
+    {
+        // Beyond 2^24 a float no longer steps from one integer to the next:
+        test_cdf(negative_binomial_distribution<Real>(10000, Real(1e-4)), {Real(99980000), Real(99990000), Real(100000000), Real(101000000)});
+    }
+    // Sparse points, each far from the last:
+    test_cdf(binomial_distribution<Real>(100000, Real(0.3)), {Real(1), Real(10), Real(29000), Real(29900), Real(30000), Real(30100), Real(31000), Real(99999), Real(100000)});
+    // Non-integer trials go to the distribution:
+    test_cdf(binomial_distribution<Real>(Real(10.5), Real(0.25)), std::vector<Real>(x.begin(), x.begin() + 10));
+}
+
+void test_errors()
+{
+    const log_factorial_cache<double> cache;
+    CHECK_THROW(pdf(binomial_distribution<double>(10, 0.5), -1.0, cache), std::domain_error);
+    CHECK_THROW(pdf(binomial_distribution<double>(10, 0.5), 11.0, cache), std::domain_error);
+    CHECK_THROW(pdf(negative_binomial_distribution<double>(10, 0.5), std::numeric_limits<double>::quiet_NaN(), cache), std::domain_error);
+    CHECK_THROW(pdf(hypergeometric_distribution<double>(5, 10, 20), 1.5, cache), std::domain_error);
+    CHECK_THROW(pdf(hypergeometric_distribution<double>(5, 10, 20), 6, cache), std::domain_error);
+    std::vector<double> x{1.0, std::numeric_limits<double>::quiet_NaN()};
+    std::vector<double> out(x.size());
+    CHECK_THROW(cdf(binomial_distribution<double>(10, 0.5), x.begin(), x.end(), out.begin()), std::domain_error);
+    CHECK_THROW(cdf(hypergeometric_distribution<double>(5, 10, 20), x.begin(), x.end(), out.begin()), std::domain_error);
+    x[1] = -1;
+    CHECK_THROW(cdf(negative_binomial_distribution<double>(10, 0.5), x.begin(), x.end(), out.begin()), std::domain_error);
+    CHECK_THROW(pdf(negative_binomial_distribution<double>(10, 0.5), x.begin(), x.end(), out.begin()), std::domain_error);
+}
+
+int main()
+{
+    test_cache<float>();
+    test_cache<double>();
+    test_binomial<float>();
+    test_binomial<double>();
+    test_binomial_recurrence();
+    test_negative_binomial<double>();
+    test_hypergeometric<float>();
+    test_hypergeometric<double>();
+    test_cdfs<double>();
+    test_cdfs<float>();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/lognormal.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/chi_squared.hpp>
+#include <boost/math/distributions/beta.hpp>
+#include <boost/math/distributions/students_t.hpp>
+#include <boost/math/distributions/binomial.hpp>
+#include <boost/math/distributions/poisson.hpp>
+#include <boost/math/distributions/negative_binomial.hpp>
+
+using namespace boost::math;
+
+// The relative error in a log-space value, allowing for the rounding of x itself: when log(p) is
+// near zero even the exact function of a rounded x may differ from log(p) in many of its digits.
+// Anything smaller than the smallest normal double can only be zero.
+bool check_log_value(long double expected, double computed, long double condition, int ulps)
+{
+    using std::fabs;
+    if (fabs(expected) < std::numeric_limits<double>::min())
+    {
+        // Too close to log(1) = 0 for double precision to represent:
+        return CHECK_LE(fabs(computed), std::numeric_limits<double>::min());
+    }
+    long double error = fabs(computed - expected) / fabs(expected);
+    long double tolerance = ulps * std::numeric_limits<double>::epsilon() * (condition > 1 ? condition : 1);
+    return CHECK_LE(error, tolerance);
+}
+
+// The double precision log-space functions against the logs of the long double functions, whose
+// wider exponent range reaches far beyond the point where the double precision probabilities underflow:
+template<class Dist, class LongDist>
+void check_log_space(const Dist& dist, const LongDist& long_dist, const std::vector<double>& x, int ulps, bool check_pdf = true)
+{
+    using std::log;
+    using std::log1p;
+    using std::fabs;
+    const long double tiny = std::numeric_limits<long double>::min();
+    for (double v : x)
+    {
+        long double lv = v;
+        long double f = pdf(long_dist, lv);
+        if (check_pdf && f > tiny)
+        {
+            if (!check_log_value(log(f), logpdf(dist, v), 1, ulps))
+            {
+                std::cerr << "  logpdf failed at x = " << v << " for " << typeid(Dist).name() << "\n";
+            }
+        }
+        // Near one the log of the probability is best found from the opposite tail:
+        long double p = cdf(long_dist, lv);
+        long double q = cdf(complement(long_dist, lv));
+        long double expected = p > 0.5L ? log1p(-q) : log(p);
+        if (p > tiny)
+        {
+            if (!check_log_value(expected, logcdf(dist, v), fabs(lv * f / (p * expected)), ulps))
+            {
+                std::cerr << "  logcdf failed at x = " << v << " for " << typeid(Dist).name() << "\n";
+            }
+        }
+        expected = q > 0.5L ? log1p(-p) : log(q);
+        if (q > tiny)
+        {
+            if (!check_log_value(expected, logcdf(complement(dist, v)), fabs(lv * f / (q * expected)), ulps))
+            {
+                std::cerr << "  logcdf complement failed at x = " << v << " for " << typeid(Dist).name() << "\n";
+            }
+        }
+    }
+}
+
+void test_normal()
+{
+    std::vector<double> x{-60, -45, -38.5, -30, -10, -3, -0.5, 0, 0.25, 2, 8.5, 20, 39, 50};
+    check_log_space(normal_distribution<double>(), normal_distribution<long double>(), x, 8);
+    check_log_space(normal_distribution<double>(2, 0.5), normal_distribution<long double>(2, 0.5), x, 8);
+    // Still finite where the cdf has long since underflowed:
+    double v = logcdf(normal_distribution<double>(), -1e5);
+    CHECK_ULP_CLOSE(-5e9 - std::log(1e5) - constants::log_root_two_pi<double>(), v, 1);
+    CHECK_EQUAL(logcdf(normal_distribution<double>(), -std::numeric_limits<double>::infinity()), -std::numeric_limits<double>::infinity());
+    CHECK_EQUAL(logcdf(complement(normal_distribution<double>(), -std::numeric_limits<double>::infinity())), 0.0);
+
+    std::vector<double> y{1e-20, 1e-5, 0.3, 1, 4, 1e6, 1e18};
+    check_log_space(lognormal_distribution<double>(0, 0.5), lognormal_distribution<long double>(0, 0.5), y, 16);
+}
+
+void test_gamma()
+{
+    std::vector<double> x{1e-300, 1e-30, 1e-3, 0.5, 2, 7.5, 40, 300, 800, 2000};
+    check_log_space(gamma_distribution<double>(3.5), gamma_distribution<long double>(3.5), x, 16, false);
+    check_log_space(gamma_distribution<double>(0.25, 4), gamma_distribution<long double>(0.25, 4), x, 16, false);
+    check_log_space(gamma_distribution<double>(150, 0.5), gamma_distribution<long double>(150, 0.5), x, 64, false);
+    check_log_space(chi_squared_distribution<double>(5), chi_squared_distribution<long double>(5), x, 16);
+    check_log_space(chi_squared_distribution<double>(300), chi_squared_distribution<long double>(300), x, 64);
+}
+
+void test_beta()
+{
+    std::vector<double> x{1e-300, 1e-100, 1e-10, 0.01, 0.2, 0.5, 0.75, 0.999, 1 - 1e-12};
+    check_log_space(beta_distribution<double>(2, 3), beta_distribution<long double>(2, 3), x, 16);
+    check_log_space(beta_distribution<double>(0.5, 40), beta_distribution<long double>(0.5, 40), x, 16);
+    check_log_space(beta_distribution<double>(120, 250), beta_distribution<long double>(120, 250), x, 256);
+}
+
+void test_students_t()
+{
+    std::vector<double> x{-1e200, -1e60, -1e20, -300, -12, -1.5, 0, 0.75, 20, 1e15, 1e80};
+    check_log_space(students_t_distribution<double>(3), students_t_distribution<long double>(3), x, 32);
+    check_log_space(students_t_distribution<double>(12.5), students_t_distribution<long double>(12.5), x, 32);
+    check_log_space(students_t_distribution<double>(400), students_t_distribution<long double>(400), x, 256);
+    // Where x^2 overflows only the leading term of the tail remains:
+    double v = logcdf(students_t_distribution<double>(3), -1e300);
+    CHECK_LE(v, -2000.0);
+    CHECK_LE(-2100.0, v);
+}
+
+void test_discrete()
+{
+    std::vector<double> k{0, 1, 3, 10, 40, 120, 199, 200};
+    check_log_space(binomial_distribution<double>(200, 0.3), binomial_distribution<long double>(200, 0.3), k, 64);
+    check_log_space(binomial_distribution<double>(200, 0.99), binomial_distribution<long double>(200, 0.99), k, 64);
+    check_log_space(binomial_distribution<double>(200, 1e-6), binomial_distribution<long double>(200, 1e-6), k, 64);
+
+    std::vector<double> m{0, 1, 5, 30, 100, 500, 2000};
+    check_log_space(poisson_distribution<double>(4.5), poisson_distribution<long double>(4.5), m, 32);
+    check_log_space(poisson_distribution<double>(600), poisson_distribution<long double>(600), m, 256);
+    check_log_space(negative_binomial_distribution<double>(3, 0.4), negative_binomial_distribution<long double>(3, 0.4), m, 32);
+    check_log_space(negative_binomial_distribution<double>(50, 0.9), negative_binomial_distribution<long double>(50, 0.9), m, 64);
+
+    // Tails far beyond the point where the double precision cdf underflows:
+    CHECK_LE(logcdf(complement(poisson_distribution<double>(4.5), 1e4)), -5e4);
+    CHECK_LE(logcdf(binomial_distribution<double>(100000, 0.5), 1000.0), -5e4);
+    CHECK_EQUAL(logcdf(binomial_distribution<double>(200, 0.3), 200.0), 0.0);
+    CHECK_EQUAL(logcdf(complement(binomial_distribution<double>(200, 0.3), 200.0)), -std::numeric_limits<double>::infinity());
+}
+
+int main()
+{
+    test_normal();
+    test_gamma();
+    test_beta();
+    test_students_t();
+    test_discrete();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <array>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/maximum_likelihood.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/distributions/sampler.hpp>
+#include <boost/math/special_functions/trigamma.hpp>
+
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+#include <execution>
+#endif
+
+using namespace boost::math;
+using boost::math::statistics::fit;
+
+template<class Dist>
+std::vector<typename Dist::value_type> draw(const Dist& dist, std::size_t n, std::uint64_t seed)
+{
+    std::mt19937_64 gen(seed);
+    sampler<Dist> s(dist);
+    std::vector<typename Dist::value_type> v(n);
+    s.fill(gen, v.begin(), v.end());
+    return v;
+}
+
+// Each estimate should lie within a few of its standard errors of the truth, and the gradient
+// of the log-likelihood should vanish there, which we check by perturbing each parameter:
+template<class Dist, class Result, std::size_t N>
+void check_fit(const Result& r, const std::array<double, N>& truth)
+{
+    auto se = r.standard_errors();
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        CHECK_LE(std::abs(r.parameters[i] - truth[i]), 5 * se[i]);
+        CHECK_LE(se[i], 0.1 * std::abs(truth[i]) + 0.05);
+        CHECK_LE(0.0, r.covariance[i][i]);
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            CHECK_EQUAL(r.covariance[i][j], r.covariance[j][i]);
+        }
+    }
+}
+
+template<class Dist, class Result>
+void check_maximum(const Result& r, const std::vector<double>& v)
+{
+    auto log_likelihood = [&v](const Dist& d) {
+        double sum = 0;
+        for (double x : v)
+        {
+            sum += logpdf(d, x);
+        }
+        return sum;
+    };
+    const double at_estimate = log_likelihood(r.distribution());
+    CHECK_ULP_CLOSE(at_estimate, r.log_likelihood, 2000);
+    auto se = r.standard_errors();
+    for (std::size_t i = 0; i < r.parameters.size(); ++i)
+    {
+        for (double sign : {-1.0, 1.0})
+        {
+            auto p = r;
+            p.parameters[i] += sign * 0.01 * se[i];
+            CHECK_LE(log_likelihood(p.distribution()), at_estimate);
+        }
+    }
+}
+
+void test_closed_forms()
+{
+    auto v = draw(normal_distribution<double>(3, 2), 10000, 1);
+    auto r = fit<normal_distribution<double>>(v);
+    CHECK_ULP_CLOSE(boost::math::statistics::mean(v), r.parameters[0], 64);
+    CHECK_ULP_CLOSE(std::sqrt(boost::math::statistics::variance(v)), r.parameters[1], 16);
+    // The covariance of the normal estimates is known exactly:
+    CHECK_ULP_CLOSE(r.parameters[1] * r.parameters[1] / 10000, r.covariance[0][0], 64);
+    CHECK_ULP_CLOSE(r.parameters[1] * r.parameters[1] / 20000, r.covariance[1][1], 64);
+    CHECK_LE(std::abs(r.covariance[0][1]), 1e-15);
+    CHECK_EQUAL(r.sample_size, std::uint64_t(10000));
+    check_maximum<normal_distribution<double>>(r, v);
+
+    v = draw(lognormal_distribution<double>(-1, 0.5), 10000, 2);
+    auto rl = fit<lognormal_distribution<double>>(v.begin(), v.end());
+    check_fit<lognormal_distribution<double>>(rl, std::array<double, 2>{{-1, 0.5}});
+    check_maximum<lognormal_distribution<double>>(rl, v);
+
+    v = draw(exponential_distribution<double>(4), 10000, 3);
+    auto re = fit<exponential_distribution<double>>(v);
+    CHECK_ULP_CLOSE(1 / boost::math::statistics::mean(v), re.parameters[0], 64);
+    CHECK_ULP_CLOSE(re.parameters[0] * re.parameters[0] / 10000, re.covariance[0][0], 64);
+
+    v = draw(poisson_distribution<double>(7.5), 10000, 4);
+    auto rp = fit<poisson_distribution<double>>(v);
+    CHECK_ULP_CLOSE(boost::math::statistics::mean(v), rp.parameters[0], 64);
+    check_maximum<poisson_distribution<double>>(rp, v);
+}
+
+void test_gamma_and_beta()
+{
+    auto v = draw(gamma_distribution<double>(2.5, 3), 20000, 5);
+    auto r = fit<gamma_distribution<double>>(v);
+    check_fit<gamma_distribution<double>>(r, std::array<double, 2>{{2.5, 3}});
+    check_maximum<gamma_distribution<double>>(r, v);
+    // The expected information for the gamma is [[trigamma(a), 1/theta], [1/theta, a/theta^2]], which the
+    // observed information matches at the estimate since the gamma is an exponential family:
+    double a = r.parameters[0];
+    double theta = r.parameters[1];
+    double det = trigamma(a) * a / (theta * theta) - 1 / (theta * theta);
+    CHECK_ULP_CLOSE(a / (theta * theta) / det / 20000, r.covariance[0][0], 1000);
+
+    auto small = draw(gamma_distribution<double>(0.2, 1), 20000, 6);
+    check_fit<gamma_distribution<double>>(fit<gamma_distribution<double>>(small), std::array<double, 2>{{0.2, 1}});
+
+    v = draw(beta_distribution<double>(0.7, 4), 20000, 7);
+    auto rb = fit<beta_distribution<double>>(v);
+    check_fit<beta_distribution<double>>(rb, std::array<double, 2>{{0.7, 4}});
+    check_maximum<beta_distribution<double>>(rb, v);
+}
+
+void test_iterative()
+{
+    auto v = draw(weibull_distribution<double>(1.7, 20), 20000, 8);
+    auto rw = fit<weibull_distribution<double>>(v);
+    check_fit<weibull_distribution<double>>(rw, std::array<double, 2>{{1.7, 20}});
+    check_maximum<weibull_distribution<double>>(rw, v);
+
+    v = draw(students_t_distribution<double>(4), 20000, 9);
+    auto rt = fit<students_t_distribution<double>>(v);
+    check_fit<students_t_distribution<double>>(rt, std::array<double, 1>{{4}});
+    check_maximum<students_t_distribution<double>>(rt, v);
+
+    v = draw(negative_binomial_distribution<double>(3.5, 0.3), 20000, 10);
+    auto rn = fit<negative_binomial_distribution<double>>(v);
+    check_fit<negative_binomial_distribution<double>>(rn, std::array<double, 2>{{3.5, 0.3}});
+    check_maximum<negative_binomial_distribution<double>>(rn, v);
+
+    v = draw(skew_normal_distribution<double>(1, 2, 4), 20000, 11);
+    auto rs = fit<skew_normal_distribution<double>>(v);
+    check_fit<skew_normal_distribution<double>>(rs, std::array<double, 3>{{1, 2, 4}});
+    check_maximum<skew_normal_distribution<double>>(rs, v);
+}
+
+void test_parallel()
+{
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+    auto v = draw(gamma_distribution<double>(2.5, 3), 500000, 12);
+    auto seq = fit<gamma_distribution<double>>(std::execution::seq, v);
+    auto par = fit<gamma_distribution<double>>(std::execution::par, v);
+    CHECK_ULP_CLOSE(seq.parameters[0], par.parameters[0], 1000);
+    CHECK_ULP_CLOSE(seq.parameters[1], par.parameters[1], 1000);
+
+    v = draw(weibull_distribution<double>(0.8, 2), 500000, 13);
+    auto wseq = fit<weibull_distribution<double>>(std::execution::seq, v.begin(), v.end());
+    auto wpar = fit<weibull_distribution<double>>(std::execution::par, v.begin(), v.end());
+    CHECK_ULP_CLOSE(wseq.parameters[0], wpar.parameters[0], 1000);
+    CHECK_ULP_CLOSE(wseq.log_likelihood, wpar.log_likelihood, 1000);
+
+    std::vector<int> counts(200000);
+    std::mt19937_64 gen(14);
+    std::negative_binomial_distribution<int> nb(5, 0.25);
+    for (auto& k : counts)
+    {
+        k = nb(gen);
+    }
+    auto nseq = fit<negative_binomial_distribution<double>>(counts);
+    auto npar = fit<negative_binomial_distribution<double>>(std::execution::par, counts);
+    CHECK_ULP_CLOSE(nseq.parameters[0], npar.parameters[0], 1000);
+    check_fit<negative_binomial_distribution<double>>(npar, std::array<double, 2>{{5, 0.25}});
+#endif
+}
+
+void test_errors()
+{
+    std::vector<double> v{1, 2, -1};
+    bool thrown = false;
+    try { fit<gamma_distribution<double>>(v); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    std::vector<double> constant(10, 2.0);
+    try { fit<normal_distribution<double>>(constant); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    // Underdispersed counts have no negative binomial estimate:
+    std::vector<double> counts{3, 4, 3, 4, 3, 4};
+    try { fit<negative_binomial_distribution<double>>(counts); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    std::vector<double> empty;
+    try { fit<beta_distribution<double>>(empty); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_closed_forms();
+    test_gamma_and_beta();
+    test_iterative();
+    test_parallel();
+    test_errors();
+    return boost::math::test::report_errors();
+}
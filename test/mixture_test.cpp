@@ -0,0 +1,186 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/mixture.hpp>
+#include <boost/math/distributions/weibull.hpp>
+
+using namespace boost::math;
+
+// The pdf and cdf of a mixture are the weighted sums of its components':
+template<class Dist>
+void check_sums(const mixture_distribution<Dist>& mix, const std::vector<double>& x)
+{
+    using std::fabs;
+    using std::log;
+    const double tol = 16 * std::numeric_limits<double>::epsilon();
+    std::vector<double> f(x.size());
+    std::vector<double> lf(x.size());
+    std::vector<double> p(x.size());
+    pdf(mix, x.begin(), x.end(), f.begin());
+    logpdf(mix, x.begin(), x.end(), lf.begin());
+    cdf(mix, x.begin(), x.end(), p.begin());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        double density = 0;
+        double probability = 0;
+        for (std::size_t j = 0; j < mix.num_components(); ++j)
+        {
+            density += mix.weights()[j] * pdf(mix.components()[j], x[i]);
+            probability += mix.weights()[j] * cdf(mix.components()[j], x[i]);
+        }
+        CHECK_EQUAL(f[i], pdf(mix, x[i]));
+        if ((density == 0) || !std::isfinite(density))
+        {
+            CHECK_EQUAL(f[i], density);
+        }
+        else
+        {
+            // The pdf is the exp of the log-sum-exp, which carries the error in the log into the result:
+            CHECK_LE(fabs(lf[i] - log(density)), tol * fabs(log(density)) + tol);
+            CHECK_LE(fabs(f[i] - density), tol * density * (1 + fabs(log(density))));
+        }
+        CHECK_LE(fabs(cdf(mix, x[i]) - probability), tol * probability);
+        CHECK_EQUAL(p[i], cdf(mix, x[i]));
+        CHECK_LE(fabs(cdf(complement(mix, x[i])) - (1 - probability)), tol);
+    }
+}
+
+template<class Dist>
+void check_quantiles(const mixture_distribution<Dist>& mix)
+{
+    using std::fabs;
+    for (double p : {1e-10, 0.001, 0.05, 0.3, 0.5, 0.77, 0.99, 0.999999})
+    {
+        double x = quantile(mix, p);
+        CHECK_LE(fabs(cdf(mix, x) - p), 64 * std::numeric_limits<double>::epsilon() * p);
+        x = quantile(complement(mix, p));
+        CHECK_LE(fabs(cdf(complement(mix, x)) - p), 64 * std::numeric_limits<double>::epsilon() * p);
+    }
+}
+
+void test_normal()
+{
+    mixture_distribution<normal_distribution<double>> mix({2.0, 1.0, 1.0}, {normal_distribution<double>(-3, 1), normal_distribution<double>(0, 0.25), normal_distribution<double>(4, 2)});
+    CHECK_ULP_CLOSE(0.5, mix.weights()[0], 1);
+    CHECK_ULP_CLOSE(0.25, mix.weights()[2], 1);
+    std::vector<double> x;
+    for (double v = -12; v < 15; v += 0.37)
+    {
+        x.push_back(v);
+    }
+    check_sums(mix, x);
+    check_quantiles(mix);
+
+    // Far in the tails the log density is still finite:
+    CHECK_LE(logpdf(mix, 100.0), -100.0);
+    CHECK_EQUAL(std::isfinite(logpdf(mix, 100.0)), true);
+
+    // Moments of the mixture from the components', checked against the textbook formulas:
+    const double m = 0.5 * -3 + 0.25 * 0 + 0.25 * 4;
+    const double v = 0.5 * (1 + 9) + 0.25 * (0.0625 + 0) + 0.25 * (4 + 16) - m * m;
+    CHECK_ULP_CLOSE(m, mean(mix), 4);
+    CHECK_ULP_CLOSE(v, variance(mix), 4);
+
+    // A mixture of one is the component:
+    mixture_distribution<normal_distribution<double>> one({3.0}, {normal_distribution<double>(1, 2)});
+    CHECK_ULP_CLOSE(pdf(normal_distribution<double>(1, 2), 0.3), pdf(one, 0.3), 2);
+    CHECK_ULP_CLOSE(quantile(normal_distribution<double>(1, 2), 0.3), quantile(one, 0.3), 2);
+    CHECK_ULP_CLOSE(skewness(normal_distribution<double>(1, 2)) + 1, skewness(one) + 1, 2);
+    CHECK_ULP_CLOSE(kurtosis(normal_distribution<double>(1, 2)), kurtosis(one), 4);
+}
+
+void test_others()
+{
+    std::vector<double> x{0.0, 1e-5};
+    for (double v = 0.01; v < 200; v *= 1.3)
+    {
+        x.push_back(v);
+    }
+    mixture_distribution<gamma_distribution<double>> gam({0.2, 0.5, 0.3}, {gamma_distribution<double>(2, 1), gamma_distribution<double>(5, 2), gamma_distribution<double>(0.5, 3)});
+    check_sums(gam, x);
+    check_quantiles(gam);
+    mixture_distribution<exponential_distribution<double>> ex({0.6, 0.4}, {exponential_distribution<double>(0.1), exponential_distribution<double>(3)});
+    check_sums(ex, x);
+    check_quantiles(ex);
+    x.erase(x.begin());
+    mixture_distribution<lognormal_distribution<double>> logn({1.0, 1.0}, {lognormal_distribution<double>(0, 1), lognormal_distribution<double>(2, 0.5)});
+    check_sums(logn, x);
+    check_quantiles(logn);
+    // Components without a specialized kernel go through their own logpdf:
+    mixture_distribution<weibull_distribution<double>> wei({1.0, 2.0}, {weibull_distribution<double>(2, 1), weibull_distribution<double>(3, 4)});
+    check_sums(wei, x);
+    check_quantiles(wei);
+}
+
+void test_fit_weights()
+{
+    std::mt19937_64 gen(12345);
+    std::vector<gamma_distribution<double>> components{gamma_distribution<double>(2, 1), gamma_distribution<double>(5, 2), gamma_distribution<double>(20, 1)};
+    std::discrete_distribution<int> pick({0.2, 0.5, 0.3});
+    std::vector<double> data;
+    for (int i = 0; i < 50000; ++i)
+    {
+        const gamma_distribution<double>& c = components[pick(gen)];
+        std::gamma_distribution<double> draw(c.shape(), c.scale());
+        data.push_back(draw(gen));
+    }
+    mixture_distribution<gamma_distribution<double>> initial(std::vector<double>{1, 1, 1}, components);
+    std::uintmax_t max_iter = 1000;
+    auto fitted = fit_weights(initial, data.begin(), data.end(), 1e-12, max_iter);
+    CHECK_LE(max_iter, std::uintmax_t(999));
+    CHECK_ABSOLUTE_ERROR(0.2, fitted.weights()[0], 0.01);
+    CHECK_ABSOLUTE_ERROR(0.5, fitted.weights()[1], 0.01);
+    CHECK_ABSOLUTE_ERROR(0.3, fitted.weights()[2], 0.01);
+    CHECK_ULP_CLOSE(1.0, fitted.weights()[0] + fitted.weights()[1] + fitted.weights()[2], 4);
+    auto fitted2 = fit_weights(initial, data.begin(), data.end());
+    CHECK_ABSOLUTE_ERROR(fitted.weights()[1], fitted2.weights()[1], 1e-3);
+
+    // A component that explains nothing is weighted down to zero:
+    std::vector<normal_distribution<double>> normals{normal_distribution<double>(0, 1), normal_distribution<double>(50, 1)};
+    std::normal_distribution<double> standard;
+    std::vector<double> near_zero;
+    for (int i = 0; i < 1000; ++i)
+    {
+        near_zero.push_back(standard(gen));
+    }
+    auto single = fit_weights(mixture_distribution<normal_distribution<double>>(std::vector<double>{1, 1}, normals), near_zero.begin(), near_zero.end());
+    CHECK_LE(single.weights()[1], 1e-6);
+}
+
+void test_errors()
+{
+    std::vector<normal_distribution<double>> two{normal_distribution<double>(0, 1), normal_distribution<double>(1, 1)};
+    CHECK_THROW(mixture_distribution<normal_distribution<double>>(std::vector<double>{1}, two), std::domain_error);
+    CHECK_THROW(mixture_distribution<normal_distribution<double>>(std::vector<double>{1, -1}, two), std::domain_error);
+    CHECK_THROW(mixture_distribution<normal_distribution<double>>(std::vector<double>{0, 0}, two), std::domain_error);
+    CHECK_THROW(mixture_distribution<normal_distribution<double>>(std::vector<double>{1, std::numeric_limits<double>::quiet_NaN()}, two), std::domain_error);
+    CHECK_THROW(mixture_distribution<normal_distribution<double>>(std::vector<double>(), std::vector<normal_distribution<double>>()), std::domain_error);
+
+    mixture_distribution<normal_distribution<double>> mix(std::vector<double>{1, 1}, two);
+    CHECK_THROW(pdf(mix, std::numeric_limits<double>::quiet_NaN()), std::domain_error);
+    CHECK_THROW(quantile(mix, 1.5), std::domain_error);
+    mixture_distribution<gamma_distribution<double>> gam({1.0}, {gamma_distribution<double>(2, 1)});
+    CHECK_THROW(cdf(gam, -1.0), std::domain_error);
+    std::vector<double> empty;
+    CHECK_THROW(fit_weights(mix, empty.begin(), empty.end()), std::domain_error);
+}
+
+int main()
+{
+    test_normal();
+    test_others();
+    test_fit_weights();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <list>
+#include <random>
+#include <vector>
+#include <boost/math/special_functions/multivariate_normal.hpp>
+#include <boost/math/concepts/real_concept.hpp>
+
+using boost::math::bivariate_normal_cdf;
+using boost::math::multivariate_normal_cdf;
+
+template<class Real>
+Real normal_cdf(Real x)
+{
+    return boost::math::erfc(-x/boost::math::constants::root_two<Real>())/2;
+}
+
+// The reduction to Owen's T function, which is well conditioned when the result is not small:
+template<class Real>
+Real owens_t_reference(Real h, Real k, Real rho)
+{
+    using std::sqrt;
+    Real s = sqrt((1 - rho)*(1 + rho));
+    Real result = (normal_cdf(h) + normal_cdf(k))/2
+        - boost::math::owens_t(h, (k - rho*h)/(h*s)) - boost::math::owens_t(k, (h - rho*k)/(k*s));
+    return h*k < 0 ? Real(result - Real(0.5)) : result;
+}
+
+template<class Real>
+void test_bivariate_special_values()
+{
+    using std::asin;
+    using boost::math::constants::two_pi;
+    Real tol = 8*std::numeric_limits<Real>::epsilon();
+    for (Real rho : {Real(-1), Real(-0.99), Real(-0.6), Real(-0.2), Real(0), Real(0.25), Real(0.5), Real(0.8), Real(0.93), Real(0.999), Real(1)})
+    {
+        Real expected = Real(0.25) + asin(rho)/two_pi<Real>();
+        CHECK_ABSOLUTE_ERROR(expected, bivariate_normal_cdf(Real(0), Real(0), rho), tol);
+        for (Real h : {Real(-3), Real(-0.5), Real(1.25)})
+        {
+            Real k = Real(0.75);
+            // Symmetry in the arguments, and the marginal identity:
+            CHECK_ABSOLUTE_ERROR(bivariate_normal_cdf(h, k, rho), bivariate_normal_cdf(k, h, rho), tol);
+            CHECK_ABSOLUTE_ERROR(normal_cdf(h), Real(bivariate_normal_cdf(h, k, rho) + bivariate_normal_cdf(h, Real(-k), Real(-rho))), tol);
+        }
+    }
+    // Independence, and the degenerate correlations:
+    CHECK_ULP_CLOSE(normal_cdf(Real(-2))*normal_cdf(Real(1.5)), bivariate_normal_cdf(Real(-2), Real(1.5), Real(0)), 8);
+    CHECK_ULP_CLOSE(normal_cdf(Real(-2)), bivariate_normal_cdf(Real(-2), Real(1.5), Real(1)), 4);
+    CHECK_ULP_CLOSE(normal_cdf(Real(1.5)) - normal_cdf(Real(1)), bivariate_normal_cdf(Real(1.5), Real(-1), Real(-1)), 8);
+    CHECK_EQUAL(bivariate_normal_cdf(Real(1), Real(-2), Real(-1)), Real(0));
+
+    // Infinite limits reduce to the marginals:
+    Real inf = std::numeric_limits<Real>::infinity();
+    CHECK_EQUAL(bivariate_normal_cdf(-inf, Real(2), Real(0.5)), Real(0));
+    CHECK_EQUAL(bivariate_normal_cdf(Real(2), -inf, Real(0.5)), Real(0));
+    CHECK_EQUAL(bivariate_normal_cdf(inf, inf, Real(0.5)), Real(1));
+    CHECK_ULP_CLOSE(normal_cdf(Real(0.3)), bivariate_normal_cdf(inf, Real(0.3), Real(-0.7)), 1);
+}
+
+template<class Real, class Wide>
+void test_bivariate_accuracy(Real tol)
+{
+    using std::abs;
+    std::mt19937_64 gen(31415);
+    std::uniform_real_distribution<double> dis(-3, 3);
+    std::uniform_real_distribution<double> rdis(-1, 1);
+    for (std::size_t i = 0; i < 5000; ++i)
+    {
+        Real h = Real(dis(gen));
+        Real k = Real(dis(gen));
+        Real rho = Real(rdis(gen));
+        // Make sure every node count is well represented, including the near singular one:
+        if (i % 3 == 0)
+        {
+            rho = rho < 0 ? Real(-1 - rho/16) : Real(1 - rho/16);
+        }
+        Wide expected = owens_t_reference(Wide(h), Wide(k), Wide(rho));
+        // The reference cancels badly when the result is small, so the error is measured relative to
+        // the result only away from the tails:
+        Real scale = (std::max)(static_cast<Real>(expected), Real(0.1));
+        Real computed = bivariate_normal_cdf(h, k, rho);
+        if (!CHECK_LE(Real(abs(computed - static_cast<Real>(expected))), tol*scale))
+        {
+            std::cerr << "  bivariate_normal_cdf failed at h = " << h << ", k = " << k << ", rho = " << rho << "\n";
+        }
+    }
+}
+
+template<class Real>
+void test_bivariate_tail()
+{
+    using std::exp;
+    // Deep in the lower tail with positive correlation every term is positive, so relative accuracy is retained.
+    // The probability increases with rho, from the product of the marginals up to the smaller marginal:
+    Real h = -7;
+    Real k = -6;
+    Real p0 = normal_cdf(h)*normal_cdf(k);
+    Real previous = p0;
+    for (Real rho : {Real(0.1), Real(0.4), Real(0.7), Real(0.9), Real(0.95), Real(0.99)})
+    {
+        Real p = bivariate_normal_cdf(h, k, rho);
+        CHECK_LE(previous, p);
+        CHECK_LE(p, normal_cdf(h));
+        previous = p;
+    }
+    // The marginals alone are only accurate to a few tens of ulp here, as erfc is ill conditioned:
+    CHECK_ULP_CLOSE(p0, bivariate_normal_cdf(h, k, Real(0)), 128);
+    // The derivative with respect to rho is the bivariate density:
+    Real rho = Real(1e-12);
+    Real density = exp(-(h*h + k*k)/2)/boost::math::constants::two_pi<Real>();
+    CHECK_ULP_CLOSE(Real(p0 + rho*density), bivariate_normal_cdf(h, k, rho), 128);
+}
+
+template<class Real>
+void test_bivariate_batch()
+{
+    std::mt19937_64 gen(2718);
+    std::uniform_real_distribution<double> dis(-4, 4);
+    std::uniform_real_distribution<double> rdis(-1, 1);
+    std::vector<Real> h, k;
+    std::list<Real> rho;
+    for (std::size_t i = 0; i < 1000; ++i)
+    {
+        h.push_back(Real(dis(gen)));
+        k.push_back(Real(dis(gen)));
+        // Runs of repeated correlations, as in a one factor copula, and the near singular region:
+        rho.push_back(i < 500 ? Real(0.35) : (i % 2 ? Real(rdis(gen)) : Real(0.97)));
+    }
+    h.push_back(std::numeric_limits<Real>::infinity());
+    k.push_back(Real(0.5));
+    rho.push_back(Real(0.35));
+    std::vector<Real> p;
+    boost::math::bivariate_normal_cdf(h.begin(), h.end(), k.begin(), rho.begin(), std::back_inserter(p));
+    CHECK_EQUAL(p.size(), h.size());
+    auto r = rho.begin();
+    for (std::size_t i = 0; i < h.size(); ++i, ++r)
+    {
+        // The batch caches the quadrature rule but otherwise runs the same arithmetic:
+        if (!CHECK_EQUAL(bivariate_normal_cdf(h[i], k[i], *r), p[i]))
+        {
+            std::cerr << "  batch mismatch at h = " << h[i] << ", k = " << k[i] << ", rho = " << *r << "\n";
+        }
+    }
+
+    std::vector<Real> bad_rho{Real(0.5), Real(1.5)};
+    CHECK_THROW(boost::math::bivariate_normal_cdf(h.begin(), h.begin() + 2, k.begin(), bad_rho.begin(), p.begin()), std::domain_error);
+    CHECK_THROW(bivariate_normal_cdf(std::numeric_limits<Real>::quiet_NaN(), Real(0), Real(0)), std::domain_error);
+}
+
+template<class Real>
+void test_multivariate()
+{
+    using std::asin;
+    using boost::math::constants::pi;
+    Real inf = std::numeric_limits<Real>::infinity();
+    Real error;
+
+    // One and two constrained variables are computed exactly, including after dropping unconstrained ones:
+    std::vector<Real> sigma{Real(4), Real(1.2), Real(0.5), Real(1.2), Real(1), Real(0.3), Real(0.5), Real(0.3), Real(2)};
+    std::vector<Real> lower{-inf, Real(-1), -inf};
+    std::vector<Real> upper{Real(1), Real(0.5), inf};
+    Real p = multivariate_normal_cdf(lower, upper, sigma, Real(1e-6), &error);
+    Real expected = bivariate_normal_cdf(Real(0.5), Real(0.5), Real(0.6)) - bivariate_normal_cdf(Real(0.5), Real(-1), Real(0.6));
+    CHECK_ULP_CLOSE(expected, p, 16);
+    CHECK_EQUAL(error, Real(0));
+    upper = {inf, Real(0.5), inf};
+    CHECK_ULP_CLOSE(Real(normal_cdf(Real(0.5)) - normal_cdf(Real(-1))), multivariate_normal_cdf(lower, upper, sigma), 16);
+
+    // The trivariate orthant probability has a closed form:
+    std::vector<Real> R{Real(1), Real(0.3), Real(-0.4), Real(0.3), Real(1), Real(0.6), Real(-0.4), Real(0.6), Real(1)};
+    std::vector<Real> zero(3, Real(0));
+    p = multivariate_normal_cdf(zero, R, Real(1e-6), &error);
+    expected = Real(0.125) + (asin(Real(0.3)) + asin(Real(-0.4)) + asin(Real(0.6)))/(4*pi<Real>());
+    CHECK_LE(error, Real(1e-6));
+    CHECK_ABSOLUTE_ERROR(expected, p, Real(2e-6));
+
+    // Equicorrelated orthants with rho = 1/2 have probability 1/(n + 1):
+    for (std::size_t n : {4, 6})
+    {
+        std::vector<Real> E(n*n, Real(0.5));
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            E[i*n + i] = 1;
+        }
+        std::vector<Real> z(n, Real(0));
+        p = multivariate_normal_cdf(z, E, Real(1e-5), &error);
+        CHECK_ABSOLUTE_ERROR(Real(1)/Real(n + 1), p, Real(2e-5));
+    }
+
+    // Independent variables give the product of the marginals:
+    std::vector<Real> I(16, Real(0));
+    std::vector<Real> limits{Real(0.1), Real(-0.2), Real(1.3), Real(-1)};
+    expected = 1;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        I[i*5] = 1;
+        expected *= normal_cdf(limits[i]);
+    }
+    CHECK_ABSOLUTE_ERROR(expected, multivariate_normal_cdf(limits, I), Real(1e-6));
+
+    // A perfectly correlated pair is handled by the pivoted factorization:
+    std::vector<Real> S{Real(1), Real(1), Real(0.5), Real(1), Real(1), Real(0.5), Real(0.5), Real(0.5), Real(1)};
+    std::vector<Real> b{Real(0.4), Real(-0.3), Real(0.8)};
+    CHECK_ABSOLUTE_ERROR(bivariate_normal_cdf(Real(-0.3), Real(0.8), Real(0.5)), multivariate_normal_cdf(b, S), Real(2e-6));
+
+    // A singular covariance, X2 = X1 with X3 independent, where the degenerate variable's limits
+    // exclude the conditional mean of X1 but not all of its values:
+    std::vector<Real> D{Real(1), Real(1), Real(0), Real(1), Real(1), Real(0), Real(0), Real(0), Real(1)};
+    lower = {-inf, Real(-0.5), -inf};
+    upper = {Real(0), inf, Real(0)};
+    p = multivariate_normal_cdf(lower, upper, D, Real(1e-5), &error);
+    CHECK_ABSOLUTE_ERROR(Real((normal_cdf(Real(0)) - normal_cdf(Real(-0.5)))/2), p, Real(1e-4));
+    // Two such pairs, X2 = X1 and X4 = X3, give the square:
+    std::vector<Real> D4{Real(1), Real(1), Real(0), Real(0), Real(1), Real(1), Real(0), Real(0),
+                         Real(0), Real(0), Real(1), Real(1), Real(0), Real(0), Real(1), Real(1)};
+    std::vector<Real> lower4{-inf, Real(-0.5), -inf, Real(-0.5)};
+    std::vector<Real> upper4{Real(0), inf, Real(0), inf};
+    p = multivariate_normal_cdf(lower4, upper4, D4, Real(1e-5), &error);
+    expected = normal_cdf(Real(0)) - normal_cdf(Real(-0.5));
+    CHECK_ABSOLUTE_ERROR(Real(expected*expected), p, Real(1e-4));
+
+    // The estimate is deterministic:
+    CHECK_EQUAL(multivariate_normal_cdf(zero, R), multivariate_normal_cdf(zero, R));
+
+    // An empty box, and the errors:
+    upper = {Real(1), Real(-1), Real(0)};
+    CHECK_EQUAL(multivariate_normal_cdf(lower, upper, sigma), Real(0));
+    std::vector<Real> short_sigma(4, Real(1));
+    CHECK_THROW(multivariate_normal_cdf(zero, short_sigma), std::domain_error);
+    std::vector<Real> bad_sigma{Real(1), Real(0), Real(0), Real(0), Real(-1), Real(0), Real(0), Real(0), Real(1)};
+    CHECK_THROW(multivariate_normal_cdf(zero, bad_sigma), std::domain_error);
+    std::vector<Real> not_correlation{Real(1), Real(2), Real(0), Real(2), Real(1), Real(0), Real(0), Real(0), Real(1)};
+    CHECK_THROW(multivariate_normal_cdf(zero, not_correlation), std::domain_error);
+}
+
+int main()
+{
+    test_bivariate_special_values<float>();
+    test_bivariate_special_values<double>();
+    test_bivariate_special_values<long double>();
+    test_bivariate_accuracy<float, double>(4*std::numeric_limits<float>::epsilon());
+    test_bivariate_accuracy<double, long double>(8*std::numeric_limits<double>::epsilon());
+    test_bivariate_accuracy<long double, long double>(64*std::numeric_limits<long double>::epsilon());
+    test_bivariate_tail<double>();
+    test_bivariate_tail<long double>();
+    test_bivariate_batch<float>();
+    test_bivariate_batch<double>();
+    test_bivariate_batch<long double>();
+    test_multivariate<double>();
+
+    // Types of unknown precision use the reduction to Owen's T function throughout:
+    using boost::math::concepts::real_concept;
+    for (double h : {0.5, 0.0, -1.5})
+    {
+        real_concept expected = bivariate_normal_cdf(h, -0.25, 0.6);
+        real_concept computed = bivariate_normal_cdf(real_concept(h), real_concept(-0.25), real_concept(0.6));
+        CHECK_LE(real_concept(abs(computed - expected)), real_concept(1e-15));
+    }
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/non_central_table.hpp>
+
+using namespace boost::math;
+
+// The table runs the distribution's own series, so agrees with it to within rounding.  Where the
+// t distribution's series cancel, its cdf is only known to about floor in absolute terms:
+template<class Dist>
+void check_table(const Dist& dist, const std::vector<double>& x, double tolerance, double floor = 0)
+{
+    using std::fabs;
+    non_central_table<Dist> table(dist);
+    CHECK_EQUAL(table.is_tabulated(), true);
+    std::vector<double> p(x.size());
+    std::vector<double> q(x.size());
+    std::vector<double> f(x.size());
+    table.cdf(x.begin(), x.end(), p.begin());
+    table.ccdf(x.begin(), x.end(), q.begin());
+    table.pdf(x.begin(), x.end(), f.begin());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        double expected = cdf(dist, x[i]);
+        CHECK_LE(fabs(p[i] - expected), tolerance * fabs(expected) + floor);
+        CHECK_EQUAL(p[i], table.cdf(x[i]));
+        expected = cdf(complement(dist, x[i]));
+        CHECK_LE(fabs(q[i] - expected), tolerance * fabs(expected) + floor);
+        CHECK_EQUAL(q[i], table.ccdf(x[i]));
+        expected = pdf(dist, x[i]);
+        CHECK_LE(fabs(f[i] - expected), tolerance * fabs(expected));
+    }
+}
+
+void test_chi_squared()
+{
+    std::vector<double> x;
+    for (double v = 0.01; v < 20000; v *= 1.15)
+    {
+        x.push_back(v);
+    }
+    const double tol = 8 * std::numeric_limits<double>::epsilon();
+    for (double l : {0.5, 5.0, 60.0, 300.0, 5000.0})
+    {
+        check_table(non_central_chi_squared_distribution<double>(4, l), x, tol);
+        check_table(non_central_chi_squared_distribution<double>(0.5, l), x, tol);
+        check_table(non_central_chi_squared_distribution<double>(150, l), x, tol);
+    }
+}
+
+void test_beta()
+{
+    std::vector<double> x;
+    for (double v = 0.001; v < 1; v += 0.0137)
+    {
+        x.push_back(v);
+    }
+    x.push_back(1e-20);
+    x.push_back(1 - 1e-12);
+    const double tol = 8 * std::numeric_limits<double>::epsilon();
+    for (double l : {0.5, 5.0, 60.0, 300.0, 5000.0})
+    {
+        check_table(non_central_beta_distribution<double>(2.5, 6, l), x, tol);
+        check_table(non_central_beta_distribution<double>(0.5, 0.75, l), x, tol);
+        check_table(non_central_beta_distribution<double>(40, 12, l), x, tol);
+    }
+    // The end points:
+    non_central_table<non_central_beta_distribution<double>> table(non_central_beta_distribution<double>(2.5, 6, 20));
+    CHECK_EQUAL(table.cdf(0.0), 0.0);
+    CHECK_EQUAL(table.ccdf(0.0), 1.0);
+    CHECK_EQUAL(table.cdf(1.0), 1.0);
+    CHECK_EQUAL(table.ccdf(1.0), 0.0);
+    CHECK_EQUAL(table.pdf(1.0), 0.0);
+}
+
+void test_f()
+{
+    std::vector<double> x{0.0};
+    for (double v = 0.01; v < 1000; v *= 1.2)
+    {
+        x.push_back(v);
+    }
+    const double tol = 8 * std::numeric_limits<double>::epsilon();
+    for (double l : {0.5, 20.0, 400.0})
+    {
+        check_table(non_central_f_distribution<double>(3, 12, l), x, tol);
+        check_table(non_central_f_distribution<double>(20, 4.5, l), x, tol);
+    }
+}
+
+void test_t()
+{
+    std::vector<double> x;
+    for (double v = -50; v < 150; v += 0.77)
+    {
+        x.push_back(v);
+    }
+    x.push_back(0);
+    const double tol = 64 * std::numeric_limits<double>::epsilon();
+    for (double delta : {-3.0, 0.5, 5.0, 40.0})
+    {
+        check_table(non_central_t_distribution<double>(7, delta), x, tol, 1e-18);
+        check_table(non_central_t_distribution<double>(2, delta), x, tol, 1e-18);
+        check_table(non_central_t_distribution<double>(150.5, delta), x, tol, 1e-18);
+    }
+}
+
+void test_pass_through()
+{
+    // Nothing to tabulate when the distribution is central:
+    non_central_table<non_central_chi_squared_distribution<double>> central(non_central_chi_squared_distribution<double>(4, 0));
+    CHECK_EQUAL(central.is_tabulated(), false);
+    CHECK_EQUAL(central.cdf(3.0), cdf(chi_squared_distribution<double>(4), 3.0));
+    non_central_table<non_central_t_distribution<double>> t(non_central_t_distribution<double>(std::numeric_limits<double>::infinity(), 2));
+    CHECK_EQUAL(t.is_tabulated(), false);
+    CHECK_EQUAL(t.cdf(1.5), cdf(normal_distribution<double>(2), 1.5));
+    // Too many weights for the table:
+    non_central_table<non_central_beta_distribution<double>> wide(non_central_beta_distribution<double>(2, 3, 5000), 100);
+    CHECK_EQUAL(wide.is_tabulated(), false);
+    CHECK_EQUAL(wide.cdf(0.9), cdf(non_central_beta_distribution<double>(2, 3, 5000), 0.9));
+
+    // Invalid arguments raise the distribution's errors:
+    non_central_table<non_central_chi_squared_distribution<double>> table(non_central_chi_squared_distribution<double>(4, 10));
+    CHECK_THROW(table.cdf(-1.0), std::domain_error);
+    CHECK_THROW(table.pdf(std::numeric_limits<double>::quiet_NaN()), std::domain_error);
+    non_central_table<non_central_beta_distribution<double>> beta(non_central_beta_distribution<double>(2, 3, 10));
+    CHECK_THROW(beta.ccdf(1.5), std::domain_error);
+}
+
+int main()
+{
+    test_chi_squared();
+    test_beta();
+    test_f();
+    test_t();
+    test_pass_through();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <iterator>
+#include <vector>
+#include <boost/math/special_functions/piecewise_chebyshev.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/erf.hpp>
+
+using boost::math::piecewise_chebyshev;
+
+template<class Real>
+void test_polynomial()
+{
+    // A cubic is reproduced exactly by a single interval:
+    auto f = [](Real x) { return 1 + x*(2 - 3*x*x); };
+    Real tol = 1000*std::numeric_limits<Real>::epsilon();
+    piecewise_chebyshev<Real> table(f, Real(-2), Real(3), tol, tol, 5);
+    CHECK_EQUAL(table.intervals(), std::size_t(1));
+    for (Real x = -2; x <= 3; x += Real(0.125))
+    {
+        // |f| <= 80 on [-2, 3]:
+        CHECK_ABSOLUTE_ERROR(f(x), table(x), 80*tol);
+    }
+    CHECK_THROW(table(Real(3.5)), std::domain_error);
+    CHECK_THROW(table(Real(-2.5)), std::domain_error);
+}
+
+template<class Real>
+void test_lgamma()
+{
+    auto f = [](Real x) { return boost::math::lgamma(x); };
+    Real tol = Real(1e-12);
+    // lgamma has zeros at 1 and 2, so relative error is measured against an absolute floor there:
+    piecewise_chebyshev<Real> table(f, Real(0.5), Real(40), tol, tol);
+    CHECK_LE(table.max_error(), tol);
+    CHECK_LE(std::size_t(2), table.intervals());
+
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> dis(Real(0.5), Real(40));
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        Real x = dis(gen);
+        Real expected = f(x);
+        Real computed = table(x);
+        using std::abs;
+        CHECK_LE(abs(computed - expected), 4*tol*(std::max)(abs(expected), Real(1)));
+    }
+    // Endpoints must hit the first and last intervals:
+    CHECK_ABSOLUTE_ERROR(f(Real(0.5)), table(Real(0.5)), 4*tol);
+    CHECK_ABSOLUTE_ERROR(f(Real(40)), table(Real(40)), 4*tol*f(Real(40)));
+
+    // The batch evaluation agrees with the scalar one, including a partial final block:
+    std::vector<Real> x(1003);
+    for (auto & v : x)
+    {
+        v = dis(gen);
+    }
+    x.back() = Real(40);
+    std::vector<Real> y;
+    table(x.begin(), x.end(), std::back_inserter(y));
+    CHECK_EQUAL(y.size(), x.size());
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(table(x[i]), y[i], 2);
+    }
+    x[500] = Real(41);
+    CHECK_THROW(table(x.begin(), x.end(), y.begin()), std::domain_error);
+}
+
+template<class Real>
+void test_erf_inv_serialization()
+{
+    // erf_inv is singular at +-1, so the adaptive bisection concentrates intervals near the ends:
+    auto f = [](Real x) { return boost::math::erf_inv(x); };
+    Real tol = Real(1e-12);
+    piecewise_chebyshev<Real> table(f, Real(-0.999), Real(0.999), tol, tol);
+    CHECK_LE(table.max_error(), tol);
+
+    std::stringstream ss;
+    table.save(ss);
+    piecewise_chebyshev<Real> reloaded(ss);
+    CHECK_EQUAL(table.intervals(), reloaded.intervals());
+    CHECK_EQUAL(table.degree(), reloaded.degree());
+    for (Real x = Real(-0.999); x <= Real(0.999); x += Real(0.0009765625))
+    {
+        CHECK_EQUAL(table(x), reloaded(x));
+        using std::abs;
+        CHECK_LE(abs(table(x) - f(x)), 4*tol*(std::max)(abs(f(x)), Real(1)));
+    }
+
+    std::stringstream truncated("0 1 16 3 2");
+    CHECK_THROW(piecewise_chebyshev<Real>{truncated}, std::domain_error);
+}
+
+int main()
+{
+    test_polynomial<float>();
+    test_polynomial<double>();
+    test_polynomial<long double>();
+    test_lgamma<double>();
+    test_lgamma<long double>();
+    test_erf_inv_serialization<double>();
+    return boost::math::test::report_errors();
+}
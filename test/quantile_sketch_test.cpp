@@ -0,0 +1,164 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/quantile_sketch.hpp>
+
+using boost::math::quantile_sketch;
+
+// The largest error in the normalized rank of the sketch's quantiles against the sorted data:
+template<class Real>
+double max_rank_error(const quantile_sketch<Real>& sketch, const std::vector<Real>& sorted)
+{
+    double worst = 0;
+    const double n = static_cast<double>(sorted.size());
+    for (int i = 1; i < 100; ++i)
+    {
+        double p = i / 100.0;
+        Real q = sketch.quantile(p);
+        // Any rank within the run of values equal to q is acceptable:
+        double lo = static_cast<double>(std::lower_bound(sorted.begin(), sorted.end(), q) - sorted.begin()) / n;
+        double hi = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), q) - sorted.begin()) / n;
+        double error = p < lo ? lo - p : (p > hi ? p - hi : 0);
+        worst = (std::max)(worst, error);
+        // And the cdf at a data point against the true fraction of samples below it:
+        Real x = sorted[static_cast<std::size_t>(p * n)];
+        double exact = static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), x) - sorted.begin()) / n;
+        worst = (std::max)(worst, std::abs(static_cast<double>(sketch.cdf(x)) - exact));
+    }
+    return worst;
+}
+
+template<class Real>
+void test_exact()
+{
+    // Below the capacity of the first level every sample is held:
+    std::vector<Real> v{5, 1, 4, 1, 3, 9, 2, 6};
+    quantile_sketch<Real> sketch;
+    sketch.insert(v.begin(), v.end());
+    CHECK_EQUAL(sketch.is_exact(), true);
+    CHECK_EQUAL(sketch.count(), std::uint64_t(8));
+    CHECK_EQUAL(sketch.min(), Real(1));
+    CHECK_EQUAL(sketch.max(), Real(9));
+    CHECK_EQUAL(static_cast<double>(sketch(Real(0))), 0.0);
+    CHECK_EQUAL(static_cast<double>(sketch(Real(1))), 0.25);
+    CHECK_EQUAL(static_cast<double>(sketch(Real(4))), 0.625);
+    CHECK_EQUAL(static_cast<double>(sketch(Real(9))), 1.0);
+    CHECK_EQUAL(sketch.quantile(0), Real(1));
+    CHECK_EQUAL(sketch.quantile(0.5), Real(3));
+    CHECK_EQUAL(sketch.quantile(0.51), Real(4));
+    CHECK_EQUAL(sketch.quantile(1), Real(9));
+}
+
+template<class Real>
+void test_stream(std::size_t k)
+{
+    std::mt19937_64 gen(17);
+    std::lognormal_distribution<double> dis(2, 1.5);
+    std::vector<Real> v(2000000);
+    quantile_sketch<Real> sketch(k);
+    for (auto& x : v)
+    {
+        x = static_cast<Real>(dis(gen));
+        sketch.insert(x);
+    }
+    CHECK_EQUAL(sketch.count(), std::uint64_t(v.size()));
+    CHECK_EQUAL(sketch.is_exact(), false);
+    // Memory is bounded by 3k plus the smallest capacity on each of the O(log(n/k)) levels:
+    CHECK_LE(sketch.retained(), 3 * k + 8 * 32);
+    std::sort(v.begin(), v.end());
+    CHECK_EQUAL(sketch.min(), v.front());
+    CHECK_EQUAL(sketch.max(), v.back());
+    CHECK_LE(max_rank_error(sketch, v), sketch.normalized_rank_error());
+}
+
+template<class Real>
+void test_merge()
+{
+    // Shards of uneven sizes, sketched separately and then combined:
+    std::mt19937_64 gen(3);
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<Real> all;
+    std::vector<quantile_sketch<Real>> shards(8);
+    for (std::size_t s = 0; s < shards.size(); ++s)
+    {
+        std::size_t n = 1000 << s;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            Real x = dis(gen) + static_cast<Real>(s);
+            all.push_back(x);
+            shards[s].insert(x);
+        }
+    }
+    quantile_sketch<Real> merged;
+    for (auto const & s : shards)
+    {
+        merged.merge(s);
+    }
+    CHECK_EQUAL(merged.count(), std::uint64_t(all.size()));
+    CHECK_LE(merged.retained(), 3 * merged.k() + 8 * 32);
+    std::sort(all.begin(), all.end());
+    CHECK_EQUAL(merged.min(), all.front());
+    CHECK_EQUAL(merged.max(), all.back());
+    CHECK_LE(max_rank_error(merged, all), merged.normalized_rank_error());
+
+    // A tree of merges is just as good:
+    std::vector<quantile_sketch<Real>> level(shards);
+    while (level.size() > 1)
+    {
+        std::vector<quantile_sketch<Real>> next;
+        for (std::size_t i = 0; i < level.size(); i += 2)
+        {
+            next.push_back(level[i]);
+            next.back().merge(level[i + 1]);
+        }
+        level = next;
+    }
+    CHECK_EQUAL(level[0].count(), std::uint64_t(all.size()));
+    CHECK_LE(max_rank_error(level[0], all), level[0].normalized_rank_error());
+}
+
+void test_errors()
+{
+    quantile_sketch<double> sketch;
+    CHECK_EQUAL(sketch.empty(), true);
+    bool thrown = false;
+    try { sketch.cdf(0); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+    sketch.insert(1.0);
+    thrown = false;
+    try { sketch.quantile(1.5); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try { sketch.insert(std::numeric_limits<double>::quiet_NaN()); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try { sketch.merge(quantile_sketch<double>(100)); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+    thrown = false;
+    try { quantile_sketch<double> s(2); } catch (const std::domain_error&) { thrown = true; }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_exact<double>();
+    test_exact<float>();
+    test_exact<std::int64_t>();
+    test_stream<double>(200);
+    test_stream<double>(50);
+    test_stream<std::uint32_t>(200);
+    test_merge<double>();
+    test_merge<float>();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/distributions/landau.hpp>
+#include <boost/math/distributions/holtsmark.hpp>
+#include <boost/math/distributions/saspoint5.hpp>
+#include <boost/math/distributions/mapairy.hpp>
+#include <boost/math/distributions/quantile_table.hpp>
+
+using namespace boost::math;
+
+// The error bound stated in the documentation, in epsilons relative to the larger of |quantile| and the interquartile range:
+constexpr double error_bound = 32;
+
+template<class Dist>
+void test_table(const Dist& dist)
+{
+    using Real = typename Dist::value_type;
+    using std::fabs;
+    using std::ldexp;
+    const Real eps = std::numeric_limits<Real>::epsilon();
+    quantile_table<Dist> table(dist);
+    CHECK_LE(table.max_error(), Real(error_bound));
+    const Real spread = quantile(complement(dist, Real(0.25))) - quantile(dist, Real(0.25));
+
+    std::vector<Real> p;
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<Real> unif(0, 1);
+    for (int i = 0; i < 2000; ++i)
+    {
+        p.push_back(unif(gen));
+    }
+    // Every octave of both tails, down to the smallest in the table, and the median:
+    for (int k = 1; k <= 65; ++k)
+    {
+        for (Real m : {Real(0.5), Real(0.6180339887), Real(0.75), Real(0.99)})
+        {
+            p.push_back(ldexp(m, -k));
+            if (1 - ldexp(m, -k) < 1)
+            {
+                p.push_back(1 - ldexp(m, -k));
+            }
+        }
+    }
+    p.push_back(Real(0.5));
+    p.push_back(1 - eps / 2);
+    for (Real x : p)
+    {
+        const Real expected = quantile(dist, x);
+        if (!(boost::math::isfinite)(expected))
+        {
+            // The quantile overflows value_type before the end of the table, and the tail beyond is passed on:
+            CHECK_EQUAL(table.quantile(x), expected);
+            CHECK_EQUAL(table.cquantile(x), quantile(complement(dist, x)));
+            continue;
+        }
+        CHECK_LE(fabs(table.quantile(x) - expected), Real(error_bound) * eps * (std::max)(fabs(expected), spread));
+        const Real expected_complement = quantile(complement(dist, x));
+        CHECK_LE(fabs(table.cquantile(x) - expected_complement), Real(error_bound) * eps * (std::max)(fabs(expected_complement), spread));
+    }
+
+    // The batched quantiles are the same as one at a time:
+    std::vector<Real> batch(p.size());
+    table.quantile(p.begin(), p.end(), batch.begin());
+    for (std::size_t i = 0; i < p.size(); ++i)
+    {
+        CHECK_EQUAL(batch[i], table.quantile(p[i]));
+    }
+
+    // Beyond the table the distribution's own quantile is used:
+    for (Real x : {ldexp(Real(1), -70), ldexp(Real(1), -100)})
+    {
+        CHECK_EQUAL(table.quantile(x), quantile(dist, x));
+        CHECK_EQUAL(table.cquantile(x), quantile(complement(dist, x)));
+    }
+
+    // Variates fall below each quartile a quarter of the time:
+    std::vector<Real> x(40000);
+    table.fill(gen, x.begin(), x.end());
+    for (Real q : {Real(0.25), Real(0.5), Real(0.75)})
+    {
+        const Real boundary = quantile(dist, q);
+        const double below = static_cast<double>(std::count_if(x.begin(), x.end(), [&](Real v) { return v < boundary; })) / x.size();
+        CHECK_ABSOLUTE_ERROR(static_cast<double>(q), below, 0.01);
+    }
+}
+
+void test_errors()
+{
+    quantile_table<landau_distribution<double>> table(landau_distribution<double>(0, 1));
+    CHECK_THROW(table.quantile(1.5), std::domain_error);
+    CHECK_THROW(table.quantile(-0.5), std::domain_error);
+    CHECK_THROW(table.quantile(std::numeric_limits<double>::quiet_NaN()), std::domain_error);
+    CHECK_THROW(table.cquantile(std::numeric_limits<double>::quiet_NaN()), std::domain_error);
+    std::vector<double> p{0.5, std::numeric_limits<double>::quiet_NaN()};
+    std::vector<double> out(p.size());
+    CHECK_THROW(table.quantile(p.begin(), p.end(), out.begin()), std::domain_error);
+}
+
+int main()
+{
+    test_table(landau_distribution<double>());
+    test_table(landau_distribution<double>(2, 3));
+    test_table(holtsmark_distribution<double>());
+    test_table(holtsmark_distribution<double>(-1, 0.5));
+    test_table(saspoint5_distribution<double>());
+    test_table(saspoint5_distribution<double>(1, 4));
+    test_table(mapairy_distribution<double>());
+    test_table(mapairy_distribution<double>(0.5, 2));
+    test_table(landau_distribution<float>());
+    test_table(saspoint5_distribution<float>());
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/quantiles.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::quantiles;
+using boost::math::statistics::approximate_quantiles;
+
+// Type 7 of Hyndman and Fan, from a sorted copy:
+template<class Real, class T>
+std::vector<Real> sorted_quantiles(std::vector<T> v, const std::vector<double>& p)
+{
+    std::sort(v.begin(), v.end());
+    std::vector<Real> result;
+    for (auto q : p)
+    {
+        const Real h = static_cast<Real>(q)*static_cast<Real>(v.size() - 1);
+        const std::size_t k = static_cast<std::size_t>(std::floor(h));
+        const Real lower = static_cast<Real>(v[k]);
+        result.push_back(k + 1 == v.size() || h == static_cast<Real>(k) ? lower : lower + (h - static_cast<Real>(k))*(static_cast<Real>(v[k + 1]) - lower));
+    }
+    return result;
+}
+
+template<class Real>
+std::vector<Real> random_data(std::size_t n, unsigned seed, bool ties)
+{
+    std::mt19937_64 gen(seed);
+    std::normal_distribution<Real> dis(5, 3);
+    std::vector<Real> v(n);
+    for (auto& x : v)
+    {
+        x = ties ? std::round(dis(gen)) : dis(gen);
+    }
+    return v;
+}
+
+const std::vector<double> percentiles{0.5, 0.9, 0.99, 0.999, 0, 1, 0.25, 0.75, 1e-5};
+
+template<class Real>
+void test_exact()
+{
+    for (std::size_t n : {1, 2, 3, 10, 1000, 65537, 300000})
+    {
+        for (bool ties : {false, true})
+        {
+            const auto v = random_data<Real>(n, static_cast<unsigned>(n), ties);
+            const auto expected = sorted_quantiles<Real>(v, percentiles);
+            const auto q = quantiles(v, percentiles);
+            CHECK_EQUAL(q.size(), percentiles.size());
+            for (std::size_t i = 0; i < q.size(); ++i)
+            {
+                CHECK_EQUAL(q[i], expected[i]);
+            }
+            CHECK_EQUAL(quantiles(std::execution::par, v, percentiles) == q, true);
+#ifdef BOOST_MATH_HAS_THREADS
+            boost::math::statistics::thread_pool pool(3);
+            CHECK_EQUAL(quantiles(pool, v, percentiles) == q, true);
+#endif
+        }
+    }
+}
+
+void test_many_quantiles()
+{
+    // A thousand quantiles, whose brackets overlap and merge, of data which is sorted, and so is the worst case
+    // for partitioning, and which is constant over long runs:
+    std::vector<double> v(200000);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = std::floor(static_cast<double>(i)/1000);
+    }
+    std::vector<double> p(1001);
+    for (std::size_t i = 0; i < p.size(); ++i)
+    {
+        p[i] = static_cast<double>(i)/1000;
+    }
+    const auto expected = sorted_quantiles<double>(v, p);
+    CHECK_EQUAL(quantiles(v, p) == expected, true);
+    std::reverse(v.begin(), v.end());
+    CHECK_EQUAL(quantiles(std::execution::par, v, p) == expected, true);
+    v.assign(100000, 2.5);
+    CHECK_EQUAL(quantiles(v, p) == std::vector<double>(p.size(), 2.5), true);
+}
+
+void test_missed_brackets()
+{
+    // Data whose values at the sampled indices are all the least, or all the greatest, so that the brackets
+    // from the sample miss the order statistics, which a second pass then finds:
+    const std::size_t n = 100000;
+    const std::vector<double> p{0.25, 0.5, 0.9, 0.99};
+    std::vector<double> indices(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        indices[i] = static_cast<double>(i);
+    }
+    const auto sampled = boost::math::statistics::detail::quantile_sample<double>(indices.cbegin(), n, boost::math::statistics::detail::quantile_sample_size(n));
+    for (bool ties : {false, true})
+    {
+        auto v = random_data<double>(n, 12, ties);
+        for (auto i : sampled)
+        {
+            v[static_cast<std::size_t>(i)] = -100;
+        }
+        CHECK_EQUAL(quantiles(v, p) == sorted_quantiles<double>(v, p), true);
+        for (auto i : sampled)
+        {
+            v[static_cast<std::size_t>(i)] = 100 + i;
+        }
+        CHECK_EQUAL(quantiles(std::execution::par, v, p) == sorted_quantiles<double>(v, p), true);
+    }
+}
+
+void test_integers()
+{
+    std::vector<int> v{5, 1, 4, 2, 3};
+    const auto q = quantiles(v, std::vector<double>{0.5, 0.1, 0.375});
+    static_assert(std::is_same<decltype(q), const std::vector<double>>::value, "Integer data has double results.");
+    CHECK_EQUAL(q[0], 3.0);
+    CHECK_ULP_CLOSE(1.4, q[1], 2);
+    CHECK_EQUAL(q[2], 2.5);
+
+    std::mt19937 gen(3);
+    std::vector<int> w(100000);
+    for (auto& x : w)
+    {
+        x = static_cast<int>(gen() % 1000) - 500;
+    }
+    CHECK_EQUAL(quantiles(w, percentiles) == sorted_quantiles<double>(w, percentiles), true);
+}
+
+void test_multiselect()
+{
+    std::vector<double> v = random_data<double>(5000, 8, true);
+    auto sorted = v;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::size_t> ranks{0, 1, 17, 2500, 2501, 4998, 4999};
+    boost::math::statistics::detail::multiselect(v.begin(), v.end(), 0, ranks.data(), ranks.data() + ranks.size());
+    for (auto k : ranks)
+    {
+        CHECK_EQUAL(v[k], sorted[k]);
+        CHECK_EQUAL(*std::max_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k) + 1), v[k]);
+        CHECK_EQUAL(*std::min_element(v.begin() + static_cast<std::ptrdiff_t>(k), v.end()), v[k]);
+    }
+}
+
+template<class Real>
+void test_approximate()
+{
+    for (std::size_t n : {1, 7, 1000, 300000})
+    {
+        auto v = random_data<Real>(n, 5, false);
+        // Values of both signs, zeros and a wide range of magnitudes:
+        for (std::size_t i = 0; i < v.size(); i += 7)
+        {
+            v[i] = i % 2 ? Real(0) : std::ldexp(v[i], static_cast<int>(i % 40) - 20);
+        }
+        const auto expected = sorted_quantiles<Real>(v, percentiles);
+        const auto q = approximate_quantiles(v, percentiles);
+        for (std::size_t i = 0; i < q.size(); ++i)
+        {
+            if (std::is_same<Real, float>::value)
+            {
+                // Every bit of a float is in the keys:
+                CHECK_EQUAL(q[i], expected[i]);
+            }
+            else
+            {
+                // Each order statistic to 2^-22, and the interpolation between them:
+                const std::size_t k = static_cast<std::size_t>(std::floor(percentiles[i]*static_cast<double>(n - 1)));
+                auto sorted = v;
+                std::sort(sorted.begin(), sorted.end());
+                const Real scale = std::max(std::abs(sorted[k]), std::abs(sorted[std::min(k + 1, n - 1)]));
+                CHECK_LE(std::abs(q[i] - expected[i]), std::ldexp(scale, -22));
+            }
+        }
+        CHECK_EQUAL(approximate_quantiles(std::execution::par, v, percentiles) == q, true);
+#ifdef BOOST_MATH_HAS_THREADS
+        boost::math::statistics::thread_pool pool(3);
+        CHECK_EQUAL(approximate_quantiles(pool, v, percentiles) == q, true);
+#endif
+    }
+
+    // Exact values of a double, when each is the least or greatest in its final bucket:
+    std::vector<double> w{1.5, -2.25, 0.0, 8.0, -0.5};
+    const auto q = approximate_quantiles(w, std::vector<double>{0, 0.25, 0.5, 1});
+    CHECK_EQUAL(q[0], -2.25);
+    CHECK_EQUAL(q[1], -0.5);
+    CHECK_EQUAL(q[2], 0.0);
+    CHECK_EQUAL(q[3], 8.0);
+}
+
+void test_errors()
+{
+    std::vector<double> empty;
+    std::vector<double> v{1, 2, 3};
+    CHECK_THROW(quantiles(empty, std::vector<double>{0.5}), std::domain_error);
+    CHECK_THROW(approximate_quantiles(std::execution::par, empty, std::vector<double>{0.5}), std::domain_error);
+    CHECK_THROW(quantiles(v, std::vector<double>{1.5}), std::domain_error);
+    CHECK_THROW(approximate_quantiles(v, std::vector<double>{-0.1}), std::domain_error);
+    CHECK_EQUAL(quantiles(v, std::vector<double>()).size(), std::size_t(0));
+}
+
+int main()
+{
+    test_exact<double>();
+    test_exact<float>();
+    test_many_quantiles();
+    test_missed_brackets();
+    test_integers();
+    test_multiselect();
+    test_approximate<double>();
+    test_approximate<float>();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/rank_correlation.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+#include <boost/math/statistics/chatterjee_correlation.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::spearman_correlation;
+using boost::math::statistics::kendall_tau;
+using boost::math::statistics::spearman_correlation_matrix;
+using boost::math::statistics::kendall_tau_matrix;
+using boost::math::statistics::chatterjee_correlation_matrix;
+using boost::math::statistics::chatterjee_correlation;
+
+template<class Real>
+std::vector<Real> midranks(const std::vector<Real>& v)
+{
+    std::vector<Real> r(v.size());
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        Real below = 0;
+        Real equal = 0;
+        for (auto x : v)
+        {
+            below += x < v[i];
+            equal += x == v[i];
+        }
+        r[i] = below + (equal + 1)/2;
+    }
+    return r;
+}
+
+template<class Real>
+Real naive_kendall_tau_b(const std::vector<Real>& x, const std::vector<Real>& y)
+{
+    Real concordant_minus_discordant = 0;
+    Real untied_x = 0;
+    Real untied_y = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < x.size(); ++j)
+        {
+            const int sx = (x[i] < x[j]) - (x[j] < x[i]);
+            const int sy = (y[i] < y[j]) - (y[j] < y[i]);
+            concordant_minus_discordant += sx*sy;
+            untied_x += sx != 0;
+            untied_y += sy != 0;
+        }
+    }
+    return concordant_minus_discordant/std::sqrt(untied_x*untied_y);
+}
+
+// Columns related to the first, some with many ties:
+template<class Real>
+std::vector<std::vector<Real>> random_columns(std::size_t p, std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::normal_distribution<Real> dis(0, 1);
+    std::vector<std::vector<Real>> columns(p, std::vector<Real>(n));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const Real common = dis(gen);
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            Real x = static_cast<Real>(j % 3)*common + dis(gen);
+            columns[j][i] = j % 4 == 1 ? std::round(2*x) : x;
+        }
+    }
+    return columns;
+}
+
+template<class Real>
+void test_pairs()
+{
+    const Real tol = 64*std::numeric_limits<Real>::epsilon();
+    auto columns = random_columns<Real>(6, 150, 3);
+    for (std::size_t i = 0; i < columns.size(); ++i)
+    {
+        for (std::size_t j = 0; j < columns.size(); ++j)
+        {
+            const auto& x = columns[i];
+            const auto& y = columns[j];
+            auto rx = midranks(x);
+            auto ry = midranks(y);
+            const Real rho = boost::math::statistics::correlation_coefficient(rx, ry);
+            CHECK_LE(std::abs(spearman_correlation(x, y) - rho), tol);
+            CHECK_LE(std::abs(kendall_tau(x, y) - naive_kendall_tau_b(x, y)), tol);
+        }
+    }
+
+    // Exact values:
+    std::vector<Real> x{1, 2, 3, 4, 5};
+    std::vector<Real> y{5, 6, 7, 8, 7};
+    CHECK_ULP_CLOSE(Real(0.82078268166812329), spearman_correlation(x, y), 4);
+    CHECK_ULP_CLOSE(Real(0.73786478737262184), kendall_tau(x, y), 4);
+    std::vector<Real> z{5, 4, 3, 2, 1};
+    CHECK_EQUAL(spearman_correlation(x, z), Real(-1));
+    CHECK_EQUAL(kendall_tau(x, z), Real(-1));
+    CHECK_EQUAL(kendall_tau(x, x), Real(1));
+
+    // Invariant under strictly increasing transformations:
+    std::vector<Real> u = columns[0];
+    std::vector<Real> v = columns[2];
+    const Real tau = kendall_tau(u, v);
+    const Real rho = spearman_correlation(u, v);
+    for (auto& t : u)
+    {
+        t = std::exp(t);
+    }
+    CHECK_EQUAL(kendall_tau(u, v), tau);
+    CHECK_EQUAL(spearman_correlation(u, v), rho);
+
+    // A constant sample has no rank correlation:
+    std::vector<Real> c(5, Real(2));
+    CHECK_NAN(spearman_correlation(x, c));
+    CHECK_NAN(kendall_tau(c, x));
+}
+
+void test_integers()
+{
+    std::vector<int> x{1, 2, 3, 4, 5};
+    std::vector<int> y{5, 6, 7, 8, 7};
+    CHECK_ULP_CLOSE(0.82078268166812329, spearman_correlation(x, y), 4);
+    CHECK_ULP_CLOSE(0.73786478737262184, kendall_tau(x, y), 4);
+}
+
+void test_long_kendall()
+{
+    // Long enough for several rounds of merging, against the O(n^2) definition:
+    auto columns = random_columns<double>(2, 3000, 9);
+    CHECK_LE(std::abs(kendall_tau(columns[0], columns[1]) - naive_kendall_tau_b(columns[0], columns[1])), 1e-13);
+    auto rounded = columns;
+    for (auto& c : rounded)
+    {
+        for (auto& t : c)
+        {
+            t = std::round(t);
+        }
+    }
+    CHECK_LE(std::abs(kendall_tau(rounded[0], rounded[1]) - naive_kendall_tau_b(rounded[0], rounded[1])), 1e-13);
+}
+
+void test_matrices()
+{
+    // More columns than one tile of the Spearman matrix:
+    auto columns = random_columns<double>(70, 300, 17);
+    columns[5].assign(300, 1.5);
+    const std::size_t p = columns.size();
+    auto rho = spearman_correlation_matrix(columns);
+    auto tau = kendall_tau_matrix(columns);
+    auto xi = chatterjee_correlation_matrix(columns);
+    CHECK_EQUAL(rho.size(), p*p);
+    for (std::size_t i = 0; i < p; ++i)
+    {
+        for (std::size_t j = 0; j < p; ++j)
+        {
+            if (i == 5 || j == 5)
+            {
+                CHECK_NAN(rho[i*p + j]);
+                CHECK_NAN(tau[i*p + j]);
+                continue;
+            }
+            if (i == j)
+            {
+                CHECK_EQUAL(rho[i*p + j], 1.0);
+                CHECK_EQUAL(tau[i*p + j], 1.0);
+            }
+            else
+            {
+                CHECK_EQUAL(rho[i*p + j], spearman_correlation(columns[i], columns[j]));
+                CHECK_EQUAL(tau[i*p + j], kendall_tau(columns[i], columns[j]));
+            }
+            CHECK_EQUAL(rho[i*p + j], rho[j*p + i]);
+        }
+    }
+
+    // Chatterjee's xi of column j on column i, as for the pairs sorted by column i.  chatterjee_correlation
+    // needs the values of column j to be distinct, which they are unless j % 4 == 1:
+    for (std::size_t i : {0, 1, 7})
+    {
+        std::vector<std::size_t> order(columns[i].size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) { return columns[i][a] < columns[i][b]; });
+        for (std::size_t j = 0; j < p; j += (j % 4 == 0 ? 2 : 1))
+        {
+            std::vector<double> x(order.size());
+            std::vector<double> y(order.size());
+            for (std::size_t k = 0; k < order.size(); ++k)
+            {
+                x[k] = columns[i][order[k]];
+                y[k] = columns[j][order[k]];
+            }
+            const double expected = chatterjee_correlation(x, y);
+            if (std::isnan(expected))
+            {
+                CHECK_NAN(xi[i*p + j]);
+            }
+            else
+            {
+                CHECK_EQUAL(xi[i*p + j], expected);
+            }
+        }
+    }
+    const double n = 300;
+    CHECK_ULP_CLOSE((n - 2)/(n + 1), xi[0], 4);
+    CHECK_NAN(xi[5]);
+
+    auto rho_par = spearman_correlation_matrix(std::execution::par, columns);
+    auto tau_par = kendall_tau_matrix(std::execution::par, columns);
+    auto xi_par = chatterjee_correlation_matrix(std::execution::par, columns);
+    auto same = [](const std::vector<double>& a, const std::vector<double>& b)
+    {
+        return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](double s, double t) { return s == t || (std::isnan(s) && std::isnan(t)); });
+    };
+    CHECK_EQUAL(same(rho, rho_par), true);
+    CHECK_EQUAL(same(tau, tau_par), true);
+    CHECK_EQUAL(same(xi, xi_par), true);
+
+#ifdef BOOST_MATH_HAS_THREADS
+    // Force the parallel path, whatever the hardware:
+    boost::math::statistics::thread_pool pool(3);
+    CHECK_EQUAL(same(rho, spearman_correlation_matrix(pool, columns)), true);
+    CHECK_EQUAL(same(tau, kendall_tau_matrix(pool, columns)), true);
+    CHECK_EQUAL(same(xi, chatterjee_correlation_matrix(pool, columns)), true);
+#endif
+
+    // Empty and single column sets:
+    std::vector<std::vector<double>> none;
+    CHECK_EQUAL(spearman_correlation_matrix(none).size(), std::size_t(0));
+    CHECK_EQUAL(kendall_tau_matrix(none).size(), std::size_t(0));
+    std::vector<std::vector<double>> one(1, columns[0]);
+    CHECK_EQUAL(kendall_tau_matrix(one)[0], 1.0);
+}
+
+void test_errors()
+{
+    std::vector<double> x{1, 2, 3};
+    std::vector<double> y{1, 2};
+    CHECK_THROW(spearman_correlation(x, y), std::domain_error);
+    CHECK_THROW(kendall_tau(x, y), std::domain_error);
+    std::vector<std::vector<double>> columns{x, y};
+    CHECK_THROW(spearman_correlation_matrix(columns), std::domain_error);
+    CHECK_THROW(kendall_tau_matrix(std::execution::par, columns), std::domain_error);
+    CHECK_THROW(chatterjee_correlation_matrix(columns), std::domain_error);
+}
+
+int main()
+{
+    test_pairs<double>();
+    test_pairs<float>();
+    test_integers();
+    test_long_kendall();
+    test_matrices();
+    test_errors();
+    return boost::math::test::report_errors();
+}
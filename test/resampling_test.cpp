@@ -0,0 +1,247 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/resampling.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/t_test.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::bootstrap_replicates;
+using boost::math::statistics::bootstrap_percentile_interval;
+using boost::math::statistics::bootstrap_bca_interval;
+using boost::math::statistics::permutation_test;
+
+struct mean_statistic
+{
+    template<class RandomAccessIterator>
+    auto operator()(RandomAccessIterator first, RandomAccessIterator last) const
+    {
+        return boost::math::statistics::mean(first, last);
+    }
+};
+
+// median partitions its range, so the values are copied into a buffer kept by each copy of the statistic:
+struct median_statistic
+{
+    std::vector<double> buffer;
+
+    template<class RandomAccessIterator>
+    double operator()(RandomAccessIterator first, RandomAccessIterator last)
+    {
+        buffer.assign(first, last);
+        return boost::math::statistics::median(buffer);
+    }
+};
+
+struct mean_difference
+{
+    template<class RandomAccessIterator>
+    auto operator()(RandomAccessIterator x_first, RandomAccessIterator x_last, RandomAccessIterator y_first, RandomAccessIterator y_last) const
+    {
+        return boost::math::statistics::mean(x_first, x_last) - boost::math::statistics::mean(y_first, y_last);
+    }
+};
+
+void test_philox()
+{
+    // The known answers of the Random123 distribution:
+    using boost::math::statistics::detail::philox4x32;
+    auto b = philox4x32::block({{0, 0, 0, 0}}, {{0, 0}});
+    CHECK_EQUAL(b[0], 0x6627e8d5u);
+    CHECK_EQUAL(b[1], 0xe169c58du);
+    CHECK_EQUAL(b[2], 0xbc57ac4cu);
+    CHECK_EQUAL(b[3], 0x9b00dbd8u);
+    b = philox4x32::block({{0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu}}, {{0xffffffffu, 0xffffffffu}});
+    CHECK_EQUAL(b[0], 0x408f276du);
+    CHECK_EQUAL(b[1], 0x41c83b0eu);
+    CHECK_EQUAL(b[2], 0xa20bc7c6u);
+    CHECK_EQUAL(b[3], 0x6d5451fdu);
+    b = philox4x32::block({{0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u}}, {{0xa4093822u, 0x299f31d0u}});
+    CHECK_EQUAL(b[0], 0xd16cfe09u);
+    CHECK_EQUAL(b[1], 0x94fdccebu);
+    CHECK_EQUAL(b[2], 0x5001e420u);
+    CHECK_EQUAL(b[3], 0x24126ea1u);
+
+    // Uniform indices, for a range which is not a power of two:
+    philox4x32 gen(7, 3);
+    std::vector<std::size_t> counts(6, 0);
+    for (std::size_t i = 0; i < 60000; ++i)
+    {
+        ++counts[boost::math::statistics::detail::uniform_index(gen, 6)];
+    }
+    for (auto c : counts)
+    {
+        CHECK_LE(std::abs(static_cast<double>(c) - 10000.0), 500.0);
+    }
+}
+
+template<class Real>
+std::vector<Real> normal_sample(std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::normal_distribution<Real> dis(3, 2);
+    std::vector<Real> v(n);
+    for (auto& t : v)
+    {
+        t = dis(gen);
+    }
+    return v;
+}
+
+template<class Real>
+void test_bootstrap()
+{
+    const std::size_t n = 2000;
+    const auto v = normal_sample<Real>(n, 11);
+    const Real mu = boost::math::statistics::mean(v);
+    const Real se = std::sqrt(boost::math::statistics::sample_variance(v)/n);
+
+    auto replicates = bootstrap_replicates(v, mean_statistic(), 4000, 5);
+    CHECK_EQUAL(replicates.size(), std::size_t(4000));
+    CHECK_LE(std::abs(boost::math::statistics::mean(replicates) - mu), Real(0.1)*se);
+    CHECK_LE(std::abs(std::sqrt(boost::math::statistics::sample_variance(replicates))/se - 1), Real(0.05));
+
+    // The same seed gives the same resamples, however they are run:
+    CHECK_EQUAL(replicates == bootstrap_replicates(std::execution::par, v, mean_statistic(), 4000, 5), true);
+    CHECK_EQUAL(replicates == bootstrap_replicates(v, mean_statistic(), 4000, 6), false);
+#ifdef BOOST_MATH_HAS_THREADS
+    boost::math::statistics::thread_pool pool(3);
+    CHECK_EQUAL(replicates == bootstrap_replicates(pool, v, mean_statistic(), 4000, 5), true);
+#endif
+
+    // For the mean of a normal sample, both intervals are close to mu -+ 1.96 se:
+    const Real z = Real(1.959963984540054);
+    auto percentile = bootstrap_percentile_interval(v, mean_statistic(), 0.95, 4000, 5);
+    CHECK_LE(std::abs(percentile.first - (mu - z*se)), Real(0.1)*se);
+    CHECK_LE(std::abs(percentile.second - (mu + z*se)), Real(0.1)*se);
+    auto bca = bootstrap_bca_interval(std::execution::par, v, mean_statistic(), 0.95, 4000, 5);
+    CHECK_LE(std::abs(bca.first - (mu - z*se)), Real(0.1)*se);
+    CHECK_LE(std::abs(bca.second - (mu + z*se)), Real(0.1)*se);
+    CHECK_LE(bca.first, bca.second);
+}
+
+void test_bca_formula()
+{
+    // Against numpy.percentile and scipy.stats.norm, for given replicates and jackknife values:
+    std::vector<double> replicates(100);
+    for (std::size_t k = 0; k < replicates.size(); ++k)
+    {
+        replicates[k] = static_cast<double>((37*k) % 100)/99;
+    }
+    std::vector<double> jackknife(12);
+    for (std::size_t k = 0; k < jackknife.size(); ++k)
+    {
+        jackknife[k] = 0.3 + 0.01*static_cast<double>(k*k)/7;
+    }
+    auto bca = boost::math::statistics::detail::bca_interval(replicates, jackknife, 0.4, 0.9);
+    CHECK_ULP_CLOSE(0.01144093868576801, bca.first, 256);
+    CHECK_ULP_CLOSE(0.8595643258558359, bca.second, 256);
+    auto percentile = boost::math::statistics::detail::percentile_interval(replicates, 0.9);
+    CHECK_ULP_CLOSE(0.05, percentile.first, 4);
+    CHECK_ULP_CLOSE(0.95, percentile.second, 4);
+
+    // Every replicate above the statistic leaves the bias undefined:
+    bca = boost::math::statistics::detail::bca_interval(replicates, jackknife, -1.0, 0.9);
+    CHECK_NAN(bca.first);
+    CHECK_NAN(bca.second);
+}
+
+void test_median_and_integers()
+{
+    const auto v = normal_sample<double>(501, 4);
+    auto replicates = bootstrap_replicates(v, median_statistic(), 500, 9);
+    CHECK_EQUAL(replicates == bootstrap_replicates(std::execution::par, v, median_statistic(), 500, 9), true);
+#ifdef BOOST_MATH_HAS_THREADS
+    boost::math::statistics::thread_pool pool(3);
+    CHECK_EQUAL(replicates == bootstrap_replicates(pool, v, median_statistic(), 500, 9), true);
+#endif
+    // Every replicate of the median of an odd sample is one of the values:
+    for (auto t : replicates)
+    {
+        CHECK_EQUAL(std::find(v.begin(), v.end(), t) != v.end(), true);
+    }
+
+    std::vector<int> w{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto interval = bootstrap_percentile_interval(w, mean_statistic(), 0.9, 2000, 1);
+    static_assert(std::is_same<decltype(interval.first), double>::value, "Integer data has double results.");
+    CHECK_LE(interval.first, 5.5);
+    CHECK_LE(5.5, interval.second);
+    CHECK_LE(1.0, interval.first);
+    CHECK_LE(interval.second, 10.0);
+}
+
+void test_permutation()
+{
+    // Of the 20 ways to choose x from the pooled values, two give a difference of means as large as 3:
+    std::vector<double> x{1, 2, 3};
+    std::vector<double> y{4, 5, 6};
+    auto exact = permutation_test(x, y, mean_difference(), 20000, 3);
+    CHECK_ULP_CLOSE(-3.0, exact.first, 4);
+    CHECK_LE(std::abs(exact.second - 0.1), 0.01);
+
+    // For normal samples, close to the t-test:
+    auto u = normal_sample<double>(300, 1);
+    auto v = normal_sample<double>(200, 2);
+    for (auto& t : v)
+    {
+        t += 0.3;
+    }
+    auto result = permutation_test(std::execution::par, u, v, mean_difference(), 20000, 3);
+    auto t_test = boost::math::statistics::two_sample_t_test(u, v);
+    CHECK_ULP_CLOSE(boost::math::statistics::mean(u) - boost::math::statistics::mean(v), result.first, 64);
+    CHECK_LE(std::abs(result.second - t_test.second), 0.01);
+    CHECK_EQUAL(result == permutation_test(u, v, mean_difference(), 20000, 3), true);
+#ifdef BOOST_MATH_HAS_THREADS
+    boost::math::statistics::thread_pool pool(3);
+    CHECK_EQUAL(result == permutation_test(pool, u, v, mean_difference(), 20000, 3), true);
+    // With the larger sample first, so the other is the one shuffled:
+    auto swapped = permutation_test(pool, v, u, mean_difference(), 20000, 3);
+    CHECK_LE(std::abs(swapped.second - t_test.second), 0.01);
+#endif
+
+    // Never zero, even when no permutation is as extreme:
+    for (auto& t : v)
+    {
+        t += 10;
+    }
+    CHECK_ULP_CLOSE(1.0/1001, permutation_test(u, v, mean_difference(), 1000, 3).second, 4);
+}
+
+void test_errors()
+{
+    std::vector<double> empty;
+    std::vector<double> v{1, 2, 3};
+    CHECK_THROW(bootstrap_replicates(empty, mean_statistic(), 10, 0), std::domain_error);
+    CHECK_THROW(bootstrap_replicates(v, mean_statistic(), 0, 0), std::domain_error);
+    CHECK_THROW(bootstrap_percentile_interval(v, mean_statistic(), 1.0, 10, 0), std::domain_error);
+    CHECK_THROW(bootstrap_bca_interval(std::execution::par, v, mean_statistic(), 0.0, 10, 0), std::domain_error);
+    CHECK_THROW(permutation_test(v, empty, mean_difference(), 10, 0), std::domain_error);
+}
+
+int main()
+{
+    test_philox();
+    test_bootstrap<double>();
+    test_bootstrap<float>();
+    test_bca_formula();
+    test_median_and_integers();
+    test_permutation();
+    test_errors();
+    return boost::math::test::report_errors();
+}
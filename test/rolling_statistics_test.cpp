@@ -0,0 +1,238 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/rolling_statistics.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::rolling_mean;
+using boost::math::statistics::rolling_variance;
+using boost::math::statistics::rolling_sample_variance;
+using boost::math::statistics::rolling_median;
+using boost::math::statistics::rolling_quantile;
+using boost::math::statistics::rolling_median_absolute_deviation;
+using boost::math::statistics::rolling_means;
+using boost::math::statistics::rolling_variances;
+using boost::math::statistics::rolling_medians;
+using boost::math::statistics::rolling_quantiles;
+using boost::math::statistics::rolling_median_absolute_deviations;
+
+template<class Real>
+std::vector<Real> random_series(std::size_t n, unsigned seed, bool ties = false)
+{
+    std::mt19937_64 gen(seed);
+    std::normal_distribution<Real> dis(1000, 3);
+    std::vector<Real> v(n);
+    for (auto& x : v)
+    {
+        x = ties ? std::round(dis(gen)) : dis(gen);
+    }
+    return v;
+}
+
+// Type 7 quantile of a sorted copy:
+template<class Real>
+Real naive_quantile(std::vector<Real> w, Real p)
+{
+    std::sort(w.begin(), w.end());
+    const Real h = (w.size() - 1)*p;
+    const std::size_t k = static_cast<std::size_t>(std::floor(h));
+    if (k + 1 >= w.size())
+    {
+        return w[k];
+    }
+    return w[k] + (h - std::floor(h))*(w[k + 1] - w[k]);
+}
+
+template<class Real>
+void test_against_naive(std::size_t window, bool ties)
+{
+    auto v = random_series<Real>(200, 12 + static_cast<unsigned>(window), ties);
+    auto means = rolling_mean(v, window);
+    auto variances = rolling_variance(v, window);
+    auto sample_variances = window > 1 ? rolling_sample_variance(v, window) : std::vector<Real>();
+    auto medians = rolling_median(v, window);
+    auto quartiles = rolling_quantile(v, window, Real(0.25));
+    auto maxima = rolling_quantile(v, window, Real(1));
+    auto mads = rolling_median_absolute_deviation(v, window);
+    CHECK_EQUAL(means.size(), v.size() - window + 1);
+    CHECK_EQUAL(mads.size(), v.size() - window + 1);
+    const Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (std::size_t i = 0; i + window <= v.size(); ++i)
+    {
+        std::vector<Real> w(v.begin() + i, v.begin() + i + window);
+        const Real mu = boost::math::statistics::mean(w);
+        const Real s2 = boost::math::statistics::variance(w);
+        CHECK_LE(std::abs(means[i] - mu), tol*std::abs(mu));
+        CHECK_LE(std::abs(variances[i] - s2), 1000*tol*(1 + s2));
+        if (window > 1)
+        {
+            CHECK_LE(std::abs(sample_variances[i] - boost::math::statistics::sample_variance(w)), 1000*tol*(1 + s2));
+        }
+        auto copy = w;
+        CHECK_EQUAL(medians[i], boost::math::statistics::median(copy));
+        CHECK_LE(std::abs(quartiles[i] - naive_quantile(w, Real(0.25))), tol*std::abs(medians[i]));
+        CHECK_EQUAL(maxima[i], *std::max_element(w.begin(), w.end()));
+        copy = w;
+        CHECK_LE(std::abs(mads[i] - boost::math::statistics::median_absolute_deviation(copy)), tol*std::abs(medians[i]));
+    }
+}
+
+void test_small()
+{
+    std::vector<double> v{5, 1, 4, 2, 3};
+    auto medians = rolling_median(v, 3);
+    CHECK_EQUAL(medians.size(), std::size_t(3));
+    CHECK_EQUAL(medians[0], 4.0);
+    CHECK_EQUAL(medians[1], 2.0);
+    CHECK_EQUAL(medians[2], 3.0);
+    auto means = rolling_mean(v, 2);
+    CHECK_EQUAL(means[0], 3.0);
+    CHECK_EQUAL(means[3], 2.5);
+    // A window of one is the series:
+    auto ones = rolling_median(v, 1);
+    CHECK_EQUAL(ones[1], 1.0);
+    auto zeros = rolling_variance(v, 1);
+    CHECK_EQUAL(zeros[4], 0.0);
+    // A window of the whole series gives one value:
+    auto all = rolling_median_absolute_deviation(v, 5);
+    CHECK_EQUAL(all.size(), std::size_t(1));
+    CHECK_EQUAL(all[0], 1.0);
+
+    // Through an output iterator:
+    std::vector<double> out(3);
+    auto end = rolling_quantile(v.begin(), v.end(), 3, 0.5, out.begin());
+    CHECK_EQUAL(static_cast<std::size_t>(end - out.begin()), std::size_t(3));
+    CHECK_EQUAL(out[1], 2.0);
+
+    // Integer data gives double results:
+    std::vector<int> u{1, 2, 3, 4};
+    auto int_means = rolling_mean(u, 2);
+    CHECK_EQUAL(int_means[0], 1.5);
+    auto int_medians = rolling_median(u, 2);
+    CHECK_EQUAL(int_medians[2], 3.5);
+}
+
+// A level shift far from zero, where the update must not lose the variance:
+void test_drift()
+{
+    std::vector<double> v(10000);
+    std::mt19937_64 gen(7);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] = (i < 5000 ? 1e9 : -1e9) + dis(gen);
+    }
+    const std::size_t window = 50;
+    auto variances = rolling_variance(v, window);
+    for (std::size_t i = 0; i < variances.size(); i += 97)
+    {
+        std::vector<double> w(v.begin() + i, v.begin() + i + window);
+        double s2 = boost::math::statistics::variance(w);
+        CHECK_LE(std::abs(variances[i] - s2), 1e-5*(1 + s2));
+    }
+}
+
+// Long enough for the order statistics to be taken in several stretches:
+void test_long()
+{
+    auto v = random_series<double>(20000, 5, true);
+    for (std::size_t window : {7, 5000})
+    {
+        auto medians = rolling_median(v, window);
+        auto mads = rolling_median_absolute_deviation(v, window);
+        for (std::size_t i = 0; i < medians.size(); i += (window < 100 ? 1 : 251))
+        {
+            std::vector<double> w(v.begin() + i, v.begin() + i + window);
+            CHECK_EQUAL(medians[i], boost::math::statistics::median(w));
+            w.assign(v.begin() + i, v.begin() + i + window);
+            CHECK_EQUAL(mads[i], boost::math::statistics::median_absolute_deviation(w));
+        }
+    }
+}
+
+void test_errors()
+{
+    std::vector<double> v{1, 2, 3};
+    CHECK_THROW(rolling_mean(v, 0), std::domain_error);
+    CHECK_THROW(rolling_median(v, 4), std::domain_error);
+    CHECK_THROW(rolling_sample_variance(v, 1), std::domain_error);
+    CHECK_THROW(rolling_quantile(v, 2, 1.5), std::domain_error);
+    CHECK_THROW(rolling_quantile(v, 2, -0.5), std::domain_error);
+}
+
+void test_batch()
+{
+    std::vector<std::vector<double>> series;
+    for (unsigned s = 0; s < 40; ++s)
+    {
+        series.push_back(random_series<double>(100 + 37*s, s));
+    }
+    const std::size_t window = 31;
+    auto seq = rolling_medians(series, window);
+    auto par = rolling_medians(std::execution::par, series, window);
+    auto means = rolling_means(std::execution::par, series, window);
+    auto variances = rolling_variances(series, window);
+    auto quantiles = rolling_quantiles(std::execution::par, series, window, 0.9);
+    auto mads = rolling_median_absolute_deviations(std::execution::par, series, window);
+    CHECK_EQUAL(seq.size(), series.size());
+    for (std::size_t s = 0; s < series.size(); ++s)
+    {
+        CHECK_EQUAL(seq[s].size(), series[s].size() - window + 1);
+        CHECK_EQUAL(seq[s] == par[s], true);
+        CHECK_EQUAL(seq[s] == rolling_median(series[s], window), true);
+        CHECK_EQUAL(means[s] == rolling_mean(series[s], window), true);
+        CHECK_EQUAL(variances[s] == rolling_variance(series[s], window), true);
+        CHECK_EQUAL(quantiles[s] == rolling_quantile(series[s], window, 0.9), true);
+        CHECK_EQUAL(mads[s] == rolling_median_absolute_deviation(series[s], window), true);
+    }
+
+#ifdef BOOST_MATH_HAS_THREADS
+    // Force the parallel path, whatever the hardware:
+    boost::math::statistics::thread_pool pool(3);
+    auto pooled = rolling_medians(pool, series, window);
+    auto pooled_mads = rolling_median_absolute_deviations(pool, series, window);
+    for (std::size_t s = 0; s < series.size(); ++s)
+    {
+        CHECK_EQUAL(pooled[s] == seq[s], true);
+        CHECK_EQUAL(pooled_mads[s] == mads[s], true);
+    }
+#endif
+
+    // A series shorter than the window is an error, whichever thread finds it:
+    series[17].resize(10);
+    CHECK_THROW(rolling_medians(std::execution::par, series, window), std::domain_error);
+}
+
+int main()
+{
+    for (std::size_t window : {1, 2, 3, 8, 15, 64})
+    {
+        test_against_naive<double>(window, false);
+        test_against_naive<double>(window, true);
+    }
+    test_against_naive<float>(9, false);
+    test_against_naive<float>(10, true);
+    test_small();
+    test_drift();
+    test_long();
+    test_errors();
+    test_batch();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,175 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <random>
+#include <vector>
+#include <boost/math/distributions.hpp>
+#include <boost/math/distributions/sampler.hpp>
+
+using boost::math::sampler;
+
+// The Kolmogorov-Smirnov statistic of the sample against the distribution; with a fixed seed the
+// tests are deterministic, and the bound used is exceeded with probability 1e-3 by a correct sampler.
+template<class Dist>
+void test_ks(const Dist& dist, std::size_t n = 20000)
+{
+    using Real = typename Dist::value_type;
+    using std::abs;
+    using std::sqrt;
+    std::mt19937_64 gen(12345);
+    sampler<Dist> s(dist);
+    std::vector<Real> x(n);
+    s.fill(gen, x.begin(), x.end());
+    // fill gives the same draws as calling the sampler repeatedly (up to contraction in the table lookups):
+    std::mt19937_64 gen2(12345);
+    for (std::size_t i = 0; i < 50; ++i)
+    {
+        CHECK_ULP_CLOSE(s(gen2), x[i], 4);
+    }
+    std::sort(x.begin(), x.end());
+    Real d = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        Real p = cdf(dist, x[i]);
+        d = (std::max)(d, (std::max)(Real(abs(p - Real(i)/n)), Real(abs(Real(i + 1)/n - p))));
+    }
+    if (!CHECK_LE(d, Real(1.95)/sqrt(Real(n))))
+    {
+        std::cerr << "  Kolmogorov-Smirnov test failed for " << typeid(Dist).name() << "\n";
+    }
+}
+
+template<class Real>
+void test_continuous()
+{
+    using namespace boost::math;
+    test_ks(normal_distribution<Real>(Real(-1), Real(3)));
+    test_ks(lognormal_distribution<Real>(Real(0.5), Real(0.75)));
+    test_ks(exponential_distribution<Real>(Real(2.5)));
+    test_ks(gamma_distribution<Real>(Real(0.25), Real(2)));
+    test_ks(gamma_distribution<Real>(Real(1)));
+    test_ks(gamma_distribution<Real>(Real(37.5), Real(0.5)));
+    test_ks(chi_squared_distribution<Real>(Real(3)));
+    test_ks(beta_distribution<Real>(Real(0.5), Real(0.5)));
+    test_ks(beta_distribution<Real>(Real(2), Real(7)));
+    test_ks(students_t_distribution<Real>(Real(1.5)));
+    test_ks(students_t_distribution<Real>(Real(30)));
+    test_ks(fisher_f_distribution<Real>(Real(3), Real(11)));
+    test_ks(non_central_chi_squared_distribution<Real>(Real(4), Real(2.5)));
+    test_ks(non_central_chi_squared_distribution<Real>(Real(1), Real(9)));
+    test_ks(non_central_chi_squared_distribution<Real>(Real(0.5), Real(3)));
+    test_ks(weibull_distribution<Real>(Real(1.5), Real(2)));
+    test_ks(cauchy_distribution<Real>(Real(1), Real(2)));
+}
+
+template<class Real>
+void test_stable()
+{
+    using namespace boost::math;
+    test_ks(landau_distribution<Real>());
+    test_ks(landau_distribution<Real>(Real(2), Real(3)));
+    test_ks(holtsmark_distribution<Real>(Real(-1), Real(0.5)));
+    test_ks(saspoint5_distribution<Real>(Real(0), Real(2)));
+    test_ks(mapairy_distribution<Real>(Real(1), Real(1)));
+
+    // The table reproduces the quantile to about epsilon^(3/4):
+    using std::abs;
+    using std::pow;
+    landau_distribution<Real> dist(Real(2), Real(3));
+    std::mt19937_64 gen(2024);
+    std::mt19937_64 gen2(2024);
+    sampler<landau_distribution<Real>> s(dist);
+    Real tol = 8*pow(std::numeric_limits<Real>::epsilon(), Real(0.75));
+    for (std::size_t i = 0; i < 2000; ++i)
+    {
+        Real x = s(gen);
+        Real expected = quantile(dist, boost::math::detail::sampler_uniform<Real>(gen2));
+        CHECK_LE(Real(abs(x - expected)), tol*(std::max)(Real(abs(expected)), Real(3)));
+    }
+}
+
+void test_ziggurat_tail()
+{
+    // The base layer of the ziggurat carries the tail beyond r ~ 3.654, which is rare enough
+    // that a KS test would not notice it missing:
+    std::mt19937_64 gen(99);
+    sampler<boost::math::normal_distribution<double>> s(boost::math::normal_distribution<double>{});
+    const std::size_t n = 4000000;
+    std::size_t count = 0;
+    double largest = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double z = std::abs(s(gen));
+        if (z > 3.6541528853610088)
+        {
+            ++count;
+        }
+        largest = (std::max)(largest, z);
+    }
+    double p = boost::math::erfc(3.6541528853610088/std::sqrt(2.0));
+    double expected = n*p;
+    CHECK_LE(std::abs(count - expected), 5*std::sqrt(expected));
+    CHECK_LE(4.5, largest);
+
+    sampler<boost::math::exponential_distribution<double>> e(boost::math::exponential_distribution<double>{});
+    count = 0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (e(gen) > 7.6971174701310497)
+        {
+            ++count;
+        }
+    }
+    expected = n*std::exp(-7.6971174701310497);
+    CHECK_LE(std::abs(count - expected), 5*std::sqrt(expected));
+}
+
+void test_generators()
+{
+    // 32 bit generators and output iterators of other types work too:
+    std::mt19937 gen(7);
+    sampler<boost::math::gamma_distribution<double>> s(boost::math::gamma_distribution<double>(3));
+    std::list<double> l(10000);
+    s.fill(gen, l.begin(), l.end());
+    double sum = 0;
+    for (double x : l)
+    {
+        CHECK_LE(0.0, x);
+        sum += x;
+    }
+    CHECK_LE(std::abs(sum/l.size() - 3), 0.1);
+
+    // Discrete distributions go through their quantile, corrected to the smallest k with cdf(k) >= u
+    // whatever the rounding policy (the default rounds outwards, which would bias the mean):
+    std::minstd_rand small_gen(3);
+    sampler<boost::math::poisson_distribution<double>> p(boost::math::poisson_distribution<double>(4));
+    sum = 0;
+    for (std::size_t i = 0; i < 10000; ++i)
+    {
+        double k = p(small_gen);
+        CHECK_EQUAL(k, std::floor(k));
+        sum += k;
+    }
+    CHECK_LE(std::abs(sum/10000 - 4), 0.1);
+    CHECK_EQUAL(p.distribution().mean(), 4.0);
+}
+
+int main()
+{
+    test_continuous<float>();
+    test_continuous<double>();
+    test_continuous<long double>();
+    test_stable<double>();
+    test_stable<long double>();
+    test_ziggurat_tail();
+    test_generators();
+    return boost::math::test::report_errors();
+}
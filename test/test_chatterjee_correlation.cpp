@@ -95,6 +95,12 @@ void test_threaded(ExecutionPolicy&& exec)
     auto par_ans = chatterjee_correlation(exec, x, y);
 
     CHECK_ULP_CLOSE(seq_ans, par_ans, 1);
+
+    // Fewer than two points have no differences of ranks, and no coefficient:
+    std::vector<Real> empty;
+    CHECK_NAN(chatterjee_correlation(exec, empty, empty));
+    std::vector<Real> one {Real(1)};
+    CHECK_NAN(chatterjee_correlation(exec, one, one));
 };
 
 #endif // BOOST_MATH_EXEC_COMPATIBLE
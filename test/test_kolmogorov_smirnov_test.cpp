@@ -0,0 +1,118 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/statistics/kolmogorov_smirnov_test.hpp>
+
+using boost::math::statistics::two_sample_kolmogorov_smirnov_test;
+using boost::math::statistics::two_sample_kolmogorov_smirnov_statistic;
+
+void test_agreement_with_scipy()
+{
+    // To reproduce:
+    // scipy.stats.ks_2samp(x, y, method='exact')
+    std::vector<double> x{0.61, 0.29, 0.06, 0.59, -1.73, -0.74, 0.51, -0.56, 0.39, 1.64, 0.05, -0.06, 0.64, -0.82, 0.37, 1.77, 1.09, -1.28, 2.36, 1.31, 1.05, -0.32, -0.4, 1.06, -2.47};
+    std::vector<double> y{2.2, 1.66, 1.38, 0.2, 0.36, 0.0, 0.96, 1.56, 0.44, 1.5, -0.3, 0.66, 2.31, 3.29, -0.27, -0.37, 0.38, 0.7, 0.52, -0.71};
+#ifdef BOOST_MATH_EXEC_COMPATIBLE
+    auto [D_par, p_par] = two_sample_kolmogorov_smirnov_test(std::execution::par, x, y);
+    CHECK_ULP_CLOSE(0.23, D_par, 1);
+    CHECK_ULP_CLOSE(0.5286364448145011, p_par, 8);
+#endif
+    std::sort(x.begin(), x.end());
+    std::sort(y.begin(), y.end());
+    auto [D, p] = two_sample_kolmogorov_smirnov_test(x, y);
+    CHECK_ULP_CLOSE(0.23, D, 1);
+    CHECK_ULP_CLOSE(0.5286364448145011, p, 8);
+    CHECK_ULP_CLOSE(D, two_sample_kolmogorov_smirnov_statistic(x, y), 0);
+    // The statistic is symmetric:
+    auto [D_swapped, p_swapped] = two_sample_kolmogorov_smirnov_test(y.begin(), y.end(), x.begin(), x.end());
+    CHECK_ULP_CLOSE(D, D_swapped, 0);
+    CHECK_ULP_CLOSE(p, p_swapped, 0);
+}
+
+void test_exact_distribution()
+{
+    using boost::math::statistics::detail::ks_two_sample_exact_sf;
+    // By counting lattice paths exactly in integer arithmetic:
+    CHECK_ULP_CLOSE(1.0/66, ks_two_sample_exact_sf<double>(5, 7, 30), 4);
+    CHECK_ULP_CLOSE(0.0094262666545816830, ks_two_sample_exact_sf<double>(3, 1000, 2500), 64);
+    // scipy.stats._stats_py._compute_prob_outside_square(n, h):
+    CHECK_ULP_CLOSE(0.05244755244755244, ks_two_sample_exact_sf<double>(10, 10, 60), 4);
+    CHECK_ULP_CLOSE(1.9823306042836678e-29, ks_two_sample_exact_sf<double>(50, 50, 2500), 16);
+    CHECK_ULP_CLOSE(8.974277567313009e-05, ks_two_sample_exact_sf<double>(1000, 1000, 100000), 256);
+    // Trivial cases: D >= 0 always, and D = 1 only when the samples do not interleave:
+    CHECK_EQUAL(ks_two_sample_exact_sf<double>(6, 9, 0), 1.0);
+    CHECK_ULP_CLOSE(2.0/5005, ks_two_sample_exact_sf<double>(6, 9, 54), 4);
+    CHECK_EQUAL(ks_two_sample_exact_sf<double>(9, 6, 54), ks_two_sample_exact_sf<double>(6, 9, 54));
+}
+
+void test_asymptotic()
+{
+    using std::sqrt;
+    // Above a million lattice points the limiting distribution of sqrt(n m/(n+m)) D is used:
+    std::mt19937_64 gen(87654);
+    std::normal_distribution<double> dist;
+    std::vector<double> x(2000);
+    std::vector<double> y(1500);
+    for (auto& v : x) { v = dist(gen); }
+    for (auto& v : y) { v = dist(gen) + 0.05; }
+    std::sort(x.begin(), x.end());
+    std::sort(y.begin(), y.end());
+    auto [D, p] = two_sample_kolmogorov_smirnov_test(x, y);
+    const double en = 2000.0 * 1500 / 3500;
+    boost::math::kolmogorov_smirnov_distribution<double> kolmogorov(en);
+    CHECK_ULP_CLOSE(cdf(complement(kolmogorov, D)), p, 64);
+    CHECK_LE(p, 1.0);
+    CHECK_LE(0.0, p);
+}
+
+void test_ties_and_integers()
+{
+    // Ties across the samples are taken together, so identical samples give D = 0 and p = 1:
+    std::vector<int> u{1, 1, 2, 3, 3, 3, 7};
+    auto [D, p] = two_sample_kolmogorov_smirnov_test(u, u);
+    CHECK_EQUAL(D, 0.0);
+    CHECK_EQUAL(p, 1.0);
+    // Non-overlapping samples:
+    std::vector<int> v{8, 9, 9, 10};
+    auto [D_apart, p_apart] = two_sample_kolmogorov_smirnov_test(u, v);
+    CHECK_EQUAL(D_apart, 1.0);
+    CHECK_ULP_CLOSE(2.0/330, p_apart, 4);
+    // The largest difference is after the tie at 3, where the cdfs are 6/7 and 2/4:
+    std::vector<int> w{0, 3, 5, 6};
+    CHECK_ULP_CLOSE(5.0/14, two_sample_kolmogorov_smirnov_statistic(u, w), 1);
+}
+
+void test_errors()
+{
+    std::vector<double> sorted{1, 2, 3};
+    std::vector<double> unsorted{1, 3, 2};
+    std::vector<double> empty;
+    std::vector<double> nan{1, std::numeric_limits<double>::quiet_NaN()};
+    CHECK_THROW(two_sample_kolmogorov_smirnov_test(sorted, unsorted), std::domain_error);
+    CHECK_THROW(two_sample_kolmogorov_smirnov_test(unsorted, sorted), std::domain_error);
+    CHECK_THROW(two_sample_kolmogorov_smirnov_test(sorted, empty), std::domain_error);
+    CHECK_THROW(two_sample_kolmogorov_smirnov_test(sorted, nan), std::domain_error);
+    CHECK_THROW(two_sample_kolmogorov_smirnov_statistic(nan, sorted), std::domain_error);
+}
+
+int main()
+{
+    test_agreement_with_scipy();
+    test_exact_distribution();
+    test_asymptotic();
+    test_ties_and_integers();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,220 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <boost/math/statistics/thread_pool.hpp>
+#include <boost/math/statistics/univariate_statistics.hpp>
+#include <boost/math/statistics/bivariate_statistics.hpp>
+
+using boost::math::statistics::thread_pool;
+
+// A user executor, without idle(), so that chunks go to every thread whether busy or not:
+class forwarding_executor
+{
+public:
+    explicit forwarding_executor(thread_pool& pool) : m_pool(pool) {}
+
+    template<class F>
+    void submit(F&& f)
+    {
+        m_pool.submit(std::forward<F>(f));
+    }
+
+    std::size_t size() const
+    {
+        return m_pool.size();
+    }
+
+private:
+    thread_pool& m_pool;
+};
+
+void wait_until_idle(const thread_pool& pool)
+{
+    while (pool.idle() < pool.size())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void test_pool()
+{
+    std::atomic<int> count {0};
+    {
+        thread_pool pool(3);
+        CHECK_EQUAL(pool.size(), std::size_t(3));
+        for (int i = 0; i < 1000; ++i)
+        {
+            pool.submit([&count]() { ++count; });
+        }
+        // The destructor runs what was submitted before joining.
+    }
+    CHECK_EQUAL(count.load(), 1000);
+
+    // With no workers, tasks run on the caller:
+    thread_pool inline_pool(0);
+    const auto caller = std::this_thread::get_id();
+    bool same_thread = false;
+    inline_pool.submit([&]() { same_thread = (std::this_thread::get_id() == caller); });
+    CHECK_EQUAL(same_thread, true);
+    CHECK_EQUAL(inline_pool.idle(), std::size_t(0));
+
+    wait_until_idle(thread_pool::shared());
+    CHECK_EQUAL(thread_pool::shared().size(), thread_pool::default_size());
+}
+
+void test_run_chunks()
+{
+    using namespace boost::math::statistics::detail;
+    thread_pool pool(3);
+    wait_until_idle(pool);
+    running_estimate cost(1);
+    const std::size_t elements = 1000;
+    const std::size_t chunks = 7;
+    const std::vector<int> data(elements);
+    const auto boundaries = chunk_iterators(data.begin(), elements, chunks);
+    CHECK_EQUAL(boundaries.front() == data.begin(), true);
+    CHECK_EQUAL(boundaries.back() == data.end(), true);
+
+    // The results come back in chunk order, whoever ran them:
+    const auto results = run_chunks(pool, cost, elements, chunks, std::size_t(0), [&boundaries](std::size_t i)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        return static_cast<std::size_t>(boundaries[i + 1] - boundaries[i]);
+    });
+    CHECK_EQUAL(results.size(), chunks);
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < chunks; ++i)
+    {
+        CHECK_LE(results[i], elements / chunks + 1);
+        CHECK_LE(elements / chunks, results[i]);
+        total += results[i];
+    }
+    CHECK_EQUAL(total, elements);
+
+    // An exception from any chunk reaches the caller, after the other chunks are done:
+    std::atomic<int> ran {0};
+    CHECK_THROW(run_chunks(pool, cost, elements, chunks, 0, [&ran](std::size_t i) -> int
+    {
+        ++ran;
+        if (i == 3)
+        {
+            throw std::domain_error("chunk 3");
+        }
+        return 0;
+    }), std::domain_error);
+    CHECK_EQUAL(ran.load(), int(chunks));
+
+    // Calls made from the workers themselves complete, since each caller works through its own chunks:
+    std::atomic<std::size_t> nested_total {0};
+    run_chunks(pool, cost, elements, 4, 0, [&](std::size_t)
+    {
+        const auto inner = run_chunks(pool, cost, elements, chunks, std::size_t(1), [](std::size_t) { return std::size_t(1); });
+        nested_total += inner.size();
+        return 0;
+    });
+    CHECK_EQUAL(nested_total.load(), 4 * chunks);
+}
+
+std::vector<double> random_data(std::size_t n, unsigned seed)
+{
+    std::mt19937_64 gen(seed);
+    std::lognormal_distribution<double> dis(1, 0.75);
+    std::vector<double> v(n);
+    for (auto& x : v)
+    {
+        x = dis(gen);
+    }
+    return v;
+}
+
+// Whether or not the data is split, which depends on the load and the calibration, the results must agree:
+template<class Executor>
+void test_statistics(Executor&& ex)
+{
+    using namespace boost::math::statistics;
+    const double tol = 1e-12;
+    const std::vector<double> u = random_data(1 << 20, 1);
+    std::vector<double> v = random_data(1 << 20, 2);
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        v[i] += u[i] / 2;
+    }
+
+    CHECK_LE(std::abs(mean(ex, u) - mean(u)), tol * mean(u));
+    CHECK_LE(std::abs(variance(ex, u) - variance(u)), tol * variance(u));
+    CHECK_LE(std::abs(skewness(ex, u) - skewness(u)), tol * skewness(u));
+    CHECK_LE(std::abs(kurtosis(ex, u) - kurtosis(u)), tol * kurtosis(u));
+    const auto [mu, s2] = mean_and_sample_variance(ex, u);
+    CHECK_LE(std::abs(s2 - sample_variance(u)), tol * s2);
+    CHECK_LE(std::abs(mu - mean(u)), tol * mu);
+
+    const auto expected = means_and_covariance(u, v);
+    const auto computed = means_and_covariance(ex, u, v);
+    CHECK_LE(std::abs(std::get<2>(computed) - std::get<2>(expected)), tol * std::get<2>(expected));
+    CHECK_LE(std::abs(correlation_coefficient(ex, u, v) - correlation_coefficient(u, v)), tol);
+
+    // A constant dataset has no skewness, in parallel too:
+    const std::vector<double> constant(1 << 18, 2.5);
+    CHECK_EQUAL(skewness(ex, constant), 0.0);
+    CHECK_EQUAL(variance(ex, constant), 0.0);
+}
+
+// Many small calls at once must all complete, and agree with the sequential results:
+void test_concurrent_callers()
+{
+    using namespace boost::math::statistics;
+    const std::vector<double> u = random_data(5000, 3);
+    const auto expected = first_four_moments(u);
+    std::atomic<int> mismatches {0};
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 8; ++t)
+    {
+        callers.emplace_back([&]()
+        {
+            for (int i = 0; i < 200; ++i)
+            {
+                const auto computed = first_four_moments(std::execution::par, u);
+                if (std::abs(std::get<1>(computed) - std::get<1>(expected)) > 1e-12 * std::get<1>(expected))
+                {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& t : callers)
+    {
+        t.join();
+    }
+    CHECK_EQUAL(mismatches.load(), 0);
+}
+
+int main()
+{
+    test_pool();
+    test_run_chunks();
+
+    thread_pool pool(3);
+    wait_until_idle(pool);
+    test_statistics(pool);
+    forwarding_executor forwarding(pool);
+    test_statistics(forwarding);
+    test_statistics(std::execution::par);
+
+    test_concurrent_callers();
+    return boost::math::test::report_errors();
+}
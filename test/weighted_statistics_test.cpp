@@ -0,0 +1,247 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <random>
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+#include <boost/math/statistics/univariate_statistics.hpp>
+
+#ifdef BOOST_MATH_HAS_THREADS
+#include <boost/math/statistics/thread_pool.hpp>
+#endif
+
+using boost::math::statistics::weighted_mean;
+using boost::math::statistics::weighted_variance;
+using boost::math::statistics::weighted_first_four_moments;
+using boost::math::statistics::weighted_skewness;
+using boost::math::statistics::weighted_kurtosis;
+using boost::math::statistics::weighted_excess_kurtosis;
+using boost::math::statistics::weighted_median;
+using boost::math::statistics::weighted_quantile;
+using boost::math::statistics::weighted_gini_coefficient;
+
+// Each value repeated as many times as its weight:
+template<class Real>
+std::vector<Real> expand(const std::vector<Real>& v, const std::vector<int>& weights)
+{
+    std::vector<Real> expanded;
+    for (std::size_t i = 0; i < v.size(); ++i)
+    {
+        expanded.insert(expanded.end(), static_cast<std::size_t>(weights[i]), v[i]);
+    }
+    return expanded;
+}
+
+template<class Real>
+void test_integer_weights()
+{
+    std::mt19937_64 gen(17);
+    std::normal_distribution<Real> dis(2, 3);
+    std::uniform_int_distribution<int> count(0, 5);
+    for (std::size_t n : {1, 2, 9, 100, 1001})
+    {
+        std::vector<Real> v(n);
+        std::vector<int> w(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            v[i] = std::round(4*dis(gen))/4;
+            w[i] = count(gen);
+        }
+        w[0] = 1;
+        auto u = expand(v, w);
+
+        CHECK_ULP_CLOSE(boost::math::statistics::mean(u), weighted_mean(v, w), 64);
+        Real M1, M2, M3, M4;
+        std::tie(M1, M2, M3, M4) = boost::math::statistics::first_four_moments(u);
+        Real W1, W2, W3, W4;
+        std::tie(W1, W2, W3, W4) = weighted_first_four_moments(v, w);
+        const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+        CHECK_LE(std::abs(W1 - M1), tol*(std::abs(M1) + 1));
+        CHECK_LE(std::abs(W2 - M2), tol*M2);
+        CHECK_LE(std::abs(W3 - M3), tol*std::sqrt(M2*M2*M2));
+        CHECK_LE(std::abs(W4 - M4), tol*M4);
+        CHECK_LE(std::abs(weighted_variance(v, w) - boost::math::statistics::variance(u)), tol*M2);
+        CHECK_LE(std::abs(weighted_skewness(v, w) - boost::math::statistics::skewness(u)), tol);
+        const Real kurtosis_tol = M2 > 0 ? tol*M4/(M2*M2) : tol;
+        CHECK_LE(std::abs(weighted_kurtosis(v, w) - boost::math::statistics::kurtosis(u)), kurtosis_tol);
+        CHECK_LE(std::abs(weighted_excess_kurtosis(v, w) - boost::math::statistics::excess_kurtosis(u)), kurtosis_tol);
+
+        // The median of the repeated values, even when it is the mean of two of them:
+        auto sorted = u;
+        CHECK_EQUAL(weighted_median(v, w), boost::math::statistics::median(sorted));
+
+        // Integer weights may be halved without changing anything:
+        std::vector<Real> halves(w.begin(), w.end());
+        for (auto& h : halves)
+        {
+            h /= 2;
+        }
+        CHECK_EQUAL(weighted_median(v, halves), weighted_median(v, w));
+        CHECK_ULP_CLOSE(weighted_mean(v, w), weighted_mean(v, halves), 4);
+
+        // Of positive values, the Gini coefficient of the repeated values:
+        std::vector<Real> positive(v.size());
+        std::transform(v.begin(), v.end(), positive.begin(), [](Real x) { return std::abs(x); });
+        auto positive_u = expand(positive, w);
+        CHECK_LE(std::abs(weighted_gini_coefficient(positive, w) - boost::math::statistics::gini_coefficient(positive_u)), tol);
+    }
+}
+
+template<class Real>
+void test_quantiles()
+{
+    // The inverse of the weighted distribution, averaged where it is flat:
+    std::vector<Real> v{3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<Real> w{1, 2, 1, 0, 1, 2, 1, 2};
+    // Sorted: 1 (2), 2 (1), 3 (1), 4 (1), 5 (1), 6 (2), 9 (2), of total weight 10:
+    CHECK_EQUAL(weighted_quantile(v, w, Real(0)), Real(1));
+    CHECK_EQUAL(weighted_quantile(v, w, Real(0.1)), Real(1));
+    CHECK_EQUAL(weighted_quantile(v, w, Real(0.2)), Real(1.5));
+    CHECK_EQUAL(weighted_quantile(v, w, Real(0.25)), Real(2));
+    CHECK_EQUAL(weighted_median(v, w), Real(4.5));
+    CHECK_EQUAL(weighted_quantile(v, w, Real(0.75)), Real(6));
+    CHECK_EQUAL(weighted_quantile(v, w, Real(0.8)), Real(7.5));
+    CHECK_EQUAL(weighted_quantile(v, w, Real(1)), Real(9));
+
+    // Against the cumulative weights of the sorted values, for weights of every size, with many ties:
+    std::mt19937_64 gen(5);
+    std::exponential_distribution<Real> weight(1);
+    std::uniform_int_distribution<int> value(0, 2000);
+    const std::size_t n = 100000;
+    std::vector<Real> x(n);
+    std::vector<Real> y(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        x[i] = static_cast<Real>(value(gen));
+        y[i] = weight(gen)*weight(gen);
+    }
+    std::vector<std::size_t> order(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](std::size_t i, std::size_t j) { return x[i] < x[j]; });
+    double total = 0;
+    for (auto t : y)
+    {
+        total += t;
+    }
+    for (Real p : {Real(0.001), Real(0.1), Real(0.5), Real(0.9), Real(0.999)})
+    {
+        double cumulative = 0;
+        std::size_t k = 0;
+        while (cumulative + y[order[k]] < p*total)
+        {
+            cumulative += y[order[k++]];
+        }
+        CHECK_EQUAL(weighted_quantile(std::execution::par, x, y, p), x[order[k]]);
+    }
+
+    // Sorted data, the worst case for the choice of pivots:
+    std::sort(x.begin(), x.end());
+    std::vector<Real> ones(n, 1);
+    CHECK_EQUAL(weighted_median(x, ones), (x[n/2 - 1] + x[n/2])/2);
+    std::reverse(x.begin(), x.end());
+    CHECK_EQUAL(weighted_median(x, ones), (x[n/2 - 1] + x[n/2])/2);
+}
+
+template<class Real>
+void test_parallel()
+{
+    std::mt19937_64 gen(3);
+    std::lognormal_distribution<Real> dis(0, 1);
+    std::uniform_real_distribution<Real> weight(0, 1);
+    const std::size_t n = 400000;
+    std::vector<Real> v(n);
+    std::vector<Real> w(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        v[i] = dis(gen);
+        w[i] = weight(gen);
+    }
+    const auto seq = weighted_first_four_moments(v, w);
+    const Real mu = weighted_mean(v, w);
+    const Real gini = weighted_gini_coefficient(v, w);
+    const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+
+    auto check = [&](const auto& par)
+    {
+        CHECK_LE(std::abs(std::get<0>(par) - std::get<0>(seq)), tol*std::get<0>(seq));
+        CHECK_LE(std::abs(std::get<1>(par) - std::get<1>(seq)), tol*std::get<1>(seq));
+        CHECK_LE(std::abs(std::get<2>(par) - std::get<2>(seq)), tol*std::get<2>(seq));
+        CHECK_LE(std::abs(std::get<3>(par) - std::get<3>(seq)), tol*std::get<3>(seq));
+    };
+    check(weighted_first_four_moments(std::execution::par, v, w));
+    CHECK_LE(std::abs(weighted_mean(std::execution::par, v, w) - mu), tol*mu);
+    CHECK_LE(std::abs(weighted_gini_coefficient(std::execution::par, v, w) - gini), tol);
+#ifdef BOOST_MATH_HAS_THREADS
+    boost::math::statistics::thread_pool pool(3);
+    check(weighted_first_four_moments(pool, v, w));
+    CHECK_LE(std::abs(weighted_mean(pool, v, w) - mu), tol*mu);
+    CHECK_LE(std::abs(weighted_skewness(pool, v, w) - weighted_skewness(v, w)), tol*weighted_skewness(v, w));
+    CHECK_LE(std::abs(weighted_gini_coefficient(pool, v, w) - gini), tol);
+    CHECK_EQUAL(weighted_median(pool, v, w), weighted_median(v, w));
+#endif
+
+    // The log-normal moments, to the error of the sample:
+    CHECK_LE(std::abs(mu - std::exp(Real(0.5))), Real(0.02));
+    CHECK_LE(std::abs(std::get<1>(seq) - (std::exp(Real(1)) - 1)*std::exp(Real(1))), Real(0.2));
+}
+
+void test_integers()
+{
+    std::vector<int> v{1, 2, 3, 4};
+    std::vector<int> w{1, 1, 1, 1};
+    const auto mu = weighted_mean(v, w);
+    static_assert(std::is_same<decltype(mu), const double>::value, "Integer data has double results.");
+    CHECK_ULP_CLOSE(2.5, mu, 2);
+    CHECK_ULP_CLOSE(1.25, weighted_variance(v, w), 2);
+    CHECK_EQUAL(weighted_median(v, w), 2.5);
+    CHECK_ULP_CLOSE(0.25, weighted_gini_coefficient(v, w), 2);
+
+    // Constant data, and a single value of positive weight:
+    std::vector<double> c(10, 3.5);
+    std::vector<double> cw(10, 0.3);
+    CHECK_EQUAL(weighted_variance(c, cw), 0.0);
+    CHECK_EQUAL(weighted_skewness(c, cw), 0.0);
+    CHECK_EQUAL(weighted_gini_coefficient(c, cw), 0.0);
+    std::vector<double> x{1, 2, 3};
+    std::vector<double> one{0, 2, 0};
+    CHECK_EQUAL(weighted_mean(x, one), 2.0);
+    CHECK_EQUAL(weighted_median(x, one), 2.0);
+    CHECK_EQUAL(weighted_variance(x, one), 0.0);
+}
+
+void test_errors()
+{
+    std::vector<double> v{1, 2, 3};
+    std::vector<double> empty;
+    CHECK_THROW(weighted_mean(v, std::vector<double>{1, 2}), std::domain_error);
+    CHECK_THROW(weighted_mean(std::execution::par, v, std::vector<double>{1, -1, 1}), std::domain_error);
+    CHECK_THROW(weighted_variance(v, std::vector<double>{0, 0, 0}), std::domain_error);
+    CHECK_THROW(weighted_median(empty, empty), std::domain_error);
+    CHECK_THROW(weighted_quantile(v, std::vector<double>{1, 1, 1}, 1.5), std::domain_error);
+    CHECK_THROW(weighted_gini_coefficient(v, std::vector<double>{1, 1, -2}), std::domain_error);
+}
+
+int main()
+{
+    test_integer_weights<double>();
+    test_integer_weights<float>();
+    test_quantiles<double>();
+    test_quantiles<float>();
+    test_parallel<double>();
+    test_integers();
+    test_errors();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright Matt Borland, 2024
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <list>
+#include <random>
+#include <utility>
+#include <vector>
+#include <boost/math/special_functions/zeta.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+#include <boost/math/concepts/real_concept.hpp>
+
+template<class Real>
+void test_zeta_batch()
+{
+    std::mt19937_64 gen(271828);
+    std::uniform_real_distribution<double> dis(-30, 120);
+    std::uniform_int_distribution<int> idis(-40, 80);
+    std::vector<Real> s;
+    for (std::size_t i = 0; i < 3000; ++i)
+    {
+        // A mixture of integers (with repeats), reals in every method region, and tiny arguments:
+        switch (i % 4)
+        {
+        case 0:
+        {
+            Real v = Real(idis(gen));
+            s.push_back(v == 1 ? Real(2) : v);
+            break;
+        }
+        case 1:
+            s.push_back(Real(dis(gen)));
+            break;
+        case 2:
+            s.push_back(Real(dis(gen))/32);
+            break;
+        default:
+            s.push_back(Real(dis(gen))*std::numeric_limits<Real>::epsilon());
+        }
+    }
+    std::vector<Real> computed(s.size());
+    auto it = boost::math::zeta(s.begin(), s.end(), computed.begin());
+    CHECK_EQUAL(it == computed.end(), true);
+    for (std::size_t i = 0; i < s.size(); ++i)
+    {
+        // Same kernels in a different order, so the results must be identical:
+        if (!CHECK_EQUAL(boost::math::zeta(s[i]), computed[i]))
+        {
+            std::cerr << "  zeta batch mismatch at s = " << s[i] << "\n";
+        }
+    }
+
+    // Works with non-random-access iterators and integer arguments too:
+    std::list<int> ints{2, 3, -3, 0, 4};
+    std::vector<double> from_ints;
+    boost::math::zeta(ints.begin(), ints.end(), std::back_inserter(from_ints));
+    CHECK_EQUAL(from_ints.size(), std::size_t(5));
+    CHECK_EQUAL(from_ints[3], -0.5);
+    CHECK_ULP_CLOSE(boost::math::zeta(3.0), from_ints[1], 0);
+
+    std::vector<Real> bad{Real(2), Real(1)};
+    CHECK_THROW(boost::math::zeta(bad.begin(), bad.end(), computed.begin()), std::domain_error);
+}
+
+template<class Real>
+void test_zeta_integer_table()
+{
+    // The pole at one splits the table in two:
+    std::vector<Real> table;
+    boost::math::zeta_integer_table<Real>(-60, 61, std::back_inserter(table));
+    boost::math::zeta_integer_table<Real>(2, 198, std::back_inserter(table));
+    CHECK_EQUAL(table.size(), std::size_t(259));
+    for (int v = -60; v < 200; ++v)
+    {
+        if (v != 1)
+        {
+            CHECK_EQUAL(boost::math::zeta(Real(v)), table[v < 1 ? v + 60 : v + 59]);
+        }
+    }
+    CHECK_EQUAL(table.back(), Real(1));
+    table.clear();
+    CHECK_THROW(boost::math::zeta_integer_table<Real>(0, 3, std::back_inserter(table)), std::domain_error);
+    CHECK_THROW(boost::math::zeta_integer_table<Real>(INT_MAX - 1, 3, std::back_inserter(table)), std::domain_error);
+}
+
+template<class Real>
+void test_polygamma_batch(Real tol, int max_order)
+{
+    using std::abs;
+    std::mt19937_64 gen(314159);
+    std::uniform_real_distribution<double> dis(-5, 60);
+    std::vector<Real> x;
+    for (std::size_t i = 0; i < 400; ++i)
+    {
+        Real v = Real(dis(gen));
+        x.push_back(i % 3 == 0 ? v/64 : v);
+    }
+    x.push_back(Real(1));
+    x.push_back(Real(0.5));
+    x.push_back(Real(1e6));
+    x.push_back(Real(1e30));
+    x.push_back(Real(0.0625));
+    for (int n : {0, 1, 2, 3, 4, 7, 12, 25, 60})
+    {
+        if (n > max_order)
+        {
+            break;
+        }
+        // Skip the arguments where the result overflows the type, the batch would throw just the same:
+        std::vector<Real> args, expected;
+        for (Real v : x)
+        {
+            try
+            {
+                expected.push_back(boost::math::polygamma(n, v));
+                args.push_back(v);
+            }
+            catch (const std::overflow_error&)
+            {
+            }
+        }
+        std::vector<Real> computed;
+        boost::math::polygamma(n, args.begin(), args.end(), std::back_inserter(computed));
+        CHECK_EQUAL(computed.size(), args.size());
+        for (std::size_t i = 0; i < args.size(); ++i)
+        {
+            // The batch sums the same asymptotic series in a different order:
+            if (!CHECK_LE(Real(abs(computed[i] - expected[i])), tol*abs(expected[i])))
+            {
+                std::cerr << "  polygamma batch mismatch at n = " << n << ", x = " << args[i] << "\n";
+            }
+        }
+    }
+    std::vector<Real> at_pole{Real(2), Real(-2)};
+    std::vector<Real> out(2);
+    CHECK_THROW(boost::math::polygamma(3, at_pole.begin(), at_pole.end(), out.begin()), std::domain_error);
+    CHECK_THROW(boost::math::polygamma(-1, at_pole.begin(), at_pole.begin() + 1, out.begin()), std::domain_error);
+}
+
+// Large orders at large x, where z^-n is denormal but the result is not:
+void test_polygamma_batch_underflow()
+{
+    using std::abs;
+    using no_promote = boost::math::policies::policy<boost::math::policies::promote_double<false>>;
+    const std::vector<std::pair<int, double>> cases{{31, 1e10}, {16, 1e20}, {20, 1e15}, {60, 1e5}, {100, 30}};
+    for (const auto& c : cases)
+    {
+        const double x = c.second;
+        std::vector<double> computed(1);
+        boost::math::polygamma(c.first, &x, &x + 1, computed.begin(), no_promote());
+        const double expected = boost::math::polygamma(c.first, x, no_promote());
+        if (!CHECK_LE(abs(computed[0] - expected), 16*std::numeric_limits<double>::epsilon()*abs(expected)))
+        {
+            std::cerr << "  polygamma batch mismatch at n = " << c.first << ", x = " << x << "\n";
+        }
+    }
+}
+
+int main()
+{
+    test_zeta_batch<float>();
+    test_zeta_batch<double>();
+    test_zeta_batch<long double>();
+    test_zeta_integer_table<double>();
+    test_zeta_integer_table<long double>();
+    test_polygamma_batch<float>(8*std::numeric_limits<float>::epsilon(), 12);
+    test_polygamma_batch<double>(16*std::numeric_limits<double>::epsilon(), 60);
+    test_polygamma_batch<long double>(16*std::numeric_limits<long double>::epsilon(), 60);
+    test_polygamma_batch<boost::math::concepts::real_concept>(64*boost::math::tools::epsilon<boost::math::concepts::real_concept>(), 25);
+    test_polygamma_batch_underflow();
+    return boost::math::test::report_errors();
+}